@@ -1002,6 +1002,11 @@ public static class bgfx
 		/// Transparent backbuffer. Availability depends on: `BGFX_CAPS_TRANSPARENT_BACKBUFFER`.
 		/// </summary>
 		TransparentBackbuffer  = 0x00100000,
+	
+		/// <summary>
+		/// Compile pipeline state objects asynchronously.
+		/// </summary>
+		AsyncPipeline          = 0x00200000,
 		FullscreenShift        = 0,
 		FullscreenMask         = 0x00000001,
 		ReservedShift          = 31,
@@ -2003,6 +2008,11 @@ public static class bgfx
 		/// </summary>
 		DepthDescending,
 	
+		/// <summary>
+		/// Sort by program, binding set, and render state to minimize state changes.
+		/// </summary>
+		State,
+	
 		Count
 	}
 	
@@ -2081,10 +2091,15 @@ public static class bgfx
 			public uint32 maxDynamicVertexBuffers;
 			public uint32 maxUniforms;
 			public uint32 maxOcclusionQueries;
+			public uint32 maxDrawBundles;
 			public uint32 maxEncoders;
 			public uint32 minResourceCbSize;
 			public uint32 transientVbSize;
 			public uint32 transientIbSize;
+			public uint32 numSortThreads;
+			public uint32 numRecordThreads;
+			public uint32 numDecodeThreads;
+			public uint32 maxFramesInFlight;
 		}
 	
 		public RendererType rendererType;
@@ -2139,6 +2154,13 @@ public static class bgfx
 			public uint32 minResourceCbSize;
 			public uint32 transientVbSize;
 			public uint32 transientIbSize;
+			public uint32 numSortThreads;
+			public uint32 numRecordThreads;
+			public uint32 numDecodeThreads;
+			public uint32 maxDrawCalls;
+			public uint32 maxFramesInFlight;
+			public uint64 textureStreamingBudget;
+			public uint32 uploadBudget;
 		}
 	
 		public RendererType type;
@@ -2147,6 +2169,7 @@ public static class bgfx
 		public uint64 capabilities;
 		public uint8 debug;
 		public uint8 profile;
+		public uint8 noopCounting;
 		public PlatformData platformData;
 		public Resolution resolution;
 		public Limits limits;
@@ -2243,6 +2266,9 @@ public static class bgfx
 		public int64 gpuTimeBegin;
 		public int64 gpuTimeEnd;
 		public uint32 gpuFrameNum;
+		public uint32 numStateChanges;
+		public uint32 numProgramChanges;
+		public uint32 numBindChanges;
 	}
 	
 	[CRepr]
@@ -2264,11 +2290,26 @@ public static class bgfx
 		public int64 gpuTimerFreq;
 		public int64 waitRender;
 		public int64 waitSubmit;
+		public uint32 numFramesInFlight;
 		public uint32 numDraw;
 		public uint32 numCompute;
 		public uint32 numBlit;
 		public uint32 maxGpuLatency;
 		public uint32 gpuFrameNum;
+		public uint32 numTransformsDropped;
+		public uint32 numScissorsDropped;
+		public uint32 numDrawsDropped;
+		public uint32 numPendingSkipped;
+		public uint32 numPipelinesPending;
+		public uint32 numDrawsFallback;
+		public uint32 numDrawsSkipped;
+		public uint32 numMultiDraw;
+		public uint32 numMultiDrawItems;
+		public uint32 numStateChanges;
+		public uint32 numProgramChanges;
+		public uint32 numBindChanges;
+		public uint32 numUniformUpdates;
+		public uint32 numUniformRedundant;
 		public uint16 numDynamicIndexBuffers;
 		public uint16 numDynamicVertexBuffers;
 		public uint16 numFrameBuffers;
@@ -2282,8 +2323,17 @@ public static class bgfx
 		public uint16 numVertexLayouts;
 		public int64 textureMemoryUsed;
 		public int64 rtMemoryUsed;
+		public int64 streamingMemoryUsed;
 		public int transientVbUsed;
 		public int transientIbUsed;
+		public int64 dynamicVbUsed;
+		public int64 dynamicVbFree;
+		public int64 dynamicVbLargestFree;
+		public int64 dynamicIbUsed;
+		public int64 dynamicIbFree;
+		public int64 dynamicIbLargestFree;
+		public uint32 numUploadsQueued;
+		public int64 uploadQueueSize;
 		public uint32[5] numPrims;
 		public int64 gpuMemoryMax;
 		public int64 gpuMemoryUsed;
@@ -2311,6 +2361,12 @@ public static class bgfx
 	{
 	}
 	
+	[CRepr]
+	public struct DrawBundleHandle {
+	    public uint16 idx;
+	    public bool Valid => idx != uint16.MaxValue;
+	}
+	
 	[CRepr]
 	public struct DynamicIndexBufferHandle {
 	    public uint16 idx;
@@ -2366,6 +2422,11 @@ public static class bgfx
 	}
 	
 	[CRepr]
+	public struct UniformBlockHandle {
+	    public uint16 idx;
+	    public bool Valid => idx != uint16.MaxValue;
+	}
+	
 	public struct UniformHandle {
 	    public uint16 idx;
 	    public bool Valid => idx != uint16.MaxValue;
@@ -2772,6 +2833,25 @@ public static class bgfx
 	[LinkName("bgfx_destroy_index_buffer")]
 	public static extern void destroy_index_buffer(IndexBufferHandle _handle);
 	
+	/// <summary>
+	/// Set upload priority of resource waiting in upload queue.
+	/// </summary>
+	///
+	/// <param name="_handle">Static index buffer handle.</param>
+	/// <param name="_priority">Upload priority, higher priority uploads are issued first.</param>
+	///
+	[LinkName("bgfx_set_index_buffer_upload_priority")]
+	public static extern void set_index_buffer_upload_priority(IndexBufferHandle _handle, uint8 _priority);
+	
+	/// <summary>
+	/// Returns true if all uploads of resource were issued to renderer.
+	/// </summary>
+	///
+	/// <param name="_handle">Static index buffer handle.</param>
+	///
+	[LinkName("bgfx_is_index_buffer_ready")]
+	public static extern bool is_index_buffer_ready(IndexBufferHandle _handle);
+	
 	/// <summary>
 	/// Create vertex layout.
 	/// </summary>
@@ -2821,6 +2901,25 @@ public static class bgfx
 	[LinkName("bgfx_destroy_vertex_buffer")]
 	public static extern void destroy_vertex_buffer(VertexBufferHandle _handle);
 	
+	/// <summary>
+	/// Set upload priority of resource waiting in upload queue.
+	/// </summary>
+	///
+	/// <param name="_handle">Static vertex buffer handle.</param>
+	/// <param name="_priority">Upload priority, higher priority uploads are issued first.</param>
+	///
+	[LinkName("bgfx_set_vertex_buffer_upload_priority")]
+	public static extern void set_vertex_buffer_upload_priority(VertexBufferHandle _handle, uint8 _priority);
+	
+	/// <summary>
+	/// Returns true if all uploads of resource were issued to renderer.
+	/// </summary>
+	///
+	/// <param name="_handle">Static vertex buffer handle.</param>
+	///
+	[LinkName("bgfx_is_vertex_buffer_ready")]
+	public static extern bool is_vertex_buffer_ready(VertexBufferHandle _handle);
+	
 	/// <summary>
 	/// Create empty dynamic index buffer.
 	/// </summary>
@@ -3076,6 +3175,51 @@ public static class bgfx
 	[LinkName("bgfx_destroy_program")]
 	public static extern void destroy_program(ProgramHandle _handle);
 	
+	/// <summary>
+	/// Pre-create pipeline state object for program, vertex layout and render
+	/// state combination, so that the first draw call using it doesn't stall.
+	/// Pipeline is created against frame buffer currently assigned to view.
+	/// </summary>
+	///
+	/// <param name="_id">View id.</param>
+	/// <param name="_program">Program handle.</param>
+	/// <param name="_layout">Vertex layout.</param>
+	/// <param name="_state">State flags. See: `BGFX_STATE_*`.</param>
+	/// <param name="_fstencil">Front stencil state.</param>
+	/// <param name="_bstencil">Back stencil state. If back is set to `BGFX_STENCIL_NONE` _fstencil is applied to both front and back facing primitives.</param>
+	///
+	[LinkName("bgfx_warm_pipeline")]
+	public static extern void warm_pipeline(ViewId _id, ProgramHandle _program, VertexLayout* _layout, uint64 _state, uint32 _fstencil, uint32 _bstencil);
+	
+	/// <summary>
+	/// Set program used in place of draw call program while its pipeline is being
+	/// compiled asynchronously. See: `BGFX_RESET_ASYNC_PIPELINE`.
+	/// </summary>
+	///
+	/// <param name="_handle">Program handle, or `BGFX_INVALID_HANDLE` to skip draw calls instead.</param>
+	///
+	[LinkName("bgfx_set_fallback_program")]
+	public static extern void set_fallback_program(ProgramHandle _handle);
+	
+	/// <summary>
+	/// Write pipeline cache through `CallbackI::cacheWrite` at the end of current
+	/// frame, instead of waiting for pipeline creation to go idle.
+	/// </summary>
+	///
+	[LinkName("bgfx_flush_pipeline_cache")]
+	public static extern void flush_pipeline_cache();
+	
+	/// <summary>
+	/// Enable multi-draw batching of draw calls using program. Program must read model
+	/// transform from instance data (`i_data0`-`i_data3`). See: `bgfx::setViewMultiDraw`.
+	/// </summary>
+	///
+	/// <param name="_handle">Program handle.</param>
+	/// <param name="_enabled">Allow draw calls using this program to be batched.</param>
+	///
+	[LinkName("bgfx_set_program_multi_draw")]
+	public static extern void set_program_multi_draw(ProgramHandle _handle, bool _enabled);
+	
 	/// <summary>
 	/// Validate texture parameters.
 	/// </summary>
@@ -3253,6 +3397,79 @@ public static class bgfx
 	[LinkName("bgfx_read_texture")]
 	public static extern uint32 read_texture(TextureHandle _handle, void* _data, uint8 _mip);
 	
+	/// <summary>
+	/// Read back texture content asynchronously. Result is available once copy is done,
+	/// instead of at fixed frame. Vulkan records copy into frame command buffer and writes
+	/// data once GPU executed it, without stalling render thread. Other renderers copy
+	/// synchronously on render thread. Tickets complete in order of submission.
+	/// @attention Texture must be created with `BGFX_TEXTURE_READ_BACK` flag.
+	/// @attention Availability depends on: `BGFX_CAPS_TEXTURE_READ_BACK`.
+	/// </summary>
+	///
+	/// <param name="_handle">Texture handle.</param>
+	/// <param name="_data">Destination buffer.</param>
+	/// <param name="_mip">Mip level.</param>
+	/// <param name="_readbackFn">Callback function called from render thread once data is written.</param>
+	/// <param name="_userData">User data passed to callback function.</param>
+	///
+	[LinkName("bgfx_read_texture_async")]
+	public static extern uint32 read_texture_async(TextureHandle _handle, void* _data, uint8 _mip, void* _readbackFn, void* _userData);
+	
+	/// <summary>
+	/// Returns true once asynchronous readback has completed, and its data was written to
+	/// destination buffer.
+	/// </summary>
+	///
+	/// <param name="_ticket">Readback ticket.</param>
+	///
+	[LinkName("bgfx_is_readback_complete")]
+	public static extern bool is_readback_complete(uint32 _ticket);
+	
+	/// <summary>
+	/// Read back buffer content asynchronously. Data is copied after all draw and compute
+	/// calls of current frame are executed.
+	/// </summary>
+	///
+	/// <param name="_handle">Dynamic index buffer handle.</param>
+	/// <param name="_offset">Offset in bytes from start of buffer.</param>
+	/// <param name="_size">Number of bytes to read.</param>
+	/// <param name="_data">Destination buffer.</param>
+	/// <param name="_readbackFn">Callback function called from render thread once data is written.</param>
+	/// <param name="_userData">User data passed to callback function.</param>
+	///
+	[LinkName("bgfx_read_dynamic_index_buffer")]
+	public static extern uint32 read_dynamic_index_buffer(DynamicIndexBufferHandle _handle, uint32 _offset, uint32 _size, void* _data, void* _readbackFn, void* _userData);
+	
+	/// <summary>
+	/// Read back buffer content asynchronously. Data is copied after all draw and compute
+	/// calls of current frame are executed.
+	/// </summary>
+	///
+	/// <param name="_handle">Dynamic vertex buffer handle.</param>
+	/// <param name="_offset">Offset in bytes from start of buffer.</param>
+	/// <param name="_size">Number of bytes to read.</param>
+	/// <param name="_data">Destination buffer.</param>
+	/// <param name="_readbackFn">Callback function called from render thread once data is written.</param>
+	/// <param name="_userData">User data passed to callback function.</param>
+	///
+	[LinkName("bgfx_read_dynamic_vertex_buffer")]
+	public static extern uint32 read_dynamic_vertex_buffer(DynamicVertexBufferHandle _handle, uint32 _offset, uint32 _size, void* _data, void* _readbackFn, void* _userData);
+	
+	/// <summary>
+	/// Read back buffer content asynchronously. Data is copied after all draw and compute
+	/// calls of current frame are executed.
+	/// </summary>
+	///
+	/// <param name="_handle">Indirect buffer handle.</param>
+	/// <param name="_offset">Offset in bytes from start of buffer.</param>
+	/// <param name="_size">Number of bytes to read.</param>
+	/// <param name="_data">Destination buffer.</param>
+	/// <param name="_readbackFn">Callback function called from render thread once data is written.</param>
+	/// <param name="_userData">User data passed to callback function.</param>
+	///
+	[LinkName("bgfx_read_indirect_buffer")]
+	public static extern uint32 read_indirect_buffer(IndirectBufferHandle _handle, uint32 _offset, uint32 _size, void* _data, void* _readbackFn, void* _userData);
+	
 	/// <summary>
 	/// Set texture debug name.
 	/// </summary>
@@ -3284,6 +3501,60 @@ public static class bgfx
 	[LinkName("bgfx_destroy_texture")]
 	public static extern void destroy_texture(TextureHandle _handle);
 	
+	/// <summary>
+	/// Set upload priority of resource waiting in upload queue.
+	/// </summary>
+	///
+	/// <param name="_handle">Texture handle.</param>
+	/// <param name="_priority">Upload priority, higher priority uploads are issued first.</param>
+	///
+	[LinkName("bgfx_set_texture_upload_priority")]
+	public static extern void set_texture_upload_priority(TextureHandle _handle, uint8 _priority);
+	
+	/// <summary>
+	/// Returns true if all uploads of resource were issued to renderer.
+	/// </summary>
+	///
+	/// <param name="_handle">Texture handle.</param>
+	///
+	[LinkName("bgfx_is_texture_ready")]
+	public static extern bool is_texture_ready(TextureHandle _handle);
+	
+	/// <summary>
+	/// Create streaming 2D texture with full mip-map chain. Only tail mips are resident
+	/// after creation, finer mips are read with `_readFn` once they are requested with
+	/// `bgfx::setTextureDesiredMip`.
+	/// </summary>
+	///
+	/// <param name="_width">Width.</param>
+	/// <param name="_height">Height.</param>
+	/// <param name="_format">Texture format. See: `TextureFormat::Enum`.</param>
+	/// <param name="_flags">Texture creation (see `BGFX_TEXTURE_*`.), and sampler (see `BGFX_SAMPLER_*`) flags.</param>
+	/// <param name="_readFn">Callback function to read texture mip.</param>
+	/// <param name="_userData">User data passed to callback function.</param>
+	///
+	[LinkName("bgfx_create_texture_streaming")]
+	public static extern TextureHandle create_texture_streaming(uint16 _width, uint16 _height, TextureFormat _format, uint64 _flags, void* _readFn, void* _userData);
+	
+	/// <summary>
+	/// Set finest mip of streaming texture that application wants to be resident.
+	/// </summary>
+	///
+	/// <param name="_handle">Streaming texture handle.</param>
+	/// <param name="_mip">Finest mip that should be resident.</param>
+	///
+	[LinkName("bgfx_set_texture_desired_mip")]
+	public static extern void set_texture_desired_mip(TextureHandle _handle, uint8 _mip);
+	
+	/// <summary>
+	/// Returns finest resident mip of streaming texture.
+	/// </summary>
+	///
+	/// <param name="_handle">Texture handle.</param>
+	///
+	[LinkName("bgfx_get_texture_resident_mip")]
+	public static extern uint8 get_texture_resident_mip(TextureHandle _handle);
+	
 	/// <summary>
 	/// Create frame buffer (simple).
 	/// </summary>
@@ -3428,6 +3699,28 @@ public static class bgfx
 	[LinkName("bgfx_destroy_uniform")]
 	public static extern void destroy_uniform(UniformHandle _handle);
 	
+	/// <summary>
+	/// Create uniform block. Uniform block data sets values of all uniforms in block
+	/// with single call, and is laid out std140-style: uniforms are tightly packed in
+	/// order they are passed, `Vec4` element takes 16 bytes, `Mat3` element takes
+	/// 48 bytes (three columns padded to 16 bytes), and `Mat4` element takes 64 bytes.
+	/// </summary>
+	///
+	/// <param name="_uniforms">Uniforms in block, in order they are laid out in block data.</param>
+	/// <param name="_num">Number of uniforms.</param>
+	///
+	[LinkName("bgfx_create_uniform_block")]
+	public static extern UniformBlockHandle create_uniform_block(UniformHandle* _uniforms, uint16 _num);
+	
+	/// <summary>
+	/// Destroy uniform block.
+	/// </summary>
+	///
+	/// <param name="_handle">Handle to uniform block object.</param>
+	///
+	[LinkName("bgfx_destroy_uniform_block")]
+	public static extern void destroy_uniform_block(UniformBlockHandle _handle);
+	
 	/// <summary>
 	/// Create occlusion query.
 	/// </summary>
@@ -3437,6 +3730,7 @@ public static class bgfx
 	
 	/// <summary>
 	/// Retrieve occlusion query result from previous frame.
+	/// With frames in flight result is `Init::limits.maxFramesInFlight - 1` frames old.
 	/// </summary>
 	///
 	/// <param name="_handle">Handle to occlusion query object.</param>
@@ -3454,6 +3748,23 @@ public static class bgfx
 	[LinkName("bgfx_destroy_occlusion_query")]
 	public static extern void destroy_occlusion_query(OcclusionQueryHandle _handle);
 	
+	/// <summary>
+	/// Create draw bundle. Draw calls recorded into draw bundle can be submitted many times
+	/// without encoding them again.
+	/// </summary>
+	///
+	[LinkName("bgfx_create_draw_bundle")]
+	public static extern DrawBundleHandle create_draw_bundle();
+	
+	/// <summary>
+	/// Destroy draw bundle.
+	/// </summary>
+	///
+	/// <param name="_handle">Handle to draw bundle object.</param>
+	///
+	[LinkName("bgfx_destroy_draw_bundle")]
+	public static extern void destroy_draw_bundle(DrawBundleHandle _handle);
+	
 	/// <summary>
 	/// Set palette color value.
 	/// </summary>
@@ -3591,6 +3902,22 @@ public static class bgfx
 	[LinkName("bgfx_set_view_mode")]
 	public static extern void set_view_mode(ViewId _id, ViewMode _mode);
 	
+	/// <summary>
+	/// Set view multi-draw batching.
+	/// When enabled, consecutive draw calls in view that differ only in transform, vertex
+	/// offset and index range are submitted with a single multi-draw indirect call. Model
+	/// transform of each draw call is passed to shader as instance data (`i_data0`-`i_data3`).
+	/// @remarks
+	///   Only used by renderers that support it, other renderers submit draw calls one by one.
+	///   Only draw calls using program enabled with `bgfx::setProgramMultiDraw` are batched.
+	/// </summary>
+	///
+	/// <param name="_id">View id.</param>
+	/// <param name="_enabled">Enable batching of consecutive compatible draw calls.</param>
+	///
+	[LinkName("bgfx_set_view_multi_draw")]
+	public static extern void set_view_multi_draw(ViewId _id, bool _enabled);
+	
 	/// <summary>
 	/// Set view frame buffer.
 	/// @remarks
@@ -3770,6 +4097,16 @@ public static class bgfx
 	[LinkName("bgfx_encoder_set_uniform")]
 	public static extern void encoder_set_uniform(Encoder* _this, UniformHandle _handle, void* _value, uint16 _num);
 	
+	/// <summary>
+	/// Set uniform block data for draw primitive.
+	/// </summary>
+	///
+	/// <param name="_handle">Uniform block.</param>
+	/// <param name="_data">Pointer to uniform block data.</param>
+	///
+	[LinkName("bgfx_encoder_set_uniform_block")]
+	public static extern void encoder_set_uniform_block(Encoder* _this, UniformBlockHandle _handle, void* _data);
+	
 	/// <summary>
 	/// Set index buffer for draw primitive.
 	/// </summary>
@@ -4008,6 +4345,36 @@ public static class bgfx
 	[LinkName("bgfx_encoder_submit_indirect_count")]
 	public static extern void encoder_submit_indirect_count(Encoder* _this, ViewId _id, ProgramHandle _program, IndirectBufferHandle _indirectHandle, uint32 _start, IndexBufferHandle _numHandle, uint32 _numIndex, uint32 _numMax, uint32 _depth, uint8 _flags);
 	
+	/// <summary>
+	/// Begin recording draw calls into draw bundle. Draw calls submitted until `endDrawBundle`
+	/// are recorded into bundle instead of being submitted to view. Previous bundle content is
+	/// discarded.
+	/// @attention Compute dispatches, occlusion queries, and conditional rendering are not recorded. Draw calls using transient index/vertex buffers or instance data buffers are dropped. Bundle doesn't keep referenced resources alive, they must outlive bundle or bundle must be recorded again. Draw calls referencing destroyed resources are dropped when bundle is submitted.
+	/// </summary>
+	///
+	/// <param name="_handle">Draw bundle.</param>
+	///
+	[LinkName("bgfx_encoder_begin_draw_bundle")]
+	public static extern void encoder_begin_draw_bundle(Encoder* _this, DrawBundleHandle _handle);
+	
+	/// <summary>
+	/// End recording draw calls into draw bundle.
+	/// </summary>
+	///
+	[LinkName("bgfx_encoder_end_draw_bundle")]
+	public static extern void encoder_end_draw_bundle(Encoder* _this);
+	
+	/// <summary>
+	/// Submit all draw calls recorded in draw bundle.
+	/// </summary>
+	///
+	/// <param name="_id">View id.</param>
+	/// <param name="_handle">Draw bundle.</param>
+	/// <param name="_mtx">Transform matrix replacing transforms recorded with draw calls, or NULL to use recorded transforms.</param>
+	///
+	[LinkName("bgfx_encoder_submit_draw_bundle")]
+	public static extern void encoder_submit_draw_bundle(Encoder* _this, ViewId _id, DrawBundleHandle _handle, void* _mtx);
+	
 	/// <summary>
 	/// Set compute index buffer.
 	/// </summary>
@@ -4150,6 +4517,42 @@ public static class bgfx
 	[LinkName("bgfx_request_screen_shot")]
 	public static extern void request_screen_shot(FrameBufferHandle _handle, char8* _filePath);
 	
+	/// <summary>
+	/// Write recorded profiler scopes in Chrome trace event JSON format.
+	/// </summary>
+	///
+	/// <param name="_filePath">Output file path.</param>
+	/// <param name="_numFrames">Number of most recent frames to write. Use 0 to write all recorded events.</param>
+	///
+	[LinkName("bgfx_save_profiler_trace")]
+	public static extern uint32 save_profiler_trace(char8* _filePath, uint16 _numFrames);
+	
+	/// <summary>
+	/// Start capturing frames, as they are received by render thread, into file.
+	/// </summary>
+	///
+	/// <param name="_filePath">Capture file path.</param>
+	///
+	[LinkName("bgfx_start_frame_capture")]
+	public static extern bool start_frame_capture(char8* _filePath);
+	
+	/// <summary>
+	/// Stop capturing frames, capture file is closed after current frame is rendered.
+	/// </summary>
+	///
+	[LinkName("bgfx_stop_frame_capture")]
+	public static extern void stop_frame_capture();
+	
+	/// <summary>
+	/// Replay captured frames. Each following frame renders next captured frame instead of frame
+	/// submitted by application.
+	/// </summary>
+	///
+	/// <param name="_filePath">Capture file path.</param>
+	///
+	[LinkName("bgfx_start_frame_replay")]
+	public static extern uint32 start_frame_replay(char8* _filePath);
+	
 	/// <summary>
 	/// Render frame.
 	/// @attention `bgfx::renderFrame` is blocking call. It waits for
@@ -4339,6 +4742,16 @@ public static class bgfx
 	[LinkName("bgfx_set_uniform")]
 	public static extern void set_uniform(UniformHandle _handle, void* _value, uint16 _num);
 	
+	/// <summary>
+	/// Set uniform block data for draw primitive.
+	/// </summary>
+	///
+	/// <param name="_handle">Uniform block.</param>
+	/// <param name="_data">Pointer to uniform block data.</param>
+	///
+	[LinkName("bgfx_set_uniform_block")]
+	public static extern void set_uniform_block(UniformBlockHandle _handle, void* _data);
+	
 	/// <summary>
 	/// Set index buffer for draw primitive.
 	/// </summary>
@@ -4585,6 +4998,36 @@ public static class bgfx
 	[LinkName("bgfx_submit_indirect_count")]
 	public static extern void submit_indirect_count(ViewId _id, ProgramHandle _program, IndirectBufferHandle _indirectHandle, uint32 _start, IndexBufferHandle _numHandle, uint32 _numIndex, uint32 _numMax, uint32 _depth, uint8 _flags);
 	
+	/// <summary>
+	/// Begin recording draw calls into draw bundle. Draw calls submitted until `endDrawBundle`
+	/// are recorded into bundle instead of being submitted to view. Previous bundle content is
+	/// discarded.
+	/// @attention Compute dispatches, occlusion queries, and conditional rendering are not recorded. Draw calls using transient index/vertex buffers or instance data buffers are dropped. Bundle doesn't keep referenced resources alive, they must outlive bundle or bundle must be recorded again. Draw calls referencing destroyed resources are dropped when bundle is submitted.
+	/// </summary>
+	///
+	/// <param name="_handle">Draw bundle.</param>
+	///
+	[LinkName("bgfx_begin_draw_bundle")]
+	public static extern void begin_draw_bundle(DrawBundleHandle _handle);
+	
+	/// <summary>
+	/// End recording draw calls into draw bundle.
+	/// </summary>
+	///
+	[LinkName("bgfx_end_draw_bundle")]
+	public static extern void end_draw_bundle();
+	
+	/// <summary>
+	/// Submit all draw calls recorded in draw bundle.
+	/// </summary>
+	///
+	/// <param name="_id">View id.</param>
+	/// <param name="_handle">Draw bundle.</param>
+	/// <param name="_mtx">Transform matrix replacing transforms recorded with draw calls, or NULL to use recorded transforms.</param>
+	///
+	[LinkName("bgfx_submit_draw_bundle")]
+	public static extern void submit_draw_bundle(ViewId _id, DrawBundleHandle _handle, void* _mtx);
+	
 	/// <summary>
 	/// Set compute index buffer.
 	/// </summary>
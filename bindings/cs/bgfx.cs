@@ -1001,6 +1001,11 @@ public static partial class bgfx
 		/// Transparent backbuffer. Availability depends on: `BGFX_CAPS_TRANSPARENT_BACKBUFFER`.
 		/// </summary>
 		TransparentBackbuffer  = 0x00100000,
+	
+		/// <summary>
+		/// Compile pipeline state objects asynchronously.
+		/// </summary>
+		AsyncPipeline          = 0x00200000,
 		FullscreenShift        = 0,
 		FullscreenMask         = 0x00000001,
 		ReservedShift          = 31,
@@ -1989,6 +1994,11 @@ public static partial class bgfx
 		/// </summary>
 		DepthDescending,
 	
+		/// <summary>
+		/// Sort by program, binding set, and render state to minimize state changes.
+		/// </summary>
+		State,
+	
 		Count
 	}
 	
@@ -2062,10 +2072,15 @@ public static partial class bgfx
 			public uint maxDynamicVertexBuffers;
 			public uint maxUniforms;
 			public uint maxOcclusionQueries;
+			public uint maxDrawBundles;
 			public uint maxEncoders;
 			public uint minResourceCbSize;
 			public uint transientVbSize;
 			public uint transientIbSize;
+			public uint numSortThreads;
+			public uint numRecordThreads;
+			public uint numDecodeThreads;
+			public uint maxFramesInFlight;
 		}
 	
 		public RendererType rendererType;
@@ -2115,6 +2130,13 @@ public static partial class bgfx
 			public uint minResourceCbSize;
 			public uint transientVbSize;
 			public uint transientIbSize;
+			public uint numSortThreads;
+			public uint numRecordThreads;
+			public uint numDecodeThreads;
+			public uint maxDrawCalls;
+			public uint maxFramesInFlight;
+			public ulong textureStreamingBudget;
+			public uint uploadBudget;
 		}
 	
 		public RendererType type;
@@ -2123,6 +2145,7 @@ public static partial class bgfx
 		public ulong capabilities;
 		public byte debug;
 		public byte profile;
+		public byte noopCounting;
 		public PlatformData platformData;
 		public Resolution resolution;
 		public Limits limits;
@@ -2210,6 +2233,9 @@ public static partial class bgfx
 		public long gpuTimeBegin;
 		public long gpuTimeEnd;
 		public uint gpuFrameNum;
+		public uint numStateChanges;
+		public uint numProgramChanges;
+		public uint numBindChanges;
 	}
 	
 	public unsafe struct EncoderStats
@@ -2229,11 +2255,26 @@ public static partial class bgfx
 		public long gpuTimerFreq;
 		public long waitRender;
 		public long waitSubmit;
+		public uint numFramesInFlight;
 		public uint numDraw;
 		public uint numCompute;
 		public uint numBlit;
 		public uint maxGpuLatency;
 		public uint gpuFrameNum;
+		public uint numTransformsDropped;
+		public uint numScissorsDropped;
+		public uint numDrawsDropped;
+		public uint numPendingSkipped;
+		public uint numPipelinesPending;
+		public uint numDrawsFallback;
+		public uint numDrawsSkipped;
+		public uint numMultiDraw;
+		public uint numMultiDrawItems;
+		public uint numStateChanges;
+		public uint numProgramChanges;
+		public uint numBindChanges;
+		public uint numUniformUpdates;
+		public uint numUniformRedundant;
 		public ushort numDynamicIndexBuffers;
 		public ushort numDynamicVertexBuffers;
 		public ushort numFrameBuffers;
@@ -2247,8 +2288,17 @@ public static partial class bgfx
 		public ushort numVertexLayouts;
 		public long textureMemoryUsed;
 		public long rtMemoryUsed;
+		public long streamingMemoryUsed;
 		public int transientVbUsed;
 		public int transientIbUsed;
+		public long dynamicVbUsed;
+		public long dynamicVbFree;
+		public long dynamicVbLargestFree;
+		public long dynamicIbUsed;
+		public long dynamicIbFree;
+		public long dynamicIbLargestFree;
+		public uint numUploadsQueued;
+		public long uploadQueueSize;
 		public fixed uint numPrims[5];
 		public long gpuMemoryMax;
 		public long gpuMemoryUsed;
@@ -2274,6 +2324,11 @@ public static partial class bgfx
 	{
 	}
 	
+	public struct DrawBundleHandle {
+	    public ushort idx;
+	    public bool Valid => idx != UInt16.MaxValue;
+	}
+	
 	public struct DynamicIndexBufferHandle {
 	    public ushort idx;
 	    public bool Valid => idx != UInt16.MaxValue;
@@ -2319,6 +2374,11 @@ public static partial class bgfx
 	    public bool Valid => idx != UInt16.MaxValue;
 	}
 	
+	public struct UniformBlockHandle {
+	    public ushort idx;
+	    public bool Valid => idx != UInt16.MaxValue;
+	}
+	
 	public struct UniformHandle {
 	    public ushort idx;
 	    public bool Valid => idx != UInt16.MaxValue;
@@ -2724,6 +2784,25 @@ public static partial class bgfx
 	[DllImport(DllName, EntryPoint="bgfx_destroy_index_buffer", CallingConvention = CallingConvention.Cdecl)]
 	public static extern unsafe void destroy_index_buffer(IndexBufferHandle _handle);
 	
+	/// <summary>
+	/// Set upload priority of resource waiting in upload queue.
+	/// </summary>
+	///
+	/// <param name="_handle">Static index buffer handle.</param>
+	/// <param name="_priority">Upload priority, higher priority uploads are issued first.</param>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_set_index_buffer_upload_priority", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe void set_index_buffer_upload_priority(IndexBufferHandle _handle, byte _priority);
+	
+	/// <summary>
+	/// Returns true if all uploads of resource were issued to renderer.
+	/// </summary>
+	///
+	/// <param name="_handle">Static index buffer handle.</param>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_is_index_buffer_ready", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe bool is_index_buffer_ready(IndexBufferHandle _handle);
+	
 	/// <summary>
 	/// Create vertex layout.
 	/// </summary>
@@ -2773,6 +2852,25 @@ public static partial class bgfx
 	[DllImport(DllName, EntryPoint="bgfx_destroy_vertex_buffer", CallingConvention = CallingConvention.Cdecl)]
 	public static extern unsafe void destroy_vertex_buffer(VertexBufferHandle _handle);
 	
+	/// <summary>
+	/// Set upload priority of resource waiting in upload queue.
+	/// </summary>
+	///
+	/// <param name="_handle">Static vertex buffer handle.</param>
+	/// <param name="_priority">Upload priority, higher priority uploads are issued first.</param>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_set_vertex_buffer_upload_priority", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe void set_vertex_buffer_upload_priority(VertexBufferHandle _handle, byte _priority);
+	
+	/// <summary>
+	/// Returns true if all uploads of resource were issued to renderer.
+	/// </summary>
+	///
+	/// <param name="_handle">Static vertex buffer handle.</param>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_is_vertex_buffer_ready", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe bool is_vertex_buffer_ready(VertexBufferHandle _handle);
+	
 	/// <summary>
 	/// Create empty dynamic index buffer.
 	/// </summary>
@@ -3029,6 +3127,51 @@ public static partial class bgfx
 	[DllImport(DllName, EntryPoint="bgfx_destroy_program", CallingConvention = CallingConvention.Cdecl)]
 	public static extern unsafe void destroy_program(ProgramHandle _handle);
 	
+	/// <summary>
+	/// Pre-create pipeline state object for program, vertex layout and render
+	/// state combination, so that the first draw call using it doesn't stall.
+	/// Pipeline is created against frame buffer currently assigned to view.
+	/// </summary>
+	///
+	/// <param name="_id">View id.</param>
+	/// <param name="_program">Program handle.</param>
+	/// <param name="_layout">Vertex layout.</param>
+	/// <param name="_state">State flags. See: `BGFX_STATE_*`.</param>
+	/// <param name="_fstencil">Front stencil state.</param>
+	/// <param name="_bstencil">Back stencil state. If back is set to `BGFX_STENCIL_NONE` _fstencil is applied to both front and back facing primitives.</param>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_warm_pipeline", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe void warm_pipeline(ushort _id, ProgramHandle _program, VertexLayout* _layout, ulong _state, uint _fstencil, uint _bstencil);
+	
+	/// <summary>
+	/// Set program used in place of draw call program while its pipeline is being
+	/// compiled asynchronously. See: `BGFX_RESET_ASYNC_PIPELINE`.
+	/// </summary>
+	///
+	/// <param name="_handle">Program handle, or `BGFX_INVALID_HANDLE` to skip draw calls instead.</param>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_set_fallback_program", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe void set_fallback_program(ProgramHandle _handle);
+	
+	/// <summary>
+	/// Write pipeline cache through `CallbackI::cacheWrite` at the end of current
+	/// frame, instead of waiting for pipeline creation to go idle.
+	/// </summary>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_flush_pipeline_cache", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe void flush_pipeline_cache();
+	
+	/// <summary>
+	/// Enable multi-draw batching of draw calls using program. Program must read model
+	/// transform from instance data (`i_data0`-`i_data3`). See: `bgfx::setViewMultiDraw`.
+	/// </summary>
+	///
+	/// <param name="_handle">Program handle.</param>
+	/// <param name="_enabled">Allow draw calls using this program to be batched.</param>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_set_program_multi_draw", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe void set_program_multi_draw(ProgramHandle _handle, bool _enabled);
+	
 	/// <summary>
 	/// Validate texture parameters.
 	/// </summary>
@@ -3208,6 +3351,79 @@ public static partial class bgfx
 	[DllImport(DllName, EntryPoint="bgfx_read_texture", CallingConvention = CallingConvention.Cdecl)]
 	public static extern unsafe uint read_texture(TextureHandle _handle, void* _data, byte _mip);
 	
+	/// <summary>
+	/// Read back texture content asynchronously. Result is available once copy is done,
+	/// instead of at fixed frame. Vulkan records copy into frame command buffer and writes
+	/// data once GPU executed it, without stalling render thread. Other renderers copy
+	/// synchronously on render thread. Tickets complete in order of submission.
+	/// @attention Texture must be created with `BGFX_TEXTURE_READ_BACK` flag.
+	/// @attention Availability depends on: `BGFX_CAPS_TEXTURE_READ_BACK`.
+	/// </summary>
+	///
+	/// <param name="_handle">Texture handle.</param>
+	/// <param name="_data">Destination buffer.</param>
+	/// <param name="_mip">Mip level.</param>
+	/// <param name="_readbackFn">Callback function called from render thread once data is written.</param>
+	/// <param name="_userData">User data passed to callback function.</param>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_read_texture_async", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe uint read_texture_async(TextureHandle _handle, void* _data, byte _mip, IntPtr _readbackFn, void* _userData);
+	
+	/// <summary>
+	/// Returns true once asynchronous readback has completed, and its data was written to
+	/// destination buffer.
+	/// </summary>
+	///
+	/// <param name="_ticket">Readback ticket.</param>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_is_readback_complete", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe bool is_readback_complete(uint _ticket);
+	
+	/// <summary>
+	/// Read back buffer content asynchronously. Data is copied after all draw and compute
+	/// calls of current frame are executed.
+	/// </summary>
+	///
+	/// <param name="_handle">Dynamic index buffer handle.</param>
+	/// <param name="_offset">Offset in bytes from start of buffer.</param>
+	/// <param name="_size">Number of bytes to read.</param>
+	/// <param name="_data">Destination buffer.</param>
+	/// <param name="_readbackFn">Callback function called from render thread once data is written.</param>
+	/// <param name="_userData">User data passed to callback function.</param>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_read_dynamic_index_buffer", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe uint read_dynamic_index_buffer(DynamicIndexBufferHandle _handle, uint _offset, uint _size, void* _data, IntPtr _readbackFn, void* _userData);
+	
+	/// <summary>
+	/// Read back buffer content asynchronously. Data is copied after all draw and compute
+	/// calls of current frame are executed.
+	/// </summary>
+	///
+	/// <param name="_handle">Dynamic vertex buffer handle.</param>
+	/// <param name="_offset">Offset in bytes from start of buffer.</param>
+	/// <param name="_size">Number of bytes to read.</param>
+	/// <param name="_data">Destination buffer.</param>
+	/// <param name="_readbackFn">Callback function called from render thread once data is written.</param>
+	/// <param name="_userData">User data passed to callback function.</param>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_read_dynamic_vertex_buffer", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe uint read_dynamic_vertex_buffer(DynamicVertexBufferHandle _handle, uint _offset, uint _size, void* _data, IntPtr _readbackFn, void* _userData);
+	
+	/// <summary>
+	/// Read back buffer content asynchronously. Data is copied after all draw and compute
+	/// calls of current frame are executed.
+	/// </summary>
+	///
+	/// <param name="_handle">Indirect buffer handle.</param>
+	/// <param name="_offset">Offset in bytes from start of buffer.</param>
+	/// <param name="_size">Number of bytes to read.</param>
+	/// <param name="_data">Destination buffer.</param>
+	/// <param name="_readbackFn">Callback function called from render thread once data is written.</param>
+	/// <param name="_userData">User data passed to callback function.</param>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_read_indirect_buffer", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe uint read_indirect_buffer(IndirectBufferHandle _handle, uint _offset, uint _size, void* _data, IntPtr _readbackFn, void* _userData);
+	
 	/// <summary>
 	/// Set texture debug name.
 	/// </summary>
@@ -3239,6 +3455,60 @@ public static partial class bgfx
 	[DllImport(DllName, EntryPoint="bgfx_destroy_texture", CallingConvention = CallingConvention.Cdecl)]
 	public static extern unsafe void destroy_texture(TextureHandle _handle);
 	
+	/// <summary>
+	/// Set upload priority of resource waiting in upload queue.
+	/// </summary>
+	///
+	/// <param name="_handle">Texture handle.</param>
+	/// <param name="_priority">Upload priority, higher priority uploads are issued first.</param>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_set_texture_upload_priority", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe void set_texture_upload_priority(TextureHandle _handle, byte _priority);
+	
+	/// <summary>
+	/// Returns true if all uploads of resource were issued to renderer.
+	/// </summary>
+	///
+	/// <param name="_handle">Texture handle.</param>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_is_texture_ready", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe bool is_texture_ready(TextureHandle _handle);
+	
+	/// <summary>
+	/// Create streaming 2D texture with full mip-map chain. Only tail mips are resident
+	/// after creation, finer mips are read with `_readFn` once they are requested with
+	/// `bgfx::setTextureDesiredMip`.
+	/// </summary>
+	///
+	/// <param name="_width">Width.</param>
+	/// <param name="_height">Height.</param>
+	/// <param name="_format">Texture format. See: `TextureFormat::Enum`.</param>
+	/// <param name="_flags">Texture creation (see `BGFX_TEXTURE_*`.), and sampler (see `BGFX_SAMPLER_*`) flags.</param>
+	/// <param name="_readFn">Callback function to read texture mip.</param>
+	/// <param name="_userData">User data passed to callback function.</param>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_create_texture_streaming", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe TextureHandle create_texture_streaming(ushort _width, ushort _height, TextureFormat _format, ulong _flags, IntPtr _readFn, void* _userData);
+	
+	/// <summary>
+	/// Set finest mip of streaming texture that application wants to be resident.
+	/// </summary>
+	///
+	/// <param name="_handle">Streaming texture handle.</param>
+	/// <param name="_mip">Finest mip that should be resident.</param>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_set_texture_desired_mip", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe void set_texture_desired_mip(TextureHandle _handle, byte _mip);
+	
+	/// <summary>
+	/// Returns finest resident mip of streaming texture.
+	/// </summary>
+	///
+	/// <param name="_handle">Texture handle.</param>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_get_texture_resident_mip", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe byte get_texture_resident_mip(TextureHandle _handle);
+	
 	/// <summary>
 	/// Create frame buffer (simple).
 	/// </summary>
@@ -3383,6 +3653,28 @@ public static partial class bgfx
 	[DllImport(DllName, EntryPoint="bgfx_destroy_uniform", CallingConvention = CallingConvention.Cdecl)]
 	public static extern unsafe void destroy_uniform(UniformHandle _handle);
 	
+	/// <summary>
+	/// Create uniform block. Uniform block data sets values of all uniforms in block
+	/// with single call, and is laid out std140-style: uniforms are tightly packed in
+	/// order they are passed, `Vec4` element takes 16 bytes, `Mat3` element takes
+	/// 48 bytes (three columns padded to 16 bytes), and `Mat4` element takes 64 bytes.
+	/// </summary>
+	///
+	/// <param name="_uniforms">Uniforms in block, in order they are laid out in block data.</param>
+	/// <param name="_num">Number of uniforms.</param>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_create_uniform_block", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe UniformBlockHandle create_uniform_block(UniformHandle* _uniforms, ushort _num);
+	
+	/// <summary>
+	/// Destroy uniform block.
+	/// </summary>
+	///
+	/// <param name="_handle">Handle to uniform block object.</param>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_destroy_uniform_block", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe void destroy_uniform_block(UniformBlockHandle _handle);
+	
 	/// <summary>
 	/// Create occlusion query.
 	/// </summary>
@@ -3392,6 +3684,7 @@ public static partial class bgfx
 	
 	/// <summary>
 	/// Retrieve occlusion query result from previous frame.
+	/// With frames in flight result is `Init::limits.maxFramesInFlight - 1` frames old.
 	/// </summary>
 	///
 	/// <param name="_handle">Handle to occlusion query object.</param>
@@ -3409,6 +3702,23 @@ public static partial class bgfx
 	[DllImport(DllName, EntryPoint="bgfx_destroy_occlusion_query", CallingConvention = CallingConvention.Cdecl)]
 	public static extern unsafe void destroy_occlusion_query(OcclusionQueryHandle _handle);
 	
+	/// <summary>
+	/// Create draw bundle. Draw calls recorded into draw bundle can be submitted many times
+	/// without encoding them again.
+	/// </summary>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_create_draw_bundle", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe DrawBundleHandle create_draw_bundle();
+	
+	/// <summary>
+	/// Destroy draw bundle.
+	/// </summary>
+	///
+	/// <param name="_handle">Handle to draw bundle object.</param>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_destroy_draw_bundle", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe void destroy_draw_bundle(DrawBundleHandle _handle);
+	
 	/// <summary>
 	/// Set palette color value.
 	/// </summary>
@@ -3546,6 +3856,22 @@ public static partial class bgfx
 	[DllImport(DllName, EntryPoint="bgfx_set_view_mode", CallingConvention = CallingConvention.Cdecl)]
 	public static extern unsafe void set_view_mode(ushort _id, ViewMode _mode);
 	
+	/// <summary>
+	/// Set view multi-draw batching.
+	/// When enabled, consecutive draw calls in view that differ only in transform, vertex
+	/// offset and index range are submitted with a single multi-draw indirect call. Model
+	/// transform of each draw call is passed to shader as instance data (`i_data0`-`i_data3`).
+	/// @remarks
+	///   Only used by renderers that support it, other renderers submit draw calls one by one.
+	///   Only draw calls using program enabled with `bgfx::setProgramMultiDraw` are batched.
+	/// </summary>
+	///
+	/// <param name="_id">View id.</param>
+	/// <param name="_enabled">Enable batching of consecutive compatible draw calls.</param>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_set_view_multi_draw", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe void set_view_multi_draw(ushort _id, bool _enabled);
+	
 	/// <summary>
 	/// Set view frame buffer.
 	/// @remarks
@@ -3725,6 +4051,16 @@ public static partial class bgfx
 	[DllImport(DllName, EntryPoint="bgfx_encoder_set_uniform", CallingConvention = CallingConvention.Cdecl)]
 	public static extern unsafe void encoder_set_uniform(Encoder* _this, UniformHandle _handle, void* _value, ushort _num);
 	
+	/// <summary>
+	/// Set uniform block data for draw primitive.
+	/// </summary>
+	///
+	/// <param name="_handle">Uniform block.</param>
+	/// <param name="_data">Pointer to uniform block data.</param>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_encoder_set_uniform_block", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe void encoder_set_uniform_block(Encoder* _this, UniformBlockHandle _handle, void* _data);
+	
 	/// <summary>
 	/// Set index buffer for draw primitive.
 	/// </summary>
@@ -3963,6 +4299,36 @@ public static partial class bgfx
 	[DllImport(DllName, EntryPoint="bgfx_encoder_submit_indirect_count", CallingConvention = CallingConvention.Cdecl)]
 	public static extern unsafe void encoder_submit_indirect_count(Encoder* _this, ushort _id, ProgramHandle _program, IndirectBufferHandle _indirectHandle, uint _start, IndexBufferHandle _numHandle, uint _numIndex, uint _numMax, uint _depth, byte _flags);
 	
+	/// <summary>
+	/// Begin recording draw calls into draw bundle. Draw calls submitted until `endDrawBundle`
+	/// are recorded into bundle instead of being submitted to view. Previous bundle content is
+	/// discarded.
+	/// @attention Compute dispatches, occlusion queries, and conditional rendering are not recorded. Draw calls using transient index/vertex buffers or instance data buffers are dropped. Bundle doesn't keep referenced resources alive, they must outlive bundle or bundle must be recorded again. Draw calls referencing destroyed resources are dropped when bundle is submitted.
+	/// </summary>
+	///
+	/// <param name="_handle">Draw bundle.</param>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_encoder_begin_draw_bundle", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe void encoder_begin_draw_bundle(Encoder* _this, DrawBundleHandle _handle);
+	
+	/// <summary>
+	/// End recording draw calls into draw bundle.
+	/// </summary>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_encoder_end_draw_bundle", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe void encoder_end_draw_bundle(Encoder* _this);
+	
+	/// <summary>
+	/// Submit all draw calls recorded in draw bundle.
+	/// </summary>
+	///
+	/// <param name="_id">View id.</param>
+	/// <param name="_handle">Draw bundle.</param>
+	/// <param name="_mtx">Transform matrix replacing transforms recorded with draw calls, or NULL to use recorded transforms.</param>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_encoder_submit_draw_bundle", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe void encoder_submit_draw_bundle(Encoder* _this, ushort _id, DrawBundleHandle _handle, void* _mtx);
+	
 	/// <summary>
 	/// Set compute index buffer.
 	/// </summary>
@@ -4105,6 +4471,42 @@ public static partial class bgfx
 	[DllImport(DllName, EntryPoint="bgfx_request_screen_shot", CallingConvention = CallingConvention.Cdecl)]
 	public static extern unsafe void request_screen_shot(FrameBufferHandle _handle, [MarshalAs(UnmanagedType.LPStr)] string _filePath);
 	
+	/// <summary>
+	/// Write recorded profiler scopes in Chrome trace event JSON format.
+	/// </summary>
+	///
+	/// <param name="_filePath">Output file path.</param>
+	/// <param name="_numFrames">Number of most recent frames to write. Use 0 to write all recorded events.</param>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_save_profiler_trace", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe uint save_profiler_trace([MarshalAs(UnmanagedType.LPStr)] string _filePath, ushort _numFrames);
+	
+	/// <summary>
+	/// Start capturing frames, as they are received by render thread, into file.
+	/// </summary>
+	///
+	/// <param name="_filePath">Capture file path.</param>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_start_frame_capture", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe bool start_frame_capture([MarshalAs(UnmanagedType.LPStr)] string _filePath);
+	
+	/// <summary>
+	/// Stop capturing frames, capture file is closed after current frame is rendered.
+	/// </summary>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_stop_frame_capture", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe void stop_frame_capture();
+	
+	/// <summary>
+	/// Replay captured frames. Each following frame renders next captured frame instead of frame
+	/// submitted by application.
+	/// </summary>
+	///
+	/// <param name="_filePath">Capture file path.</param>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_start_frame_replay", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe uint start_frame_replay([MarshalAs(UnmanagedType.LPStr)] string _filePath);
+	
 	/// <summary>
 	/// Render frame.
 	/// @attention `bgfx::renderFrame` is blocking call. It waits for
@@ -4294,6 +4696,16 @@ public static partial class bgfx
 	[DllImport(DllName, EntryPoint="bgfx_set_uniform", CallingConvention = CallingConvention.Cdecl)]
 	public static extern unsafe void set_uniform(UniformHandle _handle, void* _value, ushort _num);
 	
+	/// <summary>
+	/// Set uniform block data for draw primitive.
+	/// </summary>
+	///
+	/// <param name="_handle">Uniform block.</param>
+	/// <param name="_data">Pointer to uniform block data.</param>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_set_uniform_block", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe void set_uniform_block(UniformBlockHandle _handle, void* _data);
+	
 	/// <summary>
 	/// Set index buffer for draw primitive.
 	/// </summary>
@@ -4540,6 +4952,36 @@ public static partial class bgfx
 	[DllImport(DllName, EntryPoint="bgfx_submit_indirect_count", CallingConvention = CallingConvention.Cdecl)]
 	public static extern unsafe void submit_indirect_count(ushort _id, ProgramHandle _program, IndirectBufferHandle _indirectHandle, uint _start, IndexBufferHandle _numHandle, uint _numIndex, uint _numMax, uint _depth, byte _flags);
 	
+	/// <summary>
+	/// Begin recording draw calls into draw bundle. Draw calls submitted until `endDrawBundle`
+	/// are recorded into bundle instead of being submitted to view. Previous bundle content is
+	/// discarded.
+	/// @attention Compute dispatches, occlusion queries, and conditional rendering are not recorded. Draw calls using transient index/vertex buffers or instance data buffers are dropped. Bundle doesn't keep referenced resources alive, they must outlive bundle or bundle must be recorded again. Draw calls referencing destroyed resources are dropped when bundle is submitted.
+	/// </summary>
+	///
+	/// <param name="_handle">Draw bundle.</param>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_begin_draw_bundle", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe void begin_draw_bundle(DrawBundleHandle _handle);
+	
+	/// <summary>
+	/// End recording draw calls into draw bundle.
+	/// </summary>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_end_draw_bundle", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe void end_draw_bundle();
+	
+	/// <summary>
+	/// Submit all draw calls recorded in draw bundle.
+	/// </summary>
+	///
+	/// <param name="_id">View id.</param>
+	/// <param name="_handle">Draw bundle.</param>
+	/// <param name="_mtx">Transform matrix replacing transforms recorded with draw calls, or NULL to use recorded transforms.</param>
+	///
+	[DllImport(DllName, EntryPoint="bgfx_submit_draw_bundle", CallingConvention = CallingConvention.Cdecl)]
+	public static extern unsafe void submit_draw_bundle(ushort _id, DrawBundleHandle _handle, void* _mtx);
+	
 	/// <summary>
 	/// Set compute index buffer.
 	/// </summary>
@@ -620,6 +620,9 @@ pub const ResetFlags_Suspend: ResetFlags                = 0x00080000;
 
 /// Transparent backbuffer. Availability depends on: `BGFX_CAPS_TRANSPARENT_BACKBUFFER`.
 pub const ResetFlags_TransparentBackbuffer: ResetFlags  = 0x00100000;
+
+/// Compile pipeline state objects asynchronously.
+pub const ResetFlags_AsyncPipeline: ResetFlags          = 0x00200000;
 pub const ResetFlags_FullscreenShift: ResetFlags        = 0;
 pub const ResetFlags_FullscreenMask: ResetFlags         = 0x00000001;
 pub const ResetFlags_ReservedShift: ResetFlags          = 31;
@@ -1251,6 +1254,9 @@ pub const ViewMode = enum(c_int) {
     /// Sort draw call depth in descending order.
     DepthDescending,
 
+    /// Sort by program, binding set, and render state to minimize state changes.
+    State,
+
     Count
 };
 
@@ -1307,10 +1313,15 @@ pub const Caps = extern struct {
         maxDynamicVertexBuffers: u32,
         maxUniforms: u32,
         maxOcclusionQueries: u32,
+        maxDrawBundles: u32,
         maxEncoders: u32,
         minResourceCbSize: u32,
         transientVbSize: u32,
         transientIbSize: u32,
+        numSortThreads: u32,
+        numRecordThreads: u32,
+        numDecodeThreads: u32,
+        maxFramesInFlight: u32,
     };
 
         rendererType: RendererType,
@@ -1355,6 +1366,13 @@ pub const Init = extern struct {
         minResourceCbSize: u32,
         transientVbSize: u32,
         transientIbSize: u32,
+        numSortThreads: u32,
+        numRecordThreads: u32,
+        numDecodeThreads: u32,
+        maxDrawCalls: u32,
+        maxFramesInFlight: u32,
+        textureStreamingBudget: u64,
+        uploadBudget: u32,
     };
 
         type: RendererType,
@@ -1363,6 +1381,7 @@ pub const Init = extern struct {
         capabilities: u64,
         debug: bool,
         profile: bool,
+        noopCounting: bool,
         platformData: PlatformData,
         resolution: Resolution,
         limits: Limits,
@@ -1451,6 +1470,9 @@ pub const Init = extern struct {
         gpuTimeBegin: i64,
         gpuTimeEnd: i64,
         gpuFrameNum: u32,
+        numStateChanges: u32,
+        numProgramChanges: u32,
+        numBindChanges: u32,
     };
 
     pub const EncoderStats = extern struct {
@@ -1468,11 +1490,26 @@ pub const Init = extern struct {
         gpuTimerFreq: i64,
         waitRender: i64,
         waitSubmit: i64,
+        numFramesInFlight: u32,
         numDraw: u32,
         numCompute: u32,
         numBlit: u32,
         maxGpuLatency: u32,
         gpuFrameNum: u32,
+        numTransformsDropped: u32,
+        numScissorsDropped: u32,
+        numDrawsDropped: u32,
+        numPendingSkipped: u32,
+        numPipelinesPending: u32,
+        numDrawsFallback: u32,
+        numDrawsSkipped: u32,
+        numMultiDraw: u32,
+        numMultiDrawItems: u32,
+        numStateChanges: u32,
+        numProgramChanges: u32,
+        numBindChanges: u32,
+        numUniformUpdates: u32,
+        numUniformRedundant: u32,
         numDynamicIndexBuffers: u16,
         numDynamicVertexBuffers: u16,
         numFrameBuffers: u16,
@@ -1486,8 +1523,17 @@ pub const Init = extern struct {
         numVertexLayouts: u16,
         textureMemoryUsed: i64,
         rtMemoryUsed: i64,
+        streamingMemoryUsed: i64,
         transientVbUsed: i32,
         transientIbUsed: i32,
+        dynamicVbUsed: i64,
+        dynamicVbFree: i64,
+        dynamicVbLargestFree: i64,
+        dynamicIbUsed: i64,
+        dynamicIbFree: i64,
+        dynamicIbLargestFree: i64,
+        numUploadsQueued: u32,
+        uploadQueueSize: i64,
         numPrims: [5]u32,
         gpuMemoryMax: i64,
         gpuMemoryUsed: i64,
@@ -1621,6 +1667,12 @@ pub const Init = extern struct {
         pub inline fn setUniform(self: ?*Encoder, _handle: UniformHandle, _value: ?*const anyopaque, _num: u16) void {
             return bgfx_encoder_set_uniform(self, _handle, _value, _num);
         }
+        /// Set uniform block data for draw primitive.
+        /// <param name="_handle">Uniform block.</param>
+        /// <param name="_data">Pointer to uniform block data.</param>
+        pub inline fn setUniformBlock(self: ?*Encoder, _handle: UniformBlockHandle, _data: ?*const anyopaque) void {
+            return bgfx_encoder_set_uniform_block(self, _handle, _data);
+        }
         /// Set index buffer for draw primitive.
         /// <param name="_handle">Index buffer.</param>
         /// <param name="_firstIndex">First index to render.</param>
@@ -1784,6 +1836,25 @@ pub const Init = extern struct {
         pub inline fn submitIndirectCount(self: ?*Encoder, _id: ViewId, _program: ProgramHandle, _indirectHandle: IndirectBufferHandle, _start: u32, _numHandle: IndexBufferHandle, _numIndex: u32, _numMax: u32, _depth: u32, _flags: u8) void {
             return bgfx_encoder_submit_indirect_count(self, _id, _program, _indirectHandle, _start, _numHandle, _numIndex, _numMax, _depth, _flags);
         }
+        /// Begin recording draw calls into draw bundle. Draw calls submitted until `endDrawBundle`
+        /// are recorded into bundle instead of being submitted to view. Previous bundle content is
+        /// discarded.
+        /// @attention Compute dispatches, occlusion queries, and conditional rendering are not recorded. Draw calls using transient index/vertex buffers or instance data buffers are dropped. Bundle doesn't keep referenced resources alive, they must outlive bundle or bundle must be recorded again. Draw calls referencing destroyed resources are dropped when bundle is submitted.
+        /// <param name="_handle">Draw bundle.</param>
+        pub inline fn beginDrawBundle(self: ?*Encoder, _handle: DrawBundleHandle) void {
+            return bgfx_encoder_begin_draw_bundle(self, _handle);
+        }
+        /// End recording draw calls into draw bundle.
+        pub inline fn endDrawBundle(self: ?*Encoder) void {
+            return bgfx_encoder_end_draw_bundle(self);
+        }
+        /// Submit all draw calls recorded in draw bundle.
+        /// <param name="_id">View id.</param>
+        /// <param name="_handle">Draw bundle.</param>
+        /// <param name="_mtx">Transform matrix replacing transforms recorded with draw calls, or NULL to use recorded transforms.</param>
+        pub inline fn submitDrawBundle(self: ?*Encoder, _id: ViewId, _handle: DrawBundleHandle, _mtx: ?*const anyopaque) void {
+            return bgfx_encoder_submit_draw_bundle(self, _id, _handle, _mtx);
+        }
         /// Set compute index buffer.
         /// <param name="_stage">Compute stage.</param>
         /// <param name="_handle">Index buffer handle.</param>
@@ -1875,6 +1946,10 @@ pub const Init = extern struct {
         }
     };
 
+pub const DrawBundleHandle = extern struct {
+    idx: c_ushort,
+};
+
 pub const DynamicIndexBufferHandle = extern struct {
     idx: c_ushort,
 };
@@ -1911,6 +1986,10 @@ pub const TextureHandle = extern struct {
     idx: c_ushort,
 };
 
+pub const UniformBlockHandle = extern struct {
+    idx: c_ushort,
+};
+
 pub const UniformHandle = extern struct {
     idx: c_ushort,
 };
@@ -2210,6 +2289,21 @@ pub inline fn destroyIndexBuffer(_handle: IndexBufferHandle) void {
 }
 extern fn bgfx_destroy_index_buffer(_handle: IndexBufferHandle) void;
 
+/// Set upload priority of resource waiting in upload queue.
+/// <param name="_handle">Static index buffer handle.</param>
+/// <param name="_priority">Upload priority, higher priority uploads are issued first.</param>
+pub inline fn setIndexBufferUploadPriority(_handle: IndexBufferHandle, _priority: u8) void {
+    return bgfx_set_index_buffer_upload_priority(_handle, _priority);
+}
+extern fn bgfx_set_index_buffer_upload_priority(_handle: IndexBufferHandle, _priority: u8) void;
+
+/// Returns true if all uploads of resource were issued to renderer.
+/// <param name="_handle">Static index buffer handle.</param>
+pub inline fn isIndexBufferReady(_handle: IndexBufferHandle) bool {
+    return bgfx_is_index_buffer_ready(_handle);
+}
+extern fn bgfx_is_index_buffer_ready(_handle: IndexBufferHandle) bool;
+
 /// Create vertex layout.
 /// <param name="_layout">Vertex layout.</param>
 pub inline fn createVertexLayout(_layout: [*c]const VertexLayout) VertexLayoutHandle {
@@ -2249,6 +2343,21 @@ pub inline fn destroyVertexBuffer(_handle: VertexBufferHandle) void {
 }
 extern fn bgfx_destroy_vertex_buffer(_handle: VertexBufferHandle) void;
 
+/// Set upload priority of resource waiting in upload queue.
+/// <param name="_handle">Static vertex buffer handle.</param>
+/// <param name="_priority">Upload priority, higher priority uploads are issued first.</param>
+pub inline fn setVertexBufferUploadPriority(_handle: VertexBufferHandle, _priority: u8) void {
+    return bgfx_set_vertex_buffer_upload_priority(_handle, _priority);
+}
+extern fn bgfx_set_vertex_buffer_upload_priority(_handle: VertexBufferHandle, _priority: u8) void;
+
+/// Returns true if all uploads of resource were issued to renderer.
+/// <param name="_handle">Static vertex buffer handle.</param>
+pub inline fn isVertexBufferReady(_handle: VertexBufferHandle) bool {
+    return bgfx_is_vertex_buffer_ready(_handle);
+}
+extern fn bgfx_is_vertex_buffer_ready(_handle: VertexBufferHandle) bool;
+
 /// Create empty dynamic index buffer.
 /// <param name="_num">Number of indices.</param>
 /// <param name="_flags">Buffer creation flags.   - `BGFX_BUFFER_NONE` - No flags.   - `BGFX_BUFFER_COMPUTE_READ` - Buffer will be read from by compute shader.   - `BGFX_BUFFER_COMPUTE_WRITE` - Buffer will be written into by compute shader. When buffer       is created with `BGFX_BUFFER_COMPUTE_WRITE` flag it cannot be updated from CPU.   - `BGFX_BUFFER_COMPUTE_READ_WRITE` - Buffer will be used for read/write by compute shader.   - `BGFX_BUFFER_ALLOW_RESIZE` - Buffer will resize on buffer update if a different amount of       data is passed. If this flag is not specified, and more data is passed on update, the buffer       will be trimmed to fit the existing buffer size. This flag has effect only on dynamic       buffers.   - `BGFX_BUFFER_INDEX32` - Buffer is using 32-bit indices. This flag has effect only on       index buffers.</param>
@@ -2456,6 +2565,44 @@ pub inline fn destroyProgram(_handle: ProgramHandle) void {
 }
 extern fn bgfx_destroy_program(_handle: ProgramHandle) void;
 
+/// Pre-create pipeline state object for program, vertex layout and render
+/// state combination, so that the first draw call using it doesn't stall.
+/// Pipeline is created against frame buffer currently assigned to view.
+/// <param name="_id">View id.</param>
+/// <param name="_program">Program handle.</param>
+/// <param name="_layout">Vertex layout.</param>
+/// <param name="_state">State flags. See: `BGFX_STATE_*`.</param>
+/// <param name="_fstencil">Front stencil state.</param>
+/// <param name="_bstencil">Back stencil state. If back is set to `BGFX_STENCIL_NONE` _fstencil is applied to both front and back facing primitives.</param>
+pub inline fn warmPipeline(_id: ViewId, _program: ProgramHandle, _layout: [*c]const VertexLayout, _state: u64, _fstencil: u32, _bstencil: u32) void {
+    return bgfx_warm_pipeline(_id, _program, _layout, _state, _fstencil, _bstencil);
+}
+extern fn bgfx_warm_pipeline(_id: ViewId, _program: ProgramHandle, _layout: [*c]const VertexLayout, _state: u64, _fstencil: u32, _bstencil: u32) void;
+
+/// Set program used in place of draw call program while its pipeline is being
+/// compiled asynchronously. See: `BGFX_RESET_ASYNC_PIPELINE`.
+/// <param name="_handle">Program handle, or `BGFX_INVALID_HANDLE` to skip draw calls instead.</param>
+pub inline fn setFallbackProgram(_handle: ProgramHandle) void {
+    return bgfx_set_fallback_program(_handle);
+}
+extern fn bgfx_set_fallback_program(_handle: ProgramHandle) void;
+
+/// Write pipeline cache through `CallbackI::cacheWrite` at the end of current
+/// frame, instead of waiting for pipeline creation to go idle.
+pub inline fn flushPipelineCache() void {
+    return bgfx_flush_pipeline_cache();
+}
+extern fn bgfx_flush_pipeline_cache() void;
+
+/// Enable multi-draw batching of draw calls using program. Program must read model
+/// transform from instance data (`i_data0`-`i_data3`). See: `bgfx::setViewMultiDraw`.
+/// <param name="_handle">Program handle.</param>
+/// <param name="_enabled">Allow draw calls using this program to be batched.</param>
+pub inline fn setProgramMultiDraw(_handle: ProgramHandle, _enabled: bool) void {
+    return bgfx_set_program_multi_draw(_handle, _enabled);
+}
+extern fn bgfx_set_program_multi_draw(_handle: ProgramHandle, _enabled: bool) void;
+
 /// Validate texture parameters.
 /// <param name="_depth">Depth dimension of volume texture.</param>
 /// <param name="_cubeMap">Indicates that texture contains cubemap.</param>
@@ -2609,6 +2756,69 @@ pub inline fn readTexture(_handle: TextureHandle, _data: ?*anyopaque, _mip: u8)
 }
 extern fn bgfx_read_texture(_handle: TextureHandle, _data: ?*anyopaque, _mip: u8) u32;
 
+/// Read back texture content asynchronously. Result is available once copy is done,
+/// instead of at fixed frame. Vulkan records copy into frame command buffer and writes
+/// data once GPU executed it, without stalling render thread. Other renderers copy
+/// synchronously on render thread. Tickets complete in order of submission.
+/// @attention Texture must be created with `BGFX_TEXTURE_READ_BACK` flag.
+/// @attention Availability depends on: `BGFX_CAPS_TEXTURE_READ_BACK`.
+/// <param name="_handle">Texture handle.</param>
+/// <param name="_data">Destination buffer.</param>
+/// <param name="_mip">Mip level.</param>
+/// <param name="_readbackFn">Callback function called from render thread once data is written.</param>
+/// <param name="_userData">User data passed to callback function.</param>
+pub inline fn readTextureAsync(_handle: TextureHandle, _data: ?*anyopaque, _mip: u8, _readbackFn: ?*anyopaque, _userData: ?*anyopaque) u32 {
+    return bgfx_read_texture_async(_handle, _data, _mip, _readbackFn, _userData);
+}
+extern fn bgfx_read_texture_async(_handle: TextureHandle, _data: ?*anyopaque, _mip: u8, _readbackFn: ?*anyopaque, _userData: ?*anyopaque) u32;
+
+/// Returns true once asynchronous readback has completed, and its data was written to
+/// destination buffer.
+/// <param name="_ticket">Readback ticket.</param>
+pub inline fn isReadbackComplete(_ticket: u32) bool {
+    return bgfx_is_readback_complete(_ticket);
+}
+extern fn bgfx_is_readback_complete(_ticket: u32) bool;
+
+/// Read back buffer content asynchronously. Data is copied after all draw and compute
+/// calls of current frame are executed.
+/// <param name="_handle">Dynamic index buffer handle.</param>
+/// <param name="_offset">Offset in bytes from start of buffer.</param>
+/// <param name="_size">Number of bytes to read.</param>
+/// <param name="_data">Destination buffer.</param>
+/// <param name="_readbackFn">Callback function called from render thread once data is written.</param>
+/// <param name="_userData">User data passed to callback function.</param>
+pub inline fn readDynamicIndexBuffer(_handle: DynamicIndexBufferHandle, _offset: u32, _size: u32, _data: ?*anyopaque, _readbackFn: ?*anyopaque, _userData: ?*anyopaque) u32 {
+    return bgfx_read_dynamic_index_buffer(_handle, _offset, _size, _data, _readbackFn, _userData);
+}
+extern fn bgfx_read_dynamic_index_buffer(_handle: DynamicIndexBufferHandle, _offset: u32, _size: u32, _data: ?*anyopaque, _readbackFn: ?*anyopaque, _userData: ?*anyopaque) u32;
+
+/// Read back buffer content asynchronously. Data is copied after all draw and compute
+/// calls of current frame are executed.
+/// <param name="_handle">Dynamic vertex buffer handle.</param>
+/// <param name="_offset">Offset in bytes from start of buffer.</param>
+/// <param name="_size">Number of bytes to read.</param>
+/// <param name="_data">Destination buffer.</param>
+/// <param name="_readbackFn">Callback function called from render thread once data is written.</param>
+/// <param name="_userData">User data passed to callback function.</param>
+pub inline fn readDynamicVertexBuffer(_handle: DynamicVertexBufferHandle, _offset: u32, _size: u32, _data: ?*anyopaque, _readbackFn: ?*anyopaque, _userData: ?*anyopaque) u32 {
+    return bgfx_read_dynamic_vertex_buffer(_handle, _offset, _size, _data, _readbackFn, _userData);
+}
+extern fn bgfx_read_dynamic_vertex_buffer(_handle: DynamicVertexBufferHandle, _offset: u32, _size: u32, _data: ?*anyopaque, _readbackFn: ?*anyopaque, _userData: ?*anyopaque) u32;
+
+/// Read back buffer content asynchronously. Data is copied after all draw and compute
+/// calls of current frame are executed.
+/// <param name="_handle">Indirect buffer handle.</param>
+/// <param name="_offset">Offset in bytes from start of buffer.</param>
+/// <param name="_size">Number of bytes to read.</param>
+/// <param name="_data">Destination buffer.</param>
+/// <param name="_readbackFn">Callback function called from render thread once data is written.</param>
+/// <param name="_userData">User data passed to callback function.</param>
+pub inline fn readIndirectBuffer(_handle: IndirectBufferHandle, _offset: u32, _size: u32, _data: ?*anyopaque, _readbackFn: ?*anyopaque, _userData: ?*anyopaque) u32 {
+    return bgfx_read_indirect_buffer(_handle, _offset, _size, _data, _readbackFn, _userData);
+}
+extern fn bgfx_read_indirect_buffer(_handle: IndirectBufferHandle, _offset: u32, _size: u32, _data: ?*anyopaque, _readbackFn: ?*anyopaque, _userData: ?*anyopaque) u32;
+
 /// Set texture debug name.
 /// <param name="_handle">Texture handle.</param>
 /// <param name="_name">Texture name.</param>
@@ -2634,6 +2844,50 @@ pub inline fn destroyTexture(_handle: TextureHandle) void {
 }
 extern fn bgfx_destroy_texture(_handle: TextureHandle) void;
 
+/// Set upload priority of resource waiting in upload queue.
+/// <param name="_handle">Texture handle.</param>
+/// <param name="_priority">Upload priority, higher priority uploads are issued first.</param>
+pub inline fn setTextureUploadPriority(_handle: TextureHandle, _priority: u8) void {
+    return bgfx_set_texture_upload_priority(_handle, _priority);
+}
+extern fn bgfx_set_texture_upload_priority(_handle: TextureHandle, _priority: u8) void;
+
+/// Returns true if all uploads of resource were issued to renderer.
+/// <param name="_handle">Texture handle.</param>
+pub inline fn isTextureReady(_handle: TextureHandle) bool {
+    return bgfx_is_texture_ready(_handle);
+}
+extern fn bgfx_is_texture_ready(_handle: TextureHandle) bool;
+
+/// Create streaming 2D texture with full mip-map chain. Only tail mips are resident
+/// after creation, finer mips are read with `_readFn` once they are requested with
+/// `bgfx::setTextureDesiredMip`.
+/// <param name="_width">Width.</param>
+/// <param name="_height">Height.</param>
+/// <param name="_format">Texture format. See: `TextureFormat::Enum`.</param>
+/// <param name="_flags">Texture creation (see `BGFX_TEXTURE_*`.), and sampler (see `BGFX_SAMPLER_*`) flags.</param>
+/// <param name="_readFn">Callback function to read texture mip.</param>
+/// <param name="_userData">User data passed to callback function.</param>
+pub inline fn createTextureStreaming(_width: u16, _height: u16, _format: TextureFormat, _flags: u64, _readFn: ?*anyopaque, _userData: ?*anyopaque) TextureHandle {
+    return bgfx_create_texture_streaming(_width, _height, _format, _flags, _readFn, _userData);
+}
+extern fn bgfx_create_texture_streaming(_width: u16, _height: u16, _format: TextureFormat, _flags: u64, _readFn: ?*anyopaque, _userData: ?*anyopaque) TextureHandle;
+
+/// Set finest mip of streaming texture that application wants to be resident.
+/// <param name="_handle">Streaming texture handle.</param>
+/// <param name="_mip">Finest mip that should be resident.</param>
+pub inline fn setTextureDesiredMip(_handle: TextureHandle, _mip: u8) void {
+    return bgfx_set_texture_desired_mip(_handle, _mip);
+}
+extern fn bgfx_set_texture_desired_mip(_handle: TextureHandle, _mip: u8) void;
+
+/// Returns finest resident mip of streaming texture.
+/// <param name="_handle">Texture handle.</param>
+pub inline fn getTextureResidentMip(_handle: TextureHandle) u8 {
+    return bgfx_get_texture_resident_mip(_handle);
+}
+extern fn bgfx_get_texture_resident_mip(_handle: TextureHandle) u8;
+
 /// Create frame buffer (simple).
 /// <param name="_width">Texture width.</param>
 /// <param name="_height">Texture height.</param>
@@ -2756,6 +3010,24 @@ pub inline fn destroyUniform(_handle: UniformHandle) void {
 }
 extern fn bgfx_destroy_uniform(_handle: UniformHandle) void;
 
+/// Create uniform block. Uniform block data sets values of all uniforms in block
+/// with single call, and is laid out std140-style: uniforms are tightly packed in
+/// order they are passed, `Vec4` element takes 16 bytes, `Mat3` element takes
+/// 48 bytes (three columns padded to 16 bytes), and `Mat4` element takes 64 bytes.
+/// <param name="_uniforms">Uniforms in block, in order they are laid out in block data.</param>
+/// <param name="_num">Number of uniforms.</param>
+pub inline fn createUniformBlock(_uniforms: [*c]const UniformHandle, _num: u16) UniformBlockHandle {
+    return bgfx_create_uniform_block(_uniforms, _num);
+}
+extern fn bgfx_create_uniform_block(_uniforms: [*c]const UniformHandle, _num: u16) UniformBlockHandle;
+
+/// Destroy uniform block.
+/// <param name="_handle">Handle to uniform block object.</param>
+pub inline fn destroyUniformBlock(_handle: UniformBlockHandle) void {
+    return bgfx_destroy_uniform_block(_handle);
+}
+extern fn bgfx_destroy_uniform_block(_handle: UniformBlockHandle) void;
+
 /// Create occlusion query.
 pub inline fn createOcclusionQuery() OcclusionQueryHandle {
     return bgfx_create_occlusion_query();
@@ -2763,6 +3035,7 @@ pub inline fn createOcclusionQuery() OcclusionQueryHandle {
 extern fn bgfx_create_occlusion_query() OcclusionQueryHandle;
 
 /// Retrieve occlusion query result from previous frame.
+/// With frames in flight result is `Init::limits.maxFramesInFlight - 1` frames old.
 /// <param name="_handle">Handle to occlusion query object.</param>
 /// <param name="_result">Number of pixels that passed test. This argument can be `NULL` if result of occlusion query is not needed.</param>
 pub inline fn getResult(_handle: OcclusionQueryHandle, _result: [*c]i32) OcclusionQueryResult {
@@ -2777,6 +3050,20 @@ pub inline fn destroyOcclusionQuery(_handle: OcclusionQueryHandle) void {
 }
 extern fn bgfx_destroy_occlusion_query(_handle: OcclusionQueryHandle) void;
 
+/// Create draw bundle. Draw calls recorded into draw bundle can be submitted many times
+/// without encoding them again.
+pub inline fn createDrawBundle() DrawBundleHandle {
+    return bgfx_create_draw_bundle();
+}
+extern fn bgfx_create_draw_bundle() DrawBundleHandle;
+
+/// Destroy draw bundle.
+/// <param name="_handle">Handle to draw bundle object.</param>
+pub inline fn destroyDrawBundle(_handle: DrawBundleHandle) void {
+    return bgfx_destroy_draw_bundle(_handle);
+}
+extern fn bgfx_destroy_draw_bundle(_handle: DrawBundleHandle) void;
+
 /// Set palette color value.
 /// <param name="_index">Index into palette.</param>
 /// <param name="_rgba">RGBA floating point values.</param>
@@ -2894,6 +3181,20 @@ pub inline fn setViewMode(_id: ViewId, _mode: ViewMode) void {
 }
 extern fn bgfx_set_view_mode(_id: ViewId, _mode: ViewMode) void;
 
+/// Set view multi-draw batching.
+/// When enabled, consecutive draw calls in view that differ only in transform, vertex
+/// offset and index range are submitted with a single multi-draw indirect call. Model
+/// transform of each draw call is passed to shader as instance data (`i_data0`-`i_data3`).
+/// @remarks
+///   Only used by renderers that support it, other renderers submit draw calls one by one.
+///   Only draw calls using program enabled with `bgfx::setProgramMultiDraw` are batched.
+/// <param name="_id">View id.</param>
+/// <param name="_enabled">Enable batching of consecutive compatible draw calls.</param>
+pub inline fn setViewMultiDraw(_id: ViewId, _enabled: bool) void {
+    return bgfx_set_view_multi_draw(_id, _enabled);
+}
+extern fn bgfx_set_view_multi_draw(_id: ViewId, _enabled: bool) void;
+
 /// Set view frame buffer.
 /// @remarks
 ///   Not persistent after `bgfx::reset` call.
@@ -3012,6 +3313,11 @@ extern fn bgfx_encoder_alloc_transform(self: ?*Encoder, _transform: [*c]Transfor
 /// <param name="_num">Number of elements. Passing `UINT16_MAX` will use the _num passed on uniform creation.</param>
 extern fn bgfx_encoder_set_uniform(self: ?*Encoder, _handle: UniformHandle, _value: ?*const anyopaque, _num: u16) void;
 
+/// Set uniform block data for draw primitive.
+/// <param name="_handle">Uniform block.</param>
+/// <param name="_data">Pointer to uniform block data.</param>
+extern fn bgfx_encoder_set_uniform_block(self: ?*Encoder, _handle: UniformBlockHandle, _data: ?*const anyopaque) void;
+
 /// Set index buffer for draw primitive.
 /// <param name="_handle">Index buffer.</param>
 /// <param name="_firstIndex">First index to render.</param>
@@ -3155,6 +3461,22 @@ extern fn bgfx_encoder_submit_indirect(self: ?*Encoder, _id: ViewId, _program: P
 /// <param name="_flags">Discard or preserve states. See `BGFX_DISCARD_*`.</param>
 extern fn bgfx_encoder_submit_indirect_count(self: ?*Encoder, _id: ViewId, _program: ProgramHandle, _indirectHandle: IndirectBufferHandle, _start: u32, _numHandle: IndexBufferHandle, _numIndex: u32, _numMax: u32, _depth: u32, _flags: u8) void;
 
+/// Begin recording draw calls into draw bundle. Draw calls submitted until `endDrawBundle`
+/// are recorded into bundle instead of being submitted to view. Previous bundle content is
+/// discarded.
+/// @attention Compute dispatches, occlusion queries, and conditional rendering are not recorded. Draw calls using transient index/vertex buffers or instance data buffers are dropped. Bundle doesn't keep referenced resources alive, they must outlive bundle or bundle must be recorded again. Draw calls referencing destroyed resources are dropped when bundle is submitted.
+/// <param name="_handle">Draw bundle.</param>
+extern fn bgfx_encoder_begin_draw_bundle(self: ?*Encoder, _handle: DrawBundleHandle) void;
+
+/// End recording draw calls into draw bundle.
+extern fn bgfx_encoder_end_draw_bundle(self: ?*Encoder) void;
+
+/// Submit all draw calls recorded in draw bundle.
+/// <param name="_id">View id.</param>
+/// <param name="_handle">Draw bundle.</param>
+/// <param name="_mtx">Transform matrix replacing transforms recorded with draw calls, or NULL to use recorded transforms.</param>
+extern fn bgfx_encoder_submit_draw_bundle(self: ?*Encoder, _id: ViewId, _handle: DrawBundleHandle, _mtx: ?*const anyopaque) void;
+
 /// Set compute index buffer.
 /// <param name="_stage">Compute stage.</param>
 /// <param name="_handle">Index buffer handle.</param>
@@ -3245,6 +3567,35 @@ pub inline fn requestScreenShot(_handle: FrameBufferHandle, _filePath: [*c]const
 }
 extern fn bgfx_request_screen_shot(_handle: FrameBufferHandle, _filePath: [*c]const u8) void;
 
+/// Write recorded profiler scopes in Chrome trace event JSON format.
+/// <param name="_filePath">Output file path.</param>
+/// <param name="_numFrames">Number of most recent frames to write. Use 0 to write all recorded events.</param>
+pub inline fn saveProfilerTrace(_filePath: [*c]const u8, _numFrames: u16) u32 {
+    return bgfx_save_profiler_trace(_filePath, _numFrames);
+}
+extern fn bgfx_save_profiler_trace(_filePath: [*c]const u8, _numFrames: u16) u32;
+
+/// Start capturing frames, as they are received by render thread, into file.
+/// <param name="_filePath">Capture file path.</param>
+pub inline fn startFrameCapture(_filePath: [*c]const u8) bool {
+    return bgfx_start_frame_capture(_filePath);
+}
+extern fn bgfx_start_frame_capture(_filePath: [*c]const u8) bool;
+
+/// Stop capturing frames, capture file is closed after current frame is rendered.
+pub inline fn stopFrameCapture() void {
+    return bgfx_stop_frame_capture();
+}
+extern fn bgfx_stop_frame_capture() void;
+
+/// Replay captured frames. Each following frame renders next captured frame instead of frame
+/// submitted by application.
+/// <param name="_filePath">Capture file path.</param>
+pub inline fn startFrameReplay(_filePath: [*c]const u8) u32 {
+    return bgfx_start_frame_replay(_filePath);
+}
+extern fn bgfx_start_frame_replay(_filePath: [*c]const u8) u32;
+
 /// Render frame.
 /// @attention `bgfx::renderFrame` is blocking call. It waits for
 ///   `bgfx::frame` to be called from API thread to process frame.
@@ -3405,6 +3756,14 @@ pub inline fn setUniform(_handle: UniformHandle, _value: ?*const anyopaque, _num
 }
 extern fn bgfx_set_uniform(_handle: UniformHandle, _value: ?*const anyopaque, _num: u16) void;
 
+/// Set uniform block data for draw primitive.
+/// <param name="_handle">Uniform block.</param>
+/// <param name="_data">Pointer to uniform block data.</param>
+pub inline fn setUniformBlock(_handle: UniformBlockHandle, _data: ?*const anyopaque) void {
+    return bgfx_set_uniform_block(_handle, _data);
+}
+extern fn bgfx_set_uniform_block(_handle: UniformBlockHandle, _data: ?*const anyopaque) void;
+
 /// Set index buffer for draw primitive.
 /// <param name="_handle">Index buffer.</param>
 /// <param name="_firstIndex">First index to render.</param>
@@ -3612,6 +3971,31 @@ pub inline fn submitIndirectCount(_id: ViewId, _program: ProgramHandle, _indirec
 }
 extern fn bgfx_submit_indirect_count(_id: ViewId, _program: ProgramHandle, _indirectHandle: IndirectBufferHandle, _start: u32, _numHandle: IndexBufferHandle, _numIndex: u32, _numMax: u32, _depth: u32, _flags: u8) void;
 
+/// Begin recording draw calls into draw bundle. Draw calls submitted until `endDrawBundle`
+/// are recorded into bundle instead of being submitted to view. Previous bundle content is
+/// discarded.
+/// @attention Compute dispatches, occlusion queries, and conditional rendering are not recorded. Draw calls using transient index/vertex buffers or instance data buffers are dropped. Bundle doesn't keep referenced resources alive, they must outlive bundle or bundle must be recorded again. Draw calls referencing destroyed resources are dropped when bundle is submitted.
+/// <param name="_handle">Draw bundle.</param>
+pub inline fn beginDrawBundle(_handle: DrawBundleHandle) void {
+    return bgfx_begin_draw_bundle(_handle);
+}
+extern fn bgfx_begin_draw_bundle(_handle: DrawBundleHandle) void;
+
+/// End recording draw calls into draw bundle.
+pub inline fn endDrawBundle() void {
+    return bgfx_end_draw_bundle();
+}
+extern fn bgfx_end_draw_bundle() void;
+
+/// Submit all draw calls recorded in draw bundle.
+/// <param name="_id">View id.</param>
+/// <param name="_handle">Draw bundle.</param>
+/// <param name="_mtx">Transform matrix replacing transforms recorded with draw calls, or NULL to use recorded transforms.</param>
+pub inline fn submitDrawBundle(_id: ViewId, _handle: DrawBundleHandle, _mtx: ?*const anyopaque) void {
+    return bgfx_submit_draw_bundle(_id, _handle, _mtx);
+}
+extern fn bgfx_submit_draw_bundle(_id: ViewId, _handle: DrawBundleHandle, _mtx: ?*const anyopaque) void;
+
 /// Set compute index buffer.
 /// <param name="_stage">Compute stage.</param>
 /// <param name="_handle">Index buffer handle.</param>
@@ -129,6 +129,7 @@ public:
 		bgfx::Init init;
 		init.type     = args.m_type;
 		init.vendorId = args.m_pciId;
+		init.limits.numRecordThreads = args.m_numRecordThreads;
 		init.platformData.nwh  = entry::getNativeWindowHandle(entry::kDefaultWindowHandle);
 		init.platformData.ndt  = entry::getNativeDisplayHandle();
 		init.platformData.type = entry::getNativeWindowHandleType();
@@ -95,7 +95,6 @@ public:
 
 		m_highlighted = UINT32_MAX;
 		m_reading = 0;
-		m_currFrame = UINT32_MAX;
 		m_fov = 3.0f;
 		m_cameraSpin = false;
 
@@ -324,7 +323,8 @@ public:
 
 				// If the user previously clicked, and we're done reading data from GPU, look at ID buffer on CPU
 				// Whatever mesh has the most pixels in the ID buffer is the one the user clicked on.
-				if (m_reading == m_currFrame)
+				if (0 != m_reading
+				&&  bgfx::isReadbackComplete(m_reading) )
 				{
 					m_reading = 0;
 					std::map<uint32_t, uint32_t> ids;  // This contains all the IDs found in the buffer
@@ -386,7 +386,7 @@ public:
 				{
 					// Blit and read
 					bgfx::blit(RENDER_PASS_BLIT, m_blitTex, 0, 0, m_pickingRT);
-					m_reading = bgfx::readTexture(m_blitTex, m_blitData);
+					m_reading = bgfx::readTextureAsync(m_blitTex, m_blitData);
 				}
 			}
 
@@ -394,7 +394,7 @@ public:
 
 			// Advance to next frame. Rendering thread will be kicked to
 			// process submitted rendering primitives.
-			m_currFrame = bgfx::frame();
+			bgfx::frame();
 
 			return true;
 		}
@@ -429,7 +429,6 @@ public:
 	uint8_t m_blitData[ID_DIM*ID_DIM * 4]; // Read blit into this
 
 	uint32_t m_reading;
-	uint32_t m_currFrame;
 
 	float m_fov;
 	bool  m_cameraSpin;
@@ -750,6 +750,7 @@ bgfx::RendererType::Enum getType(const bx::StringView& _name)
 Args::Args(int _argc, const char* const* _argv)
 	: m_type(bgfx::RendererType::Count)
 	, m_pciId(BGFX_PCI_ID_NONE)
+	, m_numRecordThreads(0)
 {
 	bx::CommandLine cmdLine(_argc, (const char**)_argv);
 
@@ -797,4 +798,6 @@ Args::Args(int _argc, const char* const* _argv)
 	{
 		m_pciId = BGFX_PCI_ID_SOFTWARE_RASTERIZER;
 	}
+
+	cmdLine.hasArg(m_numRecordThreads, '\0', "record-threads");
 }
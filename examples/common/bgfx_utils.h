@@ -159,6 +159,7 @@ struct Args
 
 	bgfx::RendererType::Enum m_type;
 	uint16_t m_pciId;
+	uint32_t m_numRecordThreads;
 };
 
 #endif // BGFX_UTILS_H_HEADER_GUARD
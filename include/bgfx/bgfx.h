@@ -398,6 +398,7 @@ namespace bgfx
 			Sequential,      //!< Sort in the same order in which submit calls were called.
 			DepthAscending,  //!< Sort draw call depth in ascending order.
 			DepthDescending, //!< Sort draw call depth in descending order.
+			State,           //!< Sort by program, binding set, and render state to minimize state changes.
 
 			Count
 		};
@@ -421,6 +422,7 @@ namespace bgfx
 
 	static const uint16_t kInvalidHandle = UINT16_MAX;
 
+	BGFX_HANDLE(DrawBundleHandle)
 	BGFX_HANDLE(DynamicIndexBufferHandle)
 	BGFX_HANDLE(DynamicVertexBufferHandle)
 	BGFX_HANDLE(FrameBufferHandle)
@@ -430,6 +432,7 @@ namespace bgfx
 	BGFX_HANDLE(ProgramHandle)
 	BGFX_HANDLE(ShaderHandle)
 	BGFX_HANDLE(TextureHandle)
+	BGFX_HANDLE(UniformBlockHandle)
 	BGFX_HANDLE(UniformHandle)
 	BGFX_HANDLE(VertexBufferHandle)
 	BGFX_HANDLE(VertexLayoutHandle)
@@ -697,8 +700,9 @@ namespace bgfx
 
 		uint64_t capabilities; //!< Capabilities initialization mask (default: UINT64_MAX).
 
-		bool debug;   //!< Enable device for debugging.
-		bool profile; //!< Enable device for profiling.
+		bool debug;        //!< Enable device for debugging.
+		bool profile;      //!< Enable device for profiling.
+		bool noopCounting; //!< Enable state change counting in Noop renderer.
 
 		/// Platform data.
 		PlatformData platformData;
@@ -718,6 +722,13 @@ namespace bgfx
 			uint32_t minResourceCbSize; //!< Minimum resource command buffer size.
 			uint32_t transientVbSize;   //!< Maximum transient vertex buffer size.
 			uint32_t transientIbSize;   //!< Maximum transient index buffer size.
+			uint32_t numSortThreads;    //!< Number of sort worker threads.
+			uint32_t numRecordThreads;  //!< Number of recording worker threads.
+			uint32_t numDecodeThreads;  //!< Number of texture decode worker threads.
+			uint32_t maxDrawCalls;      //!< Maximum number of draw calls.
+			uint32_t maxFramesInFlight;      //!< Maximum number of frames submitted ahead of render thread, occlusion query results lag by N-1 frames.
+			uint64_t textureStreamingBudget; //!< Streaming texture memory budget in bytes, 0 is unlimited.
+			uint32_t uploadBudget;           //!< Resource upload budget in bytes per frame, 0 disables upload queue.
 		};
 
 		Limits limits; //!< Configurable runtime limits.
@@ -755,6 +766,29 @@ namespace bgfx
 		uint32_t size; //!< Data size.
 	};
 
+	/// Streaming texture mip read callback. It's called from internal streaming thread.
+	///
+	/// param[in] _mip Mip level.
+	/// param[in] _userData User defined data passed to `bgfx::createTextureStreaming`.
+	///
+	/// @returns Mip data obtained by calling `bgfx::alloc`, `bgfx::copy`, or `bgfx::makeRef`,
+	///   or NULL if mip can't be read.
+	///
+	/// @attention C99's equivalent binding is `bgfx_texture_mip_read_fn_t`.
+	///
+	typedef const Memory* (*TextureMipReadFn)(uint8_t _mip, void* _userData);
+
+	/// Readback completion callback. It's called from render thread.
+	///
+	/// param[in] _data Destination buffer with read back data, or NULL if buffer read back
+	///   is not supported by renderer (OpenGL ES 2.0 without `EXT_map_buffer_range`,
+	///   WebGL 1.0, and Noop renderer).
+	/// param[in] _userData User defined data passed to `bgfx::readTextureAsync` or `bgfx::readBuffer`.
+	///
+	/// @attention C99's equivalent binding is `bgfx_readback_fn_t`.
+	///
+	typedef void (*ReadbackFn)(void* _data, void* _userData);
+
 	/// Renderer capabilities.
 	///
 	/// @attention C99's equivalent binding is `bgfx_caps_t`.
@@ -814,10 +848,15 @@ namespace bgfx
 			uint32_t maxDynamicVertexBuffers; //!< Maximum number of dynamic vertex buffer handles.
 			uint32_t maxUniforms;             //!< Maximum number of uniform handles.
 			uint32_t maxOcclusionQueries;     //!< Maximum number of occlusion query handles.
+			uint32_t maxDrawBundles;          //!< Maximum number of draw bundle handles.
 			uint32_t maxEncoders;             //!< Maximum number of encoder threads.
 			uint32_t minResourceCbSize;       //!< Minimum resource command buffer size.
 			uint32_t transientVbSize;         //!< Maximum transient vertex buffer size.
 			uint32_t transientIbSize;         //!< Maximum transient index buffer size.
+			uint32_t numSortThreads;          //!< Number of sort worker threads.
+			uint32_t numRecordThreads;        //!< Number of recording worker threads.
+			uint32_t numDecodeThreads;        //!< Number of texture decode worker threads.
+			uint32_t maxFramesInFlight;       //!< Maximum number of frames submitted ahead of render thread.
 		};
 
 		Limits limits; //!< Renderer runtime limits.
@@ -968,13 +1007,16 @@ namespace bgfx
 	///
 	struct ViewStats
 	{
-		char     name[256];      //!< View name.
-		ViewId   view;           //!< View id.
-		int64_t  cpuTimeBegin;   //!< CPU (submit) begin time.
-		int64_t  cpuTimeEnd;     //!< CPU (submit) end time.
-		int64_t  gpuTimeBegin;   //!< GPU begin time.
-		int64_t  gpuTimeEnd;     //!< GPU end time.
-		uint32_t gpuFrameNum;    //!< Frame which generated gpuTimeBegin, gpuTimeEnd.
+		char     name[256];         //!< View name.
+		ViewId   view;              //!< View id.
+		int64_t  cpuTimeBegin;      //!< CPU (submit) begin time.
+		int64_t  cpuTimeEnd;        //!< CPU (submit) end time.
+		int64_t  gpuTimeBegin;      //!< GPU begin time.
+		int64_t  gpuTimeEnd;        //!< GPU end time.
+		uint32_t gpuFrameNum;       //!< Frame which generated gpuTimeBegin, gpuTimeEnd.
+		uint32_t numStateChanges;   //!< Number of render state changes.
+		uint32_t numProgramChanges; //!< Number of program changes.
+		uint32_t numBindChanges;    //!< Number of binding set changes.
 	};
 
 	/// Encoder stats.
@@ -1007,12 +1049,28 @@ namespace bgfx
 		int64_t waitRender;                 //!< Time spent waiting for render backend thread to finish issuing
 		                                    //!  draw commands to underlying graphics API.
 		int64_t waitSubmit;                 //!< Time spent waiting for submit thread to advance to next frame.
+		uint32_t numFramesInFlight;         //!< Number of frames queued for render thread when frame was
+		                                    //!  submitted.
 
 		uint32_t numDraw;                   //!< Number of draw calls submitted.
 		uint32_t numCompute;                //!< Number of compute calls submitted.
 		uint32_t numBlit;                   //!< Number of blit calls submitted.
 		uint32_t maxGpuLatency;             //!< GPU driver latency.
 		uint32_t gpuFrameNum;               //!< Frame which generated gpuTimeBegin, gpuTimeEnd.
+		uint32_t numTransformsDropped;      //!< Number of transform matrices that didn't fit into matrix cache.
+		uint32_t numScissorsDropped;        //!< Number of scissor rects that didn't fit into rect cache.
+		uint32_t numDrawsDropped;           //!< Number of draw calls that didn't fit into frame (max draw calls).
+		uint32_t numPendingSkipped;         //!< Number of draw calls, compute dispatches and blits skipped because resources are waiting for upload.
+		uint32_t numPipelinesPending;       //!< Number of pipelines waiting for asynchronous compilation.
+		uint32_t numDrawsFallback;          //!< Number of draw calls submitted with fallback program.
+		uint32_t numDrawsSkipped;           //!< Number of draw calls skipped because pipeline wasn't ready.
+		uint32_t numMultiDraw;              //!< Number of multi-draw calls submitted.
+		uint32_t numMultiDrawItems;         //!< Number of draw calls batched into multi-draw calls.
+		uint32_t numStateChanges;           //!< Number of render state changes (counting Noop renderer).
+		uint32_t numProgramChanges;         //!< Number of program changes (counting Noop renderer).
+		uint32_t numBindChanges;            //!< Number of texture and buffer binding changes (counting Noop renderer).
+		uint32_t numUniformUpdates;         //!< Number of uniform updates (counting Noop renderer).
+		uint32_t numUniformRedundant;       //!< Number of uniform updates that did not change value (counting Noop renderer).
 
 		uint16_t numDynamicIndexBuffers;    //!< Number of used dynamic index buffers.
 		uint16_t numDynamicVertexBuffers;   //!< Number of used dynamic vertex buffers.
@@ -1028,8 +1086,17 @@ namespace bgfx
 
 		int64_t textureMemoryUsed;          //!< Estimate of texture memory used.
 		int64_t rtMemoryUsed;               //!< Estimate of render target memory used.
+		int64_t streamingMemoryUsed;        //!< Memory used by resident mips of streaming textures.
 		int32_t transientVbUsed;            //!< Amount of transient vertex buffer used.
 		int32_t transientIbUsed;            //!< Amount of transient index buffer used.
+		int64_t dynamicVbUsed;              //!< Amount of shared dynamic vertex buffer memory used.
+		int64_t dynamicVbFree;              //!< Amount of shared dynamic vertex buffer memory free.
+		int64_t dynamicVbLargestFree;       //!< Largest free block in shared dynamic vertex buffers.
+		int64_t dynamicIbUsed;              //!< Amount of shared dynamic index buffer memory used.
+		int64_t dynamicIbFree;              //!< Amount of shared dynamic index buffer memory free.
+		int64_t dynamicIbLargestFree;       //!< Largest free block in shared dynamic index buffers.
+		uint32_t numUploadsQueued;          //!< Number of resource uploads waiting in upload queue.
+		int64_t uploadQueueSize;            //!< Size of resource uploads waiting in upload queue.
 
 		uint32_t numPrims[Topology::Count]; //!< Number of primitives rendered.
 
@@ -1207,6 +1274,23 @@ namespace bgfx
 			, uint16_t _num = 1
 			);
 
+		/// Set uniform block data for draw primitive.
+		///
+		/// @param[in] _handle Uniform block.
+		/// @param[in] _data Pointer to uniform block data. Data is copied, and it must
+		///   be laid out as described in `bgfx::createUniformBlock`.
+		///
+		/// @remarks
+		///   Equivalent to calling `setUniform` for each uniform in block, but data is
+		///   copied once, and renderer doesn't have to decode each uniform separately.
+		///
+		/// @attention C99's equivalent binding is `bgfx_encoder_set_uniform_block`.
+		///
+		void setUniformBlock(
+			  UniformBlockHandle _handle
+			, const void* _data
+			);
+
 		/// Set index buffer for draw primitive.
 		///
 		/// @param[in] _handle Index buffer.
@@ -1557,6 +1641,43 @@ namespace bgfx
 			, uint8_t _flags = BGFX_DISCARD_ALL
 			);
 
+		/// Begin recording draw calls into draw bundle. Draw calls submitted until `endDrawBundle`
+		/// are recorded into bundle instead of being submitted to view. Previous bundle content is
+		/// discarded.
+		///
+		/// @param[in] _handle Draw bundle.
+		///
+		/// @attention Compute dispatches, occlusion queries, and conditional rendering are not
+		///   recorded. Draw calls using transient index/vertex buffers or instance data buffers
+		///   are dropped.
+		/// @attention Bundle doesn't keep referenced resources alive, they must outlive bundle or
+		///   bundle must be recorded again. Draw calls referencing destroyed resources are
+		///   dropped when bundle is submitted.
+		/// @attention C99's equivalent binding is `bgfx_encoder_begin_draw_bundle`.
+		///
+		void beginDrawBundle(DrawBundleHandle _handle);
+
+		/// End recording draw calls into draw bundle.
+		///
+		/// @attention C99's equivalent binding is `bgfx_encoder_end_draw_bundle`.
+		///
+		void endDrawBundle();
+
+		/// Submit all draw calls recorded in draw bundle.
+		///
+		/// @param[in] _id View id.
+		/// @param[in] _handle Draw bundle.
+		/// @param[in] _mtx Transform matrix replacing transforms recorded with draw calls, or
+		///   NULL to use recorded transforms.
+		///
+		/// @attention C99's equivalent binding is `bgfx_encoder_submit_draw_bundle`.
+		///
+		void submit(
+			  ViewId _id
+			, DrawBundleHandle _handle
+			, const void* _mtx = NULL
+			);
+
 		/// Set compute index buffer.
 		///
 		/// @param[in] _stage Compute stage.
@@ -2295,6 +2416,37 @@ namespace bgfx
 	///
 	void destroy(IndexBufferHandle _handle);
 
+	/// Set upload priority of resource waiting in upload queue.
+	///
+	/// @param[in] _handle Static index buffer handle.
+	/// @param[in] _priority Upload priority, higher priority uploads are issued first.
+	///
+	/// @remarks
+	///   Upload queue is enabled with `Init::Limits::uploadBudget`. Priority is kept until
+	///   resource is destroyed.
+	///
+	/// @attention C99's equivalent binding is `bgfx_set_index_buffer_upload_priority`.
+	///
+	void setUploadPriority(
+		  IndexBufferHandle _handle
+		, uint8_t _priority
+		);
+
+	/// Returns true if all uploads of resource were issued to renderer.
+	///
+	/// @param[in] _handle Static index buffer handle.
+	///
+	/// @returns True if resource is not waiting in upload queue.
+	///
+	/// @remarks
+	///   Memory passed with `bgfx::makeRef` to deferred create or update call must be kept
+	///   valid until resource is ready. Draw calls using resource which is not created yet
+	///   are skipped.
+	///
+	/// @attention C99's equivalent binding is `bgfx_is_index_buffer_ready`.
+	///
+	bool isReady(IndexBufferHandle _handle);
+
 	/// Create vertex layout.
 	///
 	/// @attention C99's equivalent binding is `bgfx_create_vertex_layout`.
@@ -2356,6 +2508,37 @@ namespace bgfx
 	///
 	void destroy(VertexBufferHandle _handle);
 
+	/// Set upload priority of resource waiting in upload queue.
+	///
+	/// @param[in] _handle Static vertex buffer handle.
+	/// @param[in] _priority Upload priority, higher priority uploads are issued first.
+	///
+	/// @remarks
+	///   Upload queue is enabled with `Init::Limits::uploadBudget`. Priority is kept until
+	///   resource is destroyed.
+	///
+	/// @attention C99's equivalent binding is `bgfx_set_vertex_buffer_upload_priority`.
+	///
+	void setUploadPriority(
+		  VertexBufferHandle _handle
+		, uint8_t _priority
+		);
+
+	/// Returns true if all uploads of resource were issued to renderer.
+	///
+	/// @param[in] _handle Static vertex buffer handle.
+	///
+	/// @returns True if resource is not waiting in upload queue.
+	///
+	/// @remarks
+	///   Memory passed with `bgfx::makeRef` to deferred create or update call must be kept
+	///   valid until resource is ready. Draw calls using resource which is not created yet
+	///   are skipped.
+	///
+	/// @attention C99's equivalent binding is `bgfx_is_vertex_buffer_ready`.
+	///
+	bool isReady(VertexBufferHandle _handle);
+
 	/// Create empty dynamic index buffer.
 	///
 	/// @param[in] _num Number of indices.
@@ -2714,6 +2897,72 @@ namespace bgfx
 	///
 	void destroy(ProgramHandle _handle);
 
+	/// Pre-create pipeline state object for program, vertex layout and render
+	/// state combination, so that the first draw call using it doesn't stall.
+	/// Pipeline is created against frame buffer currently assigned to view.
+	///
+	/// @param[in] _id View id.
+	/// @param[in] _program Program handle.
+	/// @param[in] _layout Vertex layout.
+	/// @param[in] _state State flags. See: `BGFX_STATE_*`.
+	/// @param[in] _fstencil Front stencil state.
+	/// @param[in] _bstencil Back stencil state. If back is set to `BGFX_STENCIL_NONE`
+	///   _fstencil is applied to both front and back facing primitives.
+	///
+	/// @remarks
+	///   Only renderers that build pipeline state objects (Vulkan) do work here,
+	///   on other renderers this call is no-op. Pipelines created this way are
+	///   persisted with the rest of the pipeline cache through `CallbackI::cacheWrite`.
+	///
+	/// @attention C99's equivalent binding is `bgfx_warm_pipeline`.
+	///
+	void warmPipeline(
+		  ViewId _id
+		, ProgramHandle _program
+		, const VertexLayout& _layout
+		, uint64_t _state = BGFX_STATE_DEFAULT
+		, uint32_t _fstencil = BGFX_STENCIL_NONE
+		, uint32_t _bstencil = BGFX_STENCIL_NONE
+		);
+
+	/// Set program used in place of draw call program while its pipeline is being
+	/// compiled asynchronously. See: `BGFX_RESET_ASYNC_PIPELINE`.
+	///
+	/// @param[in] _handle Program handle, or `BGFX_INVALID_HANDLE` to skip draw
+	///   calls instead.
+	///
+	/// @remarks
+	///   Fallback program must accept vertex layouts of draw calls it's substituted
+	///   for. Its own pipelines are compiled asynchronously too, use
+	///   `bgfx::warmPipeline` to have them ready ahead of time.
+	///
+	/// @attention C99's equivalent binding is `bgfx_set_fallback_program`.
+	///
+	void setFallbackProgram(ProgramHandle _handle);
+
+	/// Write pipeline cache through `CallbackI::cacheWrite` at the end of current
+	/// frame, instead of waiting for pipeline creation to go idle.
+	///
+	/// @remarks
+	///   Only Vulkan renderer has pipeline cache, it's no-op on other renderers.
+	///
+	/// @attention C99's equivalent binding is `bgfx_flush_pipeline_cache`.
+	///
+	void flushPipelineCache();
+
+	/// Enable multi-draw batching of draw calls using program. Program must read model
+	/// transform from instance data (`i_data0`-`i_data3`). See: `bgfx::setViewMultiDraw`.
+	///
+	/// @param[in] _handle Program handle.
+	/// @param[in] _enabled Allow draw calls using this program to be batched.
+	///
+	/// @attention C99's equivalent binding is `bgfx_set_program_multi_draw`.
+	///
+	void setProgramMultiDraw(
+		  ProgramHandle _handle
+		, bool _enabled
+		);
+
 	/// Validate texture parameters.
 	///
 	/// @param[in] _depth Depth dimension of volume texture.
@@ -3032,6 +3281,111 @@ namespace bgfx
 		, uint8_t _mip = 0
 		);
 
+	/// Read back texture content asynchronously. Result is available once copy is done,
+	/// instead of at fixed frame. Vulkan records copy into frame command buffer and writes
+	/// data once GPU executed it, without stalling render thread. Other renderers copy
+	/// synchronously on render thread. Tickets complete in order of submission.
+	///
+	/// @param[in] _handle Texture handle.
+	/// @param[in] _data Destination buffer.
+	/// @param[in] _mip Mip level.
+	/// @param[in] _readbackFn Callback function called from render thread once data is written.
+	/// @param[in] _userData User data passed to callback function.
+	///
+	/// @returns Readback ticket. See: `bgfx::isReadbackComplete`.
+	///
+	/// @attention Texture must be created with `BGFX_TEXTURE_READ_BACK` flag.
+	/// @attention Availability depends on: `BGFX_CAPS_TEXTURE_READ_BACK`.
+	/// @attention C99's equivalent binding is `bgfx_read_texture_async`.
+	///
+	uint32_t readTextureAsync(
+		  TextureHandle _handle
+		, void* _data
+		, uint8_t _mip = 0
+		, ReadbackFn _readbackFn = NULL
+		, void* _userData = NULL
+		);
+
+	/// Returns true once asynchronous readback has completed, and its data was written to
+	/// destination buffer.
+	///
+	/// @param[in] _ticket Readback ticket.
+	///
+	/// @returns True if readback has completed.
+	///
+	/// @attention C99's equivalent binding is `bgfx_is_readback_complete`.
+	///
+	bool isReadbackComplete(uint32_t _ticket);
+
+	/// Read back buffer content asynchronously. Data is copied after all draw and compute
+	/// calls of current frame are executed.
+	///
+	/// @param[in] _handle Dynamic index buffer handle.
+	/// @param[in] _offset Offset in bytes from start of buffer.
+	/// @param[in] _size Number of bytes to read.
+	/// @param[in] _data Destination buffer.
+	/// @param[in] _readbackFn Callback function called from render thread once data is written.
+	/// @param[in] _userData User data passed to callback function.
+	///
+	/// @returns Readback ticket. See: `bgfx::isReadbackComplete`.
+	///
+	/// @attention C99's equivalent binding is `bgfx_read_dynamic_index_buffer`.
+	///
+	uint32_t readBuffer(
+		  DynamicIndexBufferHandle _handle
+		, uint32_t _offset
+		, uint32_t _size
+		, void* _data
+		, ReadbackFn _readbackFn = NULL
+		, void* _userData = NULL
+		);
+
+	/// Read back buffer content asynchronously. Data is copied after all draw and compute
+	/// calls of current frame are executed.
+	///
+	/// @param[in] _handle Dynamic vertex buffer handle.
+	/// @param[in] _offset Offset in bytes from start of buffer.
+	/// @param[in] _size Number of bytes to read.
+	/// @param[in] _data Destination buffer.
+	/// @param[in] _readbackFn Callback function called from render thread once data is written.
+	/// @param[in] _userData User data passed to callback function.
+	///
+	/// @returns Readback ticket. See: `bgfx::isReadbackComplete`.
+	///
+	/// @attention C99's equivalent binding is `bgfx_read_dynamic_vertex_buffer`.
+	///
+	uint32_t readBuffer(
+		  DynamicVertexBufferHandle _handle
+		, uint32_t _offset
+		, uint32_t _size
+		, void* _data
+		, ReadbackFn _readbackFn = NULL
+		, void* _userData = NULL
+		);
+
+	/// Read back buffer content asynchronously. Data is copied after all draw and compute
+	/// calls of current frame are executed.
+	///
+	/// @param[in] _handle Indirect buffer handle.
+	/// @param[in] _offset Offset in bytes from start of buffer.
+	/// @param[in] _size Number of bytes to read.
+	/// @param[in] _data Destination buffer.
+	/// @param[in] _readbackFn Callback function called from render thread once data is written.
+	/// @param[in] _userData User data passed to callback function.
+	///
+	/// @returns Readback ticket. See: `bgfx::isReadbackComplete`.
+	///
+	/// @attention C99's equivalent binding is `bgfx_read_indirect_buffer`.
+	///
+	uint32_t readBuffer(
+		  IndirectBufferHandle _handle
+		, uint32_t _offset
+		, uint32_t _size
+		, void* _data
+		, ReadbackFn _readbackFn = NULL
+		, void* _userData = NULL
+		);
+
 	/// Set texture debug name.
 	///
 	/// @param[in] _handle Texture handle.
@@ -3071,6 +3425,100 @@ namespace bgfx
 	///
 	void destroy(TextureHandle _handle);
 
+	/// Set upload priority of resource waiting in upload queue.
+	///
+	/// @param[in] _handle Texture handle.
+	/// @param[in] _priority Upload priority, higher priority uploads are issued first.
+	///
+	/// @remarks
+	///   Upload queue is enabled with `Init::Limits::uploadBudget`. Priority is kept until
+	///   resource is destroyed.
+	///
+	/// @attention C99's equivalent binding is `bgfx_set_texture_upload_priority`.
+	///
+	void setUploadPriority(
+		  TextureHandle _handle
+		, uint8_t _priority
+		);
+
+	/// Returns true if all uploads of resource were issued to renderer.
+	///
+	/// @param[in] _handle Texture handle.
+	///
+	/// @returns True if resource is not waiting in upload queue.
+	///
+	/// @remarks
+	///   Memory passed with `bgfx::makeRef` to deferred create or update call must be kept
+	///   valid until resource is ready. Draw calls using resource which is not created yet
+	///   are skipped.
+	///
+	/// @remarks
+	///   Texture decoded on worker threads is not ready until it's decoded, which can take
+	///   multiple frames.
+	///
+	/// @attention C99's equivalent binding is `bgfx_is_texture_ready`.
+	///
+	bool isReady(TextureHandle _handle);
+
+	/// Create streaming 2D texture with full mip-map chain. Only tail mips are resident
+	/// after creation, finer mips are read with `_readFn` once they are requested with
+	/// `bgfx::setTextureDesiredMip`.
+	///
+	/// @param[in] _width Width.
+	/// @param[in] _height Height.
+	/// @param[in] _format Texture format. See: `TextureFormat::Enum`.
+	/// @param[in] _flags Texture creation (see `BGFX_TEXTURE_*`.), and sampler (see `BGFX_SAMPLER_*`) flags.
+	/// @param[in] _readFn Callback function to read texture mip.
+	/// @param[in] _userData User data passed to callback function.
+	///
+	/// @returns Texture handle.
+	///
+	/// @remarks
+	///   Tail mips are read during this call, finer mips are read on internal streaming
+	///   thread, and changes are applied by `bgfx::frame` once they are read. Callback must
+	///   not call bgfx API other than `bgfx::alloc`, `bgfx::copy`, and `bgfx::makeRef`.
+	///
+	/// @remarks
+	///   When renderer supports `BGFX_CAPS_TEXTURE_BLIT` only mips that become resident are
+	///   read, otherwise resident mips are read again each time residency changes.
+	///
+	/// @remarks
+	///   Mips are evicted when they are not desired anymore, or when resident mips of all
+	///   streaming textures don't fit into `Init::Limits::textureStreamingBudget`.
+	///
+	/// @attention C99's equivalent binding is `bgfx_create_texture_streaming`.
+	///
+	TextureHandle createTextureStreaming(
+		  uint16_t _width
+		, uint16_t _height
+		, TextureFormat::Enum _format
+		, uint64_t _flags
+		, TextureMipReadFn _readFn
+		, void* _userData
+		);
+
+	/// Set finest mip of streaming texture that application wants to be resident.
+	///
+	/// @param[in] _handle Streaming texture handle.
+	/// @param[in] _mip Finest mip that should be resident.
+	///
+	/// @attention C99's equivalent binding is `bgfx_set_texture_desired_mip`.
+	///
+	void setTextureDesiredMip(
+		  TextureHandle _handle
+		, uint8_t _mip
+		);
+
+	/// Returns finest resident mip of streaming texture.
+	///
+	/// @param[in] _handle Texture handle.
+	///
+	/// @returns Finest resident mip. For regular texture it's always 0.
+	///
+	/// @attention C99's equivalent binding is `bgfx_get_texture_resident_mip`.
+	///
+	uint8_t getTextureResidentMip(TextureHandle _handle);
+
 	/// Create frame buffer (simple).
 	///
 	/// @param[in] _width Texture width.
@@ -3275,6 +3723,40 @@ namespace bgfx
 	///
 	void destroy(UniformHandle _handle);
 
+	/// Create uniform block.
+	///
+	/// @param[in] _uniforms Uniforms in block, in order they are laid out in block data.
+	/// @param[in] _num Number of uniforms.
+	///
+	/// @returns Handle to uniform block object.
+	///
+	/// @remarks
+	///   Uniform block data sets values of all uniforms in block with single call, and
+	///   is laid out std140-style: uniforms are tightly packed in order they are passed,
+	///   each element of uniform array takes:
+	///   - `UniformType::Vec4` - 16 bytes.
+	///   - `UniformType::Mat3` - 48 bytes, three columns, each padded to 16 bytes.
+	///   - `UniformType::Mat4` - 64 bytes.
+	///
+	///   Number of elements is `_num` passed on uniform creation. Sampler uniforms can't
+	///   be part of uniform block. Uniform block holds reference to its uniforms, they
+	///   can be destroyed before uniform block.
+	///
+	/// @attention C99's equivalent binding is `bgfx_create_uniform_block`.
+	///
+	UniformBlockHandle createUniformBlock(
+		  const UniformHandle* _uniforms
+		, uint16_t _num
+		);
+
+	/// Destroy uniform block.
+	///
+	/// @param[in] _handle Handle to uniform block object.
+	///
+	/// @attention C99's equivalent binding is `bgfx_destroy_uniform_block`.
+	///
+	void destroy(UniformBlockHandle _handle);
+
 	/// Create occlusion query.
 	///
 	/// @returns Handle to occlusion query object.
@@ -3284,6 +3766,7 @@ namespace bgfx
 	OcclusionQueryHandle createOcclusionQuery();
 
 	/// Retrieve occlusion query result from previous frame.
+	/// With frames in flight result is `Init::limits.maxFramesInFlight - 1` frames old.
 	///
 	/// @param[in] _handle Handle to occlusion query object.
 	/// @param[out] _result Number of pixels that passed test. This argument
@@ -3305,6 +3788,23 @@ namespace bgfx
 	///
 	void destroy(OcclusionQueryHandle _handle);
 
+	/// Create draw bundle. Draw calls recorded into draw bundle can be submitted many times
+	/// without encoding them again.
+	///
+	/// @returns Handle to draw bundle object.
+	///
+	/// @attention C99's equivalent binding is `bgfx_create_draw_bundle`.
+	///
+	DrawBundleHandle createDrawBundle();
+
+	/// Destroy draw bundle.
+	///
+	/// @param[in] _handle Handle to draw bundle object.
+	///
+	/// @attention C99's equivalent binding is `bgfx_destroy_draw_bundle`.
+	///
+	void destroy(DrawBundleHandle _handle);
+
 	/// Set palette color value.
 	///
 	/// @param[in] _index Index into palette.
@@ -3496,6 +3996,26 @@ namespace bgfx
 		, ViewMode::Enum _mode = ViewMode::Default
 		);
 
+	/// Set view multi-draw batching.
+	///
+	/// When enabled, consecutive draw calls in view that differ only in transform, vertex
+	/// offset and index range are submitted with a single multi-draw indirect call. Model
+	/// transform of each draw call is passed to shader as instance data (`i_data0`-`i_data3`).
+	///
+	/// @param[in] _id View id.
+	/// @param[in] _enabled Enable batching of consecutive compatible draw calls.
+	///
+	/// @remarks
+	///   Only used by renderers that support it, other renderers submit draw calls one by one.
+	///   Only draw calls using program enabled with `bgfx::setProgramMultiDraw` are batched.
+	///
+	/// @attention C99's equivalent binding is `bgfx_set_view_multi_draw`.
+	///
+	void setViewMultiDraw(
+		  ViewId _id
+		, bool _enabled
+		);
+
 	/// Set view frame buffer.
 	///
 	/// @param[in] _id View id.
@@ -3703,6 +4223,23 @@ namespace bgfx
 		, uint16_t _num = 1
 		);
 
+	/// Set uniform block data for draw primitive.
+	///
+	/// @param[in] _handle Uniform block.
+	/// @param[in] _data Pointer to uniform block data. Data is copied, and it must
+	///   be laid out as described in `bgfx::createUniformBlock`.
+	///
+	/// @remarks
+	///   Equivalent to calling `setUniform` for each uniform in block, but data is
+	///   copied once, and renderer doesn't have to decode each uniform separately.
+	///
+	/// @attention C99's equivalent binding is `bgfx_set_uniform_block`.
+	///
+	void setUniformBlock(
+		  UniformBlockHandle _handle
+		, const void* _data
+		);
+
 	/// Set index buffer for draw primitive.
 	///
 	/// @param[in] _handle Index buffer.
@@ -4051,6 +4588,43 @@ namespace bgfx
 		, uint8_t _flags = BGFX_DISCARD_ALL
 		);
 
+	/// Begin recording draw calls into draw bundle. Draw calls submitted until `endDrawBundle`
+	/// are recorded into bundle instead of being submitted to view. Previous bundle content is
+	/// discarded.
+	///
+	/// @param[in] _handle Draw bundle.
+	///
+	/// @attention Compute dispatches, occlusion queries, and conditional rendering are not
+	///   recorded. Draw calls using transient index/vertex buffers or instance data buffers
+	///   are dropped.
+	/// @attention Bundle doesn't keep referenced resources alive, they must outlive bundle or
+	///   bundle must be recorded again. Draw calls referencing destroyed resources are
+	///   dropped when bundle is submitted.
+	/// @attention C99's equivalent binding is `bgfx_begin_draw_bundle`.
+	///
+	void beginDrawBundle(DrawBundleHandle _handle);
+
+	/// End recording draw calls into draw bundle.
+	///
+	/// @attention C99's equivalent binding is `bgfx_end_draw_bundle`.
+	///
+	void endDrawBundle();
+
+	/// Submit all draw calls recorded in draw bundle.
+	///
+	/// @param[in] _id View id.
+	/// @param[in] _handle Draw bundle.
+	/// @param[in] _mtx Transform matrix replacing transforms recorded with draw calls, or
+	///   NULL to use recorded transforms.
+	///
+	/// @attention C99's equivalent binding is `bgfx_submit_draw_bundle`.
+	///
+	void submit(
+		  ViewId _id
+		, DrawBundleHandle _handle
+		, const void* _mtx = NULL
+		);
+
 	/// Set compute index buffer.
 	///
 	/// @param[in] _stage Compute stage.
@@ -4275,6 +4849,63 @@ namespace bgfx
 		, const char* _filePath
 		);
 
+	/// Write recorded profiler scopes in Chrome trace event JSON format.
+	///
+	/// @param[in] _filePath Output file path.
+	/// @param[in] _numFrames Number of most recent frames to write. Use 0 to write all
+	///   recorded events.
+	///
+	/// @returns Number of events written.
+	///
+	/// @remarks
+	///   Scopes are recorded from API, encoder, and render threads only when bgfx is
+	///   compiled with `BGFX_CONFIG_PROFILER=1`. Output can be loaded in
+	///   `chrome://tracing` or Perfetto.
+	///
+	/// @attention C99's equivalent binding is `bgfx_save_profiler_trace`.
+	///
+	uint32_t saveProfilerTrace(
+		  const char* _filePath
+		, uint16_t _numFrames = 0
+		);
+
+	/// Start capturing frames, as they are received by render thread, into file.
+	///
+	/// @param[in] _filePath Capture file path.
+	///
+	/// @returns True if capture file is created.
+	///
+	/// @remarks
+	///   Capture starts with frame currently being submitted, resources created before that
+	///   frame are not captured. Capture file can be replayed only by the same build of bgfx.
+	///
+	/// @attention C99's equivalent binding is `bgfx_start_frame_capture`.
+	///
+	bool startFrameCapture(const char* _filePath);
+
+	/// Stop capturing frames, capture file is closed after current frame is rendered.
+	///
+	/// @attention C99's equivalent binding is `bgfx_stop_frame_capture`.
+	///
+	void stopFrameCapture();
+
+	/// Replay captured frames. Each following frame renders next captured frame instead of frame
+	/// submitted by application.
+	///
+	/// @param[in] _filePath Capture file path.
+	///
+	/// @returns Number of frames to replay, 0 if capture file is not compatible.
+	///
+	/// @remarks
+	///   Resources of application frames are still created and destroyed. Captured resources use
+	///   the same handles as in capturing session, application replaying frames shouldn't create
+	///   its own resources. Shaders are not portable between renderers, capture can be replayed
+	///   by the same renderer type, or by `RendererType::Noop`.
+	///
+	/// @attention C99's equivalent binding is `bgfx_start_frame_replay`.
+	///
+	uint32_t startFrameReplay(const char* _filePath);
+
 } // namespace bgfx
 
 #endif // BGFX_H_HEADER_GUARD
@@ -384,6 +384,7 @@ typedef enum bgfx_view_mode
     BGFX_VIEW_MODE_SEQUENTIAL,                /** ( 1) Sort in the same order in which submit calls were called. */
     BGFX_VIEW_MODE_DEPTH_ASCENDING,           /** ( 2) Sort draw call depth in ascending order. */
     BGFX_VIEW_MODE_DEPTH_DESCENDING,          /** ( 3) Sort draw call depth in descending order. */
+    BGFX_VIEW_MODE_STATE,                     /** ( 4) Sort by program, binding set, and render state to minimize state changes. */
 
     BGFX_VIEW_MODE_COUNT
 
@@ -463,6 +464,8 @@ typedef struct bgfx_callback_vtbl_s
 
 } bgfx_callback_vtbl_t;
 
+typedef struct bgfx_draw_bundle_handle_s { uint16_t idx; } bgfx_draw_bundle_handle_t;
+
 typedef struct bgfx_dynamic_index_buffer_handle_s { uint16_t idx; } bgfx_dynamic_index_buffer_handle_t;
 
 typedef struct bgfx_dynamic_vertex_buffer_handle_s { uint16_t idx; } bgfx_dynamic_vertex_buffer_handle_t;
@@ -481,6 +484,8 @@ typedef struct bgfx_shader_handle_s { uint16_t idx; } bgfx_shader_handle_t;
 
 typedef struct bgfx_texture_handle_s { uint16_t idx; } bgfx_texture_handle_t;
 
+typedef struct bgfx_uniform_block_handle_s { uint16_t idx; } bgfx_uniform_block_handle_t;
+
 typedef struct bgfx_uniform_handle_s { uint16_t idx; } bgfx_uniform_handle_t;
 
 typedef struct bgfx_vertex_buffer_handle_s { uint16_t idx; } bgfx_vertex_buffer_handle_t;
@@ -499,6 +504,26 @@ typedef struct bgfx_vertex_layout_handle_s { uint16_t idx; } bgfx_vertex_layout_
  */
 typedef void (*bgfx_release_fn_t)(void* _ptr, void* _userData);
 
+/**
+ * Streaming texture mip read callback.
+ *
+ * @param[in] _mip Mip level.
+ * @param[in] _userData User defined data if needed.
+ *
+ */
+typedef const struct bgfx_memory_s* (*bgfx_texture_mip_read_fn_t)(uint8_t _mip, void* _userData);
+
+/**
+ * Readback completion callback.
+ *
+ * @param[in] _data Destination buffer with read back data, or NULL if buffer read back
+ *  is not supported by renderer (OpenGL ES 2.0 without `EXT_map_buffer_range`,
+ *  WebGL 1.0, and Noop renderer).
+ * @param[in] _userData User defined data if needed.
+ *
+ */
+typedef void (*bgfx_readback_fn_t)(void* _data, void* _userData);
+
 /**
  * GPU info.
  *
@@ -536,10 +561,15 @@ typedef struct bgfx_caps_limits_s
     uint32_t             maxDynamicVertexBuffers; /** Maximum number of dynamic vertex buffer handles. */
     uint32_t             maxUniforms;        /** Maximum number of uniform handles.       */
     uint32_t             maxOcclusionQueries; /** Maximum number of occlusion query handles. */
+    uint32_t             maxDrawBundles;      /** Maximum number of draw bundle handles.     */
     uint32_t             maxEncoders;        /** Maximum number of encoder threads.       */
     uint32_t             minResourceCbSize;  /** Minimum resource command buffer size.    */
     uint32_t             transientVbSize;    /** Maximum transient vertex buffer size.    */
     uint32_t             transientIbSize;    /** Maximum transient index buffer size.     */
+    uint32_t             numSortThreads;     /** Number of sort worker threads.           */
+    uint32_t             numRecordThreads;   /** Number of recording worker threads.      */
+    uint32_t             numDecodeThreads;   /** Number of texture decode worker threads. */
+    uint32_t             maxFramesInFlight;  /** Maximum number of frames submitted ahead of render thread, occlusion query results lag by N-1 frames. */
 
 } bgfx_caps_limits_t;
 
@@ -665,6 +695,13 @@ typedef struct bgfx_init_limits_s
     uint32_t             minResourceCbSize;  /** Minimum resource command buffer size.    */
     uint32_t             transientVbSize;    /** Maximum transient vertex buffer size.    */
     uint32_t             transientIbSize;    /** Maximum transient index buffer size.     */
+    uint32_t             numSortThreads;     /** Number of sort worker threads.           */
+    uint32_t             numRecordThreads;   /** Number of recording worker threads.      */
+    uint32_t             numDecodeThreads;   /** Number of texture decode worker threads. */
+    uint32_t             maxDrawCalls;       /** Maximum number of draw calls.            */
+    uint32_t             maxFramesInFlight;  /** Maximum number of frames submitted ahead of render thread. */
+    uint64_t             textureStreamingBudget; /** Streaming texture memory budget in bytes, 0 is unlimited. */
+    uint32_t             uploadBudget;       /** Resource upload budget in bytes per frame, 0 disables upload queue. */
 
 } bgfx_init_limits_t;
 
@@ -703,6 +740,7 @@ typedef struct bgfx_init_s
     uint64_t             capabilities;       /** Capabilities initialization mask (default: UINT64_MAX). */
     bool                 debug;              /** Enable device for debugging.             */
     bool                 profile;            /** Enable device for profiling.             */
+    bool                 noopCounting;       /** Enable state change counting in Noop renderer. */
     bgfx_platform_data_t platformData;       /** Platform data.                           */
     bgfx_resolution_t    resolution;         /** Backbuffer resolution and reset parameters. See: `bgfx::Resolution`. */
     bgfx_init_limits_t   limits;             /** Configurable runtime limits parameters.  */
@@ -847,6 +885,9 @@ typedef struct bgfx_view_stats_s
     int64_t              gpuTimeBegin;       /** GPU begin time.                          */
     int64_t              gpuTimeEnd;         /** GPU end time.                            */
     uint32_t             gpuFrameNum;        /** Frame which generated gpuTimeBegin, gpuTimeEnd. */
+    uint32_t             numStateChanges;    /** Number of render state changes.          */
+    uint32_t             numProgramChanges;  /** Number of program changes.               */
+    uint32_t             numBindChanges;     /** Number of binding set changes.           */
 
 } bgfx_view_stats_t;
 
@@ -878,11 +919,26 @@ typedef struct bgfx_stats_s
     int64_t              gpuTimerFreq;       /** GPU timer frequency.                     */
     int64_t              waitRender;         /** Time spent waiting for render backend thread to finish issuing draw commands to underlying graphics API. */
     int64_t              waitSubmit;         /** Time spent waiting for submit thread to advance to next frame. */
+    uint32_t             numFramesInFlight;  /** Number of frames queued for render thread when frame was submitted. */
     uint32_t             numDraw;            /** Number of draw calls submitted.          */
     uint32_t             numCompute;         /** Number of compute calls submitted.       */
     uint32_t             numBlit;            /** Number of blit calls submitted.          */
     uint32_t             maxGpuLatency;      /** GPU driver latency.                      */
     uint32_t             gpuFrameNum;        /** Frame which generated gpuTimeBegin, gpuTimeEnd. */
+    uint32_t             numTransformsDropped; /** Number of transform matrices that didn't fit into matrix cache. */
+    uint32_t             numScissorsDropped; /** Number of scissor rects that didn't fit into rect cache. */
+    uint32_t             numDrawsDropped;    /** Number of draw calls that didn't fit into frame (max draw calls). */
+    uint32_t             numPendingSkipped;  /** Number of draw calls, compute dispatches and blits skipped because resources are waiting for upload. */
+    uint32_t             numPipelinesPending; /** Number of pipelines waiting for asynchronous compilation. */
+    uint32_t             numDrawsFallback;   /** Number of draw calls submitted with fallback program. */
+    uint32_t             numDrawsSkipped;    /** Number of draw calls skipped because pipeline wasn't ready. */
+    uint32_t             numMultiDraw;       /** Number of multi-draw calls submitted. */
+    uint32_t             numMultiDrawItems;  /** Number of draw calls batched into multi-draw calls. */
+    uint32_t             numStateChanges;    /** Number of render state changes (counting Noop renderer). */
+    uint32_t             numProgramChanges;  /** Number of program changes (counting Noop renderer). */
+    uint32_t             numBindChanges;     /** Number of texture and buffer binding changes (counting Noop renderer). */
+    uint32_t             numUniformUpdates;  /** Number of uniform updates (counting Noop renderer). */
+    uint32_t             numUniformRedundant; /** Number of uniform updates that did not change value (counting Noop renderer). */
     uint16_t             numDynamicIndexBuffers; /** Number of used dynamic index buffers.    */
     uint16_t             numDynamicVertexBuffers; /** Number of used dynamic vertex buffers.   */
     uint16_t             numFrameBuffers;    /** Number of used frame buffers.            */
@@ -896,8 +952,17 @@ typedef struct bgfx_stats_s
     uint16_t             numVertexLayouts;   /** Number of used vertex layouts.           */
     int64_t              textureMemoryUsed;  /** Estimate of texture memory used.         */
     int64_t              rtMemoryUsed;       /** Estimate of render target memory used.   */
+    int64_t              streamingMemoryUsed; /** Memory used by resident mips of streaming textures. */
     int32_t              transientVbUsed;    /** Amount of transient vertex buffer used.  */
     int32_t              transientIbUsed;    /** Amount of transient index buffer used.   */
+    int64_t              dynamicVbUsed;      /** Amount of shared dynamic vertex buffer memory used. */
+    int64_t              dynamicVbFree;      /** Amount of shared dynamic vertex buffer memory free. */
+    int64_t              dynamicVbLargestFree; /** Largest free block in shared dynamic vertex buffers. */
+    int64_t              dynamicIbUsed;      /** Amount of shared dynamic index buffer memory used. */
+    int64_t              dynamicIbFree;      /** Amount of shared dynamic index buffer memory free. */
+    int64_t              dynamicIbLargestFree; /** Largest free block in shared dynamic index buffers. */
+    uint32_t             numUploadsQueued;   /** Number of resource uploads waiting in upload queue. */
+    int64_t              uploadQueueSize;    /** Size of resource uploads waiting in upload queue. */
     uint32_t             numPrims[BGFX_TOPOLOGY_COUNT]; /** Number of primitives rendered.           */
     int64_t              gpuMemoryMax;       /** Maximum available GPU memory for application. */
     int64_t              gpuMemoryUsed;      /** Amount of GPU memory used by the application. */
@@ -1400,6 +1465,25 @@ BGFX_C_API void bgfx_set_index_buffer_name(bgfx_index_buffer_handle_t _handle, c
  */
 BGFX_C_API void bgfx_destroy_index_buffer(bgfx_index_buffer_handle_t _handle);
 
+/**
+ * Set upload priority of resource waiting in upload queue.
+ *
+ * @param[in] _handle Static index buffer handle.
+ * @param[in] _priority Upload priority, higher priority uploads are issued first.
+ *
+ */
+BGFX_C_API void bgfx_set_index_buffer_upload_priority(bgfx_index_buffer_handle_t _handle, uint8_t _priority);
+
+/**
+ * Returns true if all uploads of resource were issued to renderer.
+ *
+ * @param[in] _handle Static index buffer handle.
+ *
+ * @returns True if resource is not waiting in upload queue.
+ *
+ */
+BGFX_C_API bool bgfx_is_index_buffer_ready(bgfx_index_buffer_handle_t _handle);
+
 /**
  * Create vertex layout.
  *
@@ -1456,6 +1540,25 @@ BGFX_C_API void bgfx_set_vertex_buffer_name(bgfx_vertex_buffer_handle_t _handle,
  */
 BGFX_C_API void bgfx_destroy_vertex_buffer(bgfx_vertex_buffer_handle_t _handle);
 
+/**
+ * Set upload priority of resource waiting in upload queue.
+ *
+ * @param[in] _handle Static vertex buffer handle.
+ * @param[in] _priority Upload priority, higher priority uploads are issued first.
+ *
+ */
+BGFX_C_API void bgfx_set_vertex_buffer_upload_priority(bgfx_vertex_buffer_handle_t _handle, uint8_t _priority);
+
+/**
+ * Returns true if all uploads of resource were issued to renderer.
+ *
+ * @param[in] _handle Static vertex buffer handle.
+ *
+ * @returns True if resource is not waiting in upload queue.
+ *
+ */
+BGFX_C_API bool bgfx_is_vertex_buffer_ready(bgfx_vertex_buffer_handle_t _handle);
+
 /**
  * Create empty dynamic index buffer.
  *
@@ -1767,6 +1870,48 @@ BGFX_C_API bgfx_program_handle_t bgfx_create_compute_program(bgfx_shader_handle_
  */
 BGFX_C_API void bgfx_destroy_program(bgfx_program_handle_t _handle);
 
+/**
+ * Pre-create pipeline state object for program, vertex layout and render
+ * state combination, so that the first draw call using it doesn't stall.
+ * Pipeline is created against frame buffer currently assigned to view.
+ *
+ * @param[in] _id View id.
+ * @param[in] _program Program handle.
+ * @param[in] _layout Vertex layout.
+ * @param[in] _state State flags. See: `BGFX_STATE_*`.
+ * @param[in] _fstencil Front stencil state.
+ * @param[in] _bstencil Back stencil state. If back is set to `BGFX_STENCIL_NONE`
+ *  _fstencil is applied to both front and back facing primitives.
+ *
+ */
+BGFX_C_API void bgfx_warm_pipeline(bgfx_view_id_t _id, bgfx_program_handle_t _program, const bgfx_vertex_layout_t * _layout, uint64_t _state, uint32_t _fstencil, uint32_t _bstencil);
+
+/**
+ * Set program used in place of draw call program while its pipeline is being
+ * compiled asynchronously. See: `BGFX_RESET_ASYNC_PIPELINE`.
+ *
+ * @param[in] _handle Program handle, or `BGFX_INVALID_HANDLE` to skip draw calls instead.
+ *
+ */
+BGFX_C_API void bgfx_set_fallback_program(bgfx_program_handle_t _handle);
+
+/**
+ * Write pipeline cache through `CallbackI::cacheWrite` at the end of current
+ * frame, instead of waiting for pipeline creation to go idle.
+ *
+ */
+BGFX_C_API void bgfx_flush_pipeline_cache(void);
+
+/**
+ * Enable multi-draw batching of draw calls using program. Program must read model
+ * transform from instance data (`i_data0`-`i_data3`). See: `bgfx::setViewMultiDraw`.
+ *
+ * @param[in] _handle Program handle.
+ * @param[in] _enabled Allow draw calls using this program to be batched.
+ *
+ */
+BGFX_C_API void bgfx_set_program_multi_draw(bgfx_program_handle_t _handle, bool _enabled);
+
 /**
  * Validate texture parameters.
  *
@@ -2001,6 +2146,84 @@ BGFX_C_API void bgfx_update_texture_cube(bgfx_texture_handle_t _handle, uint16_t
  */
 BGFX_C_API uint32_t bgfx_read_texture(bgfx_texture_handle_t _handle, void* _data, uint8_t _mip);
 
+/**
+ * Read back texture content asynchronously. Result is available once copy is done,
+ * instead of at fixed frame. Vulkan records copy into frame command buffer and writes
+ * data once GPU executed it, without stalling render thread. Other renderers copy
+ * synchronously on render thread. Tickets complete in order of submission.
+ * @attention Texture must be created with `BGFX_TEXTURE_READ_BACK` flag.
+ * @attention Availability depends on: `BGFX_CAPS_TEXTURE_READ_BACK`.
+ *
+ * @param[in] _handle Texture handle.
+ * @param[in] _data Destination buffer.
+ * @param[in] _mip Mip level.
+ * @param[in] _readbackFn Callback function called from render thread once data is written.
+ * @param[in] _userData User data passed to callback function.
+ *
+ * @returns Readback ticket. See: `bgfx::isReadbackComplete`.
+ *
+ */
+BGFX_C_API uint32_t bgfx_read_texture_async(bgfx_texture_handle_t _handle, void* _data, uint8_t _mip, bgfx_readback_fn_t _readbackFn, void* _userData);
+
+/**
+ * Returns true once asynchronous readback has completed, and its data was written to
+ * destination buffer.
+ *
+ * @param[in] _ticket Readback ticket.
+ *
+ * @returns True if readback has completed.
+ *
+ */
+BGFX_C_API bool bgfx_is_readback_complete(uint32_t _ticket);
+
+/**
+ * Read back buffer content asynchronously. Data is copied after all draw and compute
+ * calls of current frame are executed.
+ *
+ * @param[in] _handle Dynamic index buffer handle.
+ * @param[in] _offset Offset in bytes from start of buffer.
+ * @param[in] _size Number of bytes to read.
+ * @param[in] _data Destination buffer.
+ * @param[in] _readbackFn Callback function called from render thread once data is written.
+ * @param[in] _userData User data passed to callback function.
+ *
+ * @returns Readback ticket. See: `bgfx::isReadbackComplete`.
+ *
+ */
+BGFX_C_API uint32_t bgfx_read_dynamic_index_buffer(bgfx_dynamic_index_buffer_handle_t _handle, uint32_t _offset, uint32_t _size, void* _data, bgfx_readback_fn_t _readbackFn, void* _userData);
+
+/**
+ * Read back buffer content asynchronously. Data is copied after all draw and compute
+ * calls of current frame are executed.
+ *
+ * @param[in] _handle Dynamic vertex buffer handle.
+ * @param[in] _offset Offset in bytes from start of buffer.
+ * @param[in] _size Number of bytes to read.
+ * @param[in] _data Destination buffer.
+ * @param[in] _readbackFn Callback function called from render thread once data is written.
+ * @param[in] _userData User data passed to callback function.
+ *
+ * @returns Readback ticket. See: `bgfx::isReadbackComplete`.
+ *
+ */
+BGFX_C_API uint32_t bgfx_read_dynamic_vertex_buffer(bgfx_dynamic_vertex_buffer_handle_t _handle, uint32_t _offset, uint32_t _size, void* _data, bgfx_readback_fn_t _readbackFn, void* _userData);
+
+/**
+ * Read back buffer content asynchronously. Data is copied after all draw and compute
+ * calls of current frame are executed.
+ *
+ * @param[in] _handle Indirect buffer handle.
+ * @param[in] _offset Offset in bytes from start of buffer.
+ * @param[in] _size Number of bytes to read.
+ * @param[in] _data Destination buffer.
+ * @param[in] _readbackFn Callback function called from render thread once data is written.
+ * @param[in] _userData User data passed to callback function.
+ *
+ * @returns Readback ticket. See: `bgfx::isReadbackComplete`.
+ *
+ */
+BGFX_C_API uint32_t bgfx_read_indirect_buffer(bgfx_indirect_buffer_handle_t _handle, uint32_t _offset, uint32_t _size, void* _data, bgfx_readback_fn_t _readbackFn, void* _userData);
+
 /**
  * Set texture debug name.
  *
@@ -2035,6 +2258,61 @@ BGFX_C_API void* bgfx_get_direct_access_ptr(bgfx_texture_handle_t _handle);
  */
 BGFX_C_API void bgfx_destroy_texture(bgfx_texture_handle_t _handle);
 
+/**
+ * Set upload priority of resource waiting in upload queue.
+ *
+ * @param[in] _handle Texture handle.
+ * @param[in] _priority Upload priority, higher priority uploads are issued first.
+ *
+ */
+BGFX_C_API void bgfx_set_texture_upload_priority(bgfx_texture_handle_t _handle, uint8_t _priority);
+
+/**
+ * Returns true if all uploads of resource were issued to renderer.
+ *
+ * @param[in] _handle Texture handle.
+ *
+ * @returns True if resource is not waiting in upload queue.
+ *
+ */
+BGFX_C_API bool bgfx_is_texture_ready(bgfx_texture_handle_t _handle);
+
+/**
+ * Create streaming 2D texture with full mip-map chain. Only tail mips are resident
+ * after creation, finer mips are read with `_readFn` once they are requested with
+ * `bgfx::setTextureDesiredMip`.
+ *
+ * @param[in] _width Width.
+ * @param[in] _height Height.
+ * @param[in] _format Texture format. See: `TextureFormat::Enum`.
+ * @param[in] _flags Texture creation (see `BGFX_TEXTURE_*`.), and sampler (see `BGFX_SAMPLER_*`) flags.
+ * @param[in] _readFn Callback function to read texture mip.
+ * @param[in] _userData User data passed to callback function.
+ *
+ * @returns Texture handle.
+ *
+ */
+BGFX_C_API bgfx_texture_handle_t bgfx_create_texture_streaming(uint16_t _width, uint16_t _height, bgfx_texture_format_t _format, uint64_t _flags, bgfx_texture_mip_read_fn_t _readFn, void* _userData);
+
+/**
+ * Set finest mip of streaming texture that application wants to be resident.
+ *
+ * @param[in] _handle Streaming texture handle.
+ * @param[in] _mip Finest mip that should be resident.
+ *
+ */
+BGFX_C_API void bgfx_set_texture_desired_mip(bgfx_texture_handle_t _handle, uint8_t _mip);
+
+/**
+ * Returns finest resident mip of streaming texture.
+ *
+ * @param[in] _handle Texture handle.
+ *
+ * @returns Finest resident mip. For regular texture it's always 0.
+ *
+ */
+BGFX_C_API uint8_t bgfx_get_texture_resident_mip(bgfx_texture_handle_t _handle);
+
 /**
  * Create frame buffer (simple).
  *
@@ -2195,6 +2473,28 @@ BGFX_C_API void bgfx_get_uniform_info(bgfx_uniform_handle_t _handle, bgfx_unifor
  */
 BGFX_C_API void bgfx_destroy_uniform(bgfx_uniform_handle_t _handle);
 
+/**
+ * Create uniform block. Uniform block data sets values of all uniforms in block
+ * with single call, and is laid out std140-style: uniforms are tightly packed in
+ * order they are passed, `Vec4` element takes 16 bytes, `Mat3` element takes
+ * 48 bytes (three columns padded to 16 bytes), and `Mat4` element takes 64 bytes.
+ *
+ * @param[in] _uniforms Uniforms in block, in order they are laid out in block data.
+ * @param[in] _num Number of uniforms.
+ *
+ * @returns Handle to uniform block object.
+ *
+ */
+BGFX_C_API bgfx_uniform_block_handle_t bgfx_create_uniform_block(const bgfx_uniform_handle_t* _uniforms, uint16_t _num);
+
+/**
+ * Destroy uniform block.
+ *
+ * @param[in] _handle Handle to uniform block object.
+ *
+ */
+BGFX_C_API void bgfx_destroy_uniform_block(bgfx_uniform_block_handle_t _handle);
+
 /**
  * Create occlusion query.
  *
@@ -2203,6 +2503,7 @@ BGFX_C_API bgfx_occlusion_query_handle_t bgfx_create_occlusion_query(void);
 
 /**
  * Retrieve occlusion query result from previous frame.
+ * With frames in flight result is `Init::limits.maxFramesInFlight - 1` frames old.
  *
  * @param[in] _handle Handle to occlusion query object.
  * @param[out] _result Number of pixels that passed test. This argument
@@ -2221,6 +2522,23 @@ BGFX_C_API bgfx_occlusion_query_result_t bgfx_get_result(bgfx_occlusion_query_ha
  */
 BGFX_C_API void bgfx_destroy_occlusion_query(bgfx_occlusion_query_handle_t _handle);
 
+/**
+ * Create draw bundle. Draw calls recorded into draw bundle can be submitted many times
+ * without encoding them again.
+ *
+ * @returns Handle to draw bundle object.
+ *
+ */
+BGFX_C_API bgfx_draw_bundle_handle_t bgfx_create_draw_bundle(void);
+
+/**
+ * Destroy draw bundle.
+ *
+ * @param[in] _handle Handle to draw bundle object.
+ *
+ */
+BGFX_C_API void bgfx_destroy_draw_bundle(bgfx_draw_bundle_handle_t _handle);
+
 /**
  * Set palette color value.
  *
@@ -2352,6 +2670,21 @@ BGFX_C_API void bgfx_set_view_clear_mrt(bgfx_view_id_t _id, uint16_t _flags, flo
  */
 BGFX_C_API void bgfx_set_view_mode(bgfx_view_id_t _id, bgfx_view_mode_t _mode);
 
+/**
+ * Set view multi-draw batching.
+ * When enabled, consecutive draw calls in view that differ only in transform, vertex
+ * offset and index range are submitted with a single multi-draw indirect call. Model
+ * transform of each draw call is passed to shader as instance data (`i_data0`-`i_data3`).
+ * @remarks
+ *   Only used by renderers that support it, other renderers submit draw calls one by one.
+ *   Only draw calls using program enabled with `bgfx::setProgramMultiDraw` are batched.
+ *
+ * @param[in] _id View id.
+ * @param[in] _enabled Enable batching of consecutive compatible draw calls.
+ *
+ */
+BGFX_C_API void bgfx_set_view_multi_draw(bgfx_view_id_t _id, bool _enabled);
+
 /**
  * Set view frame buffer.
  * @remarks
@@ -2541,6 +2874,15 @@ BGFX_C_API uint32_t bgfx_encoder_alloc_transform(bgfx_encoder_t* _this, bgfx_tra
  */
 BGFX_C_API void bgfx_encoder_set_uniform(bgfx_encoder_t* _this, bgfx_uniform_handle_t _handle, const void* _value, uint16_t _num);
 
+/**
+ * Set uniform block data for draw primitive.
+ *
+ * @param[in] _handle Uniform block.
+ * @param[in] _data Pointer to uniform block data.
+ *
+ */
+BGFX_C_API void bgfx_encoder_set_uniform_block(bgfx_encoder_t* _this, bgfx_uniform_block_handle_t _handle, const void* _data);
+
 /**
  * Set index buffer for draw primitive.
  *
@@ -2770,6 +3112,33 @@ BGFX_C_API void bgfx_encoder_submit_indirect(bgfx_encoder_t* _this, bgfx_view_id
  */
 BGFX_C_API void bgfx_encoder_submit_indirect_count(bgfx_encoder_t* _this, bgfx_view_id_t _id, bgfx_program_handle_t _program, bgfx_indirect_buffer_handle_t _indirectHandle, uint32_t _start, bgfx_index_buffer_handle_t _numHandle, uint32_t _numIndex, uint32_t _numMax, uint32_t _depth, uint8_t _flags);
 
+/**
+ * Begin recording draw calls into draw bundle. Draw calls submitted until `endDrawBundle`
+ * are recorded into bundle instead of being submitted to view. Previous bundle content is
+ * discarded.
+ * @attention Compute dispatches, occlusion queries, and conditional rendering are not recorded. Draw calls using transient index/vertex buffers or instance data buffers are dropped. Bundle doesn't keep referenced resources alive, they must outlive bundle or bundle must be recorded again. Draw calls referencing destroyed resources are dropped when bundle is submitted.
+ *
+ * @param[in] _handle Draw bundle.
+ *
+ */
+BGFX_C_API void bgfx_encoder_begin_draw_bundle(bgfx_encoder_t* _this, bgfx_draw_bundle_handle_t _handle);
+
+/**
+ * End recording draw calls into draw bundle.
+ *
+ */
+BGFX_C_API void bgfx_encoder_end_draw_bundle(bgfx_encoder_t* _this);
+
+/**
+ * Submit all draw calls recorded in draw bundle.
+ *
+ * @param[in] _id View id.
+ * @param[in] _handle Draw bundle.
+ * @param[in] _mtx Transform matrix replacing transforms recorded with draw calls, or NULL to use recorded transforms.
+ *
+ */
+BGFX_C_API void bgfx_encoder_submit_draw_bundle(bgfx_encoder_t* _this, bgfx_view_id_t _id, bgfx_draw_bundle_handle_t _handle, const void* _mtx);
+
 /**
  * Set compute index buffer.
  *
@@ -2907,6 +3276,44 @@ BGFX_C_API void bgfx_encoder_blit(bgfx_encoder_t* _this, bgfx_view_id_t _id, bgf
  */
 BGFX_C_API void bgfx_request_screen_shot(bgfx_frame_buffer_handle_t _handle, const char* _filePath);
 
+/**
+ * Write recorded profiler scopes in Chrome trace event JSON format.
+ *
+ * @param[in] _filePath Output file path.
+ * @param[in] _numFrames Number of most recent frames to write. Use 0 to write all recorded events.
+ *
+ * @returns Number of events written.
+ *
+ */
+BGFX_C_API uint32_t bgfx_save_profiler_trace(const char* _filePath, uint16_t _numFrames);
+
+/**
+ * Start capturing frames, as they are received by render thread, into file.
+ *
+ * @param[in] _filePath Capture file path.
+ *
+ * @returns True if capture file is created.
+ *
+ */
+BGFX_C_API bool bgfx_start_frame_capture(const char* _filePath);
+
+/**
+ * Stop capturing frames, capture file is closed after current frame is rendered.
+ *
+ */
+BGFX_C_API void bgfx_stop_frame_capture(void);
+
+/**
+ * Replay captured frames. Each following frame renders next captured frame instead of frame
+ * submitted by application.
+ *
+ * @param[in] _filePath Capture file path.
+ *
+ * @returns Number of frames to replay, 0 if capture file is not compatible.
+ *
+ */
+BGFX_C_API uint32_t bgfx_start_frame_replay(const char* _filePath);
+
 /**
  * Render frame.
  * @attention `bgfx::renderFrame` is blocking call. It waits for
@@ -3113,6 +3520,15 @@ BGFX_C_API uint32_t bgfx_alloc_transform(bgfx_transform_t* _transform, uint16_t
  */
 BGFX_C_API void bgfx_set_uniform(bgfx_uniform_handle_t _handle, const void* _value, uint16_t _num);
 
+/**
+ * Set uniform block data for draw primitive.
+ *
+ * @param[in] _handle Uniform block.
+ * @param[in] _data Pointer to uniform block data.
+ *
+ */
+BGFX_C_API void bgfx_set_uniform_block(bgfx_uniform_block_handle_t _handle, const void* _data);
+
 /**
  * Set index buffer for draw primitive.
  *
@@ -3353,6 +3769,33 @@ BGFX_C_API void bgfx_submit_indirect(bgfx_view_id_t _id, bgfx_program_handle_t _
  */
 BGFX_C_API void bgfx_submit_indirect_count(bgfx_view_id_t _id, bgfx_program_handle_t _program, bgfx_indirect_buffer_handle_t _indirectHandle, uint32_t _start, bgfx_index_buffer_handle_t _numHandle, uint32_t _numIndex, uint32_t _numMax, uint32_t _depth, uint8_t _flags);
 
+/**
+ * Begin recording draw calls into draw bundle. Draw calls submitted until `endDrawBundle`
+ * are recorded into bundle instead of being submitted to view. Previous bundle content is
+ * discarded.
+ * @attention Compute dispatches, occlusion queries, and conditional rendering are not recorded. Draw calls using transient index/vertex buffers or instance data buffers are dropped. Bundle doesn't keep referenced resources alive, they must outlive bundle or bundle must be recorded again. Draw calls referencing destroyed resources are dropped when bundle is submitted.
+ *
+ * @param[in] _handle Draw bundle.
+ *
+ */
+BGFX_C_API void bgfx_begin_draw_bundle(bgfx_draw_bundle_handle_t _handle);
+
+/**
+ * End recording draw calls into draw bundle.
+ *
+ */
+BGFX_C_API void bgfx_end_draw_bundle(void);
+
+/**
+ * Submit all draw calls recorded in draw bundle.
+ *
+ * @param[in] _id View id.
+ * @param[in] _handle Draw bundle.
+ * @param[in] _mtx Transform matrix replacing transforms recorded with draw calls, or NULL to use recorded transforms.
+ *
+ */
+BGFX_C_API void bgfx_submit_draw_bundle(bgfx_view_id_t _id, bgfx_draw_bundle_handle_t _handle, const void* _mtx);
+
 /**
  * Set compute index buffer.
  *
@@ -3724,11 +4167,15 @@ struct bgfx_interface_vtbl
     bgfx_index_buffer_handle_t (*create_index_buffer)(const bgfx_memory_t* _mem, uint16_t _flags);
     void (*set_index_buffer_name)(bgfx_index_buffer_handle_t _handle, const char* _name, int32_t _len);
     void (*destroy_index_buffer)(bgfx_index_buffer_handle_t _handle);
+    void (*set_index_buffer_upload_priority)(bgfx_index_buffer_handle_t _handle, uint8_t _priority);
+    bool (*is_index_buffer_ready)(bgfx_index_buffer_handle_t _handle);
     bgfx_vertex_layout_handle_t (*create_vertex_layout)(const bgfx_vertex_layout_t * _layout);
     void (*destroy_vertex_layout)(bgfx_vertex_layout_handle_t _layoutHandle);
     bgfx_vertex_buffer_handle_t (*create_vertex_buffer)(const bgfx_memory_t* _mem, const bgfx_vertex_layout_t * _layout, uint16_t _flags);
     void (*set_vertex_buffer_name)(bgfx_vertex_buffer_handle_t _handle, const char* _name, int32_t _len);
     void (*destroy_vertex_buffer)(bgfx_vertex_buffer_handle_t _handle);
+    void (*set_vertex_buffer_upload_priority)(bgfx_vertex_buffer_handle_t _handle, uint8_t _priority);
+    bool (*is_vertex_buffer_ready)(bgfx_vertex_buffer_handle_t _handle);
     bgfx_dynamic_index_buffer_handle_t (*create_dynamic_index_buffer)(uint32_t _num, uint16_t _flags);
     bgfx_dynamic_index_buffer_handle_t (*create_dynamic_index_buffer_mem)(const bgfx_memory_t* _mem, uint16_t _flags);
     void (*update_dynamic_index_buffer)(bgfx_dynamic_index_buffer_handle_t _handle, uint32_t _startIndex, const bgfx_memory_t* _mem);
@@ -3753,6 +4200,10 @@ struct bgfx_interface_vtbl
     bgfx_program_handle_t (*create_program)(bgfx_shader_handle_t _vsh, bgfx_shader_handle_t _fsh, bool _destroyShaders);
     bgfx_program_handle_t (*create_compute_program)(bgfx_shader_handle_t _csh, bool _destroyShaders);
     void (*destroy_program)(bgfx_program_handle_t _handle);
+    void (*warm_pipeline)(bgfx_view_id_t _id, bgfx_program_handle_t _program, const bgfx_vertex_layout_t * _layout, uint64_t _state, uint32_t _fstencil, uint32_t _bstencil);
+    void (*set_fallback_program)(bgfx_program_handle_t _handle);
+    void (*flush_pipeline_cache)(void);
+    void (*set_program_multi_draw)(bgfx_program_handle_t _handle, bool _enabled);
     bool (*is_texture_valid)(uint16_t _depth, bool _cubeMap, uint16_t _numLayers, bgfx_texture_format_t _format, uint64_t _flags);
     bool (*is_frame_buffer_valid)(uint8_t _num, const bgfx_attachment_t* _attachment);
     void (*calc_texture_size)(bgfx_texture_info_t * _info, uint16_t _width, uint16_t _height, uint16_t _depth, bool _cubeMap, bool _hasMips, uint16_t _numLayers, bgfx_texture_format_t _format);
@@ -3765,9 +4216,19 @@ struct bgfx_interface_vtbl
     void (*update_texture_3d)(bgfx_texture_handle_t _handle, uint8_t _mip, uint16_t _x, uint16_t _y, uint16_t _z, uint16_t _width, uint16_t _height, uint16_t _depth, const bgfx_memory_t* _mem);
     void (*update_texture_cube)(bgfx_texture_handle_t _handle, uint16_t _layer, uint8_t _side, uint8_t _mip, uint16_t _x, uint16_t _y, uint16_t _width, uint16_t _height, const bgfx_memory_t* _mem, uint16_t _pitch);
     uint32_t (*read_texture)(bgfx_texture_handle_t _handle, void* _data, uint8_t _mip);
+    uint32_t (*read_texture_async)(bgfx_texture_handle_t _handle, void* _data, uint8_t _mip, bgfx_readback_fn_t _readbackFn, void* _userData);
+    bool (*is_readback_complete)(uint32_t _ticket);
+    uint32_t (*read_dynamic_index_buffer)(bgfx_dynamic_index_buffer_handle_t _handle, uint32_t _offset, uint32_t _size, void* _data, bgfx_readback_fn_t _readbackFn, void* _userData);
+    uint32_t (*read_dynamic_vertex_buffer)(bgfx_dynamic_vertex_buffer_handle_t _handle, uint32_t _offset, uint32_t _size, void* _data, bgfx_readback_fn_t _readbackFn, void* _userData);
+    uint32_t (*read_indirect_buffer)(bgfx_indirect_buffer_handle_t _handle, uint32_t _offset, uint32_t _size, void* _data, bgfx_readback_fn_t _readbackFn, void* _userData);
     void (*set_texture_name)(bgfx_texture_handle_t _handle, const char* _name, int32_t _len);
     void* (*get_direct_access_ptr)(bgfx_texture_handle_t _handle);
     void (*destroy_texture)(bgfx_texture_handle_t _handle);
+    void (*set_texture_upload_priority)(bgfx_texture_handle_t _handle, uint8_t _priority);
+    bool (*is_texture_ready)(bgfx_texture_handle_t _handle);
+    bgfx_texture_handle_t (*create_texture_streaming)(uint16_t _width, uint16_t _height, bgfx_texture_format_t _format, uint64_t _flags, bgfx_texture_mip_read_fn_t _readFn, void* _userData);
+    void (*set_texture_desired_mip)(bgfx_texture_handle_t _handle, uint8_t _mip);
+    uint8_t (*get_texture_resident_mip)(bgfx_texture_handle_t _handle);
     bgfx_frame_buffer_handle_t (*create_frame_buffer)(uint16_t _width, uint16_t _height, bgfx_texture_format_t _format, uint64_t _textureFlags);
     bgfx_frame_buffer_handle_t (*create_frame_buffer_scaled)(bgfx_backbuffer_ratio_t _ratio, bgfx_texture_format_t _format, uint64_t _textureFlags);
     bgfx_frame_buffer_handle_t (*create_frame_buffer_from_handles)(uint8_t _num, const bgfx_texture_handle_t* _handles, bool _destroyTexture);
@@ -3779,9 +4240,13 @@ struct bgfx_interface_vtbl
     bgfx_uniform_handle_t (*create_uniform)(const char* _name, bgfx_uniform_type_t _type, uint16_t _num);
     void (*get_uniform_info)(bgfx_uniform_handle_t _handle, bgfx_uniform_info_t * _info);
     void (*destroy_uniform)(bgfx_uniform_handle_t _handle);
+    bgfx_uniform_block_handle_t (*create_uniform_block)(const bgfx_uniform_handle_t* _uniforms, uint16_t _num);
+    void (*destroy_uniform_block)(bgfx_uniform_block_handle_t _handle);
     bgfx_occlusion_query_handle_t (*create_occlusion_query)(void);
     bgfx_occlusion_query_result_t (*get_result)(bgfx_occlusion_query_handle_t _handle, int32_t* _result);
     void (*destroy_occlusion_query)(bgfx_occlusion_query_handle_t _handle);
+    bgfx_draw_bundle_handle_t (*create_draw_bundle)(void);
+    void (*destroy_draw_bundle)(bgfx_draw_bundle_handle_t _handle);
     void (*set_palette_color)(uint8_t _index, const float _rgba[4]);
     void (*set_palette_color_rgba32f)(uint8_t _index, float _r, float _g, float _b, float _a);
     void (*set_palette_color_rgba8)(uint8_t _index, uint32_t _rgba);
@@ -3792,6 +4257,7 @@ struct bgfx_interface_vtbl
     void (*set_view_clear)(bgfx_view_id_t _id, uint16_t _flags, uint32_t _rgba, float _depth, uint8_t _stencil);
     void (*set_view_clear_mrt)(bgfx_view_id_t _id, uint16_t _flags, float _depth, uint8_t _stencil, uint8_t _c0, uint8_t _c1, uint8_t _c2, uint8_t _c3, uint8_t _c4, uint8_t _c5, uint8_t _c6, uint8_t _c7);
     void (*set_view_mode)(bgfx_view_id_t _id, bgfx_view_mode_t _mode);
+    void (*set_view_multi_draw)(bgfx_view_id_t _id, bool _enabled);
     void (*set_view_frame_buffer)(bgfx_view_id_t _id, bgfx_frame_buffer_handle_t _handle);
     void (*set_view_transform)(bgfx_view_id_t _id, const void* _view, const void* _proj);
     void (*set_view_order)(bgfx_view_id_t _id, uint16_t _num, const bgfx_view_id_t* _order);
@@ -3808,6 +4274,7 @@ struct bgfx_interface_vtbl
     void (*encoder_set_transform_cached)(bgfx_encoder_t* _this, uint32_t _cache, uint16_t _num);
     uint32_t (*encoder_alloc_transform)(bgfx_encoder_t* _this, bgfx_transform_t* _transform, uint16_t _num);
     void (*encoder_set_uniform)(bgfx_encoder_t* _this, bgfx_uniform_handle_t _handle, const void* _value, uint16_t _num);
+    void (*encoder_set_uniform_block)(bgfx_encoder_t* _this, bgfx_uniform_block_handle_t _handle, const void* _data);
     void (*encoder_set_index_buffer)(bgfx_encoder_t* _this, bgfx_index_buffer_handle_t _handle, uint32_t _firstIndex, uint32_t _numIndices);
     void (*encoder_set_dynamic_index_buffer)(bgfx_encoder_t* _this, bgfx_dynamic_index_buffer_handle_t _handle, uint32_t _firstIndex, uint32_t _numIndices);
     void (*encoder_set_transient_index_buffer)(bgfx_encoder_t* _this, const bgfx_transient_index_buffer_t* _tib, uint32_t _firstIndex, uint32_t _numIndices);
@@ -3828,6 +4295,9 @@ struct bgfx_interface_vtbl
     void (*encoder_submit_occlusion_query)(bgfx_encoder_t* _this, bgfx_view_id_t _id, bgfx_program_handle_t _program, bgfx_occlusion_query_handle_t _occlusionQuery, uint32_t _depth, uint8_t _flags);
     void (*encoder_submit_indirect)(bgfx_encoder_t* _this, bgfx_view_id_t _id, bgfx_program_handle_t _program, bgfx_indirect_buffer_handle_t _indirectHandle, uint32_t _start, uint32_t _num, uint32_t _depth, uint8_t _flags);
     void (*encoder_submit_indirect_count)(bgfx_encoder_t* _this, bgfx_view_id_t _id, bgfx_program_handle_t _program, bgfx_indirect_buffer_handle_t _indirectHandle, uint32_t _start, bgfx_index_buffer_handle_t _numHandle, uint32_t _numIndex, uint32_t _numMax, uint32_t _depth, uint8_t _flags);
+    void (*encoder_begin_draw_bundle)(bgfx_encoder_t* _this, bgfx_draw_bundle_handle_t _handle);
+    void (*encoder_end_draw_bundle)(bgfx_encoder_t* _this);
+    void (*encoder_submit_draw_bundle)(bgfx_encoder_t* _this, bgfx_view_id_t _id, bgfx_draw_bundle_handle_t _handle, const void* _mtx);
     void (*encoder_set_compute_index_buffer)(bgfx_encoder_t* _this, uint8_t _stage, bgfx_index_buffer_handle_t _handle, bgfx_access_t _access);
     void (*encoder_set_compute_vertex_buffer)(bgfx_encoder_t* _this, uint8_t _stage, bgfx_vertex_buffer_handle_t _handle, bgfx_access_t _access);
     void (*encoder_set_compute_dynamic_index_buffer)(bgfx_encoder_t* _this, uint8_t _stage, bgfx_dynamic_index_buffer_handle_t _handle, bgfx_access_t _access);
@@ -3839,6 +4309,10 @@ struct bgfx_interface_vtbl
     void (*encoder_discard)(bgfx_encoder_t* _this, uint8_t _flags);
     void (*encoder_blit)(bgfx_encoder_t* _this, bgfx_view_id_t _id, bgfx_texture_handle_t _dst, uint8_t _dstMip, uint16_t _dstX, uint16_t _dstY, uint16_t _dstZ, bgfx_texture_handle_t _src, uint8_t _srcMip, uint16_t _srcX, uint16_t _srcY, uint16_t _srcZ, uint16_t _width, uint16_t _height, uint16_t _depth);
     void (*request_screen_shot)(bgfx_frame_buffer_handle_t _handle, const char* _filePath);
+    uint32_t (*save_profiler_trace)(const char* _filePath, uint16_t _numFrames);
+    bool (*start_frame_capture)(const char* _filePath);
+    void (*stop_frame_capture)(void);
+    uint32_t (*start_frame_replay)(const char* _filePath);
     bgfx_render_frame_t (*render_frame)(int32_t _msecs);
     void (*set_platform_data)(const bgfx_platform_data_t * _data);
     const bgfx_internal_data_t* (*get_internal_data)(void);
@@ -3854,6 +4328,7 @@ struct bgfx_interface_vtbl
     void (*set_transform_cached)(uint32_t _cache, uint16_t _num);
     uint32_t (*alloc_transform)(bgfx_transform_t* _transform, uint16_t _num);
     void (*set_uniform)(bgfx_uniform_handle_t _handle, const void* _value, uint16_t _num);
+    void (*set_uniform_block)(bgfx_uniform_block_handle_t _handle, const void* _data);
     void (*set_index_buffer)(bgfx_index_buffer_handle_t _handle, uint32_t _firstIndex, uint32_t _numIndices);
     void (*set_dynamic_index_buffer)(bgfx_dynamic_index_buffer_handle_t _handle, uint32_t _firstIndex, uint32_t _numIndices);
     void (*set_transient_index_buffer)(const bgfx_transient_index_buffer_t* _tib, uint32_t _firstIndex, uint32_t _numIndices);
@@ -3874,6 +4349,9 @@ struct bgfx_interface_vtbl
     void (*submit_occlusion_query)(bgfx_view_id_t _id, bgfx_program_handle_t _program, bgfx_occlusion_query_handle_t _occlusionQuery, uint32_t _depth, uint8_t _flags);
     void (*submit_indirect)(bgfx_view_id_t _id, bgfx_program_handle_t _program, bgfx_indirect_buffer_handle_t _indirectHandle, uint32_t _start, uint32_t _num, uint32_t _depth, uint8_t _flags);
     void (*submit_indirect_count)(bgfx_view_id_t _id, bgfx_program_handle_t _program, bgfx_indirect_buffer_handle_t _indirectHandle, uint32_t _start, bgfx_index_buffer_handle_t _numHandle, uint32_t _numIndex, uint32_t _numMax, uint32_t _depth, uint8_t _flags);
+    void (*begin_draw_bundle)(bgfx_draw_bundle_handle_t _handle);
+    void (*end_draw_bundle)(void);
+    void (*submit_draw_bundle)(bgfx_view_id_t _id, bgfx_draw_bundle_handle_t _handle, const void* _mtx);
     void (*set_compute_index_buffer)(uint8_t _stage, bgfx_index_buffer_handle_t _handle, bgfx_access_t _access);
     void (*set_compute_vertex_buffer)(uint8_t _stage, bgfx_vertex_buffer_handle_t _handle, bgfx_access_t _access);
     void (*set_compute_dynamic_index_buffer)(uint8_t _stage, bgfx_dynamic_index_buffer_handle_t _handle, bgfx_access_t _access);
@@ -15,7 +15,7 @@
 #ifndef BGFX_DEFINES_H_HEADER_GUARD
 #define BGFX_DEFINES_H_HEADER_GUARD
 
-#define BGFX_API_VERSION UINT32_C(129)
+#define BGFX_API_VERSION UINT32_C(154)
 
 /**
  * Color RGB/alpha/depth write. When it's not specified write will be disabled.
@@ -454,6 +454,7 @@
 #define BGFX_RESET_DEPTH_CLAMP                    UINT32_C(0x00040000) //!< Enable depth clamp.
 #define BGFX_RESET_SUSPEND                        UINT32_C(0x00080000) //!< Suspend rendering.
 #define BGFX_RESET_TRANSPARENT_BACKBUFFER         UINT32_C(0x00100000) //!< Transparent backbuffer. Availability depends on: `BGFX_CAPS_TRANSPARENT_BACKBUFFER`.
+#define BGFX_RESET_ASYNC_PIPELINE                 UINT32_C(0x00200000) //!< Compile pipeline state objects asynchronously.
 
 #define BGFX_RESET_FULLSCREEN_SHIFT               0
 
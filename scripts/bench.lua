@@ -0,0 +1,53 @@
+--
+-- Copyright 2010-2024 Branimir Karadzic. All rights reserved.
+-- License: https://github.com/bkaradzic/bgfx/blob/master/LICENSE
+--
+
+project "bench"
+	uuid (os.uuid("bench") )
+	kind "ConsoleApp"
+
+	includedirs {
+		path.join(BIMG_DIR, "include"),
+		path.join(BGFX_DIR, "include"),
+	}
+
+	files {
+		path.join(BGFX_DIR, "tools/bench/**.cpp"),
+	}
+
+	links {
+		"bgfx",
+		"bimg",
+	}
+
+	using_bx()
+
+	configuration { "mingw-*" }
+		targetextension ".exe"
+
+	configuration { "vs20* or mingw*" }
+		links {
+			"gdi32",
+			"psapi",
+		}
+
+	configuration { "linux-* or freebsd" }
+		links {
+			"X11",
+			"GL",
+			"pthread",
+		}
+
+	configuration { "osx*" }
+		linkoptions {
+			"-framework Cocoa",
+			"-framework IOKit",
+			"-framework Metal",
+			"-framework OpenGL",
+			"-framework QuartzCore",
+		}
+
+	configuration {}
+
+	strip()
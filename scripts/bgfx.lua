@@ -188,15 +188,21 @@ function bgfxProjectBase(_kind, _defines)
 	if _OPTIONS["with-amalgamated"] then
 		excludes {
 			path.join(BGFX_DIR, "src/bgfx.cpp"),
+			path.join(BGFX_DIR, "src/capture.cpp"),
 			path.join(BGFX_DIR, "src/debug_**.cpp"),
+			path.join(BGFX_DIR, "src/decode.cpp"),
 			path.join(BGFX_DIR, "src/dxgi.cpp"),
 			path.join(BGFX_DIR, "src/glcontext_**.cpp"),
 			path.join(BGFX_DIR, "src/hmd**.cpp"),
 			path.join(BGFX_DIR, "src/image.cpp"),
 			path.join(BGFX_DIR, "src/nvapi.cpp"),
+			path.join(BGFX_DIR, "src/profiler.cpp"),
+			path.join(BGFX_DIR, "src/range_allocator.cpp"),
 			path.join(BGFX_DIR, "src/renderer_**.cpp"),
 			path.join(BGFX_DIR, "src/shader**.cpp"),
+			path.join(BGFX_DIR, "src/streaming.cpp"),
 			path.join(BGFX_DIR, "src/topology.cpp"),
+			path.join(BGFX_DIR, "src/upload.cpp"),
 			path.join(BGFX_DIR, "src/vertexlayout.cpp"),
 		}
 
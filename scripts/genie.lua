@@ -574,4 +574,6 @@ if _OPTIONS["with-tools"] then
 	dofile "texturev.lua"
 	dofile "geometryc.lua"
 	dofile "geometryv.lua"
+	dofile "bench.lua"
+	dofile "test.lua"
 end
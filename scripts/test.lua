@@ -0,0 +1,33 @@
+--
+-- Copyright 2010-2024 Branimir Karadzic. All rights reserved.
+-- License: https://github.com/bkaradzic/bgfx/blob/master/LICENSE
+--
+
+project "test"
+	uuid (os.uuid("test") )
+	kind "ConsoleApp"
+
+	includedirs {
+		path.join(BGFX_DIR, "include"),
+		path.join(BGFX_DIR, "src"),
+	}
+
+	files {
+		path.join(BGFX_DIR, "tests/**.cpp"),
+		path.join(BGFX_DIR, "src/range_allocator.cpp"),
+		path.join(BGFX_DIR, "src/range_allocator.h"),
+	}
+
+	using_bx()
+
+	configuration { "mingw-*" }
+		targetextension ".exe"
+
+	configuration { "linux-* or freebsd" }
+		links {
+			"pthread",
+		}
+
+	configuration {}
+
+	strip()
@@ -4,12 +4,16 @@
  */
 
 #include "bgfx.cpp"
+#include "capture.cpp"
 #include "debug_renderdoc.cpp"
+#include "decode.cpp"
 #include "dxgi.cpp"
 #include "glcontext_egl.cpp"
 #include "glcontext_wgl.cpp"
 #include "glcontext_html5.cpp"
 #include "nvapi.cpp"
+#include "profiler.cpp"
+#include "range_allocator.cpp"
 #include "renderer_agc.cpp"
 #include "renderer_d3d11.cpp"
 #include "renderer_d3d12.cpp"
@@ -21,5 +25,7 @@
 #include "shader.cpp"
 #include "shader_dxbc.cpp"
 #include "shader_spirv.cpp"
+#include "streaming.cpp"
 #include "topology.cpp"
+#include "upload.cpp"
 #include "vertexlayout.cpp"
@@ -259,6 +259,7 @@ namespace bgfx
 
 	CallbackI* g_callback = NULL;
 	bx::AllocatorI* g_allocator = NULL;
+	ProfilerTimeline g_profilerTimeline;
 
 	Caps g_caps;
 
@@ -1223,6 +1224,93 @@ namespace bgfx
 		}
 	}
 
+	static bool isUploadPending(const RenderBind& _bind)
+	{
+		const UploadQueue& uploadQueue = s_ctx->m_uploadQueue;
+
+		for (uint32_t stage = 0; stage < BGFX_CONFIG_MAX_TEXTURE_SAMPLERS; ++stage)
+		{
+			const Binding& bind = _bind.m_bind[stage];
+
+			if (kInvalidHandle == bind.m_idx)
+			{
+				continue;
+			}
+
+			switch (bind.m_type)
+			{
+			case Binding::Image:
+			case Binding::Texture:
+				if (uploadQueue.isCreatePending(UploadType::Texture, bind.m_idx) )
+				{
+					return true;
+				}
+				break;
+
+			case Binding::IndexBuffer:
+				if (uploadQueue.isCreatePending(UploadType::IndexBuffer, bind.m_idx) )
+				{
+					return true;
+				}
+				break;
+
+			case Binding::VertexBuffer:
+				if (uploadQueue.isCreatePending(UploadType::VertexBuffer, bind.m_idx) )
+				{
+					return true;
+				}
+				break;
+			}
+		}
+
+		return false;
+	}
+
+	// Draw calls using resources which are still waiting in upload queue to be created are
+	// skipped. Textures that are still decoding are waiting in upload queue even when it's
+	// disabled.
+	static bool isUploadPending(const RenderDraw& _draw, const RenderBind& _bind)
+	{
+		const UploadQueue& uploadQueue = s_ctx->m_uploadQueue;
+
+		if (!uploadQueue.hasCreatePending() )
+		{
+			return false;
+		}
+
+		if (UINT8_MAX != _draw.m_streamMask)
+		{
+			for (uint32_t idx = 0, streamMask = _draw.m_streamMask
+				; 0 != streamMask
+				; streamMask >>= 1, idx += 1
+				)
+			{
+				const uint32_t ntz = bx::uint32_cnttz(streamMask);
+				streamMask >>= ntz;
+				idx         += ntz;
+
+				if (uploadQueue.isCreatePending(UploadType::VertexBuffer, _draw.m_stream[idx].m_handle.idx) )
+				{
+					return true;
+				}
+			}
+		}
+
+		if (isValid(_draw.m_indexBuffer)
+		&&  uploadQueue.isCreatePending(UploadType::IndexBuffer, _draw.m_indexBuffer.idx) )
+		{
+			return true;
+		}
+
+		if (isValid(_draw.m_instanceDataBuffer)
+		&&  uploadQueue.isCreatePending(UploadType::VertexBuffer, _draw.m_instanceDataBuffer.idx) )
+		{
+			return true;
+		}
+
+		return isUploadPending(_bind);
+	}
+
 	void EncoderImpl::submit(ViewId _id, ProgramHandle _program, OcclusionQueryHandle _occlusionQuery, uint32_t _depth, uint8_t _flags)
 	{
 		if (BX_ENABLED(BGFX_CONFIG_DEBUG_UNIFORM)
@@ -1255,8 +1343,47 @@ namespace bgfx
 			return;
 		}
 
-		const uint32_t renderItemIdx = bx::atomicFetchAndAddsat<uint32_t>(&m_frame->m_numRenderItems, 1, BGFX_CONFIG_MAX_DRAW_CALLS);
-		if (BGFX_CONFIG_MAX_DRAW_CALLS <= renderItemIdx)
+		if (UINT8_MAX != m_draw.m_streamMask)
+		{
+			uint32_t numVertices = UINT32_MAX;
+			for (uint32_t idx = 0, streamMask = m_draw.m_streamMask
+				; 0 != streamMask
+				; streamMask >>= 1, idx += 1
+				)
+			{
+				const uint32_t ntz = bx::uint32_cnttz(streamMask);
+				streamMask >>= ntz;
+				idx         += ntz;
+				numVertices = bx::min(numVertices, m_numVertices[idx]);
+			}
+
+			m_draw.m_numVertices = numVertices;
+		}
+		else
+		{
+			m_draw.m_numVertices = m_numVertices[0];
+		}
+
+		if (NULL != m_drawBundle)
+		{
+			recordDraw(_program, _occlusionQuery, _depth);
+
+			m_draw.clear(_flags);
+			discardBind(_flags);
+			return;
+		}
+
+		if (isUploadPending(m_draw, m_bind) )
+		{
+			discard(_flags);
+			++m_numPendingSkipped;
+			return;
+		}
+
+		uint16_t bindIdx;
+		uint32_t renderItemIdx;
+		if (!allocRenderBind(bindIdx)
+		||  !allocRenderItem(renderItemIdx) )
 		{
 			discard(_flags);
 			++m_numDropped;
@@ -1268,6 +1395,29 @@ namespace bgfx
 		UniformBuffer* uniformBuffer = m_frame->m_uniformBuffer[m_uniformIdx];
 		m_uniformEnd = uniformBuffer->getPos();
 
+		m_renderItemChunk->m_key[renderItemIdx] = encodeDrawKey(_id, _program, _depth, m_draw.m_stateFlags, m_draw.m_stencil, m_bindHash);
+
+		m_draw.m_uniformIdx   = m_uniformIdx;
+		m_draw.m_uniformBegin = m_uniformBegin;
+		m_draw.m_uniformEnd   = m_uniformEnd;
+		m_draw.m_bindIdx      = bindIdx;
+
+		if (isValid(_occlusionQuery) )
+		{
+			m_draw.m_stateFlags |= BGFX_STATE_INTERNAL_OCCLUSION_QUERY;
+			m_draw.m_occlusionQuery = _occlusionQuery;
+		}
+
+		m_renderItemChunk->m_item[renderItemIdx].draw = m_draw;
+
+		m_draw.clear(_flags);
+		discardBind(_flags);
+
+		m_uniformBegin = m_uniformEnd;
+	}
+
+	uint64_t EncoderImpl::encodeDrawKey(ViewId _id, ProgramHandle _program, uint32_t _depth, uint64_t _state, uint64_t _stencil, uint32_t _bindHash)
+	{
 		m_key.m_program = isValid(_program)
 			? _program
 			: ProgramHandle{0}
@@ -1281,21 +1431,44 @@ namespace bgfx
 		case ViewMode::Sequential:      m_key.m_seq   = s_ctx->getSeqIncr(_id); type = SortKey::SortSequence; break;
 		case ViewMode::DepthAscending:  m_key.m_depth =            _depth;      type = SortKey::SortDepth;    break;
 		case ViewMode::DepthDescending: m_key.m_depth = UINT32_MAX-_depth;      type = SortKey::SortDepth;    break;
+		case ViewMode::State:
+			{
+				// Only hashes go into the key, draws that collide get grouped together, which is
+				// harmless since renderer still checks actual state before changing it.
+				const uint64_t state[] = { _state, _stencil };
+				m_key.m_depth = _depth;
+				m_key.m_bind  = uint16_t(_bindHash >> (32-BGFX_CONFIG_SORT_KEY_NUM_BITS_BIND) );
+				m_key.m_state = uint16_t(bx::hash<bx::HashMurmur2A>(state, sizeof(state) ) >> (32-BGFX_CONFIG_SORT_KEY_NUM_BITS_STATE) );
+				type = SortKey::SortState;
+			}
+			break;
+
 		default:                        m_key.m_depth =            _depth;      type = SortKey::SortProgram;  break;
 		}
 
-		uint64_t key = m_key.encodeDraw(type);
+		return m_key.encodeDraw(type);
+	}
 
-		m_frame->m_sortKeys[renderItemIdx]   = key;
-		m_frame->m_sortValues[renderItemIdx] = RenderItemCount(renderItemIdx);
+	void EncoderImpl::recordDraw(ProgramHandle _program, OcclusionQueryHandle _occlusionQuery, uint32_t _depth)
+	{
+		DrawBundle& bundle = *m_drawBundle;
 
-		m_draw.m_uniformIdx   = m_uniformIdx;
-		m_draw.m_uniformBegin = m_uniformBegin;
-		m_draw.m_uniformEnd   = m_uniformEnd;
+		BX_WARN(!isValid(_occlusionQuery) && !isValid(m_draw.m_occlusionQuery)
+			, "Occlusion queries can't be recorded into draw bundle, ignoring occlusion query."
+			);
+
+		// Transient index/vertex buffers and instance data are referenced by offset into current
+		// frame transient buffers, and they would point to other data when bundle is replayed.
+		const uint16_t transientVb = m_frame->m_transientVb->handle.idx;
+		const uint16_t transientIb = m_frame->m_transientIb->handle.idx;
+
+		bool transient = false
+			|| transientIb == m_draw.m_indexBuffer.idx
+			|| transientVb == m_draw.m_instanceDataBuffer.idx
+			;
 
 		if (UINT8_MAX != m_draw.m_streamMask)
 		{
-			uint32_t numVertices = UINT32_MAX;
 			for (uint32_t idx = 0, streamMask = m_draw.m_streamMask
 				; 0 != streamMask
 				; streamMask >>= 1, idx += 1
@@ -1304,237 +1477,1292 @@ namespace bgfx
 				const uint32_t ntz = bx::uint32_cnttz(streamMask);
 				streamMask >>= ntz;
 				idx         += ntz;
-				numVertices = bx::min(numVertices, m_numVertices[idx]);
+				transient   |= transientVb == m_draw.m_stream[idx].m_handle.idx;
 			}
-
-			m_draw.m_numVertices = numVertices;
-		}
-		else
-		{
-			m_draw.m_numVertices = m_numVertices[0];
-		}
-
-		if (isValid(_occlusionQuery) )
-		{
-			m_draw.m_stateFlags |= BGFX_STATE_INTERNAL_OCCLUSION_QUERY;
-			m_draw.m_occlusionQuery = _occlusionQuery;
-		}
-
-		m_frame->m_renderItem[renderItemIdx].draw = m_draw;
-		m_frame->m_renderItemBind[renderItemIdx]  = m_bind;
-
-		m_draw.clear(_flags);
-		m_bind.clear(_flags);
-
-		m_uniformBegin = m_uniformEnd;
-	}
-
-	void EncoderImpl::dispatch(ViewId _id, ProgramHandle _handle, uint32_t _numX, uint32_t _numY, uint32_t _numZ, uint8_t _flags)
-	{
-		if (BX_ENABLED(BGFX_CONFIG_DEBUG_UNIFORM) )
-		{
-			m_uniformSet.clear();
 		}
 
-		if (m_discard)
+		if (transient)
 		{
-			discard(_flags);
+			BX_WARN(false
+				, "Transient index/vertex buffers and instance data buffers can't be recorded into draw bundle, draw call is dropped."
+				);
+			++m_numDropped;
 			return;
 		}
 
-		const uint32_t renderItemIdx = bx::atomicFetchAndAddsat<uint32_t>(&m_frame->m_numRenderItems, 1, BGFX_CONFIG_MAX_DRAW_CALLS);
-		if (BGFX_CONFIG_MAX_DRAW_CALLS-1 <= renderItemIdx)
+		uint16_t bindIdx;
+		if (!bundle.addBind(m_bind, bindIdx) )
 		{
-			discard(_flags);
 			++m_numDropped;
 			return;
 		}
 
-		++m_numSubmitted;
-
-		UniformBuffer* uniformBuffer = m_frame->m_uniformBuffer[m_uniformIdx];
-		m_uniformEnd = uniformBuffer->getPos();
-
-		m_compute.m_startMatrix = m_draw.m_startMatrix;
-		m_compute.m_numMatrices = m_draw.m_numMatrices;
-		m_compute.m_numX   = bx::max(_numX, 1u);
-		m_compute.m_numY   = bx::max(_numY, 1u);
-		m_compute.m_numZ   = bx::max(_numZ, 1u);
-
-		m_key.m_program = _handle;
-		m_key.m_depth   = 0;
-		m_key.m_view    = _id;
-		m_key.m_seq     = s_ctx->getSeqIncr(_id);
-
-		uint64_t key = m_key.encodeCompute();
-		m_frame->m_sortKeys[renderItemIdx]   = key;
-		m_frame->m_sortValues[renderItemIdx] = RenderItemCount(renderItemIdx);
+		DrawBundle::Draw& draw = bundle.addDraw();
+		draw.m_draw    = m_draw;
+		draw.m_program = _program;
+		draw.m_depth   = _depth;
+		draw.m_blend   = m_key.m_blend;
 
-		m_compute.m_uniformIdx   = m_uniformIdx;
-		m_compute.m_uniformBegin = m_uniformBegin;
-		m_compute.m_uniformEnd   = m_uniformEnd;
-		m_frame->m_renderItem[renderItemIdx].compute = m_compute;
-		m_frame->m_renderItemBind[renderItemIdx]     = m_bind;
+		RenderDraw& rd = draw.m_draw;
+		rd.m_bindIdx            = bindIdx;
+		rd.m_occlusionQuery.idx = kInvalidHandle;
+		rd.m_submitFlags       &= ~BGFX_SUBMIT_INTERNAL_OCCLUSION_VISIBLE;
 
-		m_compute.clear(_flags);
-		m_bind.clear(_flags);
-		m_uniformBegin = m_uniformEnd;
-	}
+		// Uniforms are copied into bundle, and space they used in frame uniform buffer is reused
+		// by the next draw call.
+		UniformBuffer* uniformBuffer = m_frame->m_uniformBuffer[m_uniformIdx];
+		const uint32_t uniformSize = uniformBuffer->getPos() - m_uniformBegin;
+		rd.m_uniformBegin = bundle.addUniforms(uniformBuffer->getData(m_uniformBegin), uniformSize);
+		rd.m_uniformEnd   = rd.m_uniformBegin + uniformSize;
+		uniformBuffer->reset(m_uniformBegin);
+		m_uniformEnd = m_uniformBegin;
 
-	void EncoderImpl::blit(ViewId _id, TextureHandle _dst, uint8_t _dstMip, uint16_t _dstX, uint16_t _dstY, uint16_t _dstZ, TextureHandle _src, uint8_t _srcMip, uint16_t _srcX, uint16_t _srcY, uint16_t _srcZ, uint16_t _width, uint16_t _height, uint16_t _depth)
-	{
-		BX_WARN(m_frame->m_numBlitItems < BGFX_CONFIG_MAX_BLIT_ITEMS
-			, "Exceed number of available blit items per frame. BGFX_CONFIG_MAX_BLIT_ITEMS is %d. Skipping blit."
-			, BGFX_CONFIG_MAX_BLIT_ITEMS
-			);
-		if (m_frame->m_numBlitItems < BGFX_CONFIG_MAX_BLIT_ITEMS)
+		if (isValid(m_draw.m_uniformBlock) )
 		{
-			uint16_t item = m_frame->m_numBlitItems++;
+			UniformBuffer* uniformBlockBuffer = m_frame->m_uniformBlockBuffer[m_uniformIdx];
+			const uint32_t uniformBlockSize = uniformBlockBuffer->getPos() - m_draw.m_uniformBlockOffset;
+			rd.m_uniformBlockOffset = bundle.addUniformBlock(uniformBlockBuffer->getData(m_draw.m_uniformBlockOffset), uniformBlockSize);
+			uniformBlockBuffer->reset(m_draw.m_uniformBlockOffset);
+		}
 
-			BlitItem& bi = m_frame->m_blitItem[item];
-			bi.m_srcX    = _srcX;
-			bi.m_srcY    = _srcY;
-			bi.m_srcZ    = _srcZ;
-			bi.m_dstX    = _dstX;
-			bi.m_dstY    = _dstY;
-			bi.m_dstZ    = _dstZ;
-			bi.m_width   = _width;
-			bi.m_height  = _height;
-			bi.m_depth   = _depth;
-			bi.m_srcMip  = _srcMip;
-			bi.m_dstMip  = _dstMip;
-			bi.m_src     = _src;
-			bi.m_dst     = _dst;
+		// Matrix cache index 0 is identity, it doesn't need to be recorded.
+		rd.m_startMatrix = 0 != m_draw.m_startMatrix
+			? bundle.addMatrices(&m_frame->m_frameCache.m_matrixCache.m_cache[m_draw.m_startMatrix], m_draw.m_numMatrices)
+			: UINT32_MAX
+			;
 
-			BlitKey key;
-			key.m_view = _id;
-			key.m_item = item;
-			m_frame->m_blitKeys[item] = key.encode();
+		if (UINT16_MAX != m_draw.m_scissor)
+		{
+			draw.m_scissor = m_frame->m_frameCache.m_rectCache.m_cache[m_draw.m_scissor];
 		}
 	}
 
-	void Frame::sort()
+	// Draw bundle doesn't hold references to resources used by recorded draw calls. Draw calls
+	// referencing handles destroyed since recording are dropped, but handle that was destroyed
+	// and allocated again can't be detected.
+	static bool isDrawBundleValid(const DrawBundle& _bundle, const DrawBundle::Draw& _draw)
 	{
-		BGFX_PROFILER_SCOPE("bgfx/Sort", 0xff2040ff);
+		const RenderDraw& draw = _draw.m_draw;
+		const RenderBind& bind = _bundle.m_bind[draw.m_bindIdx];
 
-		ViewId viewRemap[BGFX_CONFIG_MAX_VIEWS];
-		for (uint32_t ii = 0; ii < BGFX_CONFIG_MAX_VIEWS; ++ii)
+		if (!s_ctx->m_programHandle.isValid(_draw.m_program.idx) )
 		{
-			viewRemap[m_viewRemap[ii] ] = ViewId(ii);
-
-			View& view = m_view[ii];
-			Rect rect(0, 0, uint16_t(m_resolution.width), uint16_t(m_resolution.height) );
+			return false;
+		}
 
-			if (isValid(view.m_fbh) )
+		if (UINT8_MAX != draw.m_streamMask)
+		{
+			for (uint32_t idx = 0, streamMask = draw.m_streamMask
+				; 0 != streamMask
+				; streamMask >>= 1, idx += 1
+				)
 			{
-				const FrameBufferRef& fbr = s_ctx->m_frameBufferRef[view.m_fbh.idx];
-				const BackbufferRatio::Enum bbRatio = fbr.m_window
-					? BackbufferRatio::Count
-					: BackbufferRatio::Enum(s_ctx->m_textureRef[fbr.un.m_th[0].idx].m_bbRatio)
-					;
+				const uint32_t ntz = bx::uint32_cnttz(streamMask);
+				streamMask >>= ntz;
+				idx         += ntz;
 
-				if (BackbufferRatio::Count != bbRatio)
+				if (!s_ctx->m_vertexBufferHandle.isValid(draw.m_stream[idx].m_handle.idx) )
 				{
-					getTextureSizeFromRatio(bbRatio, rect.m_width, rect.m_height);
-				}
-				else
-				{
-					rect.m_width  = fbr.m_width;
-					rect.m_height = fbr.m_height;
+					return false;
 				}
 			}
-
-			view.m_rect.intersect(rect);
-
-			if (!view.m_scissor.isZero() )
-			{
-				view.m_scissor.intersect(rect);
-			}
 		}
 
-		for (uint32_t ii = 0, num = m_numRenderItems; ii < num; ++ii)
+		if ( (isValid(draw.m_indexBuffer)        && !s_ctx->m_indexBufferHandle.isValid(draw.m_indexBuffer.idx) )
+		||   (isValid(draw.m_instanceDataBuffer) && !s_ctx->m_vertexBufferHandle.isValid(draw.m_instanceDataBuffer.idx) )
+		||   (isValid(draw.m_indirectBuffer)     && !s_ctx->m_vertexBufferHandle.isValid(draw.m_indirectBuffer.idx) )
+		||   (isValid(draw.m_numIndirectBuffer)  && !s_ctx->m_indexBufferHandle.isValid(draw.m_numIndirectBuffer.idx) )
+		||   (isValid(draw.m_uniformBlock)       && !s_ctx->m_uniformBlockHandle.isValid(draw.m_uniformBlock.idx) ) )
 		{
-			m_sortKeys[ii] = SortKey::remapView(m_sortKeys[ii], viewRemap);
+			return false;
 		}
 
-		bx::radixSort(m_sortKeys, s_ctx->m_tempKeys, m_sortValues, s_ctx->m_tempValues, m_numRenderItems);
-
-		for (uint32_t ii = 0, num = m_numBlitItems; ii < num; ++ii)
+		for (uint32_t stage = 0; stage < BGFX_CONFIG_MAX_TEXTURE_SAMPLERS; ++stage)
 		{
-			m_blitKeys[ii] = BlitKey::remapView(m_blitKeys[ii], viewRemap);
-		}
+			const Binding& binding = bind.m_bind[stage];
 
-		bx::radixSort(m_blitKeys, (uint32_t*)&s_ctx->m_tempKeys, m_numBlitItems);
-	}
-
-	RenderFrame::Enum renderFrame(int32_t _msecs)
-	{
-		if (BX_ENABLED(BGFX_CONFIG_MULTITHREADED) )
-		{
-			if (s_renderFrameCalled)
+			if (kInvalidHandle == binding.m_idx)
 			{
-				BGFX_CHECK_RENDER_THREAD();
+				continue;
 			}
 
-			if (NULL == s_ctx)
+			bool valid = true;
+
+			switch (binding.m_type)
 			{
-				s_renderFrameCalled = true;
-				s_threadIndex = ~BGFX_API_THREAD_MAGIC;
-				return RenderFrame::NoContext;
+			case Binding::Image:
+			case Binding::Texture:      valid = s_ctx->m_textureHandle.isValid(binding.m_idx);      break;
+			case Binding::IndexBuffer:  valid = s_ctx->m_indexBufferHandle.isValid(binding.m_idx);  break;
+			case Binding::VertexBuffer: valid = s_ctx->m_vertexBufferHandle.isValid(binding.m_idx); break;
 			}
 
-			int32_t msecs = -1 == _msecs
-				? BGFX_CONFIG_API_SEMAPHORE_TIMEOUT
-				: _msecs
-				;
-			RenderFrame::Enum result = s_ctx->renderFrame(msecs);
-			if (RenderFrame::Exiting == result)
+			if (!valid)
+			{
+				return false;
+			}
+		}
+
+		// Uniform data is stored in the same layout as in frame uniform buffer.
+		for (uint32_t pos = draw.m_uniformBegin; pos < draw.m_uniformEnd;)
+		{
+			uint32_t opcode;
+			bx::memCopy(&opcode, &_bundle.m_uniform[pos], sizeof(uint32_t) );
+			pos += sizeof(uint32_t);
+
+			if (UniformType::End == opcode)
+			{
+				break;
+			}
+
+			UniformType::Enum type;
+			uint16_t loc;
+			uint16_t num;
+			uint16_t copy;
+			UniformBuffer::decodeOpcode(opcode, type, loc, num, copy);
+
+			if (UniformType::Count > type
+			&&  !s_ctx->m_uniformHandle.isValid(loc) )
+			{
+				return false;
+			}
+
+			pos += copy ? g_uniformTypeSize[type]*num : sizeof(UniformHandle);
+		}
+
+		return true;
+	}
+
+	void EncoderImpl::submit(ViewId _id, const DrawBundle& _bundle, const void* _mtx)
+	{
+		BX_ASSERT(NULL == m_drawBundle, "Draw bundle can't be submitted while recording draw bundle.");
+
+		if (0 == _bundle.m_numDraws)
+		{
+			return;
+		}
+
+		// Bundle uniforms are appended after uniforms already set for the next draw call, then
+		// those pending uniforms are copied again after bundle uniforms, where the next draw call
+		// starts reading them.
+		const uint32_t numPending  = m_frame->m_uniformBuffer[m_uniformIdx]->getPos() - m_uniformBegin;
+		const uint32_t uniformSize = _bundle.m_uniformSize + numPending;
+		UniformBuffer::update(&m_frame->m_uniformBuffer[m_uniformIdx], uniformSize, bx::max<uint32_t>(uniformSize, 1<<20) );
+		UniformBuffer* uniformBuffer = m_frame->m_uniformBuffer[m_uniformIdx];
+
+		const uint32_t uniformBase = uniformBuffer->getPos();
+
+		if (0 != _bundle.m_uniformSize)
+		{
+			uniformBuffer->write(_bundle.m_uniform, _bundle.m_uniformSize);
+		}
+
+		if (0 != numPending)
+		{
+			uniformBuffer->write(uniformBuffer->getData(m_uniformBegin), numPending);
+		}
+
+		m_uniformBegin = uniformBase + _bundle.m_uniformSize;
+
+		// Uniform block data is written after uniform block already set for the next draw call.
+		uint32_t uniformBlockBase = 0;
+
+		if (0 != _bundle.m_uniformBlockSize)
+		{
+			UniformBuffer::update(&m_frame->m_uniformBlockBuffer[m_uniformIdx], _bundle.m_uniformBlockSize, bx::max<uint32_t>(_bundle.m_uniformBlockSize, 64<<10) );
+			UniformBuffer* uniformBlockBuffer = m_frame->m_uniformBlockBuffer[m_uniformIdx];
+
+			uniformBlockBase = uniformBlockBuffer->getPos();
+			uniformBlockBuffer->write(_bundle.m_uniformBlock, _bundle.m_uniformBlockSize);
+		}
+
+		// When transform is provided it replaces transforms of all recorded draw calls.
+		uint32_t numMatrices = 0;
+		uint32_t matrixBase  = 0;
+
+		if (NULL != _mtx)
+		{
+			numMatrices = 1;
+			matrixBase  = reserveMatrix(&numMatrices);
+			bx::memCopy(m_frame->m_frameCache.m_matrixCache.toPtr(matrixBase), _mtx, sizeof(Matrix4)*numMatrices);
+		}
+		else if (0 != _bundle.m_numMatrices)
+		{
+			numMatrices = _bundle.m_numMatrices;
+			matrixBase  = reserveMatrix(&numMatrices);
+			bx::memCopy(m_frame->m_frameCache.m_matrixCache.toPtr(matrixBase), _bundle.m_matrix, sizeof(Matrix4)*numMatrices);
+		}
+
+		const uint8_t blend = m_key.m_blend;
+
+		uint32_t lastBindIdx = UINT32_MAX;
+		uint16_t bindIdx     = 0;
+		uint32_t bindHash    = 0;
+
+		for (uint32_t ii = 0; ii < _bundle.m_numDraws; ++ii)
+		{
+			const DrawBundle::Draw& draw = _bundle.m_draw[ii];
+
+			if (!isDrawBundleValid(_bundle, draw) )
+			{
+				BX_WARN(false, "Draw bundle references destroyed handle, draw call is dropped.");
+				++m_numDropped;
+				continue;
+			}
+
+			if (isUploadPending(draw.m_draw, _bundle.m_bind[draw.m_draw.m_bindIdx]) )
+			{
+				++m_numPendingSkipped;
+				continue;
+			}
+
+			uint32_t renderItemIdx;
+			if ( (lastBindIdx != draw.m_draw.m_bindIdx && !internRenderBind(_bundle.m_bind[draw.m_draw.m_bindIdx], bindIdx, bindHash) )
+			||  !allocRenderItem(renderItemIdx) )
+			{
+				m_numDropped += _bundle.m_numDraws - ii;
+				break;
+			}
+
+			lastBindIdx = draw.m_draw.m_bindIdx;
+
+			++m_numSubmitted;
+
+			m_key.m_blend = draw.m_blend;
+			m_renderItemChunk->m_key[renderItemIdx] = encodeDrawKey(_id, draw.m_program, draw.m_depth, draw.m_draw.m_stateFlags, draw.m_draw.m_stencil, bindHash);
+
+			RenderDraw& rd = m_renderItemChunk->m_item[renderItemIdx].draw;
+			rd = draw.m_draw;
+			rd.m_uniformIdx    = m_uniformIdx;
+			rd.m_uniformBegin += uniformBase;
+			rd.m_uniformEnd   += uniformBase;
+			rd.m_bindIdx       = bindIdx;
+
+			if (isValid(rd.m_uniformBlock) )
+			{
+				rd.m_uniformBlockOffset += uniformBlockBase;
+			}
+
+			if (NULL != _mtx)
+			{
+				rd.m_startMatrix = 0 != numMatrices ? matrixBase : 0;
+				rd.m_numMatrices = 1;
+			}
+			else if (UINT32_MAX != rd.m_startMatrix
+				 &&  rd.m_startMatrix + rd.m_numMatrices <= numMatrices)
+			{
+				rd.m_startMatrix += matrixBase;
+			}
+			else
+			{
+				rd.m_startMatrix = 0;
+			}
+
+			if (UINT16_MAX != rd.m_scissor)
+			{
+				uint16_t scissor = UINT16_MAX;
+
+				if (reserveRect(scissor) )
+				{
+					m_frame->m_frameCache.m_rectCache.m_cache[scissor] = draw.m_scissor;
+				}
+
+				rd.m_scissor = scissor;
+			}
+		}
+
+		m_key.m_blend = blend;
+	}
+
+	void EncoderImpl::dispatch(ViewId _id, ProgramHandle _handle, uint32_t _numX, uint32_t _numY, uint32_t _numZ, uint8_t _flags)
+	{
+		if (BX_ENABLED(BGFX_CONFIG_DEBUG_UNIFORM) )
+		{
+			m_uniformSet.clear();
+		}
+
+		if (m_discard)
+		{
+			discard(_flags);
+			return;
+		}
+
+		BX_WARN(NULL == m_drawBundle, "Compute dispatch can't be recorded into draw bundle, ignoring dispatch.");
+		if (NULL != m_drawBundle)
+		{
+			discard(_flags);
+			++m_numDropped;
+			return;
+		}
+
+		if (s_ctx->m_uploadQueue.hasCreatePending()
+		&&  isUploadPending(m_bind) )
+		{
+			discard(_flags);
+			++m_numPendingSkipped;
+			return;
+		}
+
+		uint16_t bindIdx;
+		uint32_t renderItemIdx;
+		if (!allocRenderBind(bindIdx)
+		||  !allocRenderItem(renderItemIdx) )
+		{
+			discard(_flags);
+			++m_numDropped;
+			return;
+		}
+
+		++m_numSubmitted;
+
+		UniformBuffer* uniformBuffer = m_frame->m_uniformBuffer[m_uniformIdx];
+		m_uniformEnd = uniformBuffer->getPos();
+
+		m_compute.m_startMatrix = m_draw.m_startMatrix;
+		m_compute.m_numMatrices = m_draw.m_numMatrices;
+		m_compute.m_numX   = bx::max(_numX, 1u);
+		m_compute.m_numY   = bx::max(_numY, 1u);
+		m_compute.m_numZ   = bx::max(_numZ, 1u);
+
+		m_key.m_program = _handle;
+		m_key.m_depth   = 0;
+		m_key.m_view    = _id;
+		m_key.m_seq     = s_ctx->getSeqIncr(_id);
+
+		m_renderItemChunk->m_key[renderItemIdx] = m_key.encodeCompute();
+
+		m_compute.m_uniformIdx   = m_uniformIdx;
+		m_compute.m_uniformBegin = m_uniformBegin;
+		m_compute.m_uniformEnd   = m_uniformEnd;
+		m_compute.m_bindIdx      = bindIdx;
+		m_renderItemChunk->m_item[renderItemIdx].compute = m_compute;
+
+		m_compute.clear(_flags);
+		discardBind(_flags);
+		m_uniformBegin = m_uniformEnd;
+	}
+
+	void EncoderImpl::blit(ViewId _id, TextureHandle _dst, uint8_t _dstMip, uint16_t _dstX, uint16_t _dstY, uint16_t _dstZ, TextureHandle _src, uint8_t _srcMip, uint16_t _srcX, uint16_t _srcY, uint16_t _srcZ, uint16_t _width, uint16_t _height, uint16_t _depth)
+	{
+		if (s_ctx->m_uploadQueue.isCreatePending(UploadType::Texture, _src.idx) )
+		{
+			++m_numPendingSkipped;
+			return;
+		}
+
+		BX_WARN(m_frame->m_numBlitItems < BGFX_CONFIG_MAX_BLIT_ITEMS
+			, "Exceed number of available blit items per frame. BGFX_CONFIG_MAX_BLIT_ITEMS is %d. Skipping blit."
+			, BGFX_CONFIG_MAX_BLIT_ITEMS
+			);
+		if (m_frame->m_numBlitItems < BGFX_CONFIG_MAX_BLIT_ITEMS)
+		{
+			uint16_t item = m_frame->m_numBlitItems++;
+
+			BlitItem& bi = m_frame->m_blitItem[item];
+			bi.m_srcX    = _srcX;
+			bi.m_srcY    = _srcY;
+			bi.m_srcZ    = _srcZ;
+			bi.m_dstX    = _dstX;
+			bi.m_dstY    = _dstY;
+			bi.m_dstZ    = _dstZ;
+			bi.m_width   = _width;
+			bi.m_height  = _height;
+			bi.m_depth   = _depth;
+			bi.m_srcMip  = _srcMip;
+			bi.m_dstMip  = _dstMip;
+			bi.m_src     = _src;
+			bi.m_dst     = _dst;
+
+			BlitKey key;
+			key.m_view = _id;
+			key.m_item = item;
+			m_frame->m_blitKeys[item] = key.encode();
+		}
+	}
+
+	SortThreadPool::SortThreadPool()
+		: m_fn(NULL)
+		, m_numJobs(0)
+		, m_next(0)
+		, m_numThreads(0)
+		, m_exit(false)
+		, m_keys(NULL)
+		, m_values(NULL)
+		, m_tempKeys(NULL)
+		, m_tempValues(NULL)
+		, m_numRuns(0)
+		, m_numViews(0)
+	{
+	}
+
+	void SortThreadPool::init(uint32_t _numThreads)
+	{
+		m_exit       = false;
+		m_numThreads = bx::min<uint32_t>(_numThreads, BGFX_CONFIG_MAX_SORT_THREADS);
+
+		for (uint32_t ii = 0; ii < m_numThreads; ++ii)
+		{
+			m_thread[ii].init(workerThread, this, 0, "bgfx - sort worker thread");
+		}
+
+		BX_TRACE("Sort worker threads: %d", m_numThreads);
+	}
+
+	void SortThreadPool::shutdown()
+	{
+		if (0 == m_numThreads)
+		{
+			return;
+		}
+
+		m_exit = true;
+		m_workSem.post(m_numThreads);
+
+		for (uint32_t ii = 0; ii < m_numThreads; ++ii)
+		{
+			m_thread[ii].shutdown();
+		}
+
+		m_numThreads = 0;
+	}
+
+	int32_t SortThreadPool::workerThread(bx::Thread* /*_self*/, void* _userData)
+	{
+		BGFX_PROFILER_SET_CURRENT_THREAD_NAME("bgfx - Sort Worker Thread");
+
+		SortThreadPool* pool = (SortThreadPool*)_userData;
+
+		for (;;)
+		{
+			pool->m_workSem.wait();
+
+			if (pool->m_exit)
+			{
+				break;
+			}
+
+			pool->work();
+			pool->m_doneSem.post();
+		}
+
+		return 0;
+	}
+
+	void SortThreadPool::work()
+	{
+		for (uint32_t idx = bx::atomicFetchAndAdd<uint32_t>(&m_next, 1)
+			; idx < m_numJobs
+			; idx = bx::atomicFetchAndAdd<uint32_t>(&m_next, 1)
+			)
+		{
+			m_fn(this, idx);
+		}
+	}
+
+	void SortThreadPool::dispatch(JobFn _fn, uint32_t _num)
+	{
+		m_fn      = _fn;
+		m_numJobs = _num;
+		m_next    = 0;
+
+		m_workSem.post(m_numThreads);
+
+		// Render thread is working on jobs too.
+		work();
+
+		for (uint32_t ii = 0; ii < m_numThreads; ++ii)
+		{
+			m_doneSem.wait();
+		}
+	}
+
+	void SortThreadPool::sortRun(SortThreadPool* _pool, uint32_t _idx)
+	{
+		const Run& run = _pool->m_run[_idx];
+
+		// Sorted run ends up in temp buffer, main buffer is used as scratch.
+		bx::radixSort(
+			  &_pool->m_tempKeys[run.m_begin]
+			, &_pool->m_keys[run.m_begin]
+			, &_pool->m_tempValues[run.m_begin]
+			, &_pool->m_values[run.m_begin]
+			, run.m_num
+			);
+	}
+
+	void SortThreadPool::mergeView(SortThreadPool* _pool, uint32_t _idx)
+	{
+		const ViewRuns& vr = _pool->m_viewRuns[_idx];
+
+		uint64_t*        srcKeys   = _pool->m_tempKeys;
+		RenderItemCount* srcValues = _pool->m_tempValues;
+		uint64_t*        dstKeys   = _pool->m_keys;
+		RenderItemCount* dstValues = _pool->m_values;
+
+		Run run[BGFX_CONFIG_MAX_SORT_THREADS+2];
+		uint32_t numRuns = vr.m_numRuns;
+		bx::memCopy(run, &_pool->m_run[vr.m_firstRun], numRuns*sizeof(Run) );
+
+		while (1 < numRuns)
+		{
+			uint32_t numMerged = 0;
+
+			for (uint32_t ii = 0; ii < numRuns; ii += 2)
+			{
+				const Run& aa = run[ii];
+
+				if (ii + 1 == numRuns)
+				{
+					bx::memCopy(&dstKeys[aa.m_begin],   &srcKeys[aa.m_begin],   aa.m_num*sizeof(uint64_t) );
+					bx::memCopy(&dstValues[aa.m_begin], &srcValues[aa.m_begin], aa.m_num*sizeof(RenderItemCount) );
+					run[numMerged++] = aa;
+					continue;
+				}
+
+				const Run& bb = run[ii+1];
+
+				// Stable merge, on equal keys item from earlier run goes first.
+				uint32_t ia  = aa.m_begin;
+				uint32_t ib  = bb.m_begin;
+				uint32_t dst = aa.m_begin;
+				const uint32_t ea = aa.m_begin + aa.m_num;
+				const uint32_t eb = bb.m_begin + bb.m_num;
+
+				while (ia < ea && ib < eb)
+				{
+					const bool takeB = srcKeys[ib] < srcKeys[ia];
+					const uint32_t src = takeB ? ib++ : ia++;
+					dstKeys[dst]   = srcKeys[src];
+					dstValues[dst] = srcValues[src];
+					++dst;
+				}
+
+				bx::memCopy(&dstKeys[dst],   &srcKeys[ia],   (ea-ia)*sizeof(uint64_t) );
+				bx::memCopy(&dstValues[dst], &srcValues[ia], (ea-ia)*sizeof(RenderItemCount) );
+				dst += ea-ia;
+				bx::memCopy(&dstKeys[dst],   &srcKeys[ib],   (eb-ib)*sizeof(uint64_t) );
+				bx::memCopy(&dstValues[dst], &srcValues[ib], (eb-ib)*sizeof(RenderItemCount) );
+
+				Run& merged = run[numMerged++];
+				merged.m_begin = aa.m_begin;
+				merged.m_num   = aa.m_num + bb.m_num;
+			}
+
+			numRuns = numMerged;
+			bx::swap(srcKeys,   dstKeys);
+			bx::swap(srcValues, dstValues);
+		}
+
+		if (srcKeys != _pool->m_keys)
+		{
+			bx::memCopy(&_pool->m_keys[vr.m_begin],   &srcKeys[vr.m_begin],   vr.m_num*sizeof(uint64_t) );
+			bx::memCopy(&_pool->m_values[vr.m_begin], &srcValues[vr.m_begin], vr.m_num*sizeof(RenderItemCount) );
+		}
+	}
+
+	void SortThreadPool::sort(uint64_t* _keys, RenderItemCount* _values, uint64_t* _tempKeys, RenderItemCount* _tempValues, uint32_t _num)
+	{
+		BGFX_PROFILER_SCOPE("bgfx/Sort parallel", 0xff2040ff);
+
+		m_keys       = _keys;
+		m_values     = _values;
+		m_tempKeys   = _tempKeys;
+		m_tempValues = _tempValues;
+
+		// Bucket keys by view. Scatter is stable, keeping submit order of equal keys.
+		bx::memSet(m_viewCount, 0, sizeof(m_viewCount) );
+
+		for (uint32_t ii = 0; ii < _num; ++ii)
+		{
+			++m_viewCount[_keys[ii] >> kSortKeyViewBitShift];
+		}
+
+		const uint32_t runSize = bx::max<uint32_t>(
+			  BGFX_CONFIG_SORT_PARALLEL_MIN_ITEMS/4
+			, (_num + m_numThreads) / (m_numThreads + 1)
+			);
+
+		m_numRuns  = 0;
+		m_numViews = 0;
+
+		for (uint32_t ii = 0, offset = 0; ii < BGFX_CONFIG_MAX_VIEWS; ++ii)
+		{
+			const uint32_t count = m_viewCount[ii];
+			m_viewCount[ii] = offset;
+
+			if (0 == count)
+			{
+				continue;
+			}
+
+			ViewRuns& vr = m_viewRuns[m_numViews++];
+			vr.m_begin    = offset;
+			vr.m_num      = count;
+			vr.m_firstRun = uint16_t(m_numRuns);
+			vr.m_numRuns  = 0;
+
+			for (uint32_t jj = 0; jj < count; jj += runSize)
+			{
+				Run& run = m_run[m_numRuns++];
+				run.m_begin = offset + jj;
+				run.m_num   = bx::min<uint32_t>(runSize, count - jj);
+				++vr.m_numRuns;
+			}
+
+			offset += count;
+		}
+
+		for (uint32_t ii = 0; ii < _num; ++ii)
+		{
+			const uint64_t key = _keys[ii];
+			const uint32_t dst = m_viewCount[key >> kSortKeyViewBitShift]++;
+			_tempKeys[dst]   = key;
+			_tempValues[dst] = _values[ii];
+		}
+
+		dispatch(sortRun,   m_numRuns);
+		dispatch(mergeView, m_numViews);
+	}
+
+	void Frame::sort()
+	{
+		BGFX_PROFILER_SCOPE("bgfx/Sort", 0xff2040ff);
+
+		ViewId viewRemap[BGFX_CONFIG_MAX_VIEWS];
+		for (uint32_t ii = 0; ii < BGFX_CONFIG_MAX_VIEWS; ++ii)
+		{
+			viewRemap[m_viewRemap[ii] ] = ViewId(ii);
+		}
+
+		const uint32_t numChunks = bx::min(m_numRenderItemChunks, m_maxRenderItemChunks);
+
+		uint32_t numRenderItems = 0;
+		for (uint32_t ii = 0; ii < numChunks; ++ii)
+		{
+			numRenderItems += m_renderItemChunk[ii]->m_num;
+		}
+
+		// Draws over the limit are rejected by encoder at submit (see Stats::numDrawsDropped).
+		BX_ASSERT(numRenderItems <= g_caps.limits.maxDrawCalls
+			, "Too many draw calls %d, max %d."
+			, numRenderItems
+			, g_caps.limits.maxDrawCalls
+			);
+		m_numRenderItems = numRenderItems;
+
+		if (m_sortCapacity < m_numRenderItems)
+		{
+			m_sortCapacity = bx::max(m_numRenderItems, m_sortCapacity*2);
+			m_sortKeys     = (uint64_t*)bx::realloc(g_allocator, m_sortKeys, m_sortCapacity*sizeof(uint64_t) );
+			m_sortValues   = (RenderItemCount*)bx::realloc(g_allocator, m_sortValues, m_sortCapacity*sizeof(RenderItemCount) );
+		}
+
+		s_ctx->reserveTempSort(m_numRenderItems);
+
+		uint64_t activeView[(BGFX_CONFIG_MAX_VIEWS+63)/64] = {};
+
+		for (uint32_t ii = 0, num = 0; ii < numChunks && num < m_numRenderItems; ++ii)
+		{
+			const RenderItemChunk* chunk = m_renderItemChunk[ii];
+
+			for (uint32_t jj = 0, end = bx::min(chunk->m_num, m_numRenderItems-num); jj < end; ++jj, ++num)
+			{
+				const uint64_t key = chunk->m_key[jj];
+				const ViewId   id  = SortKey::decodeView(key);
+				activeView[id/64] |= UINT64_C(1) << (id%64);
+
+				m_sortKeys[num]   = SortKey::remapView(key, viewRemap);
+				m_sortValues[num] = RenderItemCount(chunk->m_first + jj);
+			}
+		}
+
+		m_numActiveViews = 0;
+
+		for (uint32_t ii = 0; ii < BX_COUNTOF(activeView); ++ii)
+		{
+			for (uint64_t bits = activeView[ii]; 0 != bits; bits &= bits-1)
+			{
+				m_activeView[m_numActiveViews++] = ViewId(ii*64 + uint32_t(bx::uint64_cnttz(bits) ) );
+			}
+		}
+
+		// Only views that have render items are used by renderer, the rest keep rect and scissor
+		// as set by API.
+		for (uint32_t ii = 0; ii < m_numActiveViews; ++ii)
+		{
+			const ViewId id = m_activeView[ii];
+
+			View& view = m_view[id];
+			view.m_rect    = m_viewRect[id];
+			view.m_scissor = m_viewScissor[id];
+
+			Rect rect(0, 0, uint16_t(m_resolution.width), uint16_t(m_resolution.height) );
+
+			if (isValid(view.m_fbh) )
+			{
+				if (NULL == m_frameReplaySource
+				||  !m_frameReplaySource->getFrameBufferSize(view.m_fbh, rect.m_width, rect.m_height) )
+				{
+					rendererGetFrameBufferSize(view.m_fbh, rect.m_width, rect.m_height);
+				}
+			}
+
+			view.m_rect.intersect(rect);
+
+			if (!view.m_scissor.isZero() )
+			{
+				view.m_scissor.intersect(rect);
+			}
+		}
+
+		if (0 < s_ctx->m_sortThreadPool.getNumThreads()
+		&&  BGFX_CONFIG_SORT_PARALLEL_MIN_ITEMS <= m_numRenderItems)
+		{
+			s_ctx->m_sortThreadPool.sort(m_sortKeys, m_sortValues, s_ctx->m_tempKeys, s_ctx->m_tempValues, m_numRenderItems);
+		}
+		else
+		{
+			bx::radixSort(m_sortKeys, s_ctx->m_tempKeys, m_sortValues, s_ctx->m_tempValues, m_numRenderItems);
+		}
+
+		for (uint32_t ii = 0, num = m_numBlitItems; ii < num; ++ii)
+		{
+			m_blitKeys[ii] = BlitKey::remapView(m_blitKeys[ii], viewRemap);
+		}
+
+		bx::radixSort(m_blitKeys, (uint32_t*)s_ctx->m_tempKeys, m_numBlitItems);
+
+		batchMultiDraw();
+	}
+
+	static bool isMultiDrawCandidate(const RenderDraw& _draw)
+	{
+		return true
+			&& 1 == _draw.m_streamMask
+			&& 1 >= _draw.m_numMatrices
+			&& 1 == _draw.m_numInstances
+			&& UINT32_MAX != _draw.m_numIndices
+			&& isValid(_draw.m_indexBuffer)
+			&& !isValid(_draw.m_instanceDataBuffer)
+			&& !isValid(_draw.m_indirectBuffer)
+			&& !isValid(_draw.m_occlusionQuery)
+			;
+	}
+
+	static bool isMultiDrawCompatible(const Frame& _frame, const RenderDraw& _first, const RenderDraw& _draw)
+	{
+		// Uniforms set for first item in run stay bound for the rest of run, so items that
+		// follow must not change any.
+		if (_first.m_stateFlags                   != _draw.m_stateFlags
+		||  _first.m_stencil                      != _draw.m_stencil
+		||  _first.m_rgba                         != _draw.m_rgba
+		||  _first.m_scissor                      != _draw.m_scissor
+		||  _first.m_submitFlags                  != _draw.m_submitFlags
+		||  _first.m_indexBuffer.idx              != _draw.m_indexBuffer.idx
+		||  _first.m_stream[0].m_handle.idx       != _draw.m_stream[0].m_handle.idx
+		||  _first.m_stream[0].m_layoutHandle.idx != _draw.m_stream[0].m_layoutHandle.idx
+		||  _draw.m_uniformBegin                  != _draw.m_uniformEnd
+		||  isValid(_draw.m_uniformBlock) )
+		{
+			return false;
+		}
+
+		if (_first.m_bindIdx == _draw.m_bindIdx)
+		{
+			return true;
+		}
+
+		const RenderBind& first = _frame.getRenderBind(_first.m_bindIdx);
+		const RenderBind& bind  = _frame.getRenderBind(_draw.m_bindIdx);
+
+		for (uint32_t stage = 0; stage < BGFX_CONFIG_MAX_TEXTURE_SAMPLERS; ++stage)
+		{
+			const Binding& aa = first.m_bind[stage];
+			const Binding& bb = bind.m_bind[stage];
+
+			if (aa.m_idx          != bb.m_idx
+			||  aa.m_type         != bb.m_type
+			||  aa.m_samplerFlags != bb.m_samplerFlags
+			||  aa.m_format       != bb.m_format
+			||  aa.m_access       != bb.m_access
+			||  aa.m_mip          != bb.m_mip)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	void Frame::batchMultiDraw()
+	{
+		m_numMultiDrawRuns  = 0;
+		m_numMultiDrawItems = 0;
+
+		bool enabled = false;
+		for (uint32_t ii = 0; ii < m_numActiveViews; ++ii)
+		{
+			enabled |= m_view[m_activeView[ii] ].m_multiDraw;
+		}
+
+		if (!enabled)
+		{
+			return;
+		}
+
+		BGFX_PROFILER_SCOPE("bgfx/Batch multi-draw", 0xff2040ff);
+
+		if (m_multiDrawCapacity < m_numRenderItems)
+		{
+			m_multiDrawCapacity = bx::max(m_numRenderItems, m_multiDrawCapacity*2);
+			m_multiDrawRun      = (MultiDrawRun*)bx::realloc(g_allocator, m_multiDrawRun, m_multiDrawCapacity*sizeof(MultiDrawRun) );
+		}
+
+		SortKey key;
+
+		for (uint32_t item = 0; item < m_numRenderItems;)
+		{
+			const bool isCompute = key.decode(m_sortKeys[item], m_viewRemap);
+			const RenderDraw& first = getRenderItem(m_sortValues[item]).draw;
+
+			if (isCompute
+			||  !m_view[key.m_view].m_multiDraw
+			||  !isMultiDrawProgram(key.m_program)
+			||  !isMultiDrawCandidate(first) )
+			{
+				++item;
+				continue;
+			}
+
+			uint32_t num = 1;
+
+			for (; item+num < m_numRenderItems; ++num)
+			{
+				SortKey next;
+				if (next.decode(m_sortKeys[item+num], m_viewRemap)
+				||  next.m_view        != key.m_view
+				||  next.m_program.idx != key.m_program.idx)
+				{
+					break;
+				}
+
+				const RenderDraw& draw = getRenderItem(m_sortValues[item+num]).draw;
+
+				if (!isMultiDrawCandidate(draw)
+				||  !isMultiDrawCompatible(*this, first, draw) )
+				{
+					break;
+				}
+			}
+
+			if (1 == num)
+			{
+				// Nothing to batch, item is submitted as regular draw call.
+				++item;
+				continue;
+			}
+
+			MultiDrawRun& run = m_multiDrawRun[m_numMultiDrawRuns++];
+			run.m_item  = item;
+			run.m_num   = num;
+			run.m_first = m_numMultiDrawItems;
+
+			m_numMultiDrawItems += num;
+			item += num;
+		}
+	}
+
+	RenderFrame::Enum renderFrame(int32_t _msecs)
+	{
+		if (BX_ENABLED(BGFX_CONFIG_MULTITHREADED) )
+		{
+			if (s_renderFrameCalled)
+			{
+				BGFX_CHECK_RENDER_THREAD();
+			}
+
+			if (NULL == s_ctx)
+			{
+				s_renderFrameCalled = true;
+				s_threadIndex = ~BGFX_API_THREAD_MAGIC;
+				return RenderFrame::NoContext;
+			}
+
+			int32_t msecs = -1 == _msecs
+				? BGFX_CONFIG_API_SEMAPHORE_TIMEOUT
+				: _msecs
+				;
+			RenderFrame::Enum result = s_ctx->renderFrame(msecs);
+			if (RenderFrame::Exiting == result)
 			{
 				Context* ctx = s_ctx;
 				ctx->apiSemWait();
 				s_ctx = NULL;
 				ctx->renderSemPost();
 			}
-
-			return result;
+
+			return result;
+		}
+
+		BX_ASSERT(false, "This call only makes sense if used with multi-threaded renderer.");
+		return RenderFrame::NoContext;
+	}
+
+	const uint32_t g_uniformTypeSize[UniformType::Count+1] =
+	{
+		sizeof(int32_t),
+		0,
+		4*sizeof(float),
+		3*3*sizeof(float),
+		4*4*sizeof(float),
+		1,
+	};
+
+	void UniformBuffer::writeUniform(UniformType::Enum _type, uint16_t _loc, const void* _value, uint16_t _num)
+	{
+		const uint32_t opcode = encodeOpcode(_type, _loc, _num, true);
+		write(opcode);
+		write(_value, g_uniformTypeSize[_type]*_num);
+	}
+
+	void UniformBuffer::writeUniformHandle(UniformType::Enum _type, uint16_t _loc, UniformHandle _handle, uint16_t _num)
+	{
+		const uint32_t opcode = encodeOpcode(_type, _loc, _num, false);
+		write(opcode);
+		write(&_handle, sizeof(UniformHandle) );
+	}
+
+	void UniformBuffer::writeMarker(const bx::StringView& _name)
+	{
+		const uint16_t num = bx::narrowCast<uint16_t>(_name.getLength()+1);
+		const uint32_t opcode = encodeOpcode(bgfx::UniformType::Count, 0, num, true);
+		write(opcode);
+		write(_name.getPtr(), num-1);
+		const char zero = '\0';
+		write(&zero, 1);
+	}
+
+	NonLocalAllocator::NonLocalAllocator()
+	{
+		reset();
+	}
+
+	NonLocalAllocator::~NonLocalAllocator()
+	{
+	}
+
+	void NonLocalAllocator::reset()
+	{
+		m_block.clear();
+		m_unusedBlock.clear();
+		m_used.clear();
+
+		m_flBitmap = 0;
+		bx::memSet(m_slBitmap, 0,    sizeof(m_slBitmap) );
+		bx::memSet(m_head,     0xff, sizeof(m_head) );
+
+		m_size     = 0;
+		m_usedSize = 0;
+		m_numFree  = 0;
+	}
+
+	void NonLocalAllocator::add(uint64_t _ptr, uint32_t _size)
+	{
+		const uint32_t idx = allocBlock();
+
+		Block& block = m_block[idx];
+		block.m_ptr      = _ptr;
+		block.m_size     = _size;
+		block.m_prevPhys = kInvalidIndex;
+		block.m_nextPhys = kInvalidIndex;
+
+		m_size += _size;
+
+		insertFree(idx);
+	}
+
+	uint64_t NonLocalAllocator::remove()
+	{
+		BX_ASSERT(0 == m_used.size(), "");
+
+		if (0 == m_flBitmap)
+		{
+			return kInvalidBlock;
+		}
+
+		const uint32_t fl  = bx::uint32_cnttz(m_flBitmap);
+		const uint32_t sl  = bx::uint32_cnttz(m_slBitmap[fl]);
+		const uint32_t idx = m_head[fl][sl];
+
+		const Block& block = m_block[idx];
+		BX_ASSERT(kInvalidIndex == block.m_prevPhys
+			&&    kInvalidIndex == block.m_nextPhys
+			, "Removing partial block, free blocks are not coalesced."
+			);
+
+		const uint64_t ptr = block.m_ptr;
+		m_size -= block.m_size;
+
+		removeFree(idx);
+		releaseBlock(idx);
+
+		return ptr;
+	}
+
+	uint64_t NonLocalAllocator::alloc(uint32_t _size)
+	{
+		const uint32_t size = bx::alignUp(bx::max(_size, kMinSize), kMinSize);
+
+		const uint32_t idx = findFree(size);
+		if (kInvalidIndex == idx)
+		{
+			// there is no block large enough.
+			return kInvalidBlock;
+		}
+
+		removeFree(idx);
+
+		if (m_block[idx].m_size - size >= kMinSize)
+		{
+			// Split remainder into new free block. Block array might grow, so references are
+			// taken only after allocating.
+			const uint32_t rest = allocBlock();
+
+			Block& block = m_block[idx];
+			Block& remainder = m_block[rest];
+			remainder.m_ptr      = block.m_ptr  + size;
+			remainder.m_size     = block.m_size - size;
+			remainder.m_prevPhys = idx;
+			remainder.m_nextPhys = block.m_nextPhys;
+
+			if (kInvalidIndex != block.m_nextPhys)
+			{
+				m_block[block.m_nextPhys].m_prevPhys = rest;
+			}
+
+			block.m_nextPhys = rest;
+			block.m_size     = size;
+
+			insertFree(rest);
+		}
+
+		Block& block = m_block[idx];
+		block.m_free = false;
+
+		m_usedSize += block.m_size;
+		m_used.insert(stl::make_pair(block.m_ptr, idx) );
+
+		return block.m_ptr;
+	}
+
+	void NonLocalAllocator::free(uint64_t _block)
+	{
+		UsedMap::iterator it = m_used.find(_block);
+		if (it == m_used.end() )
+		{
+			return;
+		}
+
+		uint32_t idx = it->second;
+		m_used.erase(it);
+
+		m_usedSize -= m_block[idx].m_size;
+
+		const uint32_t prev = m_block[idx].m_prevPhys;
+		if (kInvalidIndex != prev
+		&&  m_block[prev].m_free)
+		{
+			removeFree(prev);
+
+			Block& block = m_block[prev];
+			block.m_size    += m_block[idx].m_size;
+			block.m_nextPhys = m_block[idx].m_nextPhys;
+
+			if (kInvalidIndex != block.m_nextPhys)
+			{
+				m_block[block.m_nextPhys].m_prevPhys = prev;
+			}
+
+			releaseBlock(idx);
+			idx = prev;
+		}
+
+		const uint32_t next = m_block[idx].m_nextPhys;
+		if (kInvalidIndex != next
+		&&  m_block[next].m_free)
+		{
+			removeFree(next);
+
+			Block& block = m_block[idx];
+			block.m_size    += m_block[next].m_size;
+			block.m_nextPhys = m_block[next].m_nextPhys;
+
+			if (kInvalidIndex != block.m_nextPhys)
+			{
+				m_block[block.m_nextPhys].m_prevPhys = idx;
+			}
+
+			releaseBlock(next);
+		}
+
+		insertFree(idx);
+	}
+
+	bool NonLocalAllocator::compact()
+	{
+		return 0 == m_used.size();
+	}
+
+	void NonLocalAllocator::getStats(NonLocalAllocatorStats& _outStats) const
+	{
+		_outStats.m_used          = m_usedSize;
+		_outStats.m_free          = m_size - m_usedSize;
+		_outStats.m_largestFree   = 0;
+		_outStats.m_numFreeBlocks = m_numFree;
+
+		if (0 != m_flBitmap)
+		{
+			// Largest free block is in highest non-empty size class list.
+			const uint32_t fl = 31 - bx::uint32_cntlz(m_flBitmap);
+			const uint32_t sl = 31 - bx::uint32_cntlz(m_slBitmap[fl]);
+
+			for (uint32_t idx = m_head[fl][sl]; kInvalidIndex != idx; idx = m_block[idx].m_nextFree)
+			{
+				_outStats.m_largestFree = bx::max<uint64_t>(_outStats.m_largestFree, m_block[idx].m_size);
+			}
+		}
+	}
+
+	void NonLocalAllocator::mapping(uint32_t _size, uint32_t& _outFl, uint32_t& _outSl)
+	{
+		const uint32_t fl = 31 - bx::uint32_cntlz(_size);
+		_outFl = fl;
+		_outSl = (_size >> (fl - kSlBits) ) ^ kSlCount;
+	}
+
+	uint32_t NonLocalAllocator::findFree(uint32_t _size) const
+	{
+		uint32_t fl;
+		uint32_t sl;
+
+		// Round size up to next size class, so that any block from found list fits.
+		const uint64_t rounded = uint64_t(_size) + (UINT64_C(1) << (31 - bx::uint32_cntlz(_size) - kSlBits) ) - 1;
+		if (rounded <= UINT32_MAX)
+		{
+			mapping(uint32_t(rounded), fl, sl);
+
+			uint32_t slBitmap = m_slBitmap[fl] & (UINT32_MAX << sl);
+			if (0 == slBitmap)
+			{
+				const uint32_t flBitmap = uint32_t(uint64_t(m_flBitmap) & (UINT64_MAX << (fl + 1) ) );
+				if (0 != flBitmap)
+				{
+					fl = bx::uint32_cnttz(flBitmap);
+					slBitmap = m_slBitmap[fl];
+				}
+			}
+
+			if (0 != slBitmap)
+			{
+				return m_head[fl][bx::uint32_cnttz(slBitmap)];
+			}
+		}
+
+		// Blocks in same size class as requested size might still be large enough.
+		mapping(_size, fl, sl);
+
+		for (uint32_t idx = m_head[fl][sl]; kInvalidIndex != idx; idx = m_block[idx].m_nextFree)
+		{
+			if (m_block[idx].m_size >= _size)
+			{
+				return idx;
+			}
 		}
 
-		BX_ASSERT(false, "This call only makes sense if used with multi-threaded renderer.");
-		return RenderFrame::NoContext;
+		return kInvalidIndex;
 	}
 
-	const uint32_t g_uniformTypeSize[UniformType::Count+1] =
+	uint32_t NonLocalAllocator::allocBlock()
 	{
-		sizeof(int32_t),
-		0,
-		4*sizeof(float),
-		3*3*sizeof(float),
-		4*4*sizeof(float),
-		1,
-	};
+		if (!m_unusedBlock.empty() )
+		{
+			const uint32_t idx = m_unusedBlock.back();
+			m_unusedBlock.pop_back();
+			return idx;
+		}
 
-	void UniformBuffer::writeUniform(UniformType::Enum _type, uint16_t _loc, const void* _value, uint16_t _num)
+		const Block block = {};
+		m_block.push_back(block);
+
+		return uint32_t(m_block.size() - 1);
+	}
+
+	void NonLocalAllocator::releaseBlock(uint32_t _idx)
 	{
-		const uint32_t opcode = encodeOpcode(_type, _loc, _num, true);
-		write(opcode);
-		write(_value, g_uniformTypeSize[_type]*_num);
+		m_unusedBlock.push_back(_idx);
 	}
 
-	void UniformBuffer::writeUniformHandle(UniformType::Enum _type, uint16_t _loc, UniformHandle _handle, uint16_t _num)
+	void NonLocalAllocator::insertFree(uint32_t _idx)
 	{
-		const uint32_t opcode = encodeOpcode(_type, _loc, _num, false);
-		write(opcode);
-		write(&_handle, sizeof(UniformHandle) );
+		uint32_t fl;
+		uint32_t sl;
+		mapping(m_block[_idx].m_size, fl, sl);
+
+		const uint32_t head = m_head[fl][sl];
+
+		Block& block = m_block[_idx];
+		block.m_free     = true;
+		block.m_prevFree = kInvalidIndex;
+		block.m_nextFree = head;
+
+		if (kInvalidIndex != head)
+		{
+			m_block[head].m_prevFree = _idx;
+		}
+
+		m_head[fl][sl] = _idx;
+		m_flBitmap     |= UINT32_C(1) << fl;
+		m_slBitmap[fl] |= UINT32_C(1) << sl;
+
+		++m_numFree;
 	}
 
-	void UniformBuffer::writeMarker(const bx::StringView& _name)
+	void NonLocalAllocator::removeFree(uint32_t _idx)
 	{
-		const uint16_t num = bx::narrowCast<uint16_t>(_name.getLength()+1);
-		const uint32_t opcode = encodeOpcode(bgfx::UniformType::Count, 0, num, true);
-		write(opcode);
-		write(_name.getPtr(), num-1);
-		const char zero = '\0';
-		write(&zero, 1);
+		uint32_t fl;
+		uint32_t sl;
+		mapping(m_block[_idx].m_size, fl, sl);
+
+		Block& block = m_block[_idx];
+
+		if (kInvalidIndex != block.m_prevFree)
+		{
+			m_block[block.m_prevFree].m_nextFree = block.m_nextFree;
+		}
+		else
+		{
+			m_head[fl][sl] = block.m_nextFree;
+
+			if (kInvalidIndex == block.m_nextFree)
+			{
+				m_slBitmap[fl] &= ~(UINT32_C(1) << sl);
+
+				if (0 == m_slBitmap[fl])
+				{
+					m_flBitmap &= ~(UINT32_C(1) << fl);
+				}
+			}
+		}
+
+		if (kInvalidIndex != block.m_nextFree)
+		{
+			m_block[block.m_nextFree].m_prevFree = block.m_prevFree;
+		}
+
+		block.m_free     = false;
+		block.m_prevFree = kInvalidIndex;
+		block.m_nextFree = kInvalidIndex;
+
+		--m_numFree;
 	}
 
 	struct CapsFlags
@@ -1639,6 +2867,13 @@ namespace bgfx
 		BX_TRACE("\tD2 Blend    %016" PRIx64, kSortKeyDraw2BlendMask);
 		BX_TRACE("\tD2 Program  %016" PRIx64, kSortKeyDraw2ProgramMask);
 
+		BX_TRACE("");
+		BX_TRACE("\tD3 Blend    %016" PRIx64, kSortKeyDraw3BlendMask);
+		BX_TRACE("\tD3 Program  %016" PRIx64, kSortKeyDraw3ProgramMask);
+		BX_TRACE("\tD3 Bind     %016" PRIx64, kSortKeyDraw3BindMask);
+		BX_TRACE("\tD3 State    %016" PRIx64, kSortKeyDraw3StateMask);
+		BX_TRACE("\tD3 Depth    %016" PRIx64, kSortKeyDraw3DepthMask);
+
 		BX_TRACE("");
 		BX_TRACE("\t C Seq      %016" PRIx64, kSortKeyComputeSeqMask);
 		BX_TRACE("\t C Program  %016" PRIx64, kSortKeyComputeProgramMask);
@@ -1681,10 +2916,15 @@ namespace bgfx
 		LIMITS(maxDynamicVertexBuffers);
 		LIMITS(maxUniforms);
 		LIMITS(maxOcclusionQueries);
+		LIMITS(maxDrawBundles);
 		LIMITS(maxEncoders);
 		LIMITS(minResourceCbSize);
 		LIMITS(transientVbSize);
 		LIMITS(transientIbSize);
+		LIMITS(numSortThreads);
+		LIMITS(numRecordThreads);
+		LIMITS(numDecodeThreads);
+		LIMITS(maxFramesInFlight);
 #undef LIMITS
 
 		BX_TRACE("");
@@ -1767,6 +3007,7 @@ namespace bgfx
 		BX_TRACE("\t[%c] Hi-DPI",                  0 != (reset & BGFX_RESET_HIDPI)                  ? 'x' : ' ');
 		BX_TRACE("\t[%c] Depth Clamp",             0 != (reset & BGFX_RESET_DEPTH_CLAMP)            ? 'x' : ' ');
 		BX_TRACE("\t[%c] Suspend",                 0 != (reset & BGFX_RESET_SUSPEND)                ? 'x' : ' ');
+		BX_TRACE("\t[%c] Async Pipeline",          0 != (reset & BGFX_RESET_ASYNC_PIPELINE)         ? 'x' : ' ');
 	}
 
 	TextureFormat::Enum getViableTextureFormat(const bimg::ImageContainer& _imageContainer)
@@ -1930,10 +3171,28 @@ namespace bgfx
 		m_frameTimeLast = bx::getHPCounter();
 		m_flipAfterRender = !!(m_init.resolution.reset & BGFX_RESET_FLIP_AFTER_RENDER);
 
-		m_submit->create(_init.limits.minResourceCbSize);
+		if (BX_ENABLED(BGFX_CONFIG_PROFILER) )
+		{
+			g_profilerTimeline.init(g_allocator, BGFX_CONFIG_PROFILER_TIMELINE_NUM_EVENTS);
+		}
+
+		m_numFrames = 1 + (BX_ENABLED(BGFX_CONFIG_MULTITHREADED) ? _init.limits.maxFramesInFlight : 0);
+		m_uploadQueue.init(_init.limits.uploadBudget);
+		m_textureStreaming.init(_init.limits.textureStreamingBudget);
+		m_renderIdx = 0;
+		m_submitIdx = 0;
+		m_render    = &m_frame[0];
+		m_submit    = &m_frame[0];
+
+		for (uint32_t ii = 0; ii < m_numFrames; ++ii)
+		{
+			m_frame[ii].create(_init.limits.minResourceCbSize);
+		}
+
+		m_sortThreadPool.init(_init.limits.numSortThreads);
+		m_textureDecoder.init(_init.limits.numDecodeThreads);
 
 #if BGFX_CONFIG_MULTITHREADED
-		m_render->create(_init.limits.minResourceCbSize);
 
 		if (s_renderFrameCalled)
 		{
@@ -1958,12 +3217,17 @@ namespace bgfx
 		BX_TRACE("Running in %s-threaded mode", m_singleThreaded ? "single" : "multi");
 
 		s_threadIndex = BGFX_API_THREAD_MAGIC;
+		BGFX_PROFILER_SET_CURRENT_THREAD_NAME("bgfx - API Thread");
 
 		for (uint32_t ii = 0; ii < BX_COUNTOF(m_viewRemap); ++ii)
 		{
 			m_viewRemap[ii] = ViewId(ii);
 		}
 
+		m_viewRemapDirty = uint8_t(m_numFrames);
+
+		bx::memSet(m_viewDirty, 0, sizeof(m_viewDirty) );
+
 		for (uint32_t ii = 0; ii < BGFX_CONFIG_MAX_VIEWS; ++ii)
 		{
 			resetView(ViewId(ii) );
@@ -2010,10 +3274,15 @@ namespace bgfx
 			frame();
 			frame();
 			m_vertexLayoutRef.shutdown(m_layoutHandle);
-			m_submit->destroy();
-#if BGFX_CONFIG_MULTITHREADED
-			m_render->destroy();
-#endif // BGFX_CONFIG_MULTITHREADED
+
+			for (uint32_t ii = 0; ii < m_numFrames; ++ii)
+			{
+				m_frame[ii].destroy();
+			}
+
+			m_sortThreadPool.shutdown();
+			m_textureDecoder.shutdown();
+			g_profilerTimeline.shutdown();
 			return false;
 		}
 
@@ -2047,17 +3316,20 @@ namespace bgfx
 		m_textVideoMemBlitter.init(m_init.resolution.debugTextScale);
 		m_clearQuad.init();
 
-		m_submit->m_transientVb = createTransientVertexBuffer(_init.limits.transientVbSize);
-		m_submit->m_transientIb = createTransientIndexBuffer(_init.limits.transientIbSize);
-		frame();
-
-		if (BX_ENABLED(BGFX_CONFIG_MULTITHREADED) )
+		for (uint32_t ii = 0; ii < m_numFrames; ++ii)
 		{
 			m_submit->m_transientVb = createTransientVertexBuffer(_init.limits.transientVbSize);
 			m_submit->m_transientIb = createTransientIndexBuffer(_init.limits.transientIbSize);
 			frame();
 		}
 
+		// Until this point API thread waited for each frame to be rendered. Additional frames
+		// in flight let API thread run ahead of render thread.
+		for (uint32_t ii = 1; ii < m_numFrames-1; ++ii)
+		{
+			renderSemPrime();
+		}
+
 		g_internalData.caps = getCaps();
 
 		return true;
@@ -2065,6 +3337,18 @@ namespace bgfx
 
 	void Context::shutdown()
 	{
+		// Wait for all frames in flight, shutdown sequence expects render thread to be at
+		// most one frame behind.
+		for (uint32_t ii = 1; ii < m_numFrames-1; ++ii)
+		{
+			renderSemWait();
+		}
+
+		stopFrameCapture();
+		textureDecodeShutdown();
+		uploadQueueShutdown();
+		m_textureStreaming.shutdown();
+
 		getCommandBuffer(CommandBuffer::RendererShutdownBegin);
 		frame();
 
@@ -2074,7 +3358,7 @@ namespace bgfx
 		m_clearQuad.shutdown();
 		frame();
 
-		if (BX_ENABLED(BGFX_CONFIG_MULTITHREADED) )
+		for (uint32_t ii = 1; ii < m_numFrames; ++ii)
 		{
 			destroyTransientVertexBuffer(m_submit->m_transientVb);
 			destroyTransientIndexBuffer(m_submit->m_transientIb);
@@ -2111,6 +3395,11 @@ namespace bgfx
 
 		m_vertexLayoutRef.shutdown(m_layoutHandle);
 
+		for (uint32_t ii = 0; ii < BX_COUNTOF(m_drawBundle); ++ii)
+		{
+			m_drawBundle[ii].destroy();
+		}
+
 #if BGFX_CONFIG_MULTITHREADED
 		// Render thread shutdown sequence.
 		renderSemWait(); // Wait for previous frame.
@@ -2122,14 +3411,25 @@ namespace bgfx
 		{
 			m_thread.shutdown();
 		}
-
-		m_render->destroy();
 #endif // BGFX_CONFIG_MULTITHREADED
 
+		m_sortThreadPool.shutdown();
+		m_textureDecoder.shutdown();
+		g_profilerTimeline.shutdown();
+
+		bx::free(g_allocator, m_tempKeys);
+		bx::free(g_allocator, m_tempValues);
+		m_tempKeys     = NULL;
+		m_tempValues   = NULL;
+		m_tempCapacity = 0;
+
 		bx::memSet(&g_internalData, 0, sizeof(InternalData) );
 		s_ctx = NULL;
 
-		m_submit->destroy();
+		for (uint32_t ii = 0; ii < m_numFrames; ++ii)
+		{
+			m_frame[ii].destroy();
+		}
 
 		if (BX_ENABLED(BGFX_CONFIG_DEBUG) )
 		{
@@ -2205,6 +3505,8 @@ namespace bgfx
 			CHECK_HANDLE_LEAK_NAME   ("FrameBufferHandle",         m_frameBufferHandle,        FrameBufferRef, m_frameBufferRef);
 			CHECK_HANDLE_LEAK_RC_NAME("UniformHandle",             m_uniformHandle,            UniformRef,     m_uniformRef    );
 			CHECK_HANDLE_LEAK        ("OcclusionQueryHandle",      m_occlusionQueryHandle                                      );
+			CHECK_HANDLE_LEAK        ("DrawBundleHandle",          m_drawBundleHandle                                          );
+			CHECK_HANDLE_LEAK        ("UniformBlockHandle",        m_uniformBlockHandle                                        );
 #undef CHECK_HANDLE_LEAK
 #undef CHECK_HANDLE_LEAK_NAME
 		}
@@ -2272,6 +3574,11 @@ namespace bgfx
 		{
 			m_uniformHandle.free(_frame->m_freeUniform.get(ii).idx);
 		}
+
+		for (uint16_t ii = 0, num = _frame->m_freeUniformBlock.getNumQueued(); ii < num; ++ii)
+		{
+			m_uniformBlockHandle.free(_frame->m_freeUniformBlock.get(ii).idx);
+		}
 	}
 
 	Encoder* Context::begin(bool _forThread)
@@ -2291,6 +3598,8 @@ namespace bgfx
 
 			encoder = &m_encoder[idx];
 			encoder->begin(m_submit, uint8_t(idx) );
+
+			BGFX_PROFILER_BEGIN_LITERAL("bgfx/Encoder", 0xff2040ff);
 		}
 #else
 		BX_UNUSED(_forThread);
@@ -2301,99 +3610,413 @@ namespace bgfx
 
 	void Context::end(Encoder* _encoder)
 	{
-#if BGFX_CONFIG_MULTITHREADED
-		EncoderImpl* encoder = reinterpret_cast<EncoderImpl*>(_encoder);
-		if (encoder != &m_encoder[0])
+#if BGFX_CONFIG_MULTITHREADED
+		EncoderImpl* encoder = reinterpret_cast<EncoderImpl*>(_encoder);
+		if (encoder != &m_encoder[0])
+		{
+			encoder->end(true);
+
+			BGFX_PROFILER_END();
+			m_encoderEndSem.post();
+		}
+#else
+		BX_UNUSED(_encoder);
+#endif // BGFX_CONFIG_MULTITHREADED
+	}
+
+	uint32_t Context::frame(bool _capture)
+	{
+		g_profilerTimeline.frame();
+
+		m_encoder[0].end(true);
+
+#if BGFX_CONFIG_MULTITHREADED
+		bx::MutexScope resourceApiScope(m_resourceApiLock);
+
+		encoderApiWait();
+		bx::MutexScope encoderApiScope(m_encoderApiLock);
+#else
+		encoderApiWait();
+#endif // BGFX_CONFIG_MULTITHREADED
+
+		m_submit->m_capture = _capture;
+
+		uint32_t frameNum = m_submit->m_frameNum;
+
+		BGFX_PROFILER_SCOPE("bgfx/API thread frame", 0xff2040ff);
+		// wait for render thread to finish
+		renderSemWait();
+		frameNoRenderWait();
+
+		m_encoder[0].begin(m_submit, 0);
+
+		return frameNum;
+	}
+
+	void Context::frameNoRenderWait()
+	{
+		swap();
+
+		// release render thread
+		apiSemPost();
+	}
+
+	void Context::swap()
+	{
+		textureDecodeUpdate();
+		textureStreamingUpdate();
+
+		if (0 != m_uploadQueue.getNum() )
+		{
+			uploadQueueIssue(m_uploadQueue.select() );
+		}
+
+		freeDynamicBuffers();
+		m_submit->m_resolution = m_init.resolution;
+		m_init.resolution.reset &= ~BGFX_RESET_INTERNAL_FORCE;
+		m_submit->m_debug = m_debug;
+		m_submit->m_fallbackProgram = m_fallbackProgram;
+		bx::memCopy(m_submit->m_multiDrawProgram, m_multiDrawProgram, sizeof(m_multiDrawProgram) );
+		m_submit->m_perfStats.numViews = 0;
+
+		if (m_viewRemapDirty > 0)
+		{
+			--m_viewRemapDirty;
+			bx::memCopy(m_submit->m_viewRemap, m_viewRemap, sizeof(m_viewRemap) );
+		}
+
+		uint64_t* viewDirty = m_viewDirty[m_submitIdx];
+		for (uint32_t ii = 0; ii < BX_COUNTOF(m_viewDirty[0]); ++ii)
+		{
+			for (uint64_t bits = viewDirty[ii]; 0 != bits; bits &= bits-1)
+			{
+				const uint32_t id = ii*64 + uint32_t(bx::uint64_cnttz(bits) );
+				bx::memCopy(&m_submit->m_view[id], &m_view[id], sizeof(View) );
+				m_submit->m_viewRect[id]    = m_view[id].m_rect;
+				m_submit->m_viewScissor[id] = m_view[id].m_scissor;
+			}
+
+			viewDirty[ii] = 0;
+		}
+
+		if (m_colorPaletteDirty > 0)
+		{
+			--m_colorPaletteDirty;
+			bx::memCopy(m_submit->m_colorPalette, m_clearColor, sizeof(m_clearColor) );
+		}
+
+		freeAllHandles(m_submit);
+		m_submit->resetFreeHandles();
+
+		m_submit->finish();
+
+		// Next frame in ring was already rendered, renderSemWait made sure render thread is
+		// done with it.
+		Frame* submitted = m_submit;
+		m_submitIdx = (m_submitIdx + 1) % m_numFrames;
+		m_submit    = &m_frame[m_submitIdx];
+		++m_numFramesSubmitted;
+
+		bx::memCopy(submitted->m_occlusion, m_submit->m_occlusion, sizeof(m_submit->m_occlusion) );
+
+		if (!BX_ENABLED(BGFX_CONFIG_MULTITHREADED)
+		||  m_singleThreaded)
+		{
+			renderFrame();
+		}
+
+		uint32_t nextFrameNum = submitted->m_frameNum + 1;
+		m_submit->start(nextFrameNum);
+
+		if (0 != bx::atomicExchange<uint32_t>(&m_frameCaptureEnded, 0) )
+		{
+			// Render thread ended capture without stopFrameCapture being called.
+			m_frameCaptureActive = false;
+		}
+
+		if (m_frameCaptureActive)
+		{
+			m_submit->transientToCpu(false);
+		}
+
+		m_submit->m_perfStats.numFramesInFlight = m_numFramesSubmitted - bx::atomicFetchAndAdd<uint32_t>(&m_numFramesRendered, 0);
+
+		bx::memSet(m_seq, 0, sizeof(m_seq) );
+
+		m_submit->m_textVideoMem->resize(
+			  submitted->m_textVideoMem->m_small
+			, m_init.resolution.width
+			, m_init.resolution.height
+			);
+
+		int64_t now = bx::getHPCounter();
+		m_submit->m_perfStats.cpuTimeFrame = now - m_frameTimeLast;
+		m_frameTimeLast = now;
+	}
+
+	void Context::uploadQueueIssue(uint32_t _num)
+	{
+		for (uint32_t ii = 0; ii < _num; ++ii)
+		{
+			const UploadQueue::Item& item = m_uploadQueue.get(ii);
+
+			switch (item.m_cmd)
+			{
+			case CommandBuffer::CreateIndexBuffer:
+				{
+					const IndexBufferHandle handle = { item.m_handle };
+
+					CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::CreateIndexBuffer);
+					cmdbuf.write(handle);
+					cmdbuf.write(item.m_mem);
+					cmdbuf.write(uint16_t(item.m_flags) );
+
+					setUploadNameForHandle(handle, m_indexBuffers[handle.idx].m_name);
+				}
+				break;
+
+			case CommandBuffer::CreateVertexBuffer:
+				{
+					const VertexBufferHandle handle = { item.m_handle };
+					const VertexLayoutHandle layoutHandle = { item.m_layout };
+
+					CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::CreateVertexBuffer);
+					cmdbuf.write(handle);
+					cmdbuf.write(item.m_mem);
+					cmdbuf.write(layoutHandle);
+					cmdbuf.write(uint16_t(item.m_flags) );
+
+					setUploadNameForHandle(handle, m_vertexBuffers[handle.idx].m_name);
+				}
+				break;
+
+			case CommandBuffer::CreateTexture:
+				{
+					const TextureHandle handle = { item.m_handle };
+
+					CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::CreateTexture);
+					cmdbuf.write(handle);
+					cmdbuf.write(item.m_mem);
+					cmdbuf.write(item.m_flags);
+					cmdbuf.write(item.m_skip);
+
+					setUploadNameForHandle(handle, m_textureRef[handle.idx].m_name);
+				}
+				break;
+
+			case CommandBuffer::UpdateTexture:
+				{
+					const TextureHandle handle = { item.m_handle };
+
+					Rect rect;
+					rect.m_x      = item.m_x;
+					rect.m_y      = item.m_y;
+					rect.m_width  = item.m_width;
+					rect.m_height = item.m_height;
+
+					CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::UpdateTexture);
+					cmdbuf.write(handle);
+					cmdbuf.write(item.m_side);
+					cmdbuf.write(item.m_mip);
+					cmdbuf.write(rect);
+					cmdbuf.write(item.m_z);
+					cmdbuf.write(item.m_depth);
+					cmdbuf.write(item.m_pitch);
+					cmdbuf.write(item.m_mem);
+				}
+				break;
+
+			default:
+				BX_ASSERT(false, "Invalid upload command %d.", item.m_cmd);
+				break;
+			}
+		}
+
+		m_uploadQueue.pop(_num);
+	}
+
+	bool Context::uploadQueueDiscard(UploadType::Enum _type, uint16_t _handle)
+	{
+		// Resource is destroyed, remaining uploads are dropped. When its create command wasn't
+		// issued yet, renderer never sees resource.
+		const bool createPending = m_uploadQueue.isCreatePending(_type, _handle);
+		const uint32_t num = m_uploadQueue.select(_type, _handle);
+
+		for (uint32_t ii = 0; ii < num; ++ii)
+		{
+			release(m_uploadQueue.get(ii).m_mem);
+		}
+
+		m_uploadQueue.pop(num);
+		m_uploadQueue.reset(_type, _handle);
+
+		return createPending;
+	}
+
+	void Context::uploadQueueShutdown()
+	{
+		// Only uploads of leaked resources can be left in queue.
+		for (uint32_t ii = 0, num = m_uploadQueue.getNum(); ii < num; ++ii)
 		{
-			encoder->end(true);
-			m_encoderEndSem.post();
+			release(m_uploadQueue.get(ii).m_mem);
 		}
-#else
-		BX_UNUSED(_encoder);
-#endif // BGFX_CONFIG_MULTITHREADED
+
+		m_uploadQueue.pop(m_uploadQueue.getNum() );
+		m_uploadQueue.shutdown();
 	}
 
-	uint32_t Context::frame(bool _capture)
+	void Context::textureDecodeIssue(TextureHandle _handle)
 	{
-		m_encoder[0].end(true);
+		const Memory* src;
+		uint8_t skip;
+		const Memory* mem = m_textureDecoder.finish(_handle, src, skip);
 
-#if BGFX_CONFIG_MULTITHREADED
-		bx::MutexScope resourceApiScope(m_resourceApiLock);
+		TextureRef& ref = m_textureRef[_handle.idx];
+		m_uploadQueue.setBlocked(UploadType::Texture, _handle.idx, false);
 
-		encoderApiWait();
-		bx::MutexScope encoderApiScope(m_encoderApiLock);
-#else
-		encoderApiWait();
-#endif // BGFX_CONFIG_MULTITHREADED
+		if (NULL == mem)
+		{
+			// Renderer converts texture, and updates queued while it was decoding, when it
+			// couldn't be decoded.
+			ref.m_decodeFormat = TextureFormat::Count;
+			return;
+		}
 
-		m_submit->m_capture = _capture;
+		UploadQueue::Item& item = m_uploadQueue.setCreateMem(UploadType::Texture, _handle.idx, mem);
+		item.m_skip = 0;
+		release(src);
 
-		uint32_t frameNum = m_submit->m_frameNum;
+		// Updates queued while texture was decoding are decoded to the same format.
+		for (uint32_t ii = 0, num = m_uploadQueue.select(UploadType::Texture, _handle.idx); ii < num; ++ii)
+		{
+			const UploadQueue::Item& update = m_uploadQueue.get(ii);
 
-		BGFX_PROFILER_SCOPE("bgfx/API thread frame", 0xff2040ff);
-		// wait for render thread to finish
-		renderSemWait();
-		frameNoRenderWait();
+			if (CommandBuffer::UpdateTexture != update.m_cmd)
+			{
+				continue;
+			}
 
-		m_encoder[0].begin(m_submit, 0);
+			const Memory* updateSrc = update.m_mem;
+			uint16_t pitch = update.m_pitch;
 
-		return frameNum;
+			const Memory* updateMem = TextureDecoder::decodeUpdate(
+				  updateSrc
+				, update.m_width
+				, update.m_height
+				, pitch
+				, TextureFormat::Enum(ref.m_format)
+				, TextureFormat::Enum(ref.m_decodeFormat)
+				);
+
+			m_uploadQueue.setMem(ii, updateMem).m_pitch = pitch;
+			release(updateSrc);
+		}
 	}
 
-	void Context::frameNoRenderWait()
+	void Context::textureDecodeUpdate()
 	{
-		swap();
-
-		// release render thread
-		apiSemPost();
+		// Only textures that finished decoding are created. Others stay create pending across
+		// frames, and draw calls using them are skipped.
+		for (TextureHandle handle = m_textureDecoder.getDone(); isValid(handle); handle = m_textureDecoder.getDone() )
+		{
+			textureDecodeIssue(handle);
+		}
 	}
 
-	void Context::swap()
+	void Context::textureDecodeShutdown()
 	{
-		freeDynamicBuffers();
-		m_submit->m_resolution = m_init.resolution;
-		m_init.resolution.reset &= ~BGFX_RESET_INTERNAL_FORCE;
-		m_submit->m_debug = m_debug;
-		m_submit->m_perfStats.numViews = 0;
-
-		bx::memCopy(m_submit->m_viewRemap, m_viewRemap, sizeof(m_viewRemap) );
-		bx::memCopy(m_submit->m_view, m_view, sizeof(m_view) );
-
-		if (m_colorPaletteDirty > 0)
+		for (uint16_t ii = 0; 0 != m_textureDecoder.getNum() && ii < BGFX_CONFIG_MAX_TEXTURES; ++ii)
 		{
-			--m_colorPaletteDirty;
-			bx::memCopy(m_submit->m_colorPalette, m_clearColor, sizeof(m_clearColor) );
+			const TextureHandle handle = { ii };
+
+			if (m_textureDecoder.isPending(handle) )
+			{
+				m_textureDecoder.discard(handle);
+			}
 		}
+	}
 
-		freeAllHandles(m_submit);
-		m_submit->resetFreeHandles();
+	void Context::textureStreamingUpdate()
+	{
+		// When renderer can't copy mips that stay resident into resized texture, all resident
+		// mips are uploaded again.
+		const bool copyMips = 0 != (g_caps.supported & BGFX_CAPS_TEXTURE_BLIT);
 
-		m_submit->finish();
+		for (uint32_t ii = 0, num = m_textureStreaming.update(copyMips); ii < num; ++ii)
+		{
+			const TextureStreaming::Change& change = m_textureStreaming.getChange(ii);
+			const TextureHandle handle = { change.m_handle };
+
+			// Texture must be created, and all of its previous updates must be issued before it's
+			// resized. Otherwise change is returned again next frame.
+			if (m_uploadQueue.isReady(UploadType::Texture, handle.idx) )
+			{
+				textureStreamingResize(handle, change, copyMips);
+			}
+		}
+	}
 
-		bx::swap(m_render, m_submit);
+	void Context::textureStreamingResize(TextureHandle _handle, const TextureStreaming::Change& _change, bool _copyMips)
+	{
+		uint16_t width;
+		uint16_t height;
+		uint8_t  numMips;
+		uint32_t storageSize;
+		m_textureStreaming.getResidentSize(_handle, _change.m_mip, width, height, numMips, storageSize);
 
-		bx::memCopy(m_render->m_occlusion, m_submit->m_occlusion, sizeof(m_submit->m_occlusion) );
+		if (_copyMips)
+		{
+			// Mips that stay resident are copied by renderer, evicted mips are dropped.
+			const uint8_t resident = m_textureStreaming.getResidentMip(_handle);
 
-		if (!BX_ENABLED(BGFX_CONFIG_MULTITHREADED)
-		||  m_singleThreaded)
+			CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::ResizeTextureMips);
+			cmdbuf.write(_handle);
+			cmdbuf.write(width);
+			cmdbuf.write(height);
+			cmdbuf.write(numMips);
+			cmdbuf.write(int8_t(_change.m_mip - resident) );
+		}
+		else
 		{
-			renderFrame();
+			CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::ResizeTexture);
+			cmdbuf.write(_handle);
+			cmdbuf.write(width);
+			cmdbuf.write(height);
+			cmdbuf.write(numMips);
+			cmdbuf.write(uint16_t(1) );
 		}
 
-		uint32_t nextFrameNum = m_render->m_frameNum + 1;
-		m_submit->start(nextFrameNum);
+		// Only mips that were read for change are uploaded.
+		for (uint8_t ii = 0; NULL != _change.m_mem && ii < numMips; ++ii)
+		{
+			const Memory* mem = _change.m_mem[_change.m_mip + ii];
 
-		bx::memSet(m_seq, 0, sizeof(m_seq) );
+			if (NULL == mem)
+			{
+				continue;
+			}
 
-		m_submit->m_textVideoMem->resize(
-			  m_render->m_textVideoMem->m_small
-			, m_init.resolution.width
-			, m_init.resolution.height
-			);
+			const Rect rect(0, 0, uint16_t(bx::max(1, width >> ii) ), uint16_t(bx::max(1, height >> ii) ) );
 
-		int64_t now = bx::getHPCounter();
-		m_submit->m_perfStats.cpuTimeFrame = now - m_frameTimeLast;
-		m_frameTimeLast = now;
+			CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::UpdateTexture);
+			cmdbuf.write(_handle);
+			cmdbuf.write(uint8_t(0) );
+			cmdbuf.write(ii);
+			cmdbuf.write(rect);
+			cmdbuf.write(uint16_t(0) );
+			cmdbuf.write(uint16_t(1) );
+			cmdbuf.write(uint16_t(UINT16_MAX) );
+			cmdbuf.write(mem);
+		}
+
+		TextureRef& ref = m_textureRef[_handle.idx];
+		m_textureMemoryUsed += int64_t(storageSize) - int64_t(ref.m_storageSize);
+		ref.m_storageSize = storageSize;
+		ref.m_width       = width;
+		ref.m_height      = height;
+		ref.m_numMips     = numMips;
+
+		m_textureStreaming.setResident(_handle, _change.m_mip);
 	}
 
 	///
@@ -2459,6 +4082,23 @@ namespace bgfx
 
 		if (apiSemWait(_msecs) )
 		{
+			if (NULL != m_render->m_frameCaptureWriter)
+			{
+				BX_ASSERT(NULL == m_frameCaptureWriter, "Frame capture is already active.");
+				m_frameCaptureWriter = m_render->m_frameCaptureWriter;
+			}
+
+			if (NULL != m_render->m_frameReplay)
+			{
+				frameReplayEnd();
+				m_frameReplay = m_render->m_frameReplay;
+			}
+
+			if (NULL != m_frameCaptureWriter)
+			{
+				m_frameCaptureWriter->writeCommands(m_render->m_cmdPre);
+			}
+
 			{
 				BGFX_PROFILER_SCOPE("bgfx/Exec commands pre", 0xff2040ff);
 				rendererExecCommands(m_render->m_cmdPre);
@@ -2466,12 +4106,47 @@ namespace bgfx
 
 			if (m_rendererInitialized)
 			{
+				if (NULL != m_frameCaptureWriter)
+				{
+					// Sort modifies view rects in place, frame must be written before submit.
+					m_frameCaptureWriter->writeFrame(m_render);
+				}
+
+				Frame* replay = NULL;
+
+				if (NULL != m_frameReplay)
+				{
+					// Replayed transient data is written over live frame transient data.
+					m_render->transientToCpu(false);
+					replay = m_frameReplay->read(m_render);
+
+					if (NULL == replay)
+					{
+						frameReplayEnd();
+					}
+					else
+					{
+						BGFX_PROFILER_SCOPE("bgfx/Exec replay commands pre", 0xff2040ff);
+						rendererExecCommands(replay->m_cmdPre);
+					}
+				}
+
 				{
 					BGFX_PROFILER_SCOPE("bgfx/Render submit", 0xff2040ff);
-					m_renderCtx->submit(m_render, m_clearQuad, m_textVideoMemBlitter);
+					m_renderCtx->submit(NULL != replay ? replay : m_render, m_clearQuad, m_textVideoMemBlitter);
 					m_flipped = false;
 				}
 
+				if (NULL != replay)
+				{
+					{
+						BGFX_PROFILER_SCOPE("bgfx/Exec replay commands post", 0xff2040ff);
+						rendererExecCommands(replay->m_cmdPost);
+					}
+
+					frameReplayStats(replay);
+				}
+
 				{
 					BGFX_PROFILER_SCOPE("bgfx/Screenshot", 0xff2040ff);
 					for (uint8_t ii = 0, num = m_render->m_numScreenShots; ii < num; ++ii)
@@ -2481,6 +4156,22 @@ namespace bgfx
 					}
 				}
 			}
+			else
+			{
+				frameCaptureEnd();
+				frameReplayEnd();
+			}
+
+			if (NULL != m_frameCaptureWriter)
+			{
+				m_frameCaptureWriter->writeCommands(m_render->m_cmdPost);
+				m_frameCaptureWriter->endFrame();
+
+				if (m_render->m_frameCaptureStop)
+				{
+					frameCaptureEnd();
+				}
+			}
 
 			{
 				BGFX_PROFILER_SCOPE("bgfx/Exec commands post", 0xff2040ff);
@@ -2506,6 +4197,98 @@ namespace bgfx
 			;
 	}
 
+	uint32_t Context::readbackBegin(void* _data, ReadbackFn _readbackFn, void* _userData)
+	{
+		BX_ASSERT(BGFX_CONFIG_MAX_READBACKS > m_readbackIssued - m_readbackComplete
+			, "Too many readbacks waiting for GPU (max: %d)."
+			, BGFX_CONFIG_MAX_READBACKS
+			);
+
+		const uint32_t ticket = ++m_readbackIssued;
+
+		Readback& readback = m_readback[ticket % BGFX_CONFIG_MAX_READBACKS];
+		readback.m_data       = _data;
+		readback.m_readbackFn = _readbackFn;
+		readback.m_userData   = _userData;
+		readback.m_done       = false;
+
+		return ticket;
+	}
+
+	void Context::readbackEnd(uint32_t _ticket, bool _ok)
+	{
+		Readback& readback = m_readback[_ticket % BGFX_CONFIG_MAX_READBACKS];
+		readback.m_data = _ok ? readback.m_data : NULL;
+		readback.m_done = true;
+
+		// Only render thread writes completed counter, API thread observes tickets in order.
+		while (m_readbackComplete != m_readbackIssued)
+		{
+			const Readback& next = m_readback[(m_readbackComplete + 1) % BGFX_CONFIG_MAX_READBACKS];
+
+			if (!next.m_done)
+			{
+				break;
+			}
+
+			bx::atomicFetchAndAdd<uint32_t>(&m_readbackComplete, 1);
+
+			if (NULL != next.m_readbackFn)
+			{
+				next.m_readbackFn(next.m_data, next.m_userData);
+			}
+		}
+	}
+
+	void Context::frameCaptureEnd()
+	{
+		if (NULL != m_frameCaptureWriter)
+		{
+			m_frameCaptureWriter->close();
+			bx::deleteObject(g_allocator, m_frameCaptureWriter);
+			m_frameCaptureWriter = NULL;
+
+			// When capture didn't end by stopFrameCapture request, API thread still considers
+			// it active and it wouldn't allow starting new capture.
+			if (!m_render->m_frameCaptureStop)
+			{
+				bx::atomicExchange<uint32_t>(&m_frameCaptureEnded, 1);
+			}
+		}
+	}
+
+	void Context::frameReplayEnd()
+	{
+		if (NULL != m_frameReplay)
+		{
+			m_frameReplay->close();
+			bx::deleteObject(g_allocator, m_frameReplay);
+			m_frameReplay = NULL;
+		}
+	}
+
+	void Context::frameReplayStats(const Frame* _replay)
+	{
+		// Renderer stats come from replayed frame, stats of API thread are kept from live frame.
+		Stats& stats = m_render->m_perfStats;
+		const Stats live = stats;
+
+		bx::memCopy(&stats, &_replay->m_perfStats, sizeof(Stats) );
+		bx::memCopy(m_render->m_viewStats, _replay->m_viewStats, sizeof(ViewStats)*_replay->m_perfStats.numViews);
+
+		stats.cpuTimeFrame         = live.cpuTimeFrame;
+		stats.waitRender           = live.waitRender;
+		stats.waitSubmit           = live.waitSubmit;
+		stats.numFramesInFlight    = live.numFramesInFlight;
+		stats.numTransformsDropped = live.numTransformsDropped;
+		stats.numScissorsDropped   = live.numScissorsDropped;
+		stats.numDrawsDropped      = live.numDrawsDropped;
+		stats.numPendingSkipped    = live.numPendingSkipped;
+		stats.numEncoders          = live.numEncoders;
+		stats.encoderStats         = live.encoderStats;
+		stats.viewStats            = m_render->m_viewStats;
+	}
+
 	void rendererUpdateUniforms(RendererContextI* _renderCtx, UniformBuffer* _uniformBuffer, uint32_t _begin, uint32_t _end)
 	{
 		_uniformBuffer->reset(_begin);
@@ -2545,6 +4328,76 @@ namespace bgfx
 		}
 	}
 
+	const UniformBlock& rendererGetUniformBlock(UniformBlockHandle _handle)
+	{
+		return s_ctx->m_uniformBlock[_handle.idx];
+	}
+
+	void rendererGetFrameBufferSize(FrameBufferHandle _handle, uint16_t& _width, uint16_t& _height)
+	{
+		const FrameBufferRef& fbr = s_ctx->m_frameBufferRef[_handle.idx];
+		const BackbufferRatio::Enum bbRatio = fbr.m_window
+			? BackbufferRatio::Count
+			: BackbufferRatio::Enum(s_ctx->m_textureRef[fbr.un.m_th[0].idx].m_bbRatio)
+			;
+
+		if (BackbufferRatio::Count != bbRatio)
+		{
+			getTextureSizeFromRatio(bbRatio, _width, _height);
+		}
+		else
+		{
+			_width  = fbr.m_width;
+			_height = fbr.m_height;
+		}
+	}
+
+	void rendererReadbackComplete(uint32_t _ticket)
+	{
+		s_ctx->readbackEnd(_ticket, true);
+	}
+
+	void rendererUpdateUniformBlock(RendererContextI* _renderCtx, const Frame* _render, const RenderDraw& _draw)
+	{
+		if (!isValid(_draw.m_uniformBlock) )
+		{
+			return;
+		}
+
+		const UniformBlock& block = s_ctx->m_uniformBlock[_draw.m_uniformBlock.idx];
+		const uint8_t* data = _render->getUniformBlockData(_draw);
+
+		// Single scratch buffer for unpacking Mat3 arrays, sized for the largest one in block.
+		uint32_t scratchSize = 0;
+		for (uint32_t ii = 0, num = block.m_num; ii < num; ++ii)
+		{
+			const UniformBlock::Uniform& uniform = block.m_uniform[ii];
+
+			if (UniformType::Mat3 == uniform.m_type)
+			{
+				scratchSize = bx::max<uint32_t>(scratchSize, g_uniformTypeSize[uniform.m_type]*uniform.m_num);
+			}
+		}
+
+		float* scratch = 0 != scratchSize ? (float*)alloca(scratchSize) : NULL;
+
+		for (uint32_t ii = 0, num = block.m_num; ii < num; ++ii)
+		{
+			const UniformBlock::Uniform& uniform = block.m_uniform[ii];
+			const uint32_t size = g_uniformTypeSize[uniform.m_type]*uniform.m_num;
+
+			if (UniformType::Mat3 == uniform.m_type)
+			{
+				UniformBlock::unpackMat3(scratch, &data[uniform.m_offset], uniform.m_num);
+				_renderCtx->updateUniform(uniform.m_handle.idx, scratch, size);
+			}
+			else
+			{
+				_renderCtx->updateUniform(uniform.m_handle.idx, &data[uniform.m_offset], size);
+			}
+		}
+	}
+
 	void Context::flushTextureUpdateBatch(CommandBuffer& _cmdbuf)
 	{
 		BGFX_PROFILER_SCOPE("flushTextureUpdateBatch", 0xff2040ff);
@@ -3175,46 +5028,134 @@ namespace bgfx
 						flushTextureUpdateBatch(_cmdbuf);
 					}
 
-					uint32_t value = _cmdbuf.m_pos;
+					uint32_t value = _cmdbuf.m_pos;
+
+					TextureHandle handle;
+					_cmdbuf.read(handle);
+
+					uint8_t side;
+					_cmdbuf.read(side);
+
+					uint8_t mip;
+					_cmdbuf.read(mip);
+
+					_cmdbuf.skip<Rect>();
+					_cmdbuf.skip<uint16_t>();
+					_cmdbuf.skip<uint16_t>();
+					_cmdbuf.skip<uint16_t>();
+					_cmdbuf.skip<Memory*>();
+
+					uint32_t key = (handle.idx<<16)
+						| (side<<8)
+						| mip
+						;
+
+					m_textureUpdateBatch.add(key, value);
+				}
+				break;
+
+			case CommandBuffer::ReadTexture:
+				{
+					BGFX_PROFILER_SCOPE("ReadTexture", 0xff2040ff);
+
+					TextureHandle handle;
+					_cmdbuf.read(handle);
+
+					void* data;
+					_cmdbuf.read(data);
+
+					uint8_t mip;
+					_cmdbuf.read(mip);
+
+					ReadbackFn readbackFn;
+					_cmdbuf.read(readbackFn);
+
+					void* userData;
+					_cmdbuf.read(userData);
+
+					// When too many readbacks are waiting for GPU, synchronous read back completes
+					// them before this one is issued.
+					const bool full = BGFX_CONFIG_MAX_READBACKS <= m_readbackIssued - m_readbackComplete;
+
+					if (full)
+					{
+						m_renderCtx->readTexture(handle, data, mip);
+						readbackEnd(readbackBegin(data, readbackFn, userData), true);
+					}
+					else
+					{
+						const uint32_t ticket = readbackBegin(data, readbackFn, userData);
+
+						if (!m_renderCtx->readTextureAsync(handle, data, mip, ticket) )
+						{
+							m_renderCtx->readTexture(handle, data, mip);
+							readbackEnd(ticket, true);
+						}
+					}
+				}
+				break;
+
+			case CommandBuffer::ReadIndexBuffer:
+				{
+					BGFX_PROFILER_SCOPE("ReadIndexBuffer", 0xff2040ff);
 
-					TextureHandle handle;
+					IndexBufferHandle handle;
 					_cmdbuf.read(handle);
 
-					uint8_t side;
-					_cmdbuf.read(side);
+					uint32_t offset;
+					_cmdbuf.read(offset);
 
-					uint8_t mip;
-					_cmdbuf.read(mip);
+					uint32_t size;
+					_cmdbuf.read(size);
 
-					_cmdbuf.skip<Rect>();
-					_cmdbuf.skip<uint16_t>();
-					_cmdbuf.skip<uint16_t>();
-					_cmdbuf.skip<uint16_t>();
-					_cmdbuf.skip<Memory*>();
+					void* data;
+					_cmdbuf.read(data);
 
-					uint32_t key = (handle.idx<<16)
-						| (side<<8)
-						| mip
-						;
+					ReadbackFn readbackFn;
+					_cmdbuf.read(readbackFn);
 
-					m_textureUpdateBatch.add(key, value);
+					void* userData;
+					_cmdbuf.read(userData);
+
+					const bool ok = m_renderCtx->readBuffer(handle, offset, size, data);
+					BX_WARN(ok, "Buffer read back is not supported by renderer.");
+					readbackEnd(readbackBegin(data, readbackFn, userData), ok);
 				}
 				break;
 
-			case CommandBuffer::ReadTexture:
+			case CommandBuffer::ReadVertexBuffer:
 				{
-					BGFX_PROFILER_SCOPE("ReadTexture", 0xff2040ff);
+					BGFX_PROFILER_SCOPE("ReadVertexBuffer", 0xff2040ff);
 
-					TextureHandle handle;
+					VertexBufferHandle handle;
 					_cmdbuf.read(handle);
 
+					uint32_t offset;
+					_cmdbuf.read(offset);
+
+					uint32_t size;
+					_cmdbuf.read(size);
+
 					void* data;
 					_cmdbuf.read(data);
 
-					uint8_t mip;
-					_cmdbuf.read(mip);
+					ReadbackFn readbackFn;
+					_cmdbuf.read(readbackFn);
 
-					m_renderCtx->readTexture(handle, data, mip);
+					void* userData;
+					_cmdbuf.read(userData);
+
+					const bool ok = m_renderCtx->readBuffer(handle, offset, size, data);
+					BX_WARN(ok, "Buffer read back is not supported by renderer.");
+					readbackEnd(readbackBegin(data, readbackFn, userData), ok);
+				}
+				break;
+
+			case CommandBuffer::FlushPipelineCache:
+				{
+					BGFX_PROFILER_SCOPE("FlushPipelineCache", 0xff2040ff);
+
+					m_renderCtx->flushPipelineCache();
 				}
 				break;
 
@@ -3241,6 +5182,29 @@ namespace bgfx
 				}
 				break;
 
+			case CommandBuffer::ResizeTextureMips:
+				{
+					BGFX_PROFILER_SCOPE("ResizeTextureMips", 0xff2040ff);
+
+					TextureHandle handle;
+					_cmdbuf.read(handle);
+
+					uint16_t width;
+					_cmdbuf.read(width);
+
+					uint16_t height;
+					_cmdbuf.read(height);
+
+					uint8_t numMips;
+					_cmdbuf.read(numMips);
+
+					int8_t srcMip;
+					_cmdbuf.read(srcMip);
+
+					m_renderCtx->resizeTextureMips(handle, width, height, numMips, srcMip);
+				}
+				break;
+
 			case CommandBuffer::DestroyTexture:
 				{
 					BGFX_PROFILER_SCOPE("DestroyTexture", 0xff2040ff);
@@ -3338,6 +5302,28 @@ namespace bgfx
 				}
 				break;
 
+			case CommandBuffer::CreateUniformBlock:
+				{
+					BGFX_PROFILER_SCOPE("CreateUniformBlock", 0xff2040ff);
+
+					UniformBlockHandle handle;
+					_cmdbuf.read(handle);
+
+					_cmdbuf.read(m_uniformBlock[handle.idx]);
+				}
+				break;
+
+			case CommandBuffer::DestroyUniformBlock:
+				{
+					BGFX_PROFILER_SCOPE("DestroyUniformBlock", 0xff2040ff);
+
+					UniformBlockHandle handle;
+					_cmdbuf.read(handle);
+
+					m_uniformBlock[handle.idx].m_num = 0;
+				}
+				break;
+
 			case CommandBuffer::UpdateViewName:
 				{
 					BGFX_PROFILER_SCOPE("UpdateViewName", 0xff2040ff);
@@ -3365,6 +5351,29 @@ namespace bgfx
 				}
 				break;
 
+			case CommandBuffer::WarmPipeline:
+				{
+					BGFX_PROFILER_SCOPE("WarmPipeline", 0xff2040ff);
+
+					FrameBufferHandle fbh;
+					_cmdbuf.read(fbh);
+
+					ProgramHandle program;
+					_cmdbuf.read(program);
+
+					VertexLayout layout;
+					_cmdbuf.read(layout);
+
+					uint64_t state;
+					_cmdbuf.read(state);
+
+					uint64_t stencil;
+					_cmdbuf.read(stencil);
+
+					m_renderCtx->warmPipeline(fbh, program, layout, state, stencil);
+				}
+				break;
+
 			case CommandBuffer::SetName:
 				{
 					BGFX_PROFILER_SCOPE("SetName", 0xff2040ff);
@@ -3467,6 +5476,13 @@ namespace bgfx
 		, minResourceCbSize(BGFX_CONFIG_MIN_RESOURCE_COMMAND_BUFFER_SIZE)
 		, transientVbSize(BGFX_CONFIG_TRANSIENT_VERTEX_BUFFER_SIZE)
 		, transientIbSize(BGFX_CONFIG_TRANSIENT_INDEX_BUFFER_SIZE)
+		, numSortThreads(0)
+		, numRecordThreads(0)
+		, numDecodeThreads(0)
+		, maxDrawCalls(BGFX_CONFIG_MAX_DRAW_CALLS)
+		, maxFramesInFlight(1)
+		, textureStreamingBudget(0)
+		, uploadBudget(0)
 	{
 	}
 
@@ -3477,6 +5493,7 @@ namespace bgfx
 		, capabilities(UINT64_MAX)
 		, debug(BX_ENABLED(BGFX_CONFIG_DEBUG) )
 		, profile(BX_ENABLED(BGFX_CONFIG_DEBUG_ANNOTATION) )
+		, noopCounting(false)
 		, callback(NULL)
 		, allocator(NULL)
 	{
@@ -3504,6 +5521,11 @@ namespace bgfx
 
 		init.limits.maxEncoders       = bx::clamp<uint16_t>(init.limits.maxEncoders, 1, (0 != BGFX_CONFIG_MULTITHREADED) ? 128 : 1);
 		init.limits.minResourceCbSize = bx::min<uint32_t>(init.limits.minResourceCbSize, BGFX_CONFIG_MIN_RESOURCE_COMMAND_BUFFER_SIZE);
+		init.limits.numSortThreads    = bx::min<uint32_t>(init.limits.numSortThreads, (0 != BGFX_CONFIG_MULTITHREADED) ? BGFX_CONFIG_MAX_SORT_THREADS : 0);
+		init.limits.numRecordThreads  = bx::min<uint32_t>(init.limits.numRecordThreads, (0 != BGFX_CONFIG_MULTITHREADED) ? BGFX_CONFIG_MAX_RECORD_THREADS : 0);
+		init.limits.numDecodeThreads  = bx::min<uint32_t>(init.limits.numDecodeThreads, (0 != BGFX_CONFIG_MULTITHREADED) ? BGFX_CONFIG_MAX_DECODE_THREADS : 0);
+		init.limits.maxDrawCalls      = bx::clamp<uint32_t>(init.limits.maxDrawCalls, 1, kSortKeyMaxDrawCalls);
+		init.limits.maxFramesInFlight = bx::clamp<uint32_t>(init.limits.maxFramesInFlight, 1, BGFX_CONFIG_MAX_FRAMES_IN_FLIGHT);
 
 		struct ErrorState
 		{
@@ -3538,7 +5560,7 @@ namespace bgfx
 		}
 
 		bx::memSet(&g_caps, 0, sizeof(g_caps) );
-		g_caps.limits.maxDrawCalls            = BGFX_CONFIG_MAX_DRAW_CALLS;
+		g_caps.limits.maxDrawCalls            = init.limits.maxDrawCalls;
 		g_caps.limits.maxBlits                = BGFX_CONFIG_MAX_BLIT_ITEMS;
 		g_caps.limits.maxTextureSize          = 0;
 		g_caps.limits.maxTextureLayers        = 1;
@@ -3557,11 +5579,16 @@ namespace bgfx
 		g_caps.limits.maxDynamicVertexBuffers = BGFX_CONFIG_MAX_DYNAMIC_VERTEX_BUFFERS;
 		g_caps.limits.maxUniforms             = BGFX_CONFIG_MAX_UNIFORMS;
 		g_caps.limits.maxOcclusionQueries     = BGFX_CONFIG_MAX_OCCLUSION_QUERIES;
+		g_caps.limits.maxDrawBundles          = BGFX_CONFIG_MAX_DRAW_BUNDLES;
 		g_caps.limits.maxFBAttachments        = 1;
 		g_caps.limits.maxEncoders             = init.limits.maxEncoders;
 		g_caps.limits.minResourceCbSize       = init.limits.minResourceCbSize;
 		g_caps.limits.transientVbSize         = init.limits.transientVbSize;
 		g_caps.limits.transientIbSize         = init.limits.transientIbSize;
+		g_caps.limits.numSortThreads          = init.limits.numSortThreads;
+		g_caps.limits.numRecordThreads        = 0;
+		g_caps.limits.numDecodeThreads        = init.limits.numDecodeThreads;
+		g_caps.limits.maxFramesInFlight       = BX_ENABLED(BGFX_CONFIG_MULTITHREADED) ? init.limits.maxFramesInFlight : 0;
 
 		g_caps.vendorId = init.vendorId;
 		g_caps.deviceId = init.deviceId;
@@ -3722,6 +5749,15 @@ namespace bgfx
 		BGFX_ENCODER(setUniform(uniform.m_type, _handle, _value, UINT16_MAX != _num ? _num : uniform.m_num) );
 	}
 
+	void Encoder::setUniformBlock(UniformBlockHandle _handle, const void* _data)
+	{
+		BGFX_CHECK_HANDLE("setUniformBlock", s_ctx->m_uniformBlockHandle, _handle);
+		const UniformBlockRef& block = s_ctx->m_uniformBlockRef[_handle.idx];
+		BX_ASSERT(0 < block.m_size, "Setting invalid uniform block (handle %3d)!", _handle.idx);
+		BX_ASSERT(NULL != _data, "Uniform block data must not be NULL.");
+		BGFX_ENCODER(setUniformBlock(_handle, _data, block.m_size) );
+	}
+
 	void Encoder::setIndexBuffer(IndexBufferHandle _handle)
 	{
 		setIndexBuffer(_handle, 0, UINT32_MAX);
@@ -3915,6 +5951,23 @@ namespace bgfx
 		BGFX_ENCODER(submit(_id, _program, _indirectHandle, _start, _numHandle, _numIndex, _numMax, _depth, _flags) );
 	}
 
+	void Encoder::beginDrawBundle(DrawBundleHandle _handle)
+	{
+		BGFX_CHECK_HANDLE("beginDrawBundle", s_ctx->m_drawBundleHandle, _handle);
+		BGFX_ENCODER(beginDrawBundle(&s_ctx->m_drawBundle[_handle.idx]) );
+	}
+
+	void Encoder::endDrawBundle()
+	{
+		BGFX_ENCODER(endDrawBundle() );
+	}
+
+	void Encoder::submit(ViewId _id, DrawBundleHandle _handle, const void* _mtx)
+	{
+		BGFX_CHECK_HANDLE("submit", s_ctx->m_drawBundleHandle, _handle);
+		BGFX_ENCODER(submit(_id, s_ctx->m_drawBundle[_handle.idx], _mtx) );
+	}
+
 	void Encoder::setBuffer(uint8_t _stage, IndexBufferHandle _handle, Access::Enum _access)
 	{
 		BX_ASSERT(_stage < g_caps.limits.maxComputeBindings, "Invalid stage %d (max %d).", _stage, g_caps.limits.maxComputeBindings);
@@ -4195,6 +6248,16 @@ namespace bgfx
 		s_ctx->destroyIndexBuffer(_handle);
 	}
 
+	void setUploadPriority(IndexBufferHandle _handle, uint8_t _priority)
+	{
+		s_ctx->setUploadPriority(_handle, _priority);
+	}
+
+	bool isReady(IndexBufferHandle _handle)
+	{
+		return s_ctx->isReady(_handle);
+	}
+
 	VertexLayoutHandle createVertexLayout(const VertexLayout& _layout)
 	{
 		return s_ctx->createVertexLayout(_layout);
@@ -4222,6 +6285,16 @@ namespace bgfx
 		s_ctx->destroyVertexBuffer(_handle);
 	}
 
+	void setUploadPriority(VertexBufferHandle _handle, uint8_t _priority)
+	{
+		s_ctx->setUploadPriority(_handle, _priority);
+	}
+
+	bool isReady(VertexBufferHandle _handle)
+	{
+		return s_ctx->isReady(_handle);
+	}
+
 	DynamicIndexBufferHandle createDynamicIndexBuffer(uint32_t _num, uint16_t _flags)
 	{
 		return s_ctx->createDynamicIndexBuffer(_num, _flags);
@@ -4427,6 +6500,21 @@ namespace bgfx
 		s_ctx->destroyProgram(_handle);
 	}
 
+	void setFallbackProgram(ProgramHandle _handle)
+	{
+		s_ctx->setFallbackProgram(_handle);
+	}
+
+	void setProgramMultiDraw(ProgramHandle _handle, bool _enabled)
+	{
+		s_ctx->setProgramMultiDraw(_handle, _enabled);
+	}
+
+	void flushPipelineCache()
+	{
+		s_ctx->flushPipelineCache();
+	}
+
 	void isFrameBufferValid(uint8_t _num, const Attachment* _attachment, bx::Error* _err)
 	{
 		BX_ERROR_SCOPE(_err, "Frame buffer validation");
@@ -5020,6 +7108,108 @@ namespace bgfx
 		s_ctx->destroyTexture(_handle);
 	}
 
+	void setUploadPriority(TextureHandle _handle, uint8_t _priority)
+	{
+		s_ctx->setUploadPriority(_handle, _priority);
+	}
+
+	bool isReady(TextureHandle _handle)
+	{
+		return s_ctx->isReady(_handle);
+	}
+
+	TextureHandle createTextureStreaming(uint16_t _width, uint16_t _height, TextureFormat::Enum _format, uint64_t _flags, TextureMipReadFn _readFn, void* _userData)
+	{
+		BX_ASSERT(NULL != _readFn, "_readFn can't be NULL");
+		BX_ASSERT(0 == (_flags & (BGFX_TEXTURE_RT_MASK|BGFX_TEXTURE_COMPUTE_WRITE|BGFX_TEXTURE_BLIT_DST|BGFX_TEXTURE_READ_BACK) )
+			, "Streaming texture can't be written by GPU, or read back."
+			);
+
+		bx::ErrorAssert err;
+		isTextureValid(_width, _height, 0, false, 1, _format, _flags, &err);
+
+		if (!err.isOk() )
+		{
+			return BGFX_INVALID_HANDLE;
+		}
+
+		const uint8_t numMips = calcNumMips(true, _width, _height);
+		const uint8_t tail    = TextureStreaming::calcTailMip(_width, _height, numMips);
+
+		TextureInfo ti;
+		calcTextureSize(ti
+			, uint16_t(bx::max(1, _width  >> tail) )
+			, uint16_t(bx::max(1, _height >> tail) )
+			, 1
+			, false
+			, 1 < numMips - tail
+			, 1
+			, _format
+			);
+
+		// Texture is created only with tail mips, finer mips are read once they are requested.
+		const Memory* mem = alloc(ti.storageSize);
+		uint32_t offset = 0;
+
+		for (uint8_t mip = tail; mip < numMips; ++mip)
+		{
+			const uint32_t size = TextureStreaming::calcMipSize(_width, _height, mip, _format);
+			const Memory* mipMem = _readFn(mip, _userData);
+
+			BX_WARN(NULL != mipMem && size == mipMem->size
+				, "createTextureStreaming: Failed to read mip %d (storage size: %d, memory size: %d)."
+				, mip
+				, size
+				, NULL != mipMem ? mipMem->size : 0
+				);
+
+			if (NULL == mipMem
+			||  size != mipMem->size)
+			{
+				if (NULL != mipMem)
+				{
+					release(mipMem);
+				}
+
+				release(mem);
+				return BGFX_INVALID_HANDLE;
+			}
+
+			bx::memCopy(&mem->data[offset], mipMem->data, size);
+			offset += size;
+
+			release(mipMem);
+		}
+
+		TextureHandle handle = createTexture2D(
+			  BackbufferRatio::Count
+			, uint16_t(bx::max(1, _width  >> tail) )
+			, uint16_t(bx::max(1, _height >> tail) )
+			, 1 < numMips - tail
+			, 1
+			, _format
+			, _flags
+			, mem
+			);
+
+		if (isValid(handle) )
+		{
+			s_ctx->setTextureStreaming(handle, _width, _height, numMips, _format, _readFn, _userData);
+		}
+
+		return handle;
+	}
+
+	void setTextureDesiredMip(TextureHandle _handle, uint8_t _mip)
+	{
+		s_ctx->setTextureDesiredMip(_handle, _mip);
+	}
+
+	uint8_t getTextureResidentMip(TextureHandle _handle)
+	{
+		return s_ctx->getTextureResidentMip(_handle);
+	}
+
 	void updateTexture2D(TextureHandle _handle, uint16_t _layer, uint8_t _mip, uint16_t _x, uint16_t _y, uint16_t _width, uint16_t _height, const Memory* _mem, uint16_t _pitch)
 	{
 		BX_ASSERT(NULL != _mem, "_mem can't be NULL");
@@ -5073,6 +7263,36 @@ namespace bgfx
 		return s_ctx->readTexture(_handle, _data, _mip);
 	}
 
+	uint32_t readTextureAsync(TextureHandle _handle, void* _data, uint8_t _mip, ReadbackFn _readbackFn, void* _userData)
+	{
+		BX_ASSERT(NULL != _data, "_data can't be NULL");
+		BGFX_CHECK_CAPS(BGFX_CAPS_TEXTURE_READ_BACK, "Texture read-back is not supported!");
+		return s_ctx->readTextureAsync(_handle, _data, _mip, _readbackFn, _userData);
+	}
+
+	bool isReadbackComplete(uint32_t _ticket)
+	{
+		return s_ctx->isReadbackComplete(_ticket);
+	}
+
+	uint32_t readBuffer(DynamicIndexBufferHandle _handle, uint32_t _offset, uint32_t _size, void* _data, ReadbackFn _readbackFn, void* _userData)
+	{
+		BX_ASSERT(NULL != _data, "_data can't be NULL");
+		return s_ctx->readBuffer(_handle, _offset, _size, _data, _readbackFn, _userData);
+	}
+
+	uint32_t readBuffer(DynamicVertexBufferHandle _handle, uint32_t _offset, uint32_t _size, void* _data, ReadbackFn _readbackFn, void* _userData)
+	{
+		BX_ASSERT(NULL != _data, "_data can't be NULL");
+		return s_ctx->readBuffer(_handle, _offset, _size, _data, _readbackFn, _userData);
+	}
+
+	uint32_t readBuffer(IndirectBufferHandle _handle, uint32_t _offset, uint32_t _size, void* _data, ReadbackFn _readbackFn, void* _userData)
+	{
+		BX_ASSERT(NULL != _data, "_data can't be NULL");
+		return s_ctx->readBuffer(_handle, _offset, _size, _data, _readbackFn, _userData);
+	}
+
 	FrameBufferHandle createFrameBuffer(uint16_t _width, uint16_t _height, TextureFormat::Enum _format, uint64_t _textureFlags)
 	{
 		_textureFlags |= _textureFlags&BGFX_TEXTURE_RT_MSAA_MASK ? 0 : BGFX_TEXTURE_RT;
@@ -5166,6 +7386,17 @@ namespace bgfx
 		s_ctx->destroyUniform(_handle);
 	}
 
+	UniformBlockHandle createUniformBlock(const UniformHandle* _uniforms, uint16_t _num)
+	{
+		BX_ASSERT(NULL != _uniforms, "_uniforms can't be NULL");
+		return s_ctx->createUniformBlock(_uniforms, _num);
+	}
+
+	void destroy(UniformBlockHandle _handle)
+	{
+		s_ctx->destroyUniformBlock(_handle);
+	}
+
 	OcclusionQueryHandle createOcclusionQuery()
 	{
 		BGFX_CHECK_CAPS(BGFX_CAPS_OCCLUSION_QUERY, "Occlusion query is not supported!");
@@ -5184,6 +7415,16 @@ namespace bgfx
 		s_ctx->destroyOcclusionQuery(_handle);
 	}
 
+	DrawBundleHandle createDrawBundle()
+	{
+		return s_ctx->createDrawBundle();
+	}
+
+	void destroy(DrawBundleHandle _handle)
+	{
+		s_ctx->destroyDrawBundle(_handle);
+	}
+
 	void setPaletteColor(uint8_t _index, uint32_t _rgba)
 	{
 		const uint8_t rr = uint8_t(_rgba>>24);
@@ -5266,12 +7507,24 @@ namespace bgfx
 		s_ctx->setViewMode(_id, _mode);
 	}
 
+	void setViewMultiDraw(ViewId _id, bool _enabled)
+	{
+		BX_ASSERT(checkView(_id), "Invalid view id: %d", _id);
+		s_ctx->setViewMultiDraw(_id, _enabled);
+	}
+
 	void setViewFrameBuffer(ViewId _id, FrameBufferHandle _handle)
 	{
 		BX_ASSERT(checkView(_id), "Invalid view id: %d", _id);
 		s_ctx->setViewFrameBuffer(_id, _handle);
 	}
 
+	void warmPipeline(ViewId _id, ProgramHandle _program, const VertexLayout& _layout, uint64_t _state, uint32_t _fstencil, uint32_t _bstencil)
+	{
+		BX_ASSERT(checkView(_id), "Invalid view id: %d", _id);
+		s_ctx->warmPipeline(_id, _program, _layout, _state, _fstencil, _bstencil);
+	}
+
 	void setViewTransform(ViewId _id, const void* _view, const void* _proj)
 	{
 		BX_ASSERT(checkView(_id), "Invalid view id: %d", _id);
@@ -5355,6 +7608,12 @@ namespace bgfx
 		s_ctx->m_encoder0->setUniform(_handle, _value, _num);
 	}
 
+	void setUniformBlock(UniformBlockHandle _handle, const void* _data)
+	{
+		BGFX_CHECK_ENCODER0();
+		s_ctx->m_encoder0->setUniformBlock(_handle, _data);
+	}
+
 	void setIndexBuffer(IndexBufferHandle _handle)
 	{
 		BGFX_CHECK_ENCODER0();
@@ -5517,6 +7776,24 @@ namespace bgfx
 		s_ctx->m_encoder0->submit(_id, _program, _indirectHandle, _start, _numHandle, _numIndex, _numMax, _depth, _flags);
 	}
 
+	void beginDrawBundle(DrawBundleHandle _handle)
+	{
+		BGFX_CHECK_ENCODER0();
+		s_ctx->m_encoder0->beginDrawBundle(_handle);
+	}
+
+	void endDrawBundle()
+	{
+		BGFX_CHECK_ENCODER0();
+		s_ctx->m_encoder0->endDrawBundle();
+	}
+
+	void submit(ViewId _id, DrawBundleHandle _handle, const void* _mtx)
+	{
+		BGFX_CHECK_ENCODER0();
+		s_ctx->m_encoder0->submit(_id, _handle, _mtx);
+	}
+
 	void setBuffer(uint8_t _stage, IndexBufferHandle _handle, Access::Enum _access)
 	{
 		BGFX_CHECK_ENCODER0();
@@ -5589,6 +7866,49 @@ namespace bgfx
 		s_ctx->requestScreenShot(_handle, _filePath);
 	}
 
+	uint32_t saveProfilerTrace(const char* _filePath, uint16_t _numFrames)
+	{
+		BGFX_CHECK_API_THREAD();
+		BX_ASSERT(NULL != _filePath, "File path must not be NULL.");
+
+		if (!BX_ENABLED(BGFX_CONFIG_PROFILER) )
+		{
+			BX_TRACE("Profiler trace is not available, bgfx is compiled without BGFX_CONFIG_PROFILER.");
+			return 0;
+		}
+
+		uint32_t num = 0;
+
+		bx::FileWriter writer;
+		if (bx::open(&writer, _filePath) )
+		{
+			num = g_profilerTimeline.write(&writer, _numFrames);
+			bx::close(&writer);
+		}
+
+		return num;
+	}
+
+	bool startFrameCapture(const char* _filePath)
+	{
+		BGFX_CHECK_API_THREAD();
+		BX_ASSERT(NULL != _filePath, "File path must not be NULL.");
+		return s_ctx->startFrameCapture(_filePath);
+	}
+
+	void stopFrameCapture()
+	{
+		BGFX_CHECK_API_THREAD();
+		s_ctx->stopFrameCapture();
+	}
+
+	uint32_t startFrameReplay(const char* _filePath)
+	{
+		BGFX_CHECK_API_THREAD();
+		BX_ASSERT(NULL != _filePath, "File path must not be NULL.");
+		return s_ctx->startFrameReplay(_filePath);
+	}
+
 #undef BGFX_CHECK_ENCODER0
 
 } // namespace bgfx
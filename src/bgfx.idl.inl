@@ -259,6 +259,18 @@ BGFX_C_API void bgfx_destroy_index_buffer(bgfx_index_buffer_handle_t _handle)
 	bgfx::destroy(handle.cpp);
 }
 
+BGFX_C_API void bgfx_set_index_buffer_upload_priority(bgfx_index_buffer_handle_t _handle, uint8_t _priority)
+{
+	union { bgfx_index_buffer_handle_t c; bgfx::IndexBufferHandle cpp; } handle = { _handle };
+	bgfx::setUploadPriority(handle.cpp, _priority);
+}
+
+BGFX_C_API bool bgfx_is_index_buffer_ready(bgfx_index_buffer_handle_t _handle)
+{
+	union { bgfx_index_buffer_handle_t c; bgfx::IndexBufferHandle cpp; } handle = { _handle };
+	return bgfx::isReady(handle.cpp);
+}
+
 BGFX_C_API bgfx_vertex_layout_handle_t bgfx_create_vertex_layout(const bgfx_vertex_layout_t * _layout)
 {
 	const bgfx::VertexLayout & layout = *(const bgfx::VertexLayout *)_layout;
@@ -293,6 +305,18 @@ BGFX_C_API void bgfx_destroy_vertex_buffer(bgfx_vertex_buffer_handle_t _handle)
 	bgfx::destroy(handle.cpp);
 }
 
+BGFX_C_API void bgfx_set_vertex_buffer_upload_priority(bgfx_vertex_buffer_handle_t _handle, uint8_t _priority)
+{
+	union { bgfx_vertex_buffer_handle_t c; bgfx::VertexBufferHandle cpp; } handle = { _handle };
+	bgfx::setUploadPriority(handle.cpp, _priority);
+}
+
+BGFX_C_API bool bgfx_is_vertex_buffer_ready(bgfx_vertex_buffer_handle_t _handle)
+{
+	union { bgfx_vertex_buffer_handle_t c; bgfx::VertexBufferHandle cpp; } handle = { _handle };
+	return bgfx::isReady(handle.cpp);
+}
+
 BGFX_C_API bgfx_dynamic_index_buffer_handle_t bgfx_create_dynamic_index_buffer(uint32_t _num, uint16_t _flags)
 {
 	union { bgfx_dynamic_index_buffer_handle_t c; bgfx::DynamicIndexBufferHandle cpp; } handle_ret;
@@ -446,6 +470,30 @@ BGFX_C_API void bgfx_destroy_program(bgfx_program_handle_t _handle)
 	bgfx::destroy(handle.cpp);
 }
 
+BGFX_C_API void bgfx_warm_pipeline(bgfx_view_id_t _id, bgfx_program_handle_t _program, const bgfx_vertex_layout_t * _layout, uint64_t _state, uint32_t _fstencil, uint32_t _bstencil)
+{
+	union { bgfx_program_handle_t c; bgfx::ProgramHandle cpp; } program = { _program };
+	const bgfx::VertexLayout & layout = *(const bgfx::VertexLayout *)_layout;
+	bgfx::warmPipeline((bgfx::ViewId)_id, program.cpp, layout, _state, _fstencil, _bstencil);
+}
+
+BGFX_C_API void bgfx_set_fallback_program(bgfx_program_handle_t _handle)
+{
+	union { bgfx_program_handle_t c; bgfx::ProgramHandle cpp; } handle = { _handle };
+	bgfx::setFallbackProgram(handle.cpp);
+}
+
+BGFX_C_API void bgfx_flush_pipeline_cache(void)
+{
+	bgfx::flushPipelineCache();
+}
+
+BGFX_C_API void bgfx_set_program_multi_draw(bgfx_program_handle_t _handle, bool _enabled)
+{
+	union { bgfx_program_handle_t c; bgfx::ProgramHandle cpp; } handle = { _handle };
+	bgfx::setProgramMultiDraw(handle.cpp, _enabled);
+}
+
 BGFX_C_API bool bgfx_is_texture_valid(uint16_t _depth, bool _cubeMap, uint16_t _numLayers, bgfx_texture_format_t _format, uint64_t _flags)
 {
 	return bgfx::isTextureValid(_depth, _cubeMap, _numLayers, (bgfx::TextureFormat::Enum)_format, _flags);
@@ -521,6 +569,35 @@ BGFX_C_API uint32_t bgfx_read_texture(bgfx_texture_handle_t _handle, void* _data
 	return bgfx::readTexture(handle.cpp, _data, _mip);
 }
 
+BGFX_C_API uint32_t bgfx_read_texture_async(bgfx_texture_handle_t _handle, void* _data, uint8_t _mip, bgfx_readback_fn_t _readbackFn, void* _userData)
+{
+	union { bgfx_texture_handle_t c; bgfx::TextureHandle cpp; } handle = { _handle };
+	return bgfx::readTextureAsync(handle.cpp, _data, _mip, (bgfx::ReadbackFn)_readbackFn, _userData);
+}
+
+BGFX_C_API bool bgfx_is_readback_complete(uint32_t _ticket)
+{
+	return bgfx::isReadbackComplete(_ticket);
+}
+
+BGFX_C_API uint32_t bgfx_read_dynamic_index_buffer(bgfx_dynamic_index_buffer_handle_t _handle, uint32_t _offset, uint32_t _size, void* _data, bgfx_readback_fn_t _readbackFn, void* _userData)
+{
+	union { bgfx_dynamic_index_buffer_handle_t c; bgfx::DynamicIndexBufferHandle cpp; } handle = { _handle };
+	return bgfx::readBuffer(handle.cpp, _offset, _size, _data, (bgfx::ReadbackFn)_readbackFn, _userData);
+}
+
+BGFX_C_API uint32_t bgfx_read_dynamic_vertex_buffer(bgfx_dynamic_vertex_buffer_handle_t _handle, uint32_t _offset, uint32_t _size, void* _data, bgfx_readback_fn_t _readbackFn, void* _userData)
+{
+	union { bgfx_dynamic_vertex_buffer_handle_t c; bgfx::DynamicVertexBufferHandle cpp; } handle = { _handle };
+	return bgfx::readBuffer(handle.cpp, _offset, _size, _data, (bgfx::ReadbackFn)_readbackFn, _userData);
+}
+
+BGFX_C_API uint32_t bgfx_read_indirect_buffer(bgfx_indirect_buffer_handle_t _handle, uint32_t _offset, uint32_t _size, void* _data, bgfx_readback_fn_t _readbackFn, void* _userData)
+{
+	union { bgfx_indirect_buffer_handle_t c; bgfx::IndirectBufferHandle cpp; } handle = { _handle };
+	return bgfx::readBuffer(handle.cpp, _offset, _size, _data, (bgfx::ReadbackFn)_readbackFn, _userData);
+}
+
 BGFX_C_API void bgfx_set_texture_name(bgfx_texture_handle_t _handle, const char* _name, int32_t _len)
 {
 	union { bgfx_texture_handle_t c; bgfx::TextureHandle cpp; } handle = { _handle };
@@ -539,6 +616,37 @@ BGFX_C_API void bgfx_destroy_texture(bgfx_texture_handle_t _handle)
 	bgfx::destroy(handle.cpp);
 }
 
+BGFX_C_API void bgfx_set_texture_upload_priority(bgfx_texture_handle_t _handle, uint8_t _priority)
+{
+	union { bgfx_texture_handle_t c; bgfx::TextureHandle cpp; } handle = { _handle };
+	bgfx::setUploadPriority(handle.cpp, _priority);
+}
+
+BGFX_C_API bool bgfx_is_texture_ready(bgfx_texture_handle_t _handle)
+{
+	union { bgfx_texture_handle_t c; bgfx::TextureHandle cpp; } handle = { _handle };
+	return bgfx::isReady(handle.cpp);
+}
+
+BGFX_C_API bgfx_texture_handle_t bgfx_create_texture_streaming(uint16_t _width, uint16_t _height, bgfx_texture_format_t _format, uint64_t _flags, bgfx_texture_mip_read_fn_t _readFn, void* _userData)
+{
+	union { bgfx_texture_handle_t c; bgfx::TextureHandle cpp; } handle_ret;
+	handle_ret.cpp = bgfx::createTextureStreaming(_width, _height, (bgfx::TextureFormat::Enum)_format, _flags, (bgfx::TextureMipReadFn)_readFn, _userData);
+	return handle_ret.c;
+}
+
+BGFX_C_API void bgfx_set_texture_desired_mip(bgfx_texture_handle_t _handle, uint8_t _mip)
+{
+	union { bgfx_texture_handle_t c; bgfx::TextureHandle cpp; } handle = { _handle };
+	bgfx::setTextureDesiredMip(handle.cpp, _mip);
+}
+
+BGFX_C_API uint8_t bgfx_get_texture_resident_mip(bgfx_texture_handle_t _handle)
+{
+	union { bgfx_texture_handle_t c; bgfx::TextureHandle cpp; } handle = { _handle };
+	return bgfx::getTextureResidentMip(handle.cpp);
+}
+
 BGFX_C_API bgfx_frame_buffer_handle_t bgfx_create_frame_buffer(uint16_t _width, uint16_t _height, bgfx_texture_format_t _format, uint64_t _textureFlags)
 {
 	union { bgfx_frame_buffer_handle_t c; bgfx::FrameBufferHandle cpp; } handle_ret;
@@ -614,6 +722,19 @@ BGFX_C_API void bgfx_destroy_uniform(bgfx_uniform_handle_t _handle)
 	bgfx::destroy(handle.cpp);
 }
 
+BGFX_C_API bgfx_uniform_block_handle_t bgfx_create_uniform_block(const bgfx_uniform_handle_t* _uniforms, uint16_t _num)
+{
+	union { bgfx_uniform_block_handle_t c; bgfx::UniformBlockHandle cpp; } handle_ret;
+	handle_ret.cpp = bgfx::createUniformBlock((const bgfx::UniformHandle*)_uniforms, _num);
+	return handle_ret.c;
+}
+
+BGFX_C_API void bgfx_destroy_uniform_block(bgfx_uniform_block_handle_t _handle)
+{
+	union { bgfx_uniform_block_handle_t c; bgfx::UniformBlockHandle cpp; } handle = { _handle };
+	bgfx::destroy(handle.cpp);
+}
+
 BGFX_C_API bgfx_occlusion_query_handle_t bgfx_create_occlusion_query(void)
 {
 	union { bgfx_occlusion_query_handle_t c; bgfx::OcclusionQueryHandle cpp; } handle_ret;
@@ -633,6 +754,19 @@ BGFX_C_API void bgfx_destroy_occlusion_query(bgfx_occlusion_query_handle_t _hand
 	bgfx::destroy(handle.cpp);
 }
 
+BGFX_C_API bgfx_draw_bundle_handle_t bgfx_create_draw_bundle(void)
+{
+	union { bgfx_draw_bundle_handle_t c; bgfx::DrawBundleHandle cpp; } handle_ret;
+	handle_ret.cpp = bgfx::createDrawBundle();
+	return handle_ret.c;
+}
+
+BGFX_C_API void bgfx_destroy_draw_bundle(bgfx_draw_bundle_handle_t _handle)
+{
+	union { bgfx_draw_bundle_handle_t c; bgfx::DrawBundleHandle cpp; } handle = { _handle };
+	bgfx::destroy(handle.cpp);
+}
+
 BGFX_C_API void bgfx_set_palette_color(uint8_t _index, const float _rgba[4])
 {
 	bgfx::setPaletteColor(_index, _rgba);
@@ -683,6 +817,11 @@ BGFX_C_API void bgfx_set_view_mode(bgfx_view_id_t _id, bgfx_view_mode_t _mode)
 	bgfx::setViewMode((bgfx::ViewId)_id, (bgfx::ViewMode::Enum)_mode);
 }
 
+BGFX_C_API void bgfx_set_view_multi_draw(bgfx_view_id_t _id, bool _enabled)
+{
+	bgfx::setViewMultiDraw((bgfx::ViewId)_id, _enabled);
+}
+
 BGFX_C_API void bgfx_set_view_frame_buffer(bgfx_view_id_t _id, bgfx_frame_buffer_handle_t _handle)
 {
 	union { bgfx_frame_buffer_handle_t c; bgfx::FrameBufferHandle cpp; } handle = { _handle };
@@ -776,6 +915,13 @@ BGFX_C_API void bgfx_encoder_set_uniform(bgfx_encoder_t* _this, bgfx_uniform_han
 	This->setUniform(handle.cpp, _value, _num);
 }
 
+BGFX_C_API void bgfx_encoder_set_uniform_block(bgfx_encoder_t* _this, bgfx_uniform_block_handle_t _handle, const void* _data)
+{
+	bgfx::Encoder* This = (bgfx::Encoder*)_this;
+	union { bgfx_uniform_block_handle_t c; bgfx::UniformBlockHandle cpp; } handle = { _handle };
+	This->setUniformBlock(handle.cpp, _data);
+}
+
 BGFX_C_API void bgfx_encoder_set_index_buffer(bgfx_encoder_t* _this, bgfx_index_buffer_handle_t _handle, uint32_t _firstIndex, uint32_t _numIndices)
 {
 	bgfx::Encoder* This = (bgfx::Encoder*)_this;
@@ -917,6 +1063,26 @@ BGFX_C_API void bgfx_encoder_submit_indirect_count(bgfx_encoder_t* _this, bgfx_v
 	This->submit((bgfx::ViewId)_id, program.cpp, indirectHandle.cpp, _start, numHandle.cpp, _numIndex, _numMax, _depth, _flags);
 }
 
+BGFX_C_API void bgfx_encoder_begin_draw_bundle(bgfx_encoder_t* _this, bgfx_draw_bundle_handle_t _handle)
+{
+	bgfx::Encoder* This = (bgfx::Encoder*)_this;
+	union { bgfx_draw_bundle_handle_t c; bgfx::DrawBundleHandle cpp; } handle = { _handle };
+	This->beginDrawBundle(handle.cpp);
+}
+
+BGFX_C_API void bgfx_encoder_end_draw_bundle(bgfx_encoder_t* _this)
+{
+	bgfx::Encoder* This = (bgfx::Encoder*)_this;
+	This->endDrawBundle();
+}
+
+BGFX_C_API void bgfx_encoder_submit_draw_bundle(bgfx_encoder_t* _this, bgfx_view_id_t _id, bgfx_draw_bundle_handle_t _handle, const void* _mtx)
+{
+	bgfx::Encoder* This = (bgfx::Encoder*)_this;
+	union { bgfx_draw_bundle_handle_t c; bgfx::DrawBundleHandle cpp; } handle = { _handle };
+	This->submit((bgfx::ViewId)_id, handle.cpp, _mtx);
+}
+
 BGFX_C_API void bgfx_encoder_set_compute_index_buffer(bgfx_encoder_t* _this, uint8_t _stage, bgfx_index_buffer_handle_t _handle, bgfx_access_t _access)
 {
 	bgfx::Encoder* This = (bgfx::Encoder*)_this;
@@ -994,6 +1160,26 @@ BGFX_C_API void bgfx_request_screen_shot(bgfx_frame_buffer_handle_t _handle, con
 	bgfx::requestScreenShot(handle.cpp, _filePath);
 }
 
+BGFX_C_API uint32_t bgfx_save_profiler_trace(const char* _filePath, uint16_t _numFrames)
+{
+	return bgfx::saveProfilerTrace(_filePath, _numFrames);
+}
+
+BGFX_C_API bool bgfx_start_frame_capture(const char* _filePath)
+{
+	return bgfx::startFrameCapture(_filePath);
+}
+
+BGFX_C_API void bgfx_stop_frame_capture(void)
+{
+	bgfx::stopFrameCapture();
+}
+
+BGFX_C_API uint32_t bgfx_start_frame_replay(const char* _filePath)
+{
+	return bgfx::startFrameReplay(_filePath);
+}
+
 BGFX_C_API bgfx_render_frame_t bgfx_render_frame(int32_t _msecs)
 {
 	return (bgfx_render_frame_t)bgfx::renderFrame(_msecs);
@@ -1074,6 +1260,12 @@ BGFX_C_API void bgfx_set_uniform(bgfx_uniform_handle_t _handle, const void* _val
 	bgfx::setUniform(handle.cpp, _value, _num);
 }
 
+BGFX_C_API void bgfx_set_uniform_block(bgfx_uniform_block_handle_t _handle, const void* _data)
+{
+	union { bgfx_uniform_block_handle_t c; bgfx::UniformBlockHandle cpp; } handle = { _handle };
+	bgfx::setUniformBlock(handle.cpp, _data);
+}
+
 BGFX_C_API void bgfx_set_index_buffer(bgfx_index_buffer_handle_t _handle, uint32_t _firstIndex, uint32_t _numIndices)
 {
 	union { bgfx_index_buffer_handle_t c; bgfx::IndexBufferHandle cpp; } handle = { _handle };
@@ -1195,6 +1387,23 @@ BGFX_C_API void bgfx_submit_indirect_count(bgfx_view_id_t _id, bgfx_program_hand
 	bgfx::submit((bgfx::ViewId)_id, program.cpp, indirectHandle.cpp, _start, numHandle.cpp, _numIndex, _numMax, _depth, _flags);
 }
 
+BGFX_C_API void bgfx_begin_draw_bundle(bgfx_draw_bundle_handle_t _handle)
+{
+	union { bgfx_draw_bundle_handle_t c; bgfx::DrawBundleHandle cpp; } handle = { _handle };
+	bgfx::beginDrawBundle(handle.cpp);
+}
+
+BGFX_C_API void bgfx_end_draw_bundle(void)
+{
+	bgfx::endDrawBundle();
+}
+
+BGFX_C_API void bgfx_submit_draw_bundle(bgfx_view_id_t _id, bgfx_draw_bundle_handle_t _handle, const void* _mtx)
+{
+	union { bgfx_draw_bundle_handle_t c; bgfx::DrawBundleHandle cpp; } handle = { _handle };
+	bgfx::submit((bgfx::ViewId)_id, handle.cpp, _mtx);
+}
+
 BGFX_C_API void bgfx_set_compute_index_buffer(uint8_t _stage, bgfx_index_buffer_handle_t _handle, bgfx_access_t _access)
 {
 	union { bgfx_index_buffer_handle_t c; bgfx::IndexBufferHandle cpp; } handle = { _handle };
@@ -1334,11 +1543,15 @@ BGFX_C_API bgfx_interface_vtbl_t* bgfx_get_interface(uint32_t _version)
 			bgfx_create_index_buffer,
 			bgfx_set_index_buffer_name,
 			bgfx_destroy_index_buffer,
+			bgfx_set_index_buffer_upload_priority,
+			bgfx_is_index_buffer_ready,
 			bgfx_create_vertex_layout,
 			bgfx_destroy_vertex_layout,
 			bgfx_create_vertex_buffer,
 			bgfx_set_vertex_buffer_name,
 			bgfx_destroy_vertex_buffer,
+			bgfx_set_vertex_buffer_upload_priority,
+			bgfx_is_vertex_buffer_ready,
 			bgfx_create_dynamic_index_buffer,
 			bgfx_create_dynamic_index_buffer_mem,
 			bgfx_update_dynamic_index_buffer,
@@ -1363,6 +1576,10 @@ BGFX_C_API bgfx_interface_vtbl_t* bgfx_get_interface(uint32_t _version)
 			bgfx_create_program,
 			bgfx_create_compute_program,
 			bgfx_destroy_program,
+			bgfx_warm_pipeline,
+			bgfx_set_fallback_program,
+			bgfx_flush_pipeline_cache,
+			bgfx_set_program_multi_draw,
 			bgfx_is_texture_valid,
 			bgfx_is_frame_buffer_valid,
 			bgfx_calc_texture_size,
@@ -1375,9 +1592,19 @@ BGFX_C_API bgfx_interface_vtbl_t* bgfx_get_interface(uint32_t _version)
 			bgfx_update_texture_3d,
 			bgfx_update_texture_cube,
 			bgfx_read_texture,
+			bgfx_read_texture_async,
+			bgfx_is_readback_complete,
+			bgfx_read_dynamic_index_buffer,
+			bgfx_read_dynamic_vertex_buffer,
+			bgfx_read_indirect_buffer,
 			bgfx_set_texture_name,
 			bgfx_get_direct_access_ptr,
 			bgfx_destroy_texture,
+			bgfx_set_texture_upload_priority,
+			bgfx_is_texture_ready,
+			bgfx_create_texture_streaming,
+			bgfx_set_texture_desired_mip,
+			bgfx_get_texture_resident_mip,
 			bgfx_create_frame_buffer,
 			bgfx_create_frame_buffer_scaled,
 			bgfx_create_frame_buffer_from_handles,
@@ -1389,9 +1616,13 @@ BGFX_C_API bgfx_interface_vtbl_t* bgfx_get_interface(uint32_t _version)
 			bgfx_create_uniform,
 			bgfx_get_uniform_info,
 			bgfx_destroy_uniform,
+			bgfx_create_uniform_block,
+			bgfx_destroy_uniform_block,
 			bgfx_create_occlusion_query,
 			bgfx_get_result,
 			bgfx_destroy_occlusion_query,
+			bgfx_create_draw_bundle,
+			bgfx_destroy_draw_bundle,
 			bgfx_set_palette_color,
 			bgfx_set_palette_color_rgba32f,
 			bgfx_set_palette_color_rgba8,
@@ -1402,6 +1633,7 @@ BGFX_C_API bgfx_interface_vtbl_t* bgfx_get_interface(uint32_t _version)
 			bgfx_set_view_clear,
 			bgfx_set_view_clear_mrt,
 			bgfx_set_view_mode,
+			bgfx_set_view_multi_draw,
 			bgfx_set_view_frame_buffer,
 			bgfx_set_view_transform,
 			bgfx_set_view_order,
@@ -1418,6 +1650,7 @@ BGFX_C_API bgfx_interface_vtbl_t* bgfx_get_interface(uint32_t _version)
 			bgfx_encoder_set_transform_cached,
 			bgfx_encoder_alloc_transform,
 			bgfx_encoder_set_uniform,
+			bgfx_encoder_set_uniform_block,
 			bgfx_encoder_set_index_buffer,
 			bgfx_encoder_set_dynamic_index_buffer,
 			bgfx_encoder_set_transient_index_buffer,
@@ -1438,6 +1671,9 @@ BGFX_C_API bgfx_interface_vtbl_t* bgfx_get_interface(uint32_t _version)
 			bgfx_encoder_submit_occlusion_query,
 			bgfx_encoder_submit_indirect,
 			bgfx_encoder_submit_indirect_count,
+			bgfx_encoder_begin_draw_bundle,
+			bgfx_encoder_end_draw_bundle,
+			bgfx_encoder_submit_draw_bundle,
 			bgfx_encoder_set_compute_index_buffer,
 			bgfx_encoder_set_compute_vertex_buffer,
 			bgfx_encoder_set_compute_dynamic_index_buffer,
@@ -1449,6 +1685,10 @@ BGFX_C_API bgfx_interface_vtbl_t* bgfx_get_interface(uint32_t _version)
 			bgfx_encoder_discard,
 			bgfx_encoder_blit,
 			bgfx_request_screen_shot,
+			bgfx_save_profiler_trace,
+			bgfx_start_frame_capture,
+			bgfx_stop_frame_capture,
+			bgfx_start_frame_replay,
 			bgfx_render_frame,
 			bgfx_set_platform_data,
 			bgfx_get_internal_data,
@@ -1464,6 +1704,7 @@ BGFX_C_API bgfx_interface_vtbl_t* bgfx_get_interface(uint32_t _version)
 			bgfx_set_transform_cached,
 			bgfx_alloc_transform,
 			bgfx_set_uniform,
+			bgfx_set_uniform_block,
 			bgfx_set_index_buffer,
 			bgfx_set_dynamic_index_buffer,
 			bgfx_set_transient_index_buffer,
@@ -1484,6 +1725,9 @@ BGFX_C_API bgfx_interface_vtbl_t* bgfx_get_interface(uint32_t _version)
 			bgfx_submit_occlusion_query,
 			bgfx_submit_indirect,
 			bgfx_submit_indirect_count,
+			bgfx_begin_draw_bundle,
+			bgfx_end_draw_bundle,
+			bgfx_submit_draw_bundle,
 			bgfx_set_compute_index_buffer,
 			bgfx_set_compute_vertex_buffer,
 			bgfx_set_compute_dynamic_index_buffer,
@@ -53,10 +53,10 @@
 
 #if BGFX_CONFIG_PROFILER
 #	define BGFX_PROFILER_SCOPE(_name, _abgr)            ProfilerScope BX_CONCATENATE(profilerScope, __LINE__)(_name, _abgr, __FILE__, uint16_t(__LINE__) )
-#	define BGFX_PROFILER_BEGIN(_name, _abgr)            g_callback->profilerBegin(_name, _abgr, __FILE__, uint16_t(__LINE__) )
-#	define BGFX_PROFILER_BEGIN_LITERAL(_name, _abgr)    g_callback->profilerBeginLiteral(_name, _abgr, __FILE__, uint16_t(__LINE__) )
-#	define BGFX_PROFILER_END()                          g_callback->profilerEnd()
-#	define BGFX_PROFILER_SET_CURRENT_THREAD_NAME(_name) BX_NOOP()
+#	define BGFX_PROFILER_BEGIN(_name, _abgr)            profilerBegin(_name, _abgr, __FILE__, uint16_t(__LINE__) )
+#	define BGFX_PROFILER_BEGIN_LITERAL(_name, _abgr)    profilerBeginLiteral(_name, _abgr, __FILE__, uint16_t(__LINE__) )
+#	define BGFX_PROFILER_END()                          profilerEnd()
+#	define BGFX_PROFILER_SET_CURRENT_THREAD_NAME(_name) g_profilerTimeline.setThreadName(_name)
 #else
 #	define BGFX_PROFILER_SCOPE(_name, _abgr)            BX_NOOP()
 #	define BGFX_PROFILER_BEGIN(_name, _abgr)            BX_NOOP()
@@ -144,7 +144,12 @@ namespace bgfx
 
 #include <bgfx/platform.h>
 #include <bimg/bimg.h>
+#include "capture.h"
+#include "decode.h"
+#include "profiler.h"
 #include "shader.h"
+#include "streaming.h"
+#include "upload.h"
 #include "vertexlayout.h"
 #include "version.h"
 
@@ -293,11 +298,7 @@ namespace bgfx
 	extern void isFrameBufferValid(uint8_t _num, const Attachment* _attachment, bx::Error* _err);
 	extern void isIdentifierValid(const bx::StringView& _name, bx::Error* _err);
 
-#if BGFX_CONFIG_MAX_DRAW_CALLS < (64<<10)
-	typedef uint16_t RenderItemCount;
-#else
 	typedef uint32_t RenderItemCount;
-#endif // BGFX_CONFIG_MAX_DRAW_CALLS < (64<<10)
 
 	///
 	struct Handle
@@ -565,20 +566,39 @@ namespace bgfx
 	extern const uint32_t g_uniformTypeSize[UniformType::Count+1];
 	extern CallbackI* g_callback;
 	extern bx::AllocatorI* g_allocator;
+	extern ProfilerTimeline g_profilerTimeline;
 	extern Caps g_caps;
 
 	typedef bx::StringT<&g_allocator> String;
 
+	inline void profilerBegin(const char* _name, uint32_t _abgr, const char* _filePath, uint16_t _line)
+	{
+		g_profilerTimeline.begin(_name);
+		g_callback->profilerBegin(_name, _abgr, _filePath, _line);
+	}
+
+	inline void profilerBeginLiteral(const char* _name, uint32_t _abgr, const char* _filePath, uint16_t _line)
+	{
+		g_profilerTimeline.begin(_name);
+		g_callback->profilerBeginLiteral(_name, _abgr, _filePath, _line);
+	}
+
+	inline void profilerEnd()
+	{
+		g_callback->profilerEnd();
+		g_profilerTimeline.end();
+	}
+
 	struct ProfilerScope
 	{
 		ProfilerScope(const char* _name, uint32_t _abgr, const char* _filePath, uint16_t _line)
 		{
-			g_callback->profilerBeginLiteral(_name, _abgr, _filePath, _line);
+			profilerBeginLiteral(_name, _abgr, _filePath, _line);
 		}
 
 		~ProfilerScope()
 		{
-			g_callback->profilerEnd();
+			profilerEnd();
 		}
 	};
 
@@ -902,10 +922,13 @@ namespace bgfx
 			CreateTexture,
 			UpdateTexture,
 			ResizeTexture,
+			ResizeTextureMips,
 			CreateFrameBuffer,
 			CreateUniform,
+			CreateUniformBlock,
 			UpdateViewName,
 			InvalidateOcclusionQuery,
+			WarmPipeline,
 			SetName,
 			End,
 			RendererShutdownEnd,
@@ -919,7 +942,11 @@ namespace bgfx
 			DestroyTexture,
 			DestroyFrameBuffer,
 			DestroyUniform,
+			DestroyUniformBlock,
 			ReadTexture,
+			ReadIndexBuffer,
+			ReadVertexBuffer,
+			FlushPipelineCache,
 		};
 
 		void resize(uint32_t _capacity = 0)
@@ -1049,6 +1076,7 @@ namespace bgfx
 	constexpr uint64_t kSortKeyDrawTypeProgram     = uint64_t(0)<<kSortKeyDrawTypeBitShift;
 	constexpr uint64_t kSortKeyDrawTypeDepth       = uint64_t(1)<<kSortKeyDrawTypeBitShift;
 	constexpr uint64_t kSortKeyDrawTypeSequence    = uint64_t(2)<<kSortKeyDrawTypeBitShift;
+	constexpr uint64_t kSortKeyDrawTypeState       = uint64_t(3)<<kSortKeyDrawTypeBitShift;
 
 	//
 	constexpr uint8_t  kSortKeyTransNumBits        = 2;
@@ -1082,6 +1110,24 @@ namespace bgfx
 	constexpr uint8_t  kSortKeyDraw2ProgramShift   = kSortKeyDraw2BlendShift - BGFX_CONFIG_SORT_KEY_NUM_BITS_PROGRAM;
 	constexpr uint64_t kSortKeyDraw2ProgramMask    = uint64_t(BGFX_CONFIG_MAX_PROGRAMS-1)<<kSortKeyDraw2ProgramShift;
 
+	//
+	constexpr uint8_t  kSortKeyDraw3BlendShift     = kSortKeyDrawTypeBitShift - kSortKeyTransNumBits;
+	constexpr uint64_t kSortKeyDraw3BlendMask      = uint64_t(0x3)<<kSortKeyDraw3BlendShift;
+
+	constexpr uint8_t  kSortKeyDraw3ProgramShift   = kSortKeyDraw3BlendShift - BGFX_CONFIG_SORT_KEY_NUM_BITS_PROGRAM;
+	constexpr uint64_t kSortKeyDraw3ProgramMask    = uint64_t(BGFX_CONFIG_MAX_PROGRAMS-1)<<kSortKeyDraw3ProgramShift;
+
+	constexpr uint8_t  kSortKeyDraw3BindShift      = kSortKeyDraw3ProgramShift - BGFX_CONFIG_SORT_KEY_NUM_BITS_BIND;
+	constexpr uint64_t kSortKeyDraw3BindMask       = ( (uint64_t(1)<<BGFX_CONFIG_SORT_KEY_NUM_BITS_BIND)-1)<<kSortKeyDraw3BindShift;
+
+	constexpr uint8_t  kSortKeyDraw3StateShift     = kSortKeyDraw3BindShift - BGFX_CONFIG_SORT_KEY_NUM_BITS_STATE;
+	constexpr uint64_t kSortKeyDraw3StateMask      = ( (uint64_t(1)<<BGFX_CONFIG_SORT_KEY_NUM_BITS_STATE)-1)<<kSortKeyDraw3StateShift;
+
+	// Depth only breaks ties between draws with the same state, it gets whatever bits are left.
+	constexpr uint8_t  kSortKeyDraw3DepthNumBits   = kSortKeyDraw3StateShift < 32 ? kSortKeyDraw3StateShift : 32;
+	constexpr uint8_t  kSortKeyDraw3DepthShift     = kSortKeyDraw3StateShift - kSortKeyDraw3DepthNumBits;
+	constexpr uint64_t kSortKeyDraw3DepthMask      = ( (uint64_t(1)<<kSortKeyDraw3DepthNumBits)-1)<<kSortKeyDraw3DepthShift;
+
 	//
 	constexpr uint8_t  kSortKeyComputeSeqShift     = kSortKeyDrawBitShift - BGFX_CONFIG_SORT_KEY_NUM_BITS_SEQ;
 	constexpr uint64_t kSortKeyComputeSeqMask      = ( (uint64_t(1)<<BGFX_CONFIG_SORT_KEY_NUM_BITS_SEQ)-1)<<kSortKeyComputeSeqShift;
@@ -1089,6 +1135,10 @@ namespace bgfx
 	constexpr uint8_t  kSortKeyComputeProgramShift = kSortKeyComputeSeqShift - BGFX_CONFIG_SORT_KEY_NUM_BITS_PROGRAM;
 	constexpr uint64_t kSortKeyComputeProgramMask  = uint64_t(BGFX_CONFIG_MAX_PROGRAMS-1)<<kSortKeyComputeProgramShift;
 
+	// Sequence number must not wrap within single view, which limits number of draw calls.
+	constexpr uint32_t kSortKeyMaxDrawCalls        = (uint32_t(1)<<BGFX_CONFIG_SORT_KEY_NUM_BITS_SEQ)-1;
+	BX_STATIC_ASSERT(BGFX_CONFIG_MAX_DRAW_CALLS <= kSortKeyMaxDrawCalls);
+
 	BX_STATIC_ASSERT(BGFX_CONFIG_MAX_VIEWS <= (1<<kSortKeyViewNumBits) );
 	BX_STATIC_ASSERT( (BGFX_CONFIG_MAX_PROGRAMS & (BGFX_CONFIG_MAX_PROGRAMS-1) ) == 0); // Must be power of 2.
 	BX_STATIC_ASSERT( (0 // Render key mask shouldn't overlap.
@@ -1136,6 +1186,28 @@ namespace bgfx
 		^ kSortKeyDraw2BlendMask
 		^ kSortKeyDraw2ProgramMask
 		) );
+	BX_STATIC_ASSERT(0 < BGFX_CONFIG_SORT_KEY_NUM_BITS_BIND  && BGFX_CONFIG_SORT_KEY_NUM_BITS_BIND  <= 16);
+	BX_STATIC_ASSERT(0 < BGFX_CONFIG_SORT_KEY_NUM_BITS_STATE && BGFX_CONFIG_SORT_KEY_NUM_BITS_STATE <= 16);
+	BX_STATIC_ASSERT(0 < kSortKeyDraw3DepthNumBits);
+	BX_STATIC_ASSERT( (0 // Render key mask shouldn't overlap.
+		| kSortKeyViewMask
+		| kSortKeyDrawBit
+		| kSortKeyDrawTypeMask
+		| kSortKeyDraw3BlendMask
+		| kSortKeyDraw3ProgramMask
+		| kSortKeyDraw3BindMask
+		| kSortKeyDraw3StateMask
+		| kSortKeyDraw3DepthMask
+		) == (0
+		^ kSortKeyViewMask
+		^ kSortKeyDrawBit
+		^ kSortKeyDrawTypeMask
+		^ kSortKeyDraw3BlendMask
+		^ kSortKeyDraw3ProgramMask
+		^ kSortKeyDraw3BindMask
+		^ kSortKeyDraw3StateMask
+		^ kSortKeyDraw3DepthMask
+		) );
 	BX_STATIC_ASSERT( (0 // Compute key mask shouldn't overlap.
 		| kSortKeyViewMask
 		| kSortKeyDrawBit
@@ -1173,6 +1245,12 @@ namespace bgfx
 	// |        | |                   | |        |                      |
 	// |        | +-key type      seq-+ +-blend  +-program              |
 	// |        |                                                       |
+	// |----------------------------------------------------------------| Draw Key 3 - Sort by state
+	// |        |kkttpppppppppbbbbbbbbbbbbbbbbssssssssssdddddddddddddddd|
+	// |        | ^ ^        ^               ^         ^               ^|
+	// |        | | |        |               |         |               ||
+	// |        | | +-blend  +-program  bind-+   state-+         depth-+|
+	// |        | +-key type                                            |
 	// |----------------------------------------------------------------| Compute Key
 	// |        |ssssssssssssssssssssppppppppp                          |
 	// |        |                   ^        ^                          |
@@ -1188,6 +1266,7 @@ namespace bgfx
 			SortProgram,
 			SortDepth,
 			SortSequence,
+			SortState,
 		};
 
 		uint64_t encodeDraw(Enum _type)
@@ -1233,6 +1312,20 @@ namespace bgfx
 					return key;
 				}
 				break;
+
+			case SortState:
+				{
+					const uint64_t depth   = (uint64_t(m_depth >> (32-kSortKeyDraw3DepthNumBits) ) << kSortKeyDraw3DepthShift) & kSortKeyDraw3DepthMask;
+					const uint64_t state   = (uint64_t(m_state      ) << kSortKeyDraw3StateShift  ) & kSortKeyDraw3StateMask;
+					const uint64_t bind    = (uint64_t(m_bind       ) << kSortKeyDraw3BindShift   ) & kSortKeyDraw3BindMask;
+					const uint64_t program = (uint64_t(m_program.idx) << kSortKeyDraw3ProgramShift) & kSortKeyDraw3ProgramMask;
+					const uint64_t blend   = (uint64_t(m_blend      ) << kSortKeyDraw3BlendShift  ) & kSortKeyDraw3BlendMask;
+					const uint64_t view    = (uint64_t(m_view       ) << kSortKeyViewBitShift     ) & kSortKeyViewMask;
+					const uint64_t key     = view|kSortKeyDrawBit|kSortKeyDrawTypeState|blend|program|bind|state|depth;
+
+					return key;
+				}
+				break;
 			}
 
 			BX_ASSERT(false, "You should not be here.");
@@ -1275,6 +1368,12 @@ namespace bgfx
 					return false;
 				}
 
+				if (type == kSortKeyDrawTypeState)
+				{
+					m_program.idx = uint16_t( (_key & kSortKeyDraw3ProgramMask) >> kSortKeyDraw3ProgramShift);
+					return false;
+				}
+
 				m_program.idx = uint16_t( (_key & kSortKeyDraw0ProgramMask) >> kSortKeyDraw0ProgramShift);
 				return false; // draw
 			}
@@ -1303,6 +1402,8 @@ namespace bgfx
 			m_program = {0};
 			m_view    = 0;
 			m_blend   = 0;
+			m_bind    = 0;
+			m_state   = 0;
 		}
 
 		uint32_t      m_depth;
@@ -1310,6 +1411,8 @@ namespace bgfx
 		ProgramHandle m_program;
 		ViewId        m_view;
 		uint8_t       m_blend;
+		uint16_t      m_bind;
+		uint16_t      m_state;
 	};
 #undef SORT_KEY_RENDER_DRAW
 
@@ -1384,26 +1487,12 @@ namespace bgfx
 			m_num = 1;
 		}
 
-		uint32_t reserve(uint16_t* _num)
-		{
-			uint32_t num = *_num;
-			uint32_t first = bx::atomicFetchAndAddsat<uint32_t>(&m_num, num, BGFX_CONFIG_MAX_MATRIX_CACHE - 1);
-			BX_WARN(first+num < BGFX_CONFIG_MAX_MATRIX_CACHE, "Matrix cache overflow. %d (max: %d)", first+num, BGFX_CONFIG_MAX_MATRIX_CACHE);
-			num = bx::min(num, BGFX_CONFIG_MAX_MATRIX_CACHE-1-first);
-			*_num = bx::narrowCast<uint16_t>(num);
-			return first;
-		}
-
-		uint32_t add(const void* _mtx, uint16_t _num)
+		uint32_t reserveBlock(uint32_t _num, uint32_t* _first)
 		{
-			if (NULL != _mtx)
-			{
-				uint32_t first = reserve(&_num);
-				bx::memCopy(&m_cache[first], _mtx, sizeof(Matrix4)*_num);
-				return first;
-			}
-
-			return 0;
+			const uint32_t first = bx::atomicFetchAndAddsat<uint32_t>(&m_num, _num, BGFX_CONFIG_MAX_MATRIX_CACHE - 1);
+			BX_WARN(first+_num < BGFX_CONFIG_MAX_MATRIX_CACHE, "Matrix cache overflow. %d (max: %d)", first+_num, BGFX_CONFIG_MAX_MATRIX_CACHE);
+			*_first = first;
+			return bx::min(_num, BGFX_CONFIG_MAX_MATRIX_CACHE-1-first);
 		}
 
 		float* toPtr(uint32_t _cacheIdx)
@@ -1436,19 +1525,12 @@ namespace bgfx
 			m_num = 0;
 		}
 
-		uint32_t add(uint16_t _x, uint16_t _y, uint16_t _width, uint16_t _height)
+		uint32_t reserveBlock(uint32_t _num, uint32_t* _first)
 		{
-			const uint32_t first = bx::atomicFetchAndAddsat<uint32_t>(&m_num, 1, BGFX_CONFIG_MAX_RECT_CACHE-1);
-			BX_ASSERT(first+1 < BGFX_CONFIG_MAX_RECT_CACHE, "Rect cache overflow. %d (max: %d)", first, BGFX_CONFIG_MAX_RECT_CACHE);
-
-			Rect& rect = m_cache[first];
-
-			rect.m_x = _x;
-			rect.m_y = _y;
-			rect.m_width = _width;
-			rect.m_height = _height;
-
-			return first;
+			const uint32_t first = bx::atomicFetchAndAddsat<uint32_t>(&m_num, _num, BGFX_CONFIG_MAX_RECT_CACHE-1);
+			BX_WARN(first+_num < BGFX_CONFIG_MAX_RECT_CACHE, "Rect cache overflow. %d (max: %d)", first+_num, BGFX_CONFIG_MAX_RECT_CACHE);
+			*_first = first;
+			return bx::min(_num, BGFX_CONFIG_MAX_RECT_CACHE-1-first);
 		}
 
 		Rect     m_cache[BGFX_CONFIG_MAX_RECT_CACHE];
@@ -1571,6 +1653,11 @@ namespace bgfx
 			return m_pos;
 		}
 
+		const char* getData(uint32_t _pos) const
+		{
+			return &m_buffer[_pos];
+		}
+
 		void reset(uint32_t _pos = 0)
 		{
 			m_pos = _pos;
@@ -1720,6 +1807,9 @@ namespace bgfx
 				m_uniformEnd    = 0;
 				m_uniformIdx    = UINT8_MAX;
 
+				m_uniformBlockOffset = 0;
+				m_uniformBlock.idx   = kInvalidHandle;
+
 				m_stateFlags    = BGFX_STATE_DEFAULT;
 				m_stencil       = packStencil(BGFX_STENCIL_DEFAULT, BGFX_STENCIL_DEFAULT);
 				m_rgba          = 0;
@@ -1787,6 +1877,7 @@ namespace bgfx
 		uint32_t m_rgba;
 		uint32_t m_uniformBegin;
 		uint32_t m_uniformEnd;
+		uint32_t m_uniformBlockOffset;
 		uint32_t m_startMatrix;
 		uint32_t m_startIndex;
 		uint32_t m_numIndices;
@@ -1799,6 +1890,7 @@ namespace bgfx
 		uint16_t m_instanceDataStride;
 		uint16_t m_numMatrices;
 		uint16_t m_scissor;
+		uint16_t m_bindIdx;
 		uint8_t  m_submitFlags;
 		uint8_t  m_streamMask;
 		uint8_t  m_uniformIdx;
@@ -1808,6 +1900,7 @@ namespace bgfx
 		IndirectBufferHandle m_indirectBuffer;
 		IndexBufferHandle    m_numIndirectBuffer;
 		OcclusionQueryHandle m_occlusionQuery;
+		UniformBlockHandle   m_uniformBlock;
 	};
 
 	BX_ALIGN_DECL_CACHE_LINE(struct) RenderCompute
@@ -1847,6 +1940,7 @@ namespace bgfx
 		uint32_t m_startIndirect;
 		uint32_t m_numIndirect;
 		uint16_t m_numMatrices;
+		uint16_t m_bindIdx;
 		uint8_t  m_submitFlags;
 		uint8_t  m_uniformIdx;
 	};
@@ -1857,6 +1951,29 @@ namespace bgfx
 		RenderCompute compute;
 	};
 
+	// Render item storage is allocated on demand, and kept around for the next frames. During
+	// frame chunk is owned by single encoder.
+	BX_ALIGN_DECL_CACHE_LINE(struct) RenderItemChunk
+	{
+		RenderItem m_item[BGFX_CONFIG_RENDER_ITEM_CHUNK_SIZE];
+		uint64_t   m_key[BGFX_CONFIG_RENDER_ITEM_CHUNK_SIZE];
+		uint32_t   m_first;
+		uint32_t   m_num;
+		uint32_t   m_capacity;
+	};
+
+	// Binding sets are stored once per frame, and render items reference them by index. Binding
+	// set at index 0 is always empty (all bindings discarded).
+	BX_ALIGN_DECL_CACHE_LINE(struct) RenderBindChunk
+	{
+		RenderBind m_bind[BGFX_CONFIG_RENDER_BIND_CHUNK_SIZE];
+		uint32_t   m_first;
+		uint32_t   m_num;
+	};
+
+	constexpr uint32_t kMaxRenderBindChunks = BGFX_CONFIG_MAX_RENDER_BIND_SETS/BGFX_CONFIG_RENDER_BIND_CHUNK_SIZE;
+	BX_STATIC_ASSERT(0 < kMaxRenderBindChunks);
+
 	BX_ALIGN_DECL_CACHE_LINE(struct) BlitItem
 	{
 		uint16_t m_srcX;
@@ -1955,6 +2072,53 @@ namespace bgfx
 		int16_t           m_refCount;
 	};
 
+	struct UniformBlockRef
+	{
+		UniformHandle m_uniform[BGFX_CONFIG_MAX_UNIFORM_BLOCK_UNIFORMS];
+		uint16_t      m_num;
+		uint32_t      m_size;
+	};
+
+	// Uniform block layout. Uniforms are tightly packed, and each array element takes
+	// multiple of 16 bytes, Mat3 columns are padded to 16 bytes.
+	struct UniformBlock
+	{
+		struct Uniform
+		{
+			UniformHandle m_handle;
+			uint8_t       m_type;
+			uint16_t      m_num;
+			uint32_t      m_offset;
+			uint32_t      m_size;
+		};
+
+		static uint32_t getStride(UniformType::Enum _type)
+		{
+			return UniformType::Mat4 == _type ? 64
+				:  UniformType::Mat3 == _type ? 48
+				:  16
+				;
+		}
+
+		// Converts Mat3 array from uniform block layout to the one expected by setUniform.
+		static void unpackMat3(float* _dst, const void* _src, uint16_t _num)
+		{
+			const float* src = (const float*)_src;
+
+			for (uint32_t ii = 0; ii < _num; ++ii, src += 12, _dst += 9)
+			{
+				bx::memCopy(&_dst[0], &src[0], 3*sizeof(float) );
+				bx::memCopy(&_dst[3], &src[4], 3*sizeof(float) );
+				bx::memCopy(&_dst[6], &src[8], 3*sizeof(float) );
+			}
+		}
+
+		Uniform  m_uniform[BGFX_CONFIG_MAX_UNIFORM_BLOCK_UNIFORMS];
+		uint32_t m_size;
+		uint32_t m_hash;
+		uint16_t m_num;
+	};
+
 	struct TextureRef
 	{
 		void init(
@@ -1987,6 +2151,7 @@ namespace bgfx
 			m_immutable   = _immutable;
 			m_cubeMap     = _cubeMap;
 			m_flags       = _flags;
+			m_decodeFormat = TextureFormat::Count;
 		}
 
 		bool isRt() const
@@ -2027,6 +2192,7 @@ namespace bgfx
 		uint8_t  m_numSamples;
 		uint8_t  m_numMips;
 		uint16_t m_numLayers;
+		uint8_t  m_decodeFormat; //!< Format texture was decoded to by texture decoder.
 		bool     m_owned;
 		bool     m_immutable;
 		bool     m_cubeMap;
@@ -2055,6 +2221,7 @@ namespace bgfx
 			setScissor(0, 0, 0, 0);
 			setClear(BGFX_CLEAR_NONE, 0, 0.0f, 0);
 			setMode(ViewMode::Default);
+			setMultiDraw(false);
 			setFrameBuffer(BGFX_INVALID_HANDLE);
 			setTransform(NULL, NULL);
 		}
@@ -2090,6 +2257,11 @@ namespace bgfx
 			m_mode = uint8_t(_mode);
 		}
 
+		void setMultiDraw(bool _enabled)
+		{
+			m_multiDraw = _enabled;
+		}
+
 		void setFrameBuffer(FrameBufferHandle _handle)
 		{
 			m_fbh = _handle;
@@ -2123,6 +2295,7 @@ namespace bgfx
 		Matrix4 m_proj;
 		FrameBufferHandle m_fbh;
 		uint8_t m_mode;
+		bool    m_multiDraw;
 	};
 
 	struct FrameCache
@@ -2155,24 +2328,117 @@ namespace bgfx
 		FrameBufferHandle handle;
 	};
 
+	// Sorts render items on render thread and a small pool of worker threads. Keys are
+	// bucketed per view, each view bucket is split into runs which are radix sorted in
+	// parallel, and runs are merged back per view. Result is identical to single
+	// bx::radixSort over all keys.
+	class SortThreadPool
+	{
+	public:
+		SortThreadPool();
+
+		void init(uint32_t _numThreads);
+
+		void shutdown();
+
+		uint32_t getNumThreads() const
+		{
+			return m_numThreads;
+		}
+
+		void sort(uint64_t* _keys, RenderItemCount* _values, uint64_t* _tempKeys, RenderItemCount* _tempValues, uint32_t _num);
+
+	private:
+		typedef void (*JobFn)(SortThreadPool* _pool, uint32_t _idx);
+
+		void dispatch(JobFn _fn, uint32_t _num);
+		void work();
+
+		static int32_t workerThread(bx::Thread* _self, void* _userData);
+		static void sortRun(SortThreadPool* _pool, uint32_t _idx);
+		static void mergeView(SortThreadPool* _pool, uint32_t _idx);
+
+		struct Run
+		{
+			uint32_t m_begin;
+			uint32_t m_num;
+		};
+
+		struct ViewRuns
+		{
+			uint32_t m_begin;
+			uint32_t m_num;
+			uint16_t m_firstRun;
+			uint16_t m_numRuns;
+		};
+
+		bx::Thread    m_thread[BGFX_CONFIG_MAX_SORT_THREADS];
+		bx::Semaphore m_workSem;
+		bx::Semaphore m_doneSem;
+
+		JobFn    m_fn;
+		uint32_t m_numJobs;
+		uint32_t m_next;
+		uint32_t m_numThreads;
+		bool     m_exit;
+
+		uint64_t*        m_keys;
+		RenderItemCount* m_values;
+		uint64_t*        m_tempKeys;
+		RenderItemCount* m_tempValues;
+
+		uint32_t m_numRuns;
+		uint32_t m_numViews;
+		Run      m_run[BGFX_CONFIG_MAX_VIEWS+BGFX_CONFIG_MAX_SORT_THREADS+1];
+		ViewRuns m_viewRuns[BGFX_CONFIG_MAX_VIEWS];
+		uint32_t m_viewCount[BGFX_CONFIG_MAX_VIEWS];
+	};
+
+	// Run of consecutive sorted draw items in multi-draw view that can be submitted with
+	// single multi-draw call.
+	struct MultiDrawRun
+	{
+		uint32_t m_item;  // Sorted position of first item in run.
+		uint32_t m_num;   // Number of items in run.
+		uint32_t m_first; // Number of batched items in all previous runs.
+	};
+
 	BX_ALIGN_DECL_CACHE_LINE(struct) Frame
 	{
 		Frame()
-			: m_waitSubmit(0)
+			: m_sortKeys(NULL)
+			, m_sortValues(NULL)
+			, m_sortCapacity(0)
+			, m_multiDrawRun(NULL)
+			, m_numMultiDrawRuns(0)
+			, m_numMultiDrawItems(0)
+			, m_multiDrawCapacity(0)
+			, m_renderItemChunk(NULL)
+			, m_numRenderItemChunks(0)
+			, m_maxRenderItemChunks(0)
+			, m_numRenderBindChunks(0)
+			, m_numActiveViews(0)
+			, m_waitSubmit(0)
 			, m_waitRender(0)
 			, m_frameNum(0)
 			, m_capture(false)
+			, m_frameCaptureWriter(NULL)
+			, m_frameReplay(NULL)
+			, m_frameCaptureStop(false)
+			, m_frameReplaySource(NULL)
 		{
-			SortKey term;
-			term.reset();
-			term.m_program = BGFX_INVALID_HANDLE;
-			m_sortKeys[BGFX_CONFIG_MAX_DRAW_CALLS]   = term.encodeDraw(SortKey::SortProgram);
-			m_sortValues[BGFX_CONFIG_MAX_DRAW_CALLS] = BGFX_CONFIG_MAX_DRAW_CALLS;
 			bx::memSet(m_occlusion, 0xff, sizeof(m_occlusion) );
+			bx::memSet(m_renderBindChunk, 0, sizeof(m_renderBindChunk) );
 
-			m_perfStats.viewStats = m_viewStats;
+			m_fallbackProgram = BGFX_INVALID_HANDLE;
+			bx::memSet(m_multiDrawProgram, 0, sizeof(m_multiDrawProgram) );
 
-			bx::memSet(&m_renderItemBind[0], 0, sizeof(m_renderItemBind));
+			m_perfStats.viewStats           = m_viewStats;
+			m_perfStats.numPipelinesPending = 0;
+			m_perfStats.numDrawsFallback    = 0;
+			m_perfStats.numDrawsSkipped     = 0;
+			m_perfStats.numMultiDraw        = 0;
+			m_perfStats.numMultiDrawItems   = 0;
 		}
 
 		~Frame()
@@ -2184,14 +2450,34 @@ namespace bgfx
 			m_cmdPre.init(_minResourceCbSize);
 			m_cmdPost.init(_minResourceCbSize);
 
+			{
+				// Draw call budget is handed out per chunk, last chunk is clamped to remaining
+				// budget. Chunks left partially filled by encoders are not refilled.
+				m_maxRenderItemChunks = (g_caps.limits.maxDrawCalls + BGFX_CONFIG_RENDER_ITEM_CHUNK_SIZE - 1) / BGFX_CONFIG_RENDER_ITEM_CHUNK_SIZE;
+				m_renderItemChunk = (RenderItemChunk**)bx::alloc(g_allocator, sizeof(RenderItemChunk*)*m_maxRenderItemChunks);
+				bx::memSet(m_renderItemChunk, 0, sizeof(RenderItemChunk*)*m_maxRenderItemChunks);
+			}
+
+			{
+				// First chunk is never handed to encoders, it only holds empty binding set.
+				RenderBindChunk* chunk = (RenderBindChunk*)bx::alignedAlloc(g_allocator, sizeof(RenderBindChunk), BX_ALIGNOF(RenderBindChunk) );
+				bx::memSet(chunk, 0, sizeof(RenderBindChunk) );
+				chunk->m_bind[0].clear();
+				chunk->m_first = 0;
+				chunk->m_num   = 1;
+				m_renderBindChunk[0] = chunk;
+			}
+
 			{
 				const uint32_t num = g_caps.limits.maxEncoders;
 
-				m_uniformBuffer = (UniformBuffer**)bx::alloc(g_allocator, sizeof(UniformBuffer*)*num);
+				m_uniformBuffer      = (UniformBuffer**)bx::alloc(g_allocator, sizeof(UniformBuffer*)*num);
+				m_uniformBlockBuffer = (UniformBuffer**)bx::alloc(g_allocator, sizeof(UniformBuffer*)*num);
 
 				for (uint32_t ii = 0; ii < num; ++ii)
 				{
-					m_uniformBuffer[ii] = UniformBuffer::create();
+					m_uniformBuffer[ii]      = UniformBuffer::create();
+					m_uniformBlockBuffer[ii] = UniformBuffer::create(64<<10);
 				}
 			}
 
@@ -2205,10 +2491,37 @@ namespace bgfx
 			for (uint32_t ii = 0, num = g_caps.limits.maxEncoders; ii < num; ++ii)
 			{
 				UniformBuffer::destroy(m_uniformBuffer[ii]);
+				UniformBuffer::destroy(m_uniformBlockBuffer[ii]);
 			}
 
 			bx::free(g_allocator, m_uniformBuffer);
+			bx::free(g_allocator, m_uniformBlockBuffer);
 			bx::deleteObject(g_allocator, m_textVideoMem);
+
+			for (uint32_t ii = 0; ii < m_maxRenderItemChunks; ++ii)
+			{
+				bx::alignedFree(g_allocator, m_renderItemChunk[ii], BX_ALIGNOF(RenderItemChunk) );
+			}
+
+			bx::free(g_allocator, m_renderItemChunk);
+			m_renderItemChunk     = NULL;
+			m_maxRenderItemChunks = 0;
+
+			for (uint32_t ii = 0; ii < kMaxRenderBindChunks; ++ii)
+			{
+				bx::alignedFree(g_allocator, m_renderBindChunk[ii], BX_ALIGNOF(RenderBindChunk) );
+				m_renderBindChunk[ii] = NULL;
+			}
+
+			bx::free(g_allocator, m_sortKeys);
+			bx::free(g_allocator, m_sortValues);
+			m_sortKeys     = NULL;
+			m_sortValues   = NULL;
+			m_sortCapacity = 0;
+
+			bx::free(g_allocator, m_multiDrawRun);
+			m_multiDrawRun      = NULL;
+			m_multiDrawCapacity = 0;
 		}
 
 		void reset()
@@ -2224,8 +2537,10 @@ namespace bgfx
 			m_perfStats.transientIbUsed = m_iboffset;
 
 			m_frameCache.reset();
-			m_numRenderItems = 0;
-			m_numBlitItems   = 0;
+			m_numRenderItems      = 0;
+			m_numRenderItemChunks = 0;
+			m_numRenderBindChunks = 1;
+			m_numBlitItems        = 0;
 			m_iboffset = 0;
 			m_vboffset = 0;
 			m_cmdPre.start();
@@ -2233,6 +2548,10 @@ namespace bgfx
 			m_capture = false;
 			m_numScreenShots = 0;
 			m_frameNum = frameNum;
+			m_frameCaptureWriter = NULL;
+			m_frameReplay        = NULL;
+			m_frameCaptureStop   = false;
+			m_frameReplaySource  = NULL;
 		}
 
 		void finish()
@@ -2241,8 +2560,106 @@ namespace bgfx
 			m_cmdPost.finish();
 		}
 
+		// Renderer might point transient buffer data into mapped GPU memory (see
+		// BGFX_CONFIG_TRANSIENT_BUFFER_ZERO_COPY), this points it back to memory allocated with
+		// transient buffer, optionally copying data already written.
+		void transientToCpu(bool _copy)
+		{
+			uint8_t* ib = (uint8_t*)m_transientIb + bx::alignUp<uint32_t>(sizeof(TransientIndexBuffer), 16);
+			if (ib != m_transientIb->data)
+			{
+				if (_copy)
+				{
+					bx::memCopy(ib, m_transientIb->data, m_iboffset);
+				}
+
+				m_transientIb->data = ib;
+			}
+
+			uint8_t* vb = (uint8_t*)m_transientVb + bx::alignUp<uint32_t>(sizeof(TransientVertexBuffer), 16);
+			if (vb != m_transientVb->data)
+			{
+				if (_copy)
+				{
+					bx::memCopy(vb, m_transientVb->data, m_vboffset);
+				}
+
+				m_transientVb->data = vb;
+			}
+		}
+
 		void sort();
 
+		// Finds runs of compatible draw items in sorted views with multi-draw enabled.
+		void batchMultiDraw();
+
+		bool isMultiDrawProgram(ProgramHandle _handle) const
+		{
+			return isValid(_handle)
+				&& 0 != (m_multiDrawProgram[_handle.idx/32] & (1<<(_handle.idx%32) ) )
+				;
+		}
+
+		// Reserves chunk together with its share of frame draw call budget. Encoder owns chunk
+		// exclusively, so submit doesn't touch any shared state until chunk is full.
+		RenderItemChunk* reserveRenderItemChunk()
+		{
+			const uint32_t idx = bx::atomicFetchAndAddsat<uint32_t>(&m_numRenderItemChunks, 1, m_maxRenderItemChunks);
+			if (m_maxRenderItemChunks <= idx)
+			{
+				return NULL;
+			}
+
+			RenderItemChunk* chunk = m_renderItemChunk[idx];
+
+			if (NULL == chunk)
+			{
+				chunk = (RenderItemChunk*)bx::alignedAlloc(g_allocator, sizeof(RenderItemChunk), BX_ALIGNOF(RenderItemChunk) );
+				chunk->m_first    = idx*BGFX_CONFIG_RENDER_ITEM_CHUNK_SIZE;
+				chunk->m_capacity = bx::min<uint32_t>(BGFX_CONFIG_RENDER_ITEM_CHUNK_SIZE, g_caps.limits.maxDrawCalls - chunk->m_first);
+				m_renderItemChunk[idx] = chunk;
+			}
+
+			chunk->m_num = 0;
+
+			return chunk;
+		}
+
+		const RenderItem& getRenderItem(uint32_t _idx) const
+		{
+			const RenderItemChunk* chunk = m_renderItemChunk[_idx / BGFX_CONFIG_RENDER_ITEM_CHUNK_SIZE];
+			return chunk->m_item[_idx % BGFX_CONFIG_RENDER_ITEM_CHUNK_SIZE];
+		}
+
+		RenderBindChunk* reserveRenderBindChunk()
+		{
+			const uint32_t idx = bx::atomicFetchAndAddsat<uint32_t>(&m_numRenderBindChunks, 1, kMaxRenderBindChunks);
+			if (kMaxRenderBindChunks <= idx)
+			{
+				return NULL;
+			}
+
+			RenderBindChunk* chunk = m_renderBindChunk[idx];
+
+			if (NULL == chunk)
+			{
+				chunk = (RenderBindChunk*)bx::alignedAlloc(g_allocator, sizeof(RenderBindChunk), BX_ALIGNOF(RenderBindChunk) );
+				bx::memSet(chunk->m_bind, 0, sizeof(chunk->m_bind) );
+				chunk->m_first = idx*BGFX_CONFIG_RENDER_BIND_CHUNK_SIZE;
+				m_renderBindChunk[idx] = chunk;
+			}
+
+			chunk->m_num = 0;
+
+			return chunk;
+		}
+
+		const RenderBind& getRenderBind(uint16_t _bindIdx) const
+		{
+			const RenderBindChunk* chunk = m_renderBindChunk[_bindIdx / BGFX_CONFIG_RENDER_BIND_CHUNK_SIZE];
+			return chunk->m_bind[_bindIdx % BGFX_CONFIG_RENDER_BIND_CHUNK_SIZE];
+		}
+
 		uint32_t getAvailTransientIndexBuffer(uint32_t _num, uint16_t _indexSize)
 		{
 			const uint32_t offset = bx::strideAlign(m_iboffset, _indexSize);
@@ -2321,6 +2738,16 @@ namespace bgfx
 			return m_freeUniform.queue(_handle);
 		}
 
+		bool free(UniformBlockHandle _handle)
+		{
+			return m_freeUniformBlock.queue(_handle);
+		}
+
+		const uint8_t* getUniformBlockData(const RenderDraw& _draw) const
+		{
+			return (const uint8_t*)m_uniformBlockBuffer[_draw.m_uniformIdx]->getData(_draw.m_uniformBlockOffset);
+		}
+
 		void resetFreeHandles()
 		{
 			m_freeIndexBuffer.reset();
@@ -2331,6 +2758,7 @@ namespace bgfx
 			m_freeTexture.reset();
 			m_freeFrameBuffer.reset();
 			m_freeUniform.reset();
+			m_freeUniformBlock.reset();
 		}
 
 		ViewId m_viewRemap[BGFX_CONFIG_MAX_VIEWS];
@@ -2338,18 +2766,40 @@ namespace bgfx
 
 		View m_view[BGFX_CONFIG_MAX_VIEWS];
 
+		// View rect and scissor as set by API, sort intersects `m_view` rect and scissor with
+		// render target size in place. Views are copied into frame only when changed.
+		Rect m_viewRect[BGFX_CONFIG_MAX_VIEWS];
+		Rect m_viewScissor[BGFX_CONFIG_MAX_VIEWS];
+
+		// Views with at least one render item, in view id order. Valid after sort.
+		ViewId   m_activeView[BGFX_CONFIG_MAX_VIEWS];
+		uint16_t m_numActiveViews;
+
 		int32_t m_occlusion[BGFX_CONFIG_MAX_OCCLUSION_QUERIES];
 
-		uint64_t m_sortKeys[BGFX_CONFIG_MAX_DRAW_CALLS+1];
-		RenderItemCount m_sortValues[BGFX_CONFIG_MAX_DRAW_CALLS+1];
-		RenderItem m_renderItem[BGFX_CONFIG_MAX_DRAW_CALLS+1];
-		RenderBind m_renderItemBind[BGFX_CONFIG_MAX_DRAW_CALLS + 1];
+		uint64_t* m_sortKeys;
+		RenderItemCount* m_sortValues;
+		uint32_t m_sortCapacity;
+
+		// Multi-draw runs in sorted order. Valid after sort.
+		MultiDrawRun* m_multiDrawRun;
+		uint32_t m_numMultiDrawRuns;
+		uint32_t m_numMultiDrawItems;
+		uint32_t m_multiDrawCapacity;
+
+		RenderItemChunk** m_renderItemChunk;
+		uint32_t m_numRenderItemChunks;
+		uint32_t m_maxRenderItemChunks;
+
+		RenderBindChunk* m_renderBindChunk[kMaxRenderBindChunks];
+		uint32_t m_numRenderBindChunks;
 
 		uint32_t m_blitKeys[BGFX_CONFIG_MAX_BLIT_ITEMS+1];
 		BlitItem m_blitItem[BGFX_CONFIG_MAX_BLIT_ITEMS+1];
 
 		FrameCache m_frameCache;
 		UniformBuffer** m_uniformBuffer;
+		UniformBuffer** m_uniformBlockBuffer;
 
 		uint32_t m_numRenderItems;
 		uint16_t m_numBlitItems;
@@ -2361,6 +2811,8 @@ namespace bgfx
 
 		Resolution m_resolution;
 		uint32_t m_debug;
+		ProgramHandle m_fallbackProgram;
+		uint32_t m_multiDrawProgram[(BGFX_CONFIG_MAX_PROGRAMS+31)/32];
 
 		ScreenShot m_screenShot[BGFX_CONFIG_MAX_SCREENSHOTS];
 		uint8_t m_numScreenShots;
@@ -2432,6 +2884,7 @@ namespace bgfx
 		FreeHandle<TextureHandle,      BGFX_CONFIG_MAX_TEXTURES>       m_freeTexture;
 		FreeHandle<FrameBufferHandle,  BGFX_CONFIG_MAX_FRAME_BUFFERS>  m_freeFrameBuffer;
 		FreeHandle<UniformHandle,      BGFX_CONFIG_MAX_UNIFORMS>       m_freeUniform;
+		FreeHandle<UniformBlockHandle, BGFX_CONFIG_MAX_UNIFORM_BLOCKS> m_freeUniformBlock;
 
 		TextVideoMem* m_textVideoMem;
 
@@ -2444,6 +2897,165 @@ namespace bgfx
 		uint32_t m_frameNum;
 
 		bool m_capture;
+
+		// Frame capture and replay are handed over to render thread with frame.
+		FrameCaptureWriter* m_frameCaptureWriter;
+		FrameCaptureReader* m_frameReplay;
+		bool m_frameCaptureStop;
+
+		// Set on frame read from capture file, sort uses frame buffer sizes of capturing session.
+		const FrameCaptureReader* m_frameReplaySource;
+	};
+
+	// Draw calls recorded once and replayed into frames. Recorded draws keep uniform, matrix and
+	// binding set offsets relative to the bundle, these are relocated when bundle is submitted.
+	struct DrawBundle
+	{
+		struct Draw
+		{
+			RenderDraw    m_draw;
+			Rect          m_scissor;
+			ProgramHandle m_program;
+			uint32_t      m_depth;
+			uint8_t       m_blend;
+		};
+
+		DrawBundle()
+			: m_draw(NULL)
+			, m_bind(NULL)
+			, m_matrix(NULL)
+			, m_uniform(NULL)
+			, m_uniformBlock(NULL)
+			, m_numDraws(0)
+			, m_maxDraws(0)
+			, m_numBinds(0)
+			, m_maxBinds(0)
+			, m_numMatrices(0)
+			, m_maxMatrices(0)
+			, m_uniformSize(0)
+			, m_uniformMax(0)
+			, m_uniformBlockSize(0)
+			, m_uniformBlockMax(0)
+		{
+		}
+
+		void reset()
+		{
+			m_numDraws         = 0;
+			m_numBinds         = 0;
+			m_numMatrices      = 0;
+			m_uniformSize      = 0;
+			m_uniformBlockSize = 0;
+		}
+
+		void destroy()
+		{
+			release(m_draw);
+			release(m_bind);
+			release(m_matrix);
+			release(m_uniform);
+			release(m_uniformBlock);
+
+			*this = DrawBundle();
+		}
+
+		Draw& addDraw()
+		{
+			grow(m_draw, m_numDraws, m_numDraws+1, m_maxDraws);
+			return m_draw[m_numDraws++];
+		}
+
+		// Only consecutive draws are checked for the same binding set, which keeps bundle
+		// binding set indices ordered by draw.
+		bool addBind(const RenderBind& _bind, uint16_t& _bindIdx)
+		{
+			if (0 < m_numBinds
+			&&  0 == bx::memCmp(m_bind[m_numBinds-1].m_bind, _bind.m_bind, sizeof(_bind.m_bind) ) )
+			{
+				_bindIdx = uint16_t(m_numBinds-1);
+				return true;
+			}
+
+			if (UINT16_MAX <= m_numBinds)
+			{
+				return false;
+			}
+
+			grow(m_bind, m_numBinds, m_numBinds+1, m_maxBinds);
+			m_bind[m_numBinds] = _bind;
+			_bindIdx = uint16_t(m_numBinds++);
+
+			return true;
+		}
+
+		uint32_t addMatrices(const Matrix4* _mtx, uint32_t _num)
+		{
+			grow(m_matrix, m_numMatrices, m_numMatrices+_num, m_maxMatrices);
+			bx::memCopy(&m_matrix[m_numMatrices], _mtx, _num*sizeof(Matrix4) );
+
+			const uint32_t first = m_numMatrices;
+			m_numMatrices += _num;
+			return first;
+		}
+
+		uint32_t addUniforms(const void* _data, uint32_t _size)
+		{
+			grow(m_uniform, m_uniformSize, m_uniformSize+_size, m_uniformMax);
+			bx::memCopy(&m_uniform[m_uniformSize], _data, _size);
+
+			const uint32_t offset = m_uniformSize;
+			m_uniformSize += _size;
+			return offset;
+		}
+
+		uint32_t addUniformBlock(const void* _data, uint32_t _size)
+		{
+			grow(m_uniformBlock, m_uniformBlockSize, m_uniformBlockSize+_size, m_uniformBlockMax);
+			bx::memCopy(&m_uniformBlock[m_uniformBlockSize], _data, _size);
+
+			const uint32_t offset = m_uniformBlockSize;
+			m_uniformBlockSize += _size;
+			return offset;
+		}
+
+		template<typename Ty>
+		static void grow(Ty*& _data, uint32_t _num, uint32_t _required, uint32_t& _max)
+		{
+			if (_required > _max)
+			{
+				const uint32_t max = bx::max<uint32_t>(_required, bx::max<uint32_t>(_max + _max/2, 64) );
+
+				Ty* data = (Ty*)bx::alignedAlloc(g_allocator, max*sizeof(Ty), bx::max<size_t>(BX_ALIGNOF(Ty), 16) );
+				bx::memCopy(data, _data, _num*sizeof(Ty) );
+				release(_data);
+
+				_data = data;
+				_max  = max;
+			}
+		}
+
+		template<typename Ty>
+		static void release(Ty* _data)
+		{
+			bx::alignedFree(g_allocator, _data, bx::max<size_t>(BX_ALIGNOF(Ty), 16) );
+		}
+
+		Draw*       m_draw;
+		RenderBind* m_bind;
+		Matrix4*    m_matrix;
+		uint8_t*    m_uniform;
+		uint8_t*    m_uniformBlock;
+
+		uint32_t m_numDraws;
+		uint32_t m_maxDraws;
+		uint32_t m_numBinds;
+		uint32_t m_maxBinds;
+		uint32_t m_numMatrices;
+		uint32_t m_maxMatrices;
+		uint32_t m_uniformSize;
+		uint32_t m_uniformMax;
+		uint32_t m_uniformBlockSize;
+		uint32_t m_uniformBlockMax;
 	};
 
 	BX_ALIGN_DECL_CACHE_LINE(struct) EncoderImpl
@@ -2457,6 +3069,8 @@ namespace bgfx
 			// clear all bytes (inclusively the padding) before we start.
 			bx::memSet(&m_bind, 0, sizeof(m_bind));
 
+			m_drawBundle = NULL;
+
 			discard(BGFX_DISCARD_ALL);
 		}
 
@@ -2473,12 +3087,173 @@ namespace bgfx
 			UniformBuffer* uniformBuffer = m_frame->m_uniformBuffer[m_uniformIdx];
 			uniformBuffer->reset();
 
+			UniformBuffer* uniformBlockBuffer = m_frame->m_uniformBlockBuffer[m_uniformIdx];
+			uniformBlockBuffer->reset();
+
+			m_renderItemChunk = NULL;
+			m_renderBindChunk = NULL;
+
+			m_matrixPos = 0;
+			m_matrixEnd = 0;
+			m_rectPos   = 0;
+			m_rectEnd   = 0;
+			m_renderBindCache.reset();
+
+			// Binding sets from previous frame are gone, except empty binding set which is
+			// always at index 0.
+			m_bindIdx = 0 == m_bindIdx ? 0 : kInvalidHandle;
+
 			m_numSubmitted = 0;
 			m_numDropped   = 0;
+
+			m_numTransformsDropped = 0;
+			m_numScissorsDropped   = 0;
+			m_numDrawsDropped      = 0;
+			m_numPendingSkipped    = 0;
 		}
 
-		void end(bool _finalize)
+		bool allocRenderItem(uint32_t& _idx)
 		{
+			if (NULL == m_renderItemChunk
+			||  m_renderItemChunk->m_capacity == m_renderItemChunk->m_num)
+			{
+				m_renderItemChunk = m_frame->reserveRenderItemChunk();
+
+				if (NULL == m_renderItemChunk)
+				{
+					++m_numDrawsDropped;
+					return false;
+				}
+			}
+
+			_idx = m_renderItemChunk->m_num++;
+
+			return true;
+		}
+
+		uint32_t reserveMatrix(uint32_t* _num)
+		{
+			uint32_t num = *_num;
+
+			if (m_matrixEnd - m_matrixPos < num)
+			{
+				// Remainder of the current block is left unused.
+				uint32_t first;
+				const uint32_t reserved = m_frame->m_frameCache.m_matrixCache.reserveBlock(
+					  bx::max<uint32_t>(num, BGFX_CONFIG_MATRIX_CACHE_BLOCK_SIZE)
+					, &first
+					);
+				m_matrixPos = first;
+				m_matrixEnd = first + reserved;
+
+				if (reserved < num)
+				{
+					m_numTransformsDropped += num - reserved;
+					num = reserved;
+				}
+			}
+
+			const uint32_t first = m_matrixPos;
+			m_matrixPos += num;
+			*_num = num;
+
+			return first;
+		}
+
+		bool reserveRect(uint16_t& _idx)
+		{
+			if (m_rectEnd == m_rectPos)
+			{
+				uint32_t first;
+				const uint32_t reserved = m_frame->m_frameCache.m_rectCache.reserveBlock(BGFX_CONFIG_RECT_CACHE_BLOCK_SIZE, &first);
+				m_rectPos = first;
+				m_rectEnd = first + reserved;
+
+				if (0 == reserved)
+				{
+					++m_numScissorsDropped;
+					return false;
+				}
+			}
+
+			_idx = uint16_t(m_rectPos++);
+
+			return true;
+		}
+
+		bool allocRenderBind(uint16_t& _bindIdx)
+		{
+			if (kInvalidHandle != m_bindIdx)
+			{
+				_bindIdx = m_bindIdx;
+				return true;
+			}
+
+			if (internRenderBind(m_bind, _bindIdx, m_bindHash) )
+			{
+				m_bindIdx = _bindIdx;
+				return true;
+			}
+
+			return false;
+		}
+
+		bool internRenderBind(const RenderBind& _bind, uint16_t& _bindIdx, uint32_t& _bindHash)
+		{
+			const uint32_t hash = bx::hash<bx::HashMurmur2A>(_bind.m_bind, sizeof(_bind.m_bind) );
+			_bindHash = hash;
+
+			uint16_t bindIdx = m_renderBindCache.find(hash);
+			if (kInvalidHandle != bindIdx
+			&&  0 == bx::memCmp(m_frame->getRenderBind(bindIdx).m_bind, _bind.m_bind, sizeof(_bind.m_bind) ) )
+			{
+				_bindIdx = bindIdx;
+				return true;
+			}
+
+			if (NULL == m_renderBindChunk
+			||  BGFX_CONFIG_RENDER_BIND_CHUNK_SIZE == m_renderBindChunk->m_num)
+			{
+				m_renderBindChunk = m_frame->reserveRenderBindChunk();
+
+				if (NULL == m_renderBindChunk)
+				{
+					return false;
+				}
+			}
+
+			const uint32_t idx = m_renderBindChunk->m_num++;
+			m_renderBindChunk->m_bind[idx] = _bind;
+
+			bindIdx = uint16_t(m_renderBindChunk->m_first + idx);
+
+			// Keep lookup table at most half full, otherwise probing for missing keys gets slow.
+			if (m_renderBindCache.getNumElements() < BGFX_CONFIG_RENDER_BIND_CACHE_SIZE/2)
+			{
+				m_renderBindCache.insert(hash, bindIdx);
+			}
+
+			_bindIdx = bindIdx;
+
+			return true;
+		}
+
+		uint64_t encodeDrawKey(ViewId _id, ProgramHandle _program, uint32_t _depth, uint64_t _state, uint64_t _stencil, uint32_t _bindHash);
+
+		void discardBind(uint8_t _flags)
+		{
+			if (0 != (_flags & BGFX_DISCARD_BINDINGS) )
+			{
+				m_bind.clear(_flags);
+				m_bindIdx  = 0;
+				m_bindHash = 0;
+			}
+		}
+
+		void end(bool _finalize)
+		{
+			BX_ASSERT(NULL == m_drawBundle, "Encoder ended while recording draw bundle, endDrawBundle wasn't called.");
+
 			if (_finalize)
 			{
 				UniformBuffer* uniformBuffer = m_frame->m_uniformBuffer[m_uniformIdx];
@@ -2522,6 +3297,16 @@ namespace bgfx
 			uniformBuffer->writeUniform(_type, _handle.idx, _value, _num);
 		}
 
+		void setUniformBlock(UniformBlockHandle _handle, const void* _data, uint32_t _size)
+		{
+			UniformBuffer::update(&m_frame->m_uniformBlockBuffer[m_uniformIdx], _size, bx::max<uint32_t>(_size, 64<<10) );
+			UniformBuffer* uniformBlockBuffer = m_frame->m_uniformBlockBuffer[m_uniformIdx];
+
+			m_draw.m_uniformBlock       = _handle;
+			m_draw.m_uniformBlockOffset = uniformBlockBuffer->getPos();
+			uniformBlockBuffer->write(_data, _size);
+		}
+
 		void setState(uint64_t _state, uint32_t _rgba)
 		{
 			const uint8_t blend    = ( (_state&BGFX_STATE_BLEND_MASK    )>>BGFX_STATE_BLEND_SHIFT    )&0xff;
@@ -2563,7 +3348,17 @@ namespace bgfx
 
 		uint16_t setScissor(uint16_t _x, uint16_t _y, uint16_t _width, uint16_t _height)
 		{
-			uint16_t scissor = bx::narrowCast<uint16_t>(m_frame->m_frameCache.m_rectCache.add(_x, _y, _width, _height) );
+			uint16_t scissor = UINT16_MAX;
+
+			if (reserveRect(scissor) )
+			{
+				Rect& rect = m_frame->m_frameCache.m_rectCache.m_cache[scissor];
+				rect.m_x      = _x;
+				rect.m_y      = _y;
+				rect.m_width  = _width;
+				rect.m_height = _height;
+			}
+
 			m_draw.m_scissor = scissor;
 			return scissor;
 		}
@@ -2575,17 +3370,30 @@ namespace bgfx
 
 		uint32_t setTransform(const void* _mtx, uint16_t _num)
 		{
-			m_draw.m_startMatrix = m_frame->m_frameCache.m_matrixCache.add(_mtx, _num);
-			m_draw.m_numMatrices = _num;
+			uint32_t num = _num;
+
+			if (NULL != _mtx)
+			{
+				const uint32_t first = reserveMatrix(&num);
+				bx::memCopy(m_frame->m_frameCache.m_matrixCache.toPtr(first), _mtx, sizeof(Matrix4)*num);
+				m_draw.m_startMatrix = first;
+			}
+			else
+			{
+				m_draw.m_startMatrix = 0;
+			}
+
+			m_draw.m_numMatrices = uint16_t(num);
 
 			return m_draw.m_startMatrix;
 		}
 
 		uint32_t allocTransform(Transform* _transform, uint16_t _num)
 		{
-			uint32_t first   = m_frame->m_frameCache.m_matrixCache.reserve(&_num);
+			uint32_t num     = _num;
+			uint32_t first   = reserveMatrix(&num);
 			_transform->data = m_frame->m_frameCache.m_matrixCache.toPtr(first);
-			_transform->num  = _num;
+			_transform->num  = uint16_t(num);
 
 			return first;
 		}
@@ -2730,6 +3538,8 @@ namespace bgfx
 
 		void setTexture(uint8_t _stage, UniformHandle _sampler, TextureHandle _handle, uint32_t _flags)
 		{
+			m_bindIdx = kInvalidHandle;
+
 			Binding& bind = m_bind.m_bind[_stage];
 			bind.m_idx    = _handle.idx;
 			bind.m_type   = uint8_t(Binding::Texture);
@@ -2750,6 +3560,8 @@ namespace bgfx
 
 		void setBuffer(uint8_t _stage, IndexBufferHandle _handle, Access::Enum _access)
 		{
+			m_bindIdx = kInvalidHandle;
+
 			Binding& bind = m_bind.m_bind[_stage];
 			bind.m_idx    = _handle.idx;
 			bind.m_type   = uint8_t(Binding::IndexBuffer);
@@ -2760,6 +3572,8 @@ namespace bgfx
 
 		void setBuffer(uint8_t _stage, VertexBufferHandle _handle, Access::Enum _access)
 		{
+			m_bindIdx = kInvalidHandle;
+
 			Binding& bind = m_bind.m_bind[_stage];
 			bind.m_idx    = _handle.idx;
 			bind.m_type   = uint8_t(Binding::VertexBuffer);
@@ -2770,6 +3584,8 @@ namespace bgfx
 
 		void setImage(uint8_t _stage, TextureHandle _handle, uint8_t _mip, Access::Enum _access, TextureFormat::Enum _format)
 		{
+			m_bindIdx = kInvalidHandle;
+
 			Binding& bind = m_bind.m_bind[_stage];
 			bind.m_idx    = _handle.idx;
 			bind.m_type   = uint8_t(Binding::Image);
@@ -2788,7 +3604,7 @@ namespace bgfx
 			m_discard = false;
 			m_draw.clear(_flags);
 			m_compute.clear(_flags);
-			m_bind.clear(_flags);
+			discardBind(_flags);
 		}
 
 		void submit(ViewId _id, ProgramHandle _program, OcclusionQueryHandle _occlusionQuery, uint32_t _depth, uint8_t _flags);
@@ -2821,16 +3637,50 @@ namespace bgfx
 
 		void blit(ViewId _id, TextureHandle _dst, uint8_t _dstMip, uint16_t _dstX, uint16_t _dstY, uint16_t _dstZ, TextureHandle _src, uint8_t _srcMip, uint16_t _srcX, uint16_t _srcY, uint16_t _srcZ, uint16_t _width, uint16_t _height, uint16_t _depth);
 
+		void beginDrawBundle(DrawBundle* _bundle)
+		{
+			BX_ASSERT(NULL == m_drawBundle, "Draw bundle is already being recorded, endDrawBundle wasn't called.");
+			_bundle->reset();
+			m_drawBundle = _bundle;
+		}
+
+		void endDrawBundle()
+		{
+			BX_ASSERT(NULL != m_drawBundle, "Draw bundle is not being recorded, beginDrawBundle wasn't called.");
+			m_drawBundle = NULL;
+		}
+
+		void recordDraw(ProgramHandle _program, OcclusionQueryHandle _occlusionQuery, uint32_t _depth);
+
+		void submit(ViewId _id, const DrawBundle& _bundle, const void* _mtx);
+
 		Frame* m_frame;
+		DrawBundle* m_drawBundle;
+		RenderItemChunk* m_renderItemChunk;
+		RenderBindChunk* m_renderBindChunk;
+
+		typedef bx::HandleHashMapT<BGFX_CONFIG_RENDER_BIND_CACHE_SIZE> RenderBindCache;
+		RenderBindCache m_renderBindCache;
 
 		SortKey m_key;
 
 		RenderDraw    m_draw;
 		RenderCompute m_compute;
 		RenderBind    m_bind;
+		uint16_t      m_bindIdx;
+		uint32_t      m_bindHash;
 
 		uint32_t m_numSubmitted;
 		uint32_t m_numDropped;
+		uint32_t m_numTransformsDropped;
+		uint32_t m_numScissorsDropped;
+		uint32_t m_numDrawsDropped;
+		uint32_t m_numPendingSkipped;
+
+		uint32_t m_matrixPos;
+		uint32_t m_matrixEnd;
+		uint32_t m_rectPos;
+		uint32_t m_rectEnd;
 
 		uint32_t m_uniformBegin;
 		uint32_t m_uniformEnd;
@@ -2943,129 +3793,87 @@ namespace bgfx
 		VertexLayoutHandle m_dynamicVertexBufferRef[BGFX_CONFIG_MAX_DYNAMIC_VERTEX_BUFFERS];
 	};
 
-	// First-fit non-local allocator.
+	struct NonLocalAllocatorStats
+	{
+		uint64_t m_used;
+		uint64_t m_free;
+		uint64_t m_largestFree;
+		uint32_t m_numFreeBlocks;
+	};
+
+	// Two-level segregated fit (TLSF) non-local allocator. Free blocks are kept in lists
+	// segregated by size class, first level is most significant bit of block size, second
+	// level is next kSlBits bits. Alloc and free (with immediate coalescing of neighbouring
+	// free blocks) are O(1).
 	class NonLocalAllocator
 	{
 	public:
 		static const uint64_t kInvalidBlock = UINT64_MAX;
 
-		NonLocalAllocator()
-		{
-		}
-
-		~NonLocalAllocator()
-		{
-		}
-
-		void reset()
-		{
-			m_free.clear();
-			m_used.clear();
-		}
-
-		void add(uint64_t _ptr, uint32_t _size)
-		{
-			m_free.push_back(Free(_ptr, _size) );
-		}
-
-		uint64_t remove()
-		{
-			BX_ASSERT(0 == m_used.size(), "");
+		NonLocalAllocator();
 
-			if (0 < m_free.size() )
-			{
-				Free freeBlock = m_free.front();
-				m_free.pop_front();
-				return freeBlock.m_ptr;
-			}
+		~NonLocalAllocator();
 
-			return 0;
-		}
+		void reset();
 
-		uint64_t alloc(uint32_t _size)
-		{
-			_size = bx::max(_size, 16u);
+		void add(uint64_t _ptr, uint32_t _size);
 
-			for (FreeList::iterator it = m_free.begin(), itEnd = m_free.end(); it != itEnd; ++it)
-			{
-				if (it->m_size >= _size)
-				{
-					uint64_t ptr = it->m_ptr;
+		// Removes block previously added with `add`. Must be called only when there are no
+		// allocated blocks.
+		uint64_t remove();
 
-					m_used.insert(stl::make_pair(ptr, _size) );
+		uint64_t alloc(uint32_t _size);
 
-					if (it->m_size != _size)
-					{
-						it->m_size -= _size;
-						it->m_ptr  += _size;
-					}
-					else
-					{
-						m_free.erase(it);
-					}
+		void free(uint64_t _block);
 
-					return ptr;
-				}
-			}
+		// Free blocks are coalesced in `free`, only returns true if there are no allocated
+		// blocks.
+		bool compact();
 
-			// there is no block large enough.
-			return kInvalidBlock;
-		}
+		void getStats(NonLocalAllocatorStats& _outStats) const;
 
-		void free(uint64_t _block)
-		{
-			UsedList::iterator it = m_used.find(_block);
-			if (it != m_used.end() )
-			{
-				m_free.push_front(Free(it->first, it->second) );
-				m_used.erase(it);
-			}
-		}
+	private:
+		static constexpr uint32_t kSlBits       = 4;
+		static constexpr uint32_t kSlCount      = 1<<kSlBits;
+		static constexpr uint32_t kFlCount      = 32;
+		static constexpr uint32_t kMinSize      = 16;
+		static constexpr uint32_t kInvalidIndex = UINT32_MAX;
 
-		bool compact()
+		struct Block
 		{
-			m_free.sort();
+			uint64_t m_ptr;
+			uint32_t m_size;
+			uint32_t m_prevPhys;
+			uint32_t m_nextPhys;
+			uint32_t m_prevFree;
+			uint32_t m_nextFree;
+			bool     m_free;
+		};
 
-			for (FreeList::iterator it = m_free.begin(), next = it, itEnd = m_free.end(); next != itEnd;)
-			{
-				if ( (it->m_ptr + it->m_size) == next->m_ptr)
-				{
-					it->m_size += next->m_size;
-					next = m_free.erase(next);
-				}
-				else
-				{
-					it = next;
-					++next;
-				}
-			}
+		static void mapping(uint32_t _size, uint32_t& _outFl, uint32_t& _outSl);
 
-			return 0 == m_used.size();
-		}
+		uint32_t findFree(uint32_t _size) const;
+		uint32_t allocBlock();
+		void releaseBlock(uint32_t _idx);
+		void insertFree(uint32_t _idx);
+		void removeFree(uint32_t _idx);
 
-	private:
-		struct Free
-		{
-			Free(uint64_t _ptr, uint32_t _size)
-				: m_ptr(_ptr)
-				, m_size(_size)
-			{
-			}
+		typedef stl::vector<Block> BlockArray;
+		BlockArray m_block;
 
-			bool operator<(const Free& rhs) const
-			{
-				return m_ptr < rhs.m_ptr;
-			}
+		typedef stl::vector<uint32_t> IndexArray;
+		IndexArray m_unusedBlock;
 
-			uint64_t m_ptr;
-			uint32_t m_size;
-		};
+		typedef stl::unordered_map<uint64_t, uint32_t> UsedMap;
+		UsedMap m_used;
 
-		typedef stl::list<Free> FreeList;
-		FreeList m_free;
+		uint32_t m_flBitmap;
+		uint32_t m_slBitmap[kFlCount];
+		uint32_t m_head[kFlCount][kSlCount];
 
-		typedef stl::unordered_map<uint64_t, uint32_t> UsedList;
-		UsedList m_used;
+		uint64_t m_size;
+		uint64_t m_usedSize;
+		uint32_t m_numFree;
 	};
 
 	struct BX_NO_VTABLE RendererContextI
@@ -3087,6 +3895,8 @@ namespace bgfx
 		virtual void createDynamicVertexBuffer(VertexBufferHandle _handle, uint32_t _size, uint16_t _flags) = 0;
 		virtual void updateDynamicVertexBuffer(VertexBufferHandle _handle, uint32_t _offset, uint32_t _size, const Memory* _mem) = 0;
 		virtual void destroyDynamicVertexBuffer(VertexBufferHandle _handle) = 0;
+		virtual bool readBuffer(IndexBufferHandle _handle, uint32_t _offset, uint32_t _size, void* _data) = 0;
+		virtual bool readBuffer(VertexBufferHandle _handle, uint32_t _offset, uint32_t _size, void* _data) = 0;
 		virtual void createShader(ShaderHandle _handle, const Memory* _mem) = 0;
 		virtual void destroyShader(ShaderHandle _handle) = 0;
 		virtual void createProgram(ProgramHandle _handle, ShaderHandle _vsh, ShaderHandle _fsh) = 0;
@@ -3096,7 +3906,11 @@ namespace bgfx
 		virtual void updateTexture(TextureHandle _handle, uint8_t _side, uint8_t _mip, const Rect& _rect, uint16_t _z, uint16_t _depth, uint16_t _pitch, const Memory* _mem) = 0;
 		virtual void updateTextureEnd() = 0;
 		virtual void readTexture(TextureHandle _handle, void* _data, uint8_t _mip) = 0;
+		// Records copy without waiting for GPU. Returns false when renderer can only read back
+		// synchronously, otherwise it calls rendererReadbackComplete once data is written.
+		virtual bool readTextureAsync(TextureHandle _handle, void* _data, uint8_t _mip, uint32_t _ticket) = 0;
 		virtual void resizeTexture(TextureHandle _handle, uint16_t _width, uint16_t _height, uint8_t _numMips, uint16_t _numLayers) = 0;
+		virtual void resizeTextureMips(TextureHandle _handle, uint16_t _width, uint16_t _height, uint8_t _numMips, int8_t _srcMip) = 0;
 		virtual void overrideInternal(TextureHandle _handle, uintptr_t _ptr) = 0;
 		virtual uintptr_t getInternal(TextureHandle _handle) = 0;
 		virtual void destroyTexture(TextureHandle _handle) = 0;
@@ -3109,6 +3923,8 @@ namespace bgfx
 		virtual void updateViewName(ViewId _id, const char* _name) = 0;
 		virtual void updateUniform(uint16_t _loc, const void* _data, uint32_t _size) = 0;
 		virtual void invalidateOcclusionQuery(OcclusionQueryHandle _handle) = 0;
+		virtual void warmPipeline(FrameBufferHandle _fbh, ProgramHandle _program, const VertexLayout& _layout, uint64_t _state, uint64_t _stencil) = 0;
+		virtual void flushPipelineCache() = 0;
 		virtual void setMarker(const char* _name, uint16_t _len) = 0;
 		virtual void setName(Handle _handle, const char* _name, uint16_t _len) = 0;
 		virtual void submit(Frame* _render, ClearQuad& _clearQuad, TextVideoMemBlitter& _textVideoMemBlitter) = 0;
@@ -3121,6 +3937,10 @@ namespace bgfx
 	}
 
 	void rendererUpdateUniforms(RendererContextI* _renderCtx, UniformBuffer* _uniformBuffer, uint32_t _begin, uint32_t _end);
+	const UniformBlock& rendererGetUniformBlock(UniformBlockHandle _handle);
+	void rendererGetFrameBufferSize(FrameBufferHandle _handle, uint16_t& _width, uint16_t& _height);
+	void rendererUpdateUniformBlock(RendererContextI* _renderCtx, const Frame* _render, const RenderDraw& _draw);
+	void rendererReadbackComplete(uint32_t _ticket);
 
 #if BGFX_CONFIG_DEBUG
 #	define BGFX_API_FUNC(_func) BX_NO_INLINE _func
@@ -3134,22 +3954,40 @@ namespace bgfx
 
 		Context()
 			: m_render(&m_frame[0])
-			, m_submit(&m_frame[BGFX_CONFIG_MULTITHREADED ? 1 : 0])
+			, m_submit(&m_frame[0])
+			, m_numFrames(1)
+			, m_renderIdx(0)
+			, m_submitIdx(0)
+			, m_numFramesSubmitted(0)
+			, m_numFramesRendered(0)
+			, m_tempKeys(NULL)
+			, m_tempValues(NULL)
+			, m_tempCapacity(0)
 			, m_numFreeDynamicIndexBufferHandles(0)
 			, m_numFreeDynamicVertexBufferHandles(0)
 			, m_numFreeOcclusionQueryHandles(0)
 			, m_colorPaletteDirty(0)
+			, m_viewRemapDirty(0)
 			, m_frames(0)
 			, m_debug(BGFX_DEBUG_NONE)
 			, m_rtMemoryUsed(0)
 			, m_textureMemoryUsed(0)
 			, m_renderCtx(NULL)
+			, m_frameCaptureWriter(NULL)
+			, m_frameReplay(NULL)
+			, m_frameCaptureActive(false)
+			, m_frameCaptureEnded(0)
+			, m_readbackTicket(0)
+			, m_readbackComplete(0)
+			, m_readbackIssued(0)
 			, m_headless(false)
 			, m_rendererInitialized(false)
 			, m_exit(false)
 			, m_flipAfterRender(false)
 			, m_singleThreaded(false)
 		{
+			m_fallbackProgram = BGFX_INVALID_HANDLE;
+			bx::memSet(m_multiDrawProgram, 0, sizeof(m_multiDrawProgram) );
 		}
 
 		~Context()
@@ -3171,6 +4009,20 @@ namespace bgfx
 		bool init(const Init& _init);
 		void shutdown();
 
+		// render thread
+		void reserveTempSort(uint32_t _num)
+		{
+			// Temp keys are also used as scratch for sorting blit keys.
+			const uint32_t num = bx::max<uint32_t>(_num, BGFX_CONFIG_MAX_BLIT_ITEMS);
+
+			if (m_tempCapacity < num)
+			{
+				m_tempCapacity = bx::max(num, m_tempCapacity*2);
+				m_tempKeys     = (uint64_t*)bx::realloc(g_allocator, m_tempKeys, m_tempCapacity*sizeof(uint64_t) );
+				m_tempValues   = (RenderItemCount*)bx::realloc(g_allocator, m_tempValues, m_tempCapacity*sizeof(RenderItemCount) );
+			}
+		}
+
 		CommandBuffer& getCommandBuffer(CommandBuffer::Enum _cmd)
 		{
 			CommandBuffer& cmdbuf = _cmd < CommandBuffer::End ? m_submit->m_cmdPre : m_submit->m_cmdPost;
@@ -3179,6 +4031,32 @@ namespace bgfx
 			return cmdbuf;
 		}
 
+		// Textures that are written by GPU are created immediately, they don't upload any data,
+		// and they are used by commands that can't wait for upload (blit, frame buffer, read back).
+		bool isUploadDeferred(uint64_t _flags, uint8_t _bbRatio) const
+		{
+			return m_uploadQueue.isEnabled()
+				&& BackbufferRatio::Count == _bbRatio
+				&& 0 == (_flags & (0
+					| BGFX_TEXTURE_RT_MASK
+					| BGFX_TEXTURE_COMPUTE_WRITE
+					| BGFX_TEXTURE_BLIT_DST
+					| BGFX_TEXTURE_READ_BACK
+					) )
+				;
+		}
+
+		void uploadQueueIssue(uint32_t _num);
+		bool uploadQueueDiscard(UploadType::Enum _type, uint16_t _handle);
+		void uploadQueueShutdown();
+
+		void textureStreamingUpdate();
+		void textureStreamingResize(TextureHandle _handle, const TextureStreaming::Change& _change, bool _copyMips);
+
+		void textureDecodeIssue(TextureHandle _handle);
+		void textureDecodeUpdate();
+		void textureDecodeShutdown();
+
 		BGFX_API_FUNC(void reset(uint32_t _width, uint32_t _height, uint32_t _flags, TextureFormat::Enum _format) )
 		{
 			BGFX_MUTEX_SCOPE(m_resourceApiLock);
@@ -3243,6 +4121,7 @@ namespace bgfx
 			for (uint32_t ii = 0; ii < BGFX_CONFIG_MAX_VIEWS; ++ii)
 			{
 				m_view[ii].setFrameBuffer(BGFX_INVALID_HANDLE);
+				setViewDirty(ViewId(ii) );
 			}
 
 			for (uint16_t ii = 0, num = m_textureHandle.getNumHandles(); ii < num; ++ii)
@@ -3323,6 +4202,22 @@ namespace bgfx
 			stats.textureMemoryUsed = m_textureMemoryUsed;
 			stats.rtMemoryUsed      = m_rtMemoryUsed;
 
+			stats.streamingMemoryUsed = m_textureStreaming.getUsed();
+
+			stats.numUploadsQueued = m_uploadQueue.getNum();
+			stats.uploadQueueSize  = m_uploadQueue.getSize();
+
+			NonLocalAllocatorStats allocatorStats;
+			m_dynVertexBufferAllocator.getStats(allocatorStats);
+			stats.dynamicVbUsed        = int64_t(allocatorStats.m_used);
+			stats.dynamicVbFree        = int64_t(allocatorStats.m_free);
+			stats.dynamicVbLargestFree = int64_t(allocatorStats.m_largestFree);
+
+			m_dynIndexBufferAllocator.getStats(allocatorStats);
+			stats.dynamicIbUsed        = int64_t(allocatorStats.m_used);
+			stats.dynamicIbFree        = int64_t(allocatorStats.m_free);
+			stats.dynamicIbLargestFree = int64_t(allocatorStats.m_largestFree);
+
 			return &stats;
 		}
 
@@ -3339,12 +4234,20 @@ namespace bgfx
 				ib.m_size  = _mem->size;
 				ib.m_flags = _flags;
 
-				CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::CreateIndexBuffer);
-				cmdbuf.write(handle);
-				cmdbuf.write(_mem);
-				cmdbuf.write(_flags);
+				if (m_uploadQueue.isEnabled() )
+				{
+					UploadQueue::Item& item = m_uploadQueue.push(UploadType::IndexBuffer, handle.idx, CommandBuffer::CreateIndexBuffer, true, _mem);
+					item.m_flags = _flags;
+				}
+				else
+				{
+					CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::CreateIndexBuffer);
+					cmdbuf.write(handle);
+					cmdbuf.write(_mem);
+					cmdbuf.write(_flags);
 
-				setDebugNameForHandle(handle);
+					setDebugNameForHandle(handle);
+				}
 			}
 			else
 			{
@@ -3363,7 +4266,27 @@ namespace bgfx
 			IndexBuffer& ref = m_indexBuffers[_handle.idx];
 			ref.m_name.set(_name);
 
-			setNameForHandle(_handle, _name);
+			// Name is set by renderer once queued buffer is created.
+			if (!m_uploadQueue.isCreatePending(UploadType::IndexBuffer, _handle.idx) )
+			{
+				setNameForHandle(_handle, _name);
+			}
+		}
+
+		BGFX_API_FUNC(void setUploadPriority(IndexBufferHandle _handle, uint8_t _priority) )
+		{
+			BGFX_MUTEX_SCOPE(m_resourceApiLock);
+			BGFX_CHECK_HANDLE("setUploadPriority", m_indexBufferHandle, _handle);
+
+			m_uploadQueue.setPriority(UploadType::IndexBuffer, _handle.idx, _priority);
+		}
+
+		BGFX_API_FUNC(bool isReady(IndexBufferHandle _handle) )
+		{
+			BGFX_MUTEX_SCOPE(m_resourceApiLock);
+			BGFX_CHECK_HANDLE("isReady", m_indexBufferHandle, _handle);
+
+			return m_uploadQueue.isReady(UploadType::IndexBuffer, _handle.idx);
 		}
 
 		BGFX_API_FUNC(void destroyIndexBuffer(IndexBufferHandle _handle) )
@@ -3371,14 +4294,19 @@ namespace bgfx
 			BGFX_MUTEX_SCOPE(m_resourceApiLock);
 
 			BGFX_CHECK_HANDLE("destroyIndexBuffer", m_indexBufferHandle, _handle);
+			const bool created = !uploadQueueDiscard(UploadType::IndexBuffer, _handle.idx);
+
 			bool ok = m_submit->free(_handle); BX_UNUSED(ok);
 			BX_ASSERT(ok, "Index buffer handle %d is already destroyed!", _handle.idx);
 
 			IndexBuffer& ref = m_indexBuffers[_handle.idx];
 			ref.m_name.clear();
 
-			CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::DestroyIndexBuffer);
-			cmdbuf.write(_handle);
+			if (created)
+			{
+				CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::DestroyIndexBuffer);
+				cmdbuf.write(_handle);
+			}
 		}
 
 		VertexLayoutHandle findOrCreateVertexLayout(const VertexLayout& _layout, bool _refCountOnCreation = false)
@@ -3455,13 +4383,22 @@ namespace bgfx
 				vb.m_size   = _mem->size;
 				vb.m_stride = _layout.m_stride;
 
-				CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::CreateVertexBuffer);
-				cmdbuf.write(handle);
-				cmdbuf.write(_mem);
-				cmdbuf.write(layoutHandle);
-				cmdbuf.write(_flags);
+				if (m_uploadQueue.isEnabled() )
+				{
+					UploadQueue::Item& item = m_uploadQueue.push(UploadType::VertexBuffer, handle.idx, CommandBuffer::CreateVertexBuffer, true, _mem);
+					item.m_layout = layoutHandle.idx;
+					item.m_flags  = _flags;
+				}
+				else
+				{
+					CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::CreateVertexBuffer);
+					cmdbuf.write(handle);
+					cmdbuf.write(_mem);
+					cmdbuf.write(layoutHandle);
+					cmdbuf.write(_flags);
 
-				setDebugNameForHandle(handle);
+					setDebugNameForHandle(handle);
+				}
 
 				return handle;
 			}
@@ -3481,7 +4418,27 @@ namespace bgfx
 			VertexBuffer& ref = m_vertexBuffers[_handle.idx];
 			ref.m_name.set(_name);
 
-			setNameForHandle(_handle, _name);
+			// Name is set by renderer once queued buffer is created.
+			if (!m_uploadQueue.isCreatePending(UploadType::VertexBuffer, _handle.idx) )
+			{
+				setNameForHandle(_handle, _name);
+			}
+		}
+
+		BGFX_API_FUNC(void setUploadPriority(VertexBufferHandle _handle, uint8_t _priority) )
+		{
+			BGFX_MUTEX_SCOPE(m_resourceApiLock);
+			BGFX_CHECK_HANDLE("setUploadPriority", m_vertexBufferHandle, _handle);
+
+			m_uploadQueue.setPriority(UploadType::VertexBuffer, _handle.idx, _priority);
+		}
+
+		BGFX_API_FUNC(bool isReady(VertexBufferHandle _handle) )
+		{
+			BGFX_MUTEX_SCOPE(m_resourceApiLock);
+			BGFX_CHECK_HANDLE("isReady", m_vertexBufferHandle, _handle);
+
+			return m_uploadQueue.isReady(UploadType::VertexBuffer, _handle.idx);
 		}
 
 		BGFX_API_FUNC(void destroyVertexBuffer(VertexBufferHandle _handle) )
@@ -3489,14 +4446,19 @@ namespace bgfx
 			BGFX_MUTEX_SCOPE(m_resourceApiLock);
 
 			BGFX_CHECK_HANDLE("destroyVertexBuffer", m_vertexBufferHandle, _handle);
+			const bool created = !uploadQueueDiscard(UploadType::VertexBuffer, _handle.idx);
+
 			bool ok = m_submit->free(_handle); BX_UNUSED(ok);
 			BX_ASSERT(ok, "Vertex buffer handle %d is already destroyed!", _handle.idx);
 
 			VertexBuffer& ref = m_vertexBuffers[_handle.idx];
 			ref.m_name.clear();
 
-			CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::DestroyVertexBuffer);
-			cmdbuf.write(_handle);
+			if (created)
+			{
+				CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::DestroyVertexBuffer);
+				cmdbuf.write(_handle);
+			}
 		}
 
 		void destroyVertexBufferInternal(VertexBufferHandle _handle)
@@ -3506,7 +4468,7 @@ namespace bgfx
 			{
 				CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::DestroyVertexLayout);
 				cmdbuf.write(layoutHandle);
-				m_render->free(layoutHandle);
+				getNextSubmitFrame()->free(layoutHandle);
 			}
 
 			m_vertexBufferHandle.free(_handle.idx);
@@ -3680,7 +4642,7 @@ namespace bgfx
 				m_dynIndexBufferAllocator.free(uint64_t(_dib.m_handle.idx) << 32 | _dib.m_offset);
 				if (m_dynIndexBufferAllocator.compact() )
 				{
-					for (uint64_t ptr = m_dynIndexBufferAllocator.remove(); 0 != ptr; ptr = m_dynIndexBufferAllocator.remove() )
+					for (uint64_t ptr = m_dynIndexBufferAllocator.remove(); NonLocalAllocator::kInvalidBlock != ptr; ptr = m_dynIndexBufferAllocator.remove() )
 					{
 						IndexBufferHandle handle = { uint16_t(ptr >> 32) };
 						destroyIndexBuffer(handle);
@@ -3881,7 +4843,7 @@ namespace bgfx
 				m_dynVertexBufferAllocator.free(uint64_t(_dvb.m_handle.idx) << 32 | _dvb.m_offset);
 				if (m_dynVertexBufferAllocator.compact() )
 				{
-					for (uint64_t ptr = m_dynVertexBufferAllocator.remove(); 0 != ptr; ptr = m_dynVertexBufferAllocator.remove() )
+					for (uint64_t ptr = m_dynVertexBufferAllocator.remove(); NonLocalAllocator::kInvalidBlock != ptr; ptr = m_dynVertexBufferAllocator.remove() )
 					{
 						VertexBufferHandle handle = { uint16_t(ptr >> 32) };
 						destroyVertexBuffer(handle);
@@ -3899,7 +4861,7 @@ namespace bgfx
 			{
 				CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::DestroyVertexLayout);
 				cmdbuf.write(layoutHandle);
-				m_render->free(layoutHandle);
+				getNextSubmitFrame()->free(layoutHandle);
 			}
 
 			DynamicVertexBuffer& dvb = m_dynamicVertexBuffers[_handle.idx];
@@ -4074,6 +5036,10 @@ namespace bgfx
 				uint32_t size  = _num * BGFX_CONFIG_DRAW_INDIRECT_STRIDE;
 				uint16_t flags = BGFX_BUFFER_DRAW_INDIRECT;
 
+				VertexBuffer& vb = m_vertexBuffers[handle.idx];
+				vb.m_size   = size;
+				vb.m_stride = 0;
+
 				CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::CreateDynamicVertexBuffer);
 				cmdbuf.write(handle);
 				cmdbuf.write(size);
@@ -4296,6 +5262,20 @@ namespace bgfx
 			}
 		}
 
+		// Name set while resource creation was in upload queue is passed to renderer after
+		// resource is created.
+		void setUploadNameForHandle(Handle _handle, const bx::StringView& _name)
+		{
+			if (_name.isEmpty() )
+			{
+				setDebugNameForHandle(_handle);
+			}
+			else
+			{
+				setNameForHandle(_handle, _name);
+			}
+		}
+
 		BGFX_API_FUNC(void setName(ShaderHandle _handle, const bx::StringView& _name) )
 		{
 			BGFX_MUTEX_SCOPE(m_resourceApiLock);
@@ -4498,9 +5478,58 @@ namespace bgfx
 				cmdbuf.write(_handle);
 
 				m_programHashMap.removeByHandle(_handle.idx);
+
+				if (m_fallbackProgram.idx == _handle.idx)
+				{
+					m_fallbackProgram = BGFX_INVALID_HANDLE;
+				}
+
+				m_multiDrawProgram[_handle.idx/32] &= ~(1<<(_handle.idx%32) );
 			}
 		}
 
+		BGFX_API_FUNC(void setFallbackProgram(ProgramHandle _handle) )
+		{
+			BGFX_MUTEX_SCOPE(m_resourceApiLock);
+
+			BGFX_CHECK_HANDLE_INVALID_OK("setFallbackProgram", m_programHandle, _handle);
+			m_fallbackProgram = _handle;
+		}
+
+		BGFX_API_FUNC(void setProgramMultiDraw(ProgramHandle _handle, bool _enabled) )
+		{
+			BGFX_MUTEX_SCOPE(m_resourceApiLock);
+
+			BGFX_CHECK_HANDLE("setProgramMultiDraw", m_programHandle, _handle);
+
+			const uint32_t mask = 1<<(_handle.idx%32);
+			m_multiDrawProgram[_handle.idx/32] = _enabled
+				? m_multiDrawProgram[_handle.idx/32] |  mask
+				: m_multiDrawProgram[_handle.idx/32] & ~mask
+				;
+		}
+
+		BGFX_API_FUNC(void warmPipeline(ViewId _id, ProgramHandle _program, const VertexLayout& _layout, uint64_t _state, uint32_t _fstencil, uint32_t _bstencil) )
+		{
+			BGFX_MUTEX_SCOPE(m_resourceApiLock);
+
+			BGFX_CHECK_HANDLE("warmPipeline", m_programHandle, _program);
+
+			CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::WarmPipeline);
+			cmdbuf.write(m_view[_id].m_fbh);
+			cmdbuf.write(_program);
+			cmdbuf.write(_layout);
+			cmdbuf.write(_state);
+			cmdbuf.write(packStencil(_fstencil, _bstencil) );
+		}
+
+		BGFX_API_FUNC(void flushPipelineCache() )
+		{
+			BGFX_MUTEX_SCOPE(m_resourceApiLock);
+
+			getCommandBuffer(CommandBuffer::FlushPipelineCache);
+		}
+
 		BGFX_API_FUNC(TextureHandle createTexture(const Memory* _mem, uint64_t _flags, uint8_t _skip, TextureInfo* _info, BackbufferRatio::Enum _ratio, bool _immutable) )
 		{
 			BGFX_MUTEX_SCOPE(m_resourceApiLock);
@@ -4574,13 +5603,57 @@ namespace bgfx
 				m_textureMemoryUsed += int64_t(ref.m_storageSize);
 			}
 
-			CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::CreateTexture);
-			cmdbuf.write(handle);
-			cmdbuf.write(_mem);
-			cmdbuf.write(_flags);
-			cmdbuf.write(_skip);
+			// Image files in formats renderer would convert are decoded on worker threads, and
+			// texture creation is queued until decoded. When decoder is full, texture is
+			// converted by renderer.
+			const TextureFormat::Enum decodeFormat = m_textureDecoder.isEnabled()
+				? TextureDecoder::getDecodeFormat(imageContainer)
+				: TextureFormat::Count
+				;
 
-			setDebugNameForHandle(handle);
+			uint32_t magic;
+			bx::memCopy(&magic, _mem->data, sizeof(magic) );
+
+			const bool decode = true
+				&& TextureFormat::Count != decodeFormat
+				&& !m_textureDecoder.isFull()
+				&& BGFX_CHUNK_MAGIC_TEX != magic
+				&& BackbufferRatio::Count == _ratio
+				&& 0 == (_flags & (0
+					| BGFX_TEXTURE_RT_MASK
+					| BGFX_TEXTURE_COMPUTE_WRITE
+					| BGFX_TEXTURE_BLIT_DST
+					| BGFX_TEXTURE_READ_BACK
+					) )
+				;
+
+			if (decode)
+			{
+				m_textureDecoder.push(handle, _mem, _skip, decodeFormat);
+				ref.m_decodeFormat = uint8_t(decodeFormat);
+			}
+
+			// Creation of decoding texture is queued even when upload queue is disabled, and
+			// it's blocked until texture is decoded.
+			if (decode
+			||  isUploadDeferred(_flags, ref.m_bbRatio) )
+			{
+				UploadQueue::Item& item = m_uploadQueue.push(UploadType::Texture, handle.idx, CommandBuffer::CreateTexture, true, _mem);
+				item.m_flags = _flags;
+				item.m_skip  = _skip;
+
+				m_uploadQueue.setBlocked(UploadType::Texture, handle.idx, decode);
+			}
+			else
+			{
+				CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::CreateTexture);
+				cmdbuf.write(handle);
+				cmdbuf.write(_mem);
+				cmdbuf.write(_flags);
+				cmdbuf.write(_skip);
+
+				setDebugNameForHandle(handle);
+			}
 
 			return handle;
 		}
@@ -4593,7 +5666,62 @@ namespace bgfx
 			TextureRef& ref = m_textureRef[_handle.idx];
 			ref.m_name.set(_name);
 
-			setNameForHandle(_handle, _name);
+			// Name is set by renderer once queued or decoding texture is created.
+			if (!m_textureDecoder.isPending(_handle)
+			&&  !m_uploadQueue.isCreatePending(UploadType::Texture, _handle.idx) )
+			{
+				setNameForHandle(_handle, _name);
+			}
+		}
+
+		BGFX_API_FUNC(void setUploadPriority(TextureHandle _handle, uint8_t _priority) )
+		{
+			BGFX_MUTEX_SCOPE(m_resourceApiLock);
+			BGFX_CHECK_HANDLE("setUploadPriority", m_textureHandle, _handle);
+
+			m_uploadQueue.setPriority(UploadType::Texture, _handle.idx, _priority);
+		}
+
+		BGFX_API_FUNC(bool isReady(TextureHandle _handle) )
+		{
+			BGFX_MUTEX_SCOPE(m_resourceApiLock);
+			BGFX_CHECK_HANDLE("isReady", m_textureHandle, _handle);
+
+			return !m_textureDecoder.isPending(_handle)
+				&& m_uploadQueue.isReady(UploadType::Texture, _handle.idx)
+				;
+		}
+
+		BGFX_API_FUNC(void setTextureStreaming(TextureHandle _handle, uint16_t _width, uint16_t _height, uint8_t _numMips, TextureFormat::Enum _format, TextureMipReadFn _readFn, void* _userData) )
+		{
+			BGFX_MUTEX_SCOPE(m_resourceApiLock);
+			BGFX_CHECK_HANDLE("setTextureStreaming", m_textureHandle, _handle);
+
+			m_textureStreaming.add(_handle, _width, _height, _numMips, _format, _readFn, _userData);
+		}
+
+		BGFX_API_FUNC(void setTextureDesiredMip(TextureHandle _handle, uint8_t _mip) )
+		{
+			BGFX_MUTEX_SCOPE(m_resourceApiLock);
+			BGFX_CHECK_HANDLE("setTextureDesiredMip", m_textureHandle, _handle);
+
+			BX_WARN(m_textureStreaming.isStreaming(_handle), "Texture %d is not streaming texture.", _handle.idx);
+			if (m_textureStreaming.isStreaming(_handle) )
+			{
+				m_textureStreaming.setDesiredMip(_handle, _mip);
+			}
+		}
+
+		BGFX_API_FUNC(uint8_t getTextureResidentMip(TextureHandle _handle) )
+		{
+			BGFX_MUTEX_SCOPE(m_resourceApiLock);
+			BGFX_CHECK_HANDLE("getTextureResidentMip", m_textureHandle, _handle);
+
+			// All mips of regular texture are resident.
+			return m_textureStreaming.isStreaming(_handle)
+				? m_textureStreaming.getResidentMip(_handle)
+				: 0
+				;
 		}
 
 		void setDirectAccessPtr(TextureHandle _handle, void* _ptr)
@@ -4626,12 +5754,10 @@ namespace bgfx
 			textureDecRef(_handle);
 		}
 
-		BGFX_API_FUNC(uint32_t readTexture(TextureHandle _handle, void* _data, uint8_t _mip) )
+		// Every readback gets ticket in order of submission. Render thread counts completed
+		// readbacks, so ticket is complete once counter reaches it.
+		uint32_t readTexture(TextureHandle _handle, void* _data, uint8_t _mip, ReadbackFn _readbackFn, void* _userData)
 		{
-			BGFX_MUTEX_SCOPE(m_resourceApiLock);
-
-			BGFX_CHECK_HANDLE("readTexture", m_textureHandle, _handle);
-
 			const TextureRef& ref = m_textureRef[_handle.idx];
 			BX_ASSERT(ref.isReadBack(), "Can't read from texture which was not created with BGFX_TEXTURE_READ_BACK.");
 			BX_ASSERT(_mip < ref.m_numMips, "Invalid mip: %d num mips:", _mip, ref.m_numMips);
@@ -4641,7 +5767,84 @@ namespace bgfx
 			cmdbuf.write(_handle);
 			cmdbuf.write(_data);
 			cmdbuf.write(_mip);
-			return m_submit->m_frameNum + 2;
+			cmdbuf.write(_readbackFn);
+			cmdbuf.write(_userData);
+			return ++m_readbackTicket;
+		}
+
+		BGFX_API_FUNC(uint32_t readTexture(TextureHandle _handle, void* _data, uint8_t _mip) )
+		{
+			BGFX_MUTEX_SCOPE(m_resourceApiLock);
+
+			BGFX_CHECK_HANDLE("readTexture", m_textureHandle, _handle);
+
+			readTexture(_handle, _data, _mip, NULL, NULL);
+			return m_submit->m_frameNum + m_numFrames;
+		}
+
+		BGFX_API_FUNC(uint32_t readTextureAsync(TextureHandle _handle, void* _data, uint8_t _mip, ReadbackFn _readbackFn, void* _userData) )
+		{
+			BGFX_MUTEX_SCOPE(m_resourceApiLock);
+
+			BGFX_CHECK_HANDLE("readTextureAsync", m_textureHandle, _handle);
+
+			return readTexture(_handle, _data, _mip, _readbackFn, _userData);
+		}
+
+		BGFX_API_FUNC(bool isReadbackComplete(uint32_t _ticket) )
+		{
+			const uint32_t complete = bx::atomicFetchAndAdd<uint32_t>(&m_readbackComplete, 0);
+			return int32_t(complete - _ticket) >= 0;
+		}
+
+		uint32_t readBuffer(CommandBuffer::Enum _cmd, uint16_t _idx, uint32_t _start, uint32_t _offset, uint32_t _size, uint32_t _bufferSize, void* _data, ReadbackFn _readbackFn, void* _userData)
+		{
+			const uint32_t size = bx::min(_size, bx::uint32_satsub(_bufferSize, _offset) );
+			BX_ASSERT(_size == size, "Truncating buffer read back (offset %d, size %d, buffer size %d)."
+				, _offset
+				, _size
+				, _bufferSize
+				);
+
+			CommandBuffer& cmdbuf = getCommandBuffer(_cmd);
+			cmdbuf.write(_idx);
+			cmdbuf.write(_start + _offset);
+			cmdbuf.write(size);
+			cmdbuf.write(_data);
+			cmdbuf.write(_readbackFn);
+			cmdbuf.write(_userData);
+			return ++m_readbackTicket;
+		}
+
+		BGFX_API_FUNC(uint32_t readBuffer(DynamicIndexBufferHandle _handle, uint32_t _offset, uint32_t _size, void* _data, ReadbackFn _readbackFn, void* _userData) )
+		{
+			BGFX_MUTEX_SCOPE(m_resourceApiLock);
+
+			BGFX_CHECK_HANDLE("readBuffer", m_dynamicIndexBufferHandle, _handle);
+
+			const DynamicIndexBuffer& dib = m_dynamicIndexBuffers[_handle.idx];
+			const uint32_t indexSize = 0 == (dib.m_flags & BGFX_BUFFER_INDEX32) ? 2 : 4;
+			return readBuffer(CommandBuffer::ReadIndexBuffer, dib.m_handle.idx, dib.m_startIndex*indexSize, _offset, _size, dib.m_size, _data, _readbackFn, _userData);
+		}
+
+		BGFX_API_FUNC(uint32_t readBuffer(DynamicVertexBufferHandle _handle, uint32_t _offset, uint32_t _size, void* _data, ReadbackFn _readbackFn, void* _userData) )
+		{
+			BGFX_MUTEX_SCOPE(m_resourceApiLock);
+
+			BGFX_CHECK_HANDLE("readBuffer", m_dynamicVertexBufferHandle, _handle);
+
+			const DynamicVertexBuffer& dvb = m_dynamicVertexBuffers[_handle.idx];
+			return readBuffer(CommandBuffer::ReadVertexBuffer, dvb.m_handle.idx, dvb.m_startVertex*dvb.m_stride, _offset, _size, dvb.m_size, _data, _readbackFn, _userData);
+		}
+
+		BGFX_API_FUNC(uint32_t readBuffer(IndirectBufferHandle _handle, uint32_t _offset, uint32_t _size, void* _data, ReadbackFn _readbackFn, void* _userData) )
+		{
+			BGFX_MUTEX_SCOPE(m_resourceApiLock);
+
+			VertexBufferHandle handle = { _handle.idx };
+			BGFX_CHECK_HANDLE("readBuffer", m_vertexBufferHandle, handle);
+
+			return readBuffer(CommandBuffer::ReadVertexBuffer, handle.idx, 0, _offset, _size, m_vertexBuffers[handle.idx].m_size, _data, _readbackFn, _userData);
 		}
 
 		void resizeTexture(TextureHandle _handle, uint16_t _width, uint16_t _height, uint8_t _numMips, uint16_t _numLayers)
@@ -4700,11 +5903,28 @@ namespace bgfx
 					m_textureMemoryUsed -= int64_t(ref.m_storageSize);
 				}
 
+				// Decode result of destroyed texture is not needed, only running decode is
+				// waited for.
+				if (m_textureDecoder.isPending(_handle) )
+				{
+					m_textureDecoder.discard(_handle);
+				}
+
+				const bool created = !uploadQueueDiscard(UploadType::Texture, _handle.idx);
+
+				if (m_textureStreaming.isStreaming(_handle) )
+				{
+					m_textureStreaming.remove(_handle);
+				}
+
 				bool ok = m_submit->free(_handle); BX_UNUSED(ok);
 				BX_ASSERT(ok, "Texture handle %d is already destroyed!", _handle.idx);
 
-				CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::DestroyTexture);
-				cmdbuf.write(_handle);
+				if (created)
+				{
+					CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::DestroyTexture);
+					cmdbuf.write(_handle);
+				}
 			}
 		}
 
@@ -4732,6 +5952,42 @@ namespace bgfx
 				return;
 			}
 
+			// Updates of texture that is still decoding are queued, and they are decoded once
+			// it's known whether texture was decoded.
+			const bool decoding = m_textureDecoder.isPending(_handle);
+
+			if (!decoding
+			&&  TextureFormat::Count != ref.m_decodeFormat)
+			{
+				const Memory* mem = TextureDecoder::decodeUpdate(
+					  _mem
+					, _width
+					, _height
+					, _pitch
+					, TextureFormat::Enum(ref.m_format)
+					, TextureFormat::Enum(ref.m_decodeFormat)
+					);
+
+				release(_mem);
+				_mem = mem;
+			}
+
+			if (decoding
+			||  isUploadDeferred(ref.m_flags, ref.m_bbRatio) )
+			{
+				UploadQueue::Item& item = m_uploadQueue.push(UploadType::Texture, _handle.idx, CommandBuffer::UpdateTexture, false, _mem);
+				item.m_side   = _side;
+				item.m_mip    = _mip;
+				item.m_x      = _x;
+				item.m_y      = _y;
+				item.m_z      = _z;
+				item.m_width  = _width;
+				item.m_height = _height;
+				item.m_depth  = _depth;
+				item.m_pitch  = _pitch;
+				return;
+			}
+
 			CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::UpdateTexture);
 			cmdbuf.write(_handle);
 			cmdbuf.write(_side);
@@ -4986,6 +6242,11 @@ namespace bgfx
 
 			BGFX_CHECK_HANDLE("destroyUniform", m_uniformHandle, _handle);
 
+			uniformDecRef(_handle);
+		}
+
+		void uniformDecRef(UniformHandle _handle)
+		{
 			UniformRef& uniform = m_uniformRef[_handle.idx];
 			BX_ASSERT(uniform.m_refCount > 0, "Destroying already destroyed uniform %d.", _handle.idx);
 			int32_t refs = --uniform.m_refCount;
@@ -5003,6 +6264,100 @@ namespace bgfx
 			}
 		}
 
+		BGFX_API_FUNC(UniformBlockHandle createUniformBlock(const UniformHandle* _uniforms, uint16_t _num) )
+		{
+			BGFX_MUTEX_SCOPE(m_resourceApiLock);
+
+			if (0 == _num
+			||  BGFX_CONFIG_MAX_UNIFORM_BLOCK_UNIFORMS < _num)
+			{
+				BX_TRACE("Invalid number of uniforms in uniform block %d (max: %d)."
+					, _num
+					, BGFX_CONFIG_MAX_UNIFORM_BLOCK_UNIFORMS
+					);
+				return BGFX_INVALID_HANDLE;
+			}
+
+			UniformBlock block;
+			bx::memSet(&block, 0, sizeof(UniformBlock) );
+
+			for (uint16_t ii = 0; ii < _num; ++ii)
+			{
+				const UniformHandle handle = _uniforms[ii];
+				BGFX_CHECK_HANDLE("createUniformBlock", m_uniformHandle, handle);
+
+				const UniformRef& uniform = m_uniformRef[handle.idx];
+				if (UniformType::Sampler == uniform.m_type)
+				{
+					BX_TRACE("Sampler uniform `%s` can't be part of uniform block.", uniform.m_name.getPtr() );
+					return BGFX_INVALID_HANDLE;
+				}
+
+				UniformBlock::Uniform& entry = block.m_uniform[ii];
+				entry.m_handle = handle;
+				entry.m_type   = uint8_t(uniform.m_type);
+				entry.m_num    = uniform.m_num;
+				entry.m_offset = block.m_size;
+				entry.m_size   = UniformBlock::getStride(uniform.m_type)*uniform.m_num;
+
+				block.m_size += entry.m_size;
+			}
+
+			block.m_num  = _num;
+			block.m_hash = bx::hash<bx::HashMurmur2A>(block.m_uniform, sizeof(UniformBlock::Uniform)*_num);
+
+			UniformBlockHandle handle = { m_uniformBlockHandle.alloc() };
+
+			if (!isValid(handle) )
+			{
+				BX_TRACE("Failed to allocate uniform block handle.");
+				return BGFX_INVALID_HANDLE;
+			}
+
+			BX_TRACE("Creating uniform block (handle %3d), num %d, size %d", handle.idx, _num, block.m_size);
+
+			// Uniform block keeps reference to its uniforms, they can't be destroyed while
+			// renderer still updates them from uniform block.
+			UniformBlockRef& ref = m_uniformBlockRef[handle.idx];
+			ref.m_num  = _num;
+			ref.m_size = block.m_size;
+
+			for (uint16_t ii = 0; ii < _num; ++ii)
+			{
+				ref.m_uniform[ii] = _uniforms[ii];
+				++m_uniformRef[_uniforms[ii].idx].m_refCount;
+			}
+
+			CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::CreateUniformBlock);
+			cmdbuf.write(handle);
+			cmdbuf.write(block);
+
+			return handle;
+		}
+
+		BGFX_API_FUNC(void destroyUniformBlock(UniformBlockHandle _handle) )
+		{
+			BGFX_MUTEX_SCOPE(m_resourceApiLock);
+
+			BGFX_CHECK_HANDLE("destroyUniformBlock", m_uniformBlockHandle, _handle);
+
+			bool ok = m_submit->free(_handle); BX_UNUSED(ok);
+			BX_ASSERT(ok, "Uniform block handle %d is already destroyed!", _handle.idx);
+
+			UniformBlockRef& ref = m_uniformBlockRef[_handle.idx];
+
+			for (uint16_t ii = 0; ii < ref.m_num; ++ii)
+			{
+				uniformDecRef(ref.m_uniform[ii]);
+			}
+
+			ref.m_num  = 0;
+			ref.m_size = 0;
+
+			CommandBuffer& cmdbuf = getCommandBuffer(CommandBuffer::DestroyUniformBlock);
+			cmdbuf.write(_handle);
+		}
+
 		BGFX_API_FUNC(OcclusionQueryHandle createOcclusionQuery() )
 		{
 			BGFX_MUTEX_SCOPE(m_resourceApiLock);
@@ -5049,6 +6404,32 @@ namespace bgfx
 			m_freeOcclusionQueryHandle[m_numFreeOcclusionQueryHandles++] = _handle;
 		}
 
+		BGFX_API_FUNC(DrawBundleHandle createDrawBundle() )
+		{
+			BGFX_MUTEX_SCOPE(m_resourceApiLock);
+
+			DrawBundleHandle handle = { m_drawBundleHandle.alloc() };
+
+			BX_WARN(isValid(handle), "Failed to allocate draw bundle handle.");
+			if (isValid(handle) )
+			{
+				m_drawBundle[handle.idx].reset();
+			}
+
+			return handle;
+		}
+
+		BGFX_API_FUNC(void destroyDrawBundle(DrawBundleHandle _handle) )
+		{
+			BGFX_MUTEX_SCOPE(m_resourceApiLock);
+
+			BGFX_CHECK_HANDLE("destroyDrawBundle", m_drawBundleHandle, _handle);
+
+			// Bundle content is copied into frame when submitted, it can be released right away.
+			m_drawBundle[_handle.idx].destroy();
+			m_drawBundleHandle.free(_handle.idx);
+		}
+
 		BGFX_API_FUNC(void requestScreenShot(FrameBufferHandle _handle, const char* _filePath) )
 		{
 			BGFX_MUTEX_SCOPE(m_resourceApiLock);
@@ -5086,6 +6467,71 @@ namespace bgfx
 			screenShot.filePath.set(_filePath);
 		}
 
+		BGFX_API_FUNC(bool startFrameCapture(const char* _filePath) )
+		{
+			BGFX_MUTEX_SCOPE(m_resourceApiLock);
+
+			if (m_frameCaptureActive
+			||  m_submit->m_frameCaptureStop)
+			{
+				BX_TRACE("Frame capture is already active, or it's stopping in this frame.");
+				return false;
+			}
+
+			FrameCaptureWriter* writer = BX_NEW(g_allocator, FrameCaptureWriter);
+
+			if (!writer->open(_filePath) )
+			{
+				bx::deleteObject(g_allocator, writer);
+				return false;
+			}
+
+			m_submit->m_frameCaptureWriter = writer;
+			m_frameCaptureActive = true;
+
+			// Captured transient data is read back by render thread, it must not be in
+			// write-combined memory.
+			m_submit->transientToCpu(true);
+
+			return true;
+		}
+
+		BGFX_API_FUNC(void stopFrameCapture() )
+		{
+			BGFX_MUTEX_SCOPE(m_resourceApiLock);
+
+			if (m_frameCaptureActive)
+			{
+				m_submit->m_frameCaptureStop = true;
+				m_frameCaptureActive = false;
+			}
+		}
+
+		BGFX_API_FUNC(uint32_t startFrameReplay(const char* _filePath) )
+		{
+			BGFX_MUTEX_SCOPE(m_resourceApiLock);
+
+			FrameCaptureReader* reader = BX_NEW(g_allocator, FrameCaptureReader);
+
+			if (!reader->open(_filePath)
+			||  0 == reader->getNumFrames() )
+			{
+				reader->close();
+				bx::deleteObject(g_allocator, reader);
+				return 0;
+			}
+
+			if (NULL != m_submit->m_frameReplay)
+			{
+				m_submit->m_frameReplay->close();
+				bx::deleteObject(g_allocator, m_submit->m_frameReplay);
+			}
+
+			m_submit->m_frameReplay = reader;
+
+			return reader->getNumFrames();
+		}
+
 		BGFX_API_FUNC(void setPaletteColor(uint8_t _index, const float _rgba[4]) )
 		{
 			BGFX_MUTEX_SCOPE(m_resourceApiLock);
@@ -5095,7 +6541,7 @@ namespace bgfx
 				, BGFX_CONFIG_MAX_COLOR_PALETTE
 				);
 			bx::memCopy(&m_clearColor[_index][0], _rgba, 16);
-			m_colorPaletteDirty = 2;
+			m_colorPaletteDirty = uint8_t(m_numFrames);
 		}
 
 		BGFX_API_FUNC(void setViewName(ViewId _id, const bx::StringView& _name) )
@@ -5110,11 +6556,13 @@ namespace bgfx
 		BGFX_API_FUNC(void setViewRect(ViewId _id, uint16_t _x, uint16_t _y, uint16_t _width, uint16_t _height) )
 		{
 			m_view[_id].setRect(_x, _y, _width, _height);
+			setViewDirty(_id);
 		}
 
 		BGFX_API_FUNC(void setViewScissor(ViewId _id, uint16_t _x, uint16_t _y, uint16_t _width, uint16_t _height) )
 		{
 			m_view[_id].setScissor(_x, _y, _width, _height);
+			setViewDirty(_id);
 		}
 
 		BGFX_API_FUNC(void setViewClear(ViewId _id, uint16_t _flags, uint32_t _rgba, float _depth, uint8_t _stencil) )
@@ -5125,6 +6573,7 @@ namespace bgfx
 				);
 
 			m_view[_id].setClear(_flags, _rgba, _depth, _stencil);
+			setViewDirty(_id);
 		}
 
 		BGFX_API_FUNC(void setViewClear(ViewId _id, uint16_t _flags, float _depth, uint8_t _stencil, uint8_t _0, uint8_t _1, uint8_t _2, uint8_t _3, uint8_t _4, uint8_t _5, uint8_t _6, uint8_t _7) )
@@ -5135,27 +6584,38 @@ namespace bgfx
 				);
 
 			m_view[_id].setClear(_flags, _depth, _stencil, _0, _1, _2, _3, _4, _5, _6, _7);
+			setViewDirty(_id);
 		}
 
 		BGFX_API_FUNC(void setViewMode(ViewId _id, ViewMode::Enum _mode) )
 		{
 			m_view[_id].setMode(_mode);
+			setViewDirty(_id);
+		}
+
+		BGFX_API_FUNC(void setViewMultiDraw(ViewId _id, bool _enabled) )
+		{
+			m_view[_id].setMultiDraw(_enabled);
+			setViewDirty(_id);
 		}
 
 		BGFX_API_FUNC(void setViewFrameBuffer(ViewId _id, FrameBufferHandle _handle) )
 		{
 			BGFX_CHECK_HANDLE_INVALID_OK("setViewFrameBuffer", m_frameBufferHandle, _handle);
 			m_view[_id].setFrameBuffer(_handle);
+			setViewDirty(_id);
 		}
 
 		BGFX_API_FUNC(void setViewTransform(ViewId _id, const void* _view, const void* _proj) )
 		{
 			m_view[_id].setTransform(_view, _proj);
+			setViewDirty(_id);
 		}
 
 		BGFX_API_FUNC(void resetView(ViewId _id) )
 		{
 			m_view[_id].reset();
+			setViewDirty(_id);
 		}
 
 		BGFX_API_FUNC(void setViewOrder(ViewId _id, uint16_t _num, const ViewId* _order) )
@@ -5173,6 +6633,17 @@ namespace bgfx
 			{
 				bx::memCopy(&m_viewRemap[_id], _order, num*sizeof(ViewId) );
 			}
+
+			m_viewRemapDirty = uint8_t(m_numFrames);
+		}
+
+		void setViewDirty(ViewId _id)
+		{
+			// Every frame in ring has its own copy of view state, mark view dirty for all of them.
+			for (uint32_t ii = 0; ii < BX_COUNTOF(m_viewDirty); ++ii)
+			{
+				m_viewDirty[ii][_id/64] |= UINT64_C(1) << (_id%64);
+			}
 		}
 
 		BGFX_API_FUNC(Encoder* begin(bool _forThread) );
@@ -5192,11 +6663,28 @@ namespace bgfx
 		void frameNoRenderWait();
 		void swap();
 
+		Frame* getNextSubmitFrame()
+		{
+			return &m_frame[(m_submitIdx + 1) % m_numFrames];
+		}
+
+		// render thread
+		void nextRenderFrame()
+		{
+			m_render    = &m_frame[m_renderIdx];
+			m_renderIdx = (m_renderIdx + 1) % m_numFrames;
+		}
+
 		// render thread
 		void flip();
 		RenderFrame::Enum renderFrame(int32_t _msecs = -1);
 		void flushTextureUpdateBatch(CommandBuffer& _cmdbuf);
 		void rendererExecCommands(CommandBuffer& _cmdbuf);
+		uint32_t readbackBegin(void* _data, ReadbackFn _readbackFn, void* _userData);
+		void readbackEnd(uint32_t _ticket, bool _ok);
+		void frameCaptureEnd();
+		void frameReplayEnd();
+		void frameReplayStats(const Frame* _replay);
 
 #if BGFX_CONFIG_MULTITHREADED
 		void apiSemPost()
@@ -5211,6 +6699,7 @@ namespace bgfx
 		{
 			if (m_singleThreaded)
 			{
+				nextRenderFrame();
 				return true;
 			}
 
@@ -5219,6 +6708,7 @@ namespace bgfx
 			bool ok = m_apiSem.wait(_msecs);
 			if (ok)
 			{
+				nextRenderFrame();
 				m_render->m_waitSubmit = bx::getHPCounter()-start;
 				m_submit->m_perfStats.waitSubmit = m_submit->m_waitSubmit;
 				return true;
@@ -5228,6 +6718,18 @@ namespace bgfx
 		}
 
 		void renderSemPost()
+		{
+			bx::atomicFetchAndAdd<uint32_t>(&m_numFramesRendered, 1);
+
+			if (!m_singleThreaded)
+			{
+				m_renderSem.post();
+			}
+		}
+
+		// Lets API thread run one more frame ahead of render thread. Unlike renderSemPost it
+		// doesn't count as rendered frame.
+		void renderSemPrime()
 		{
 			if (!m_singleThreaded)
 			{
@@ -5257,14 +6759,28 @@ namespace bgfx
 				m_encoderEndSem.wait();
 			}
 
+			uint32_t numTransformsDropped = 0;
+			uint32_t numScissorsDropped   = 0;
+			uint32_t numDrawsDropped      = 0;
+			uint32_t numPendingSkipped    = 0;
+
 			for (uint16_t ii = 0; ii < numEncoders; ++ii)
 			{
 				uint16_t idx = m_encoderHandle->getHandleAt(ii);
 				m_encoderStats[ii].cpuTimeBegin = m_encoder[idx].m_cpuTimeBegin;
 				m_encoderStats[ii].cpuTimeEnd   = m_encoder[idx].m_cpuTimeEnd;
+
+				numTransformsDropped += m_encoder[idx].m_numTransformsDropped;
+				numScissorsDropped   += m_encoder[idx].m_numScissorsDropped;
+				numDrawsDropped      += m_encoder[idx].m_numDrawsDropped;
+				numPendingSkipped    += m_encoder[idx].m_numPendingSkipped;
 			}
 
-			m_submit->m_perfStats.numEncoders = uint8_t(numEncoders);
+			m_submit->m_perfStats.numEncoders          = uint8_t(numEncoders);
+			m_submit->m_perfStats.numTransformsDropped = numTransformsDropped;
+			m_submit->m_perfStats.numScissorsDropped   = numScissorsDropped;
+			m_submit->m_perfStats.numDrawsDropped      = numDrawsDropped;
+			m_submit->m_perfStats.numPendingSkipped    = numPendingSkipped;
 
 			m_encoderHandle->reset();
 			uint16_t idx = m_encoderHandle->alloc();
@@ -5285,10 +6801,16 @@ namespace bgfx
 		bool apiSemWait(int32_t _msecs = -1)
 		{
 			BX_UNUSED(_msecs);
+			nextRenderFrame();
 			return true;
 		}
 
 		void renderSemPost()
+		{
+			++m_numFramesRendered;
+		}
+
+		void renderSemPrime()
 		{
 		}
 
@@ -5300,7 +6822,11 @@ namespace bgfx
 		{
 			m_encoderStats[0].cpuTimeBegin = m_encoder[0].m_cpuTimeBegin;
 			m_encoderStats[0].cpuTimeEnd   = m_encoder[0].m_cpuTimeEnd;
-			m_submit->m_perfStats.numEncoders = 1;
+			m_submit->m_perfStats.numEncoders          = 1;
+			m_submit->m_perfStats.numTransformsDropped = m_encoder[0].m_numTransformsDropped;
+			m_submit->m_perfStats.numScissorsDropped   = m_encoder[0].m_numScissorsDropped;
+			m_submit->m_perfStats.numDrawsDropped      = m_encoder[0].m_numDrawsDropped;
+			m_submit->m_perfStats.numPendingSkipped    = m_encoder[0].m_numPendingSkipped;
 		}
 #endif // BGFX_CONFIG_MULTITHREADED
 
@@ -5310,12 +6836,22 @@ namespace bgfx
 		uint32_t      m_numEncoders;
 		bx::HandleAlloc* m_encoderHandle;
 
-		Frame  m_frame[1+(BGFX_CONFIG_MULTITHREADED ? 1 : 0)];
+		// Frames are used as ring, API thread can submit up to `m_numFrames-1` frames ahead
+		// of render thread.
+		Frame  m_frame[1+(BGFX_CONFIG_MULTITHREADED ? BGFX_CONFIG_MAX_FRAMES_IN_FLIGHT : 0)];
 		Frame* m_render;
 		Frame* m_submit;
-
-		uint64_t m_tempKeys[BGFX_CONFIG_MAX_DRAW_CALLS];
-		RenderItemCount m_tempValues[BGFX_CONFIG_MAX_DRAW_CALLS];
+		uint32_t m_numFrames;
+		uint32_t m_renderIdx;
+		uint32_t m_submitIdx;
+		uint32_t m_numFramesSubmitted;
+		uint32_t m_numFramesRendered;
+
+		uint64_t* m_tempKeys;
+		RenderItemCount* m_tempValues;
+		uint32_t m_tempCapacity;
+		SortThreadPool m_sortThreadPool;
+		TextureDecoder m_textureDecoder;
 
 		IndexBuffer  m_indexBuffers[BGFX_CONFIG_MAX_INDEX_BUFFERS];
 		VertexBuffer m_vertexBuffers[BGFX_CONFIG_MAX_VERTEX_BUFFERS];
@@ -5345,6 +6881,8 @@ namespace bgfx
 		bx::HandleAllocT<BGFX_CONFIG_MAX_FRAME_BUFFERS> m_frameBufferHandle;
 		bx::HandleAllocT<BGFX_CONFIG_MAX_UNIFORMS> m_uniformHandle;
 		bx::HandleAllocT<BGFX_CONFIG_MAX_OCCLUSION_QUERIES> m_occlusionQueryHandle;
+		bx::HandleAllocT<BGFX_CONFIG_MAX_DRAW_BUNDLES> m_drawBundleHandle;
+		bx::HandleAllocT<BGFX_CONFIG_MAX_UNIFORM_BLOCKS> m_uniformBlockHandle;
 
 		typedef bx::HandleHashMapT<BGFX_CONFIG_MAX_UNIFORMS*2> UniformHashMap;
 		UniformHashMap m_uniformHashMap;
@@ -5361,20 +6899,32 @@ namespace bgfx
 		TextureRef      m_textureRef[BGFX_CONFIG_MAX_TEXTURES];
 		FrameBufferRef  m_frameBufferRef[BGFX_CONFIG_MAX_FRAME_BUFFERS];
 		VertexLayoutRef m_vertexLayoutRef;
+		DrawBundle      m_drawBundle[BGFX_CONFIG_MAX_DRAW_BUNDLES];
+		UniformBlockRef m_uniformBlockRef[BGFX_CONFIG_MAX_UNIFORM_BLOCKS];
+
+		// Uniform block layouts used by render thread.
+		UniformBlock m_uniformBlock[BGFX_CONFIG_MAX_UNIFORM_BLOCKS];
 
 		ViewId m_viewRemap[BGFX_CONFIG_MAX_VIEWS];
 		uint32_t m_seq[BGFX_CONFIG_MAX_VIEWS];
 		View m_view[BGFX_CONFIG_MAX_VIEWS];
 
+		// Views changed since they were last copied into frame, one set per frame in ring.
+		uint64_t m_viewDirty[BX_COUNTOF(m_frame)][(BGFX_CONFIG_MAX_VIEWS+63)/64];
+
 		float m_clearColor[BGFX_CONFIG_MAX_COLOR_PALETTE][4];
 
 		uint8_t m_colorPaletteDirty;
+		uint8_t m_viewRemapDirty;
 
 		Init     m_init;
 		int64_t  m_frameTimeLast;
 		uint32_t m_frames;
 		uint32_t m_debug;
 
+		ProgramHandle m_fallbackProgram;
+		uint32_t m_multiDrawProgram[(BGFX_CONFIG_MAX_PROGRAMS+31)/32];
+
 		int64_t m_rtMemoryUsed;
 		int64_t m_textureMemoryUsed;
 
@@ -5383,6 +6933,30 @@ namespace bgfx
 
 		RendererContextI* m_renderCtx;
 
+		FrameCaptureWriter* m_frameCaptureWriter;
+		FrameCaptureReader* m_frameReplay;
+		bool m_frameCaptureActive;
+		uint32_t m_frameCaptureEnded; // Written by render thread, consumed by API thread.
+
+		struct Readback
+		{
+			void*      m_data;
+			ReadbackFn m_readbackFn;
+			void*      m_userData;
+			bool       m_done;
+		};
+
+		// Readbacks issued by render thread, and not yet completed. Tickets are completed in
+		// order of submission, even when renderer finishes them out of order.
+		Readback m_readback[BGFX_CONFIG_MAX_READBACKS];
+
+		uint32_t m_readbackTicket;   // API thread.
+		uint32_t m_readbackComplete; // Written by render thread, read by API thread.
+		uint32_t m_readbackIssued;   // Render thread.
+
+		UploadQueue m_uploadQueue;
+		TextureStreaming m_textureStreaming;
+
 		bool m_headless;
 		bool m_rendererInitialized;
 		bool m_exit;
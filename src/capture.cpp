@@ -0,0 +1,1060 @@
+/*
+ * Copyright 2011-2024 Branimir Karadzic. All rights reserved.
+ * License: https://github.com/bkaradzic/bgfx/blob/master/LICENSE
+ */
+
+#include "bgfx_p.h"
+#include "capture.h"
+
+namespace bgfx
+{
+	constexpr uint32_t kFrameCaptureMagic      = BX_MAKEFOURCC('B', 'G', 'F', 'C');
+	constexpr uint32_t kFrameCaptureFrameMagic = BX_MAKEFOURCC('F', 'R', 'M', 0x0);
+	constexpr uint32_t kFrameCaptureVersion    = 3;
+
+	struct FrameCaptureHeader
+	{
+		uint32_t m_magic;
+		uint32_t m_version;
+		uint32_t m_layoutHash;
+		uint32_t m_numFrames;
+		RendererType::Enum m_rendererType;
+	};
+
+	// Frame is captured as memory image of internal structures, capture can be replayed only by
+	// build with the same structure layout and compile time limits.
+	static uint32_t getLayoutHash()
+	{
+		const uint32_t layout[] =
+		{
+			BGFX_CONFIG_MAX_VIEWS,
+			BGFX_CONFIG_MAX_COLOR_PALETTE,
+			BGFX_CONFIG_MAX_MATRIX_CACHE,
+			BGFX_CONFIG_MAX_RECT_CACHE,
+			BGFX_CONFIG_MAX_BLIT_ITEMS,
+			BGFX_CONFIG_RENDER_ITEM_CHUNK_SIZE,
+			BGFX_CONFIG_RENDER_BIND_CHUNK_SIZE,
+			uint32_t(sizeof(void*) ),
+			uint32_t(sizeof(View) ),
+			uint32_t(sizeof(RenderItem) ),
+			uint32_t(sizeof(RenderBind) ),
+			uint32_t(sizeof(BlitItem) ),
+			uint32_t(sizeof(Resolution) ),
+			uint32_t(sizeof(VertexLayout) ),
+			uint32_t(sizeof(UniformBlock) ),
+			uint32_t(sizeof(Attachment) ),
+			uint32_t(sizeof(TextureCreate) ),
+		};
+
+		return bx::hash<bx::HashMurmur2A>(layout, sizeof(layout) );
+	}
+
+	static bool isTextureCreate(const Memory* _mem)
+	{
+		uint32_t magic = 0;
+
+		if (sizeof(uint32_t)+sizeof(TextureCreate) <= _mem->size)
+		{
+			bx::memCopy(&magic, _mem->data, sizeof(uint32_t) );
+		}
+
+		return BGFX_CHUNK_MAGIC_TEX == magic;
+	}
+
+	// Reads command arguments from command buffer, and writes them into capture file. Pointers
+	// to memory are replaced with memory content. When writer is NULL command is only skipped.
+	class CommandBufferCaptureWriter
+	{
+	public:
+		CommandBufferCaptureWriter(CommandBuffer& _cmdbuf, bx::WriterI* _writer, bx::Error* _err)
+			: m_cmdbuf(_cmdbuf)
+			, m_writer(_writer)
+			, m_err(_err)
+		{
+		}
+
+		template<typename Ty>
+		Ty value()
+		{
+			Ty val;
+			m_cmdbuf.read(val);
+
+			if (NULL != m_writer)
+			{
+				bx::write(m_writer, val, m_err);
+			}
+
+			return val;
+		}
+
+		void data(uint32_t _size)
+		{
+			const uint8_t* data = m_cmdbuf.skip(_size);
+
+			if (NULL != m_writer)
+			{
+				bx::write(m_writer, data, int32_t(_size), m_err);
+			}
+		}
+
+		void memory()
+		{
+			const Memory* mem;
+			m_cmdbuf.read(mem);
+			writeMemory(mem);
+		}
+
+		void textureMemory()
+		{
+			const Memory* mem;
+			m_cmdbuf.read(mem);
+			writeMemory(mem);
+
+			if (NULL != mem
+			&&  isTextureCreate(mem) )
+			{
+				TextureCreate tc;
+				bx::memCopy(&tc, &mem->data[sizeof(uint32_t)], sizeof(TextureCreate) );
+				writeMemory(tc.m_mem);
+			}
+		}
+
+		void nativeWindowHandle()
+		{
+			void* nwh;
+			m_cmdbuf.read(nwh);
+		}
+
+	private:
+		void writeMemory(const Memory* _mem)
+		{
+			if (NULL == m_writer)
+			{
+				return;
+			}
+
+			const uint32_t size = NULL == _mem ? UINT32_MAX : _mem->size;
+			bx::write(m_writer, size, m_err);
+
+			if (UINT32_MAX != size)
+			{
+				bx::write(m_writer, _mem->data, int32_t(size), m_err);
+			}
+		}
+
+		CommandBuffer& m_cmdbuf;
+		bx::WriterI* m_writer;
+		bx::Error*   m_err;
+	};
+
+	// Reads command arguments from capture file, and writes them into command buffer the same
+	// way API thread does.
+	class CommandBufferCaptureReader
+	{
+	public:
+		CommandBufferCaptureReader(CommandBuffer& _cmdbuf, bx::ReaderI* _reader, bx::Error* _err)
+			: m_cmdbuf(_cmdbuf)
+			, m_reader(_reader)
+			, m_err(_err)
+		{
+		}
+
+		template<typename Ty>
+		Ty value()
+		{
+			Ty val;
+			bx::read(m_reader, val, m_err);
+			m_cmdbuf.write(val);
+			return val;
+		}
+
+		void data(uint32_t _size)
+		{
+			uint8_t temp[256];
+
+			for (uint32_t size = _size; 0 < size && m_err->isOk();)
+			{
+				const uint32_t num = bx::min<uint32_t>(size, sizeof(temp) );
+				bx::read(m_reader, temp, int32_t(num), m_err);
+				m_cmdbuf.write(temp, num);
+				size -= num;
+			}
+		}
+
+		void memory()
+		{
+			const Memory* mem = readMemory();
+			m_cmdbuf.write(mem);
+		}
+
+		void textureMemory()
+		{
+			const Memory* mem = readMemory();
+
+			if (NULL != mem
+			&&  isTextureCreate(mem) )
+			{
+				TextureCreate tc;
+				bx::memCopy(&tc, &mem->data[sizeof(uint32_t)], sizeof(TextureCreate) );
+				tc.m_mem = readMemory();
+				bx::memCopy(&mem->data[sizeof(uint32_t)], &tc, sizeof(TextureCreate) );
+			}
+
+			m_cmdbuf.write(mem);
+		}
+
+		void nativeWindowHandle()
+		{
+			// Window of captured application doesn't exist, window frame buffers are created
+			// for main window instead.
+			void* nwh = g_platformData.nwh;
+			m_cmdbuf.write(nwh);
+		}
+
+	private:
+		const Memory* readMemory()
+		{
+			uint32_t size = UINT32_MAX;
+			bx::read(m_reader, size, m_err);
+
+			if (UINT32_MAX == size
+			||  !m_err->isOk() )
+			{
+				return NULL;
+			}
+
+			const Memory* mem = alloc(size);
+			bx::read(m_reader, mem->data, int32_t(size), m_err);
+
+			return mem;
+		}
+
+		CommandBuffer& m_cmdbuf;
+		bx::ReaderI* m_reader;
+		bx::Error*   m_err;
+	};
+
+	// Walks command arguments in the same order as Context::rendererExecCommands reads them.
+	template<typename ArchiveT>
+	static void serializeCommand(ArchiveT& _ar, uint8_t _command)
+	{
+		switch (_command)
+		{
+		case CommandBuffer::RendererInit:
+			_ar.template value<Init>();
+			break;
+
+		case CommandBuffer::CreateVertexLayout:
+			_ar.template value<VertexLayoutHandle>();
+			_ar.template value<VertexLayout>();
+			break;
+
+		case CommandBuffer::CreateIndexBuffer:
+			_ar.template value<IndexBufferHandle>();
+			_ar.memory();
+			_ar.template value<uint16_t>();
+			break;
+
+		case CommandBuffer::CreateVertexBuffer:
+			_ar.template value<VertexBufferHandle>();
+			_ar.memory();
+			_ar.template value<VertexLayoutHandle>();
+			_ar.template value<uint16_t>();
+			break;
+
+		case CommandBuffer::CreateDynamicIndexBuffer:
+			_ar.template value<IndexBufferHandle>();
+			_ar.template value<uint32_t>();
+			_ar.template value<uint16_t>();
+			break;
+
+		case CommandBuffer::UpdateDynamicIndexBuffer:
+			_ar.template value<IndexBufferHandle>();
+			_ar.template value<uint32_t>();
+			_ar.template value<uint32_t>();
+			_ar.memory();
+			break;
+
+		case CommandBuffer::CreateDynamicVertexBuffer:
+			_ar.template value<VertexBufferHandle>();
+			_ar.template value<uint32_t>();
+			_ar.template value<uint16_t>();
+			break;
+
+		case CommandBuffer::UpdateDynamicVertexBuffer:
+			_ar.template value<VertexBufferHandle>();
+			_ar.template value<uint32_t>();
+			_ar.template value<uint32_t>();
+			_ar.memory();
+			break;
+
+		case CommandBuffer::CreateShader:
+			_ar.template value<ShaderHandle>();
+			_ar.memory();
+			break;
+
+		case CommandBuffer::CreateProgram:
+			_ar.template value<ProgramHandle>();
+			_ar.template value<ShaderHandle>();
+			_ar.template value<ShaderHandle>();
+			break;
+
+		case CommandBuffer::CreateTexture:
+			_ar.template value<TextureHandle>();
+			_ar.textureMemory();
+			_ar.template value<uint64_t>();
+			_ar.template value<uint8_t>();
+			break;
+
+		case CommandBuffer::UpdateTexture:
+			_ar.template value<TextureHandle>();
+			_ar.template value<uint8_t>();
+			_ar.template value<uint8_t>();
+			_ar.template value<Rect>();
+			_ar.template value<uint16_t>();
+			_ar.template value<uint16_t>();
+			_ar.template value<uint16_t>();
+			_ar.memory();
+			break;
+
+		case CommandBuffer::ResizeTexture:
+			_ar.template value<TextureHandle>();
+			_ar.template value<uint16_t>();
+			_ar.template value<uint16_t>();
+			_ar.template value<uint8_t>();
+			_ar.template value<uint16_t>();
+			break;
+
+		case CommandBuffer::ResizeTextureMips:
+			_ar.template value<TextureHandle>();
+			_ar.template value<uint16_t>();
+			_ar.template value<uint16_t>();
+			_ar.template value<uint8_t>();
+			_ar.template value<int8_t>();
+			break;
+
+		case CommandBuffer::CreateFrameBuffer:
+			_ar.template value<FrameBufferHandle>();
+
+			if (_ar.template value<bool>() )
+			{
+				_ar.nativeWindowHandle();
+				_ar.template value<uint16_t>();
+				_ar.template value<uint16_t>();
+				_ar.template value<TextureFormat::Enum>();
+				_ar.template value<TextureFormat::Enum>();
+			}
+			else
+			{
+				const uint8_t num = _ar.template value<uint8_t>();
+				_ar.data(sizeof(Attachment) * num);
+			}
+			break;
+
+		case CommandBuffer::CreateUniform:
+			_ar.template value<UniformHandle>();
+			_ar.template value<UniformType::Enum>();
+			_ar.template value<uint16_t>();
+			_ar.data(_ar.template value<uint8_t>() );
+			break;
+
+		case CommandBuffer::CreateUniformBlock:
+			_ar.template value<UniformBlockHandle>();
+			_ar.template value<UniformBlock>();
+			break;
+
+		case CommandBuffer::UpdateViewName:
+			_ar.template value<ViewId>();
+			_ar.data(_ar.template value<uint16_t>() );
+			break;
+
+		case CommandBuffer::InvalidateOcclusionQuery:
+			_ar.template value<OcclusionQueryHandle>();
+			break;
+
+		case CommandBuffer::WarmPipeline:
+			_ar.template value<FrameBufferHandle>();
+			_ar.template value<ProgramHandle>();
+			_ar.template value<VertexLayout>();
+			_ar.template value<uint64_t>();
+			_ar.template value<uint64_t>();
+			break;
+
+		case CommandBuffer::SetName:
+			_ar.template value<Handle>();
+			_ar.data(_ar.template value<uint16_t>() );
+			break;
+
+		case CommandBuffer::DestroyVertexLayout:
+			_ar.template value<VertexLayoutHandle>();
+			break;
+
+		case CommandBuffer::DestroyIndexBuffer:
+		case CommandBuffer::DestroyDynamicIndexBuffer:
+			_ar.template value<IndexBufferHandle>();
+			break;
+
+		case CommandBuffer::DestroyVertexBuffer:
+		case CommandBuffer::DestroyDynamicVertexBuffer:
+			_ar.template value<VertexBufferHandle>();
+			break;
+
+		case CommandBuffer::DestroyShader:
+			_ar.template value<ShaderHandle>();
+			break;
+
+		case CommandBuffer::DestroyProgram:
+			_ar.template value<ProgramHandle>();
+			break;
+
+		case CommandBuffer::DestroyTexture:
+			_ar.template value<TextureHandle>();
+			break;
+
+		case CommandBuffer::DestroyFrameBuffer:
+			_ar.template value<FrameBufferHandle>();
+			break;
+
+		case CommandBuffer::DestroyUniform:
+			_ar.template value<UniformHandle>();
+			break;
+
+		case CommandBuffer::DestroyUniformBlock:
+			_ar.template value<UniformBlockHandle>();
+			break;
+
+		case CommandBuffer::ReadTexture:
+			_ar.template value<TextureHandle>();
+			_ar.template value<void*>();
+			_ar.template value<uint8_t>();
+			_ar.template value<ReadbackFn>();
+			_ar.template value<void*>();
+			break;
+
+		case CommandBuffer::ReadIndexBuffer:
+			_ar.template value<IndexBufferHandle>();
+			_ar.template value<uint32_t>();
+			_ar.template value<uint32_t>();
+			_ar.template value<void*>();
+			_ar.template value<ReadbackFn>();
+			_ar.template value<void*>();
+			break;
+
+		case CommandBuffer::ReadVertexBuffer:
+			_ar.template value<VertexBufferHandle>();
+			_ar.template value<uint32_t>();
+			_ar.template value<uint32_t>();
+			_ar.template value<void*>();
+			_ar.template value<ReadbackFn>();
+			_ar.template value<void*>();
+			break;
+
+		case CommandBuffer::FlushPipelineCache:
+		case CommandBuffer::RendererShutdownBegin:
+		case CommandBuffer::RendererShutdownEnd:
+		case CommandBuffer::End:
+			break;
+
+		default:
+			BX_ASSERT(false, "Invalid command: %d", _command);
+			break;
+		}
+	}
+
+	FrameCaptureWriter::FrameCaptureWriter()
+		: m_numFrames(0)
+	{
+	}
+
+	FrameCaptureWriter::~FrameCaptureWriter()
+	{
+	}
+
+	bool FrameCaptureWriter::open(const char* _filePath)
+	{
+		if (!bx::open(&m_writer, _filePath, false, &m_err) )
+		{
+			BX_TRACE("Failed to create frame capture file \"%s\".", _filePath);
+			return false;
+		}
+
+		FrameCaptureHeader header;
+		header.m_magic        = kFrameCaptureMagic;
+		header.m_version      = kFrameCaptureVersion;
+		header.m_layoutHash   = getLayoutHash();
+		header.m_numFrames    = 0;
+		header.m_rendererType = g_caps.rendererType;
+		bx::write(&m_writer, header, &m_err);
+
+		m_numFrames = 0;
+
+		return m_err.isOk();
+	}
+
+	void FrameCaptureWriter::close()
+	{
+		BX_WARN(m_err.isOk(), "Frame capture write failed, capture file is incomplete.");
+
+		bx::Error err;
+		bx::seek(&m_writer, BX_OFFSETOF(FrameCaptureHeader, m_numFrames), bx::Whence::Begin);
+		bx::write(&m_writer, m_numFrames, &err);
+		bx::close(&m_writer);
+	}
+
+	void FrameCaptureWriter::writeCommands(CommandBuffer& _cmdbuf)
+	{
+		_cmdbuf.reset();
+
+		for (;;)
+		{
+			uint8_t command;
+			_cmdbuf.read(command);
+
+			if (CommandBuffer::End                 == command
+			||  CommandBuffer::RendererShutdownEnd == command)
+			{
+				break;
+			}
+
+			// Renderer lifetime commands, and reading textures and buffers into application
+			// memory can't be replayed.
+			const bool skip = false
+				|| CommandBuffer::RendererInit          == command
+				|| CommandBuffer::RendererShutdownBegin == command
+				|| CommandBuffer::ReadTexture           == command
+				|| CommandBuffer::ReadIndexBuffer       == command
+				|| CommandBuffer::ReadVertexBuffer      == command
+				;
+
+			if (!skip)
+			{
+				bx::write(&m_writer, command, &m_err);
+			}
+
+			CommandBufferCaptureWriter ar(_cmdbuf, skip ? NULL : &m_writer, &m_err);
+			serializeCommand(ar, command);
+		}
+
+		const uint8_t end = CommandBuffer::End;
+		bx::write(&m_writer, end, &m_err);
+	}
+
+	void FrameCaptureWriter::writeFrame(const Frame* _frame)
+	{
+		BGFX_PROFILER_SCOPE("bgfx/Frame capture", 0xff2040ff);
+
+		bx::write(&m_writer, kFrameCaptureFrameMagic, &m_err);
+
+		bx::write(&m_writer, _frame->m_resolution, &m_err);
+		bx::write(&m_writer, _frame->m_debug, &m_err);
+		bx::write(&m_writer, _frame->m_fallbackProgram, &m_err);
+		bx::write(&m_writer, _frame->m_multiDrawProgram, int32_t(sizeof(_frame->m_multiDrawProgram) ), &m_err);
+		bx::write(&m_writer, _frame->m_viewRemap,    int32_t(sizeof(_frame->m_viewRemap) ),    &m_err);
+		bx::write(&m_writer, _frame->m_colorPalette, int32_t(sizeof(_frame->m_colorPalette) ), &m_err);
+		bx::write(&m_writer, _frame->m_view,         int32_t(sizeof(_frame->m_view) ),         &m_err);
+		bx::write(&m_writer, _frame->m_viewRect,     int32_t(sizeof(_frame->m_viewRect) ),     &m_err);
+		bx::write(&m_writer, _frame->m_viewScissor,  int32_t(sizeof(_frame->m_viewScissor) ),  &m_err);
+
+		{
+			// Sort clips views rendering into frame buffer to frame buffer size, which is known
+			// only by API thread.
+			FrameCaptureReader::FrameBufferSize fbs[BGFX_CONFIG_MAX_VIEWS];
+			uint16_t num = 0;
+
+			uint64_t used[(BGFX_CONFIG_MAX_FRAME_BUFFERS+63)/64] = {};
+
+			for (uint32_t ii = 0; ii < BGFX_CONFIG_MAX_VIEWS; ++ii)
+			{
+				const FrameBufferHandle fbh = _frame->m_view[ii].m_fbh;
+				const uint64_t bit = UINT64_C(1) << (fbh.idx%64);
+
+				if (isValid(fbh)
+				&&  0 == (used[fbh.idx/64] & bit) )
+				{
+					used[fbh.idx/64] |= bit;
+
+					FrameCaptureReader::FrameBufferSize& size = fbs[num++];
+					size.m_handle = fbh;
+					rendererGetFrameBufferSize(fbh, size.m_width, size.m_height);
+				}
+			}
+
+			bx::write(&m_writer, num, &m_err);
+			bx::write(&m_writer, fbs, int32_t(sizeof(fbs[0])*num), &m_err);
+		}
+
+		uint32_t uniformEnd[UINT8_MAX] = {};
+
+		{
+			const uint32_t numChunks = bx::min(_frame->m_numRenderItemChunks, _frame->m_maxRenderItemChunks);
+			bx::write(&m_writer, numChunks, &m_err);
+
+			for (uint32_t ii = 0; ii < numChunks; ++ii)
+			{
+				const RenderItemChunk* chunk = _frame->m_renderItemChunk[ii];
+				const uint32_t num = chunk->m_num;
+
+				bx::write(&m_writer, num, &m_err);
+				bx::write(&m_writer, chunk->m_key,  int32_t(sizeof(uint64_t)*num),   &m_err);
+				bx::write(&m_writer, chunk->m_item, int32_t(sizeof(RenderItem)*num), &m_err);
+
+				for (uint32_t jj = 0; jj < num; ++jj)
+				{
+					const RenderItem& item = chunk->m_item[jj];
+					const bool isCompute = 0 == (chunk->m_key[jj] & kSortKeyDrawBit);
+					const uint8_t  idx = isCompute ? item.compute.m_uniformIdx : item.draw.m_uniformIdx;
+					const uint32_t end = isCompute ? item.compute.m_uniformEnd : item.draw.m_uniformEnd;
+
+					if (UINT8_MAX != idx)
+					{
+						uniformEnd[idx] = bx::max(uniformEnd[idx], end);
+					}
+				}
+			}
+		}
+
+		{
+			const uint32_t numChunks = bx::min<uint32_t>(_frame->m_numRenderBindChunks, kMaxRenderBindChunks);
+			bx::write(&m_writer, numChunks, &m_err);
+
+			// First chunk is never used by encoders, it only holds empty binding set.
+			for (uint32_t ii = 1; ii < numChunks; ++ii)
+			{
+				const RenderBindChunk* chunk = _frame->m_renderBindChunk[ii];
+				bx::write(&m_writer, chunk->m_num, &m_err);
+				bx::write(&m_writer, chunk->m_bind, int32_t(sizeof(RenderBind)*chunk->m_num), &m_err);
+			}
+		}
+
+		{
+			const MatrixCache& matrixCache = _frame->m_frameCache.m_matrixCache;
+			const uint32_t numMatrices = bx::min<uint32_t>(matrixCache.m_num, BGFX_CONFIG_MAX_MATRIX_CACHE);
+			bx::write(&m_writer, numMatrices, &m_err);
+			bx::write(&m_writer, matrixCache.m_cache, int32_t(sizeof(Matrix4)*numMatrices), &m_err);
+
+			const RectCache& rectCache = _frame->m_frameCache.m_rectCache;
+			const uint32_t numRects = bx::min<uint32_t>(rectCache.m_num, BGFX_CONFIG_MAX_RECT_CACHE);
+			bx::write(&m_writer, numRects, &m_err);
+			bx::write(&m_writer, rectCache.m_cache, int32_t(sizeof(Rect)*numRects), &m_err);
+		}
+
+		{
+			const uint16_t numBlitItems = _frame->m_numBlitItems;
+			bx::write(&m_writer, numBlitItems, &m_err);
+			bx::write(&m_writer, _frame->m_blitKeys, int32_t(sizeof(uint32_t)*numBlitItems), &m_err);
+			bx::write(&m_writer, _frame->m_blitItem, int32_t(sizeof(BlitItem)*numBlitItems), &m_err);
+		}
+
+		{
+			const uint16_t numEncoders = uint16_t(g_caps.limits.maxEncoders);
+			bx::write(&m_writer, numEncoders, &m_err);
+
+			for (uint32_t ii = 0; ii < numEncoders; ++ii)
+			{
+				// Uniform buffer is finished, only range used by render items is written.
+				const uint32_t uniformSize = uniformEnd[ii];
+				bx::write(&m_writer, uniformSize, &m_err);
+				bx::write(&m_writer, _frame->m_uniformBuffer[ii]->getData(0), int32_t(uniformSize), &m_err);
+
+				const uint32_t uniformBlockSize = _frame->m_uniformBlockBuffer[ii]->getPos();
+				bx::write(&m_writer, uniformBlockSize, &m_err);
+				bx::write(&m_writer, _frame->m_uniformBlockBuffer[ii]->getData(0), int32_t(uniformBlockSize), &m_err);
+			}
+		}
+
+		{
+			bx::write(&m_writer, _frame->m_transientIb->handle, &m_err);
+			bx::write(&m_writer, _frame->m_iboffset, &m_err);
+			bx::write(&m_writer, _frame->m_transientIb->data, int32_t(_frame->m_iboffset), &m_err);
+
+			bx::write(&m_writer, _frame->m_transientVb->handle, &m_err);
+			bx::write(&m_writer, _frame->m_vboffset, &m_err);
+			bx::write(&m_writer, _frame->m_transientVb->data, int32_t(_frame->m_vboffset), &m_err);
+		}
+	}
+
+	void FrameCaptureWriter::endFrame()
+	{
+		++m_numFrames;
+	}
+
+	FrameCaptureReader::FrameCaptureReader()
+		: m_frame(NULL)
+		, m_numFrames(0)
+		, m_numFramesRead(0)
+		, m_numFrameBufferSizes(0)
+	{
+	}
+
+	FrameCaptureReader::~FrameCaptureReader()
+	{
+		BX_ASSERT(NULL == m_frame, "FrameCaptureReader::close must be called.");
+	}
+
+	bool FrameCaptureReader::open(const char* _filePath)
+	{
+		if (!bx::open(&m_reader, _filePath, &m_err) )
+		{
+			BX_TRACE("Failed to open frame capture file \"%s\".", _filePath);
+			return false;
+		}
+
+		FrameCaptureHeader header;
+		bx::read(&m_reader, header, &m_err);
+
+		if (!m_err.isOk()
+		||  kFrameCaptureMagic   != header.m_magic
+		||  kFrameCaptureVersion != header.m_version)
+		{
+			BX_TRACE("\"%s\" is not frame capture file.", _filePath);
+			bx::close(&m_reader);
+			return false;
+		}
+
+		if (getLayoutHash() != header.m_layoutHash)
+		{
+			BX_TRACE("Frame capture \"%s\" was written by build with different configuration.", _filePath);
+			bx::close(&m_reader);
+			return false;
+		}
+
+		BX_WARN(RendererType::Noop == g_caps.rendererType || header.m_rendererType == g_caps.rendererType
+			, "Frame capture was written with %s renderer, shaders might not be usable by %s renderer."
+			, getRendererName(header.m_rendererType)
+			, getRendererName(g_caps.rendererType)
+			);
+
+		m_numFrames     = header.m_numFrames;
+		m_numFramesRead = 0;
+
+		m_frame = BX_ALIGNED_NEW(g_allocator, Frame, BX_ALIGNOF(Frame) );
+		m_frame->create(g_caps.limits.minResourceCbSize);
+
+		return true;
+	}
+
+	void FrameCaptureReader::close()
+	{
+		if (NULL != m_frame)
+		{
+			m_frame->destroy();
+			bx::deleteObject(g_allocator, m_frame, BX_ALIGNOF(Frame) );
+			m_frame = NULL;
+
+			bx::close(&m_reader);
+		}
+	}
+
+	Frame* FrameCaptureReader::read(const Frame* _live)
+	{
+		if (m_numFramesRead == m_numFrames
+		||  !m_err.isOk() )
+		{
+			return NULL;
+		}
+
+		BGFX_PROFILER_SCOPE("bgfx/Frame replay read", 0xff2040ff);
+
+		m_frame->start(m_numFramesRead);
+		m_frame->m_frameReplaySource = this;
+
+		readCommands(m_frame->m_cmdPre);
+		const bool ok = readFrame(_live);
+		readCommands(m_frame->m_cmdPost);
+
+		m_frame->finish();
+
+		if (!ok
+		||  !m_err.isOk() )
+		{
+			BX_TRACE("Frame replay stopped at frame %d of %d.", m_numFramesRead, m_numFrames);
+			m_numFramesRead = m_numFrames;
+			return NULL;
+		}
+
+		++m_numFramesRead;
+
+		return m_frame;
+	}
+
+	bool FrameCaptureReader::getFrameBufferSize(FrameBufferHandle _handle, uint16_t& _width, uint16_t& _height) const
+	{
+		for (uint32_t ii = 0, num = m_numFrameBufferSizes; ii < num; ++ii)
+		{
+			const FrameBufferSize& size = m_frameBufferSize[ii];
+
+			if (size.m_handle.idx == _handle.idx)
+			{
+				_width  = size.m_width;
+				_height = size.m_height;
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	void FrameCaptureReader::readCommands(CommandBuffer& _cmdbuf)
+	{
+		for (;;)
+		{
+			uint8_t command = CommandBuffer::End;
+			bx::read(&m_reader, command, &m_err);
+
+			if (CommandBuffer::End == command
+			||  !m_err.isOk() )
+			{
+				break;
+			}
+
+			_cmdbuf.write(command);
+
+			CommandBufferCaptureReader ar(_cmdbuf, &m_reader, &m_err);
+			serializeCommand(ar, command);
+		}
+	}
+
+	bool FrameCaptureReader::readFrame(const Frame* _live)
+	{
+		Frame* frame = m_frame;
+
+		uint32_t magic = 0;
+		bx::read(&m_reader, magic, &m_err);
+
+		if (kFrameCaptureFrameMagic != magic)
+		{
+			return false;
+		}
+
+		bx::read(&m_reader, frame->m_resolution, &m_err);
+		bx::read(&m_reader, frame->m_debug, &m_err);
+		bx::read(&m_reader, frame->m_fallbackProgram, &m_err);
+		bx::read(&m_reader, frame->m_multiDrawProgram, int32_t(sizeof(frame->m_multiDrawProgram) ), &m_err);
+		bx::read(&m_reader, frame->m_viewRemap,    int32_t(sizeof(frame->m_viewRemap) ),    &m_err);
+		bx::read(&m_reader, frame->m_colorPalette, int32_t(sizeof(frame->m_colorPalette) ), &m_err);
+		bx::read(&m_reader, frame->m_view,         int32_t(sizeof(frame->m_view) ),         &m_err);
+		bx::read(&m_reader, frame->m_viewRect,     int32_t(sizeof(frame->m_viewRect) ),     &m_err);
+		bx::read(&m_reader, frame->m_viewScissor,  int32_t(sizeof(frame->m_viewScissor) ),  &m_err);
+
+		bx::read(&m_reader, m_numFrameBufferSizes, &m_err);
+
+		if (BGFX_CONFIG_MAX_VIEWS < m_numFrameBufferSizes)
+		{
+			return false;
+		}
+
+		bx::read(&m_reader, m_frameBufferSize, int32_t(sizeof(FrameBufferSize)*m_numFrameBufferSizes), &m_err);
+
+		{
+			uint32_t numChunks = 0;
+			bx::read(&m_reader, numChunks, &m_err);
+
+			for (uint32_t ii = 0; ii < numChunks && m_err.isOk(); ++ii)
+			{
+				uint32_t num = 0;
+				bx::read(&m_reader, num, &m_err);
+
+				RenderItemChunk* chunk = frame->reserveRenderItemChunk();
+
+				if (NULL == chunk
+				||  chunk->m_capacity < num)
+				{
+					BX_TRACE("Captured frame doesn't fit into draw call limit, increase Init::limits::maxDrawCalls.");
+					return false;
+				}
+
+				bx::read(&m_reader, chunk->m_key,  int32_t(sizeof(uint64_t)*num),   &m_err);
+				bx::read(&m_reader, chunk->m_item, int32_t(sizeof(RenderItem)*num), &m_err);
+				chunk->m_num = num;
+			}
+		}
+
+		{
+			uint32_t numChunks = 0;
+			bx::read(&m_reader, numChunks, &m_err);
+
+			for (uint32_t ii = 1; ii < numChunks && m_err.isOk(); ++ii)
+			{
+				uint32_t num = 0;
+				bx::read(&m_reader, num, &m_err);
+
+				RenderBindChunk* chunk = frame->reserveRenderBindChunk();
+
+				if (NULL == chunk
+				||  BGFX_CONFIG_RENDER_BIND_CHUNK_SIZE < num)
+				{
+					return false;
+				}
+
+				bx::read(&m_reader, chunk->m_bind, int32_t(sizeof(RenderBind)*num), &m_err);
+				chunk->m_num = num;
+			}
+		}
+
+		{
+			MatrixCache& matrixCache = frame->m_frameCache.m_matrixCache;
+			uint32_t numMatrices = 0;
+			bx::read(&m_reader, numMatrices, &m_err);
+
+			if (BGFX_CONFIG_MAX_MATRIX_CACHE < numMatrices)
+			{
+				return false;
+			}
+
+			bx::read(&m_reader, matrixCache.m_cache, int32_t(sizeof(Matrix4)*numMatrices), &m_err);
+			matrixCache.m_num = numMatrices;
+
+			RectCache& rectCache = frame->m_frameCache.m_rectCache;
+			uint32_t numRects = 0;
+			bx::read(&m_reader, numRects, &m_err);
+
+			if (BGFX_CONFIG_MAX_RECT_CACHE < numRects)
+			{
+				return false;
+			}
+
+			bx::read(&m_reader, rectCache.m_cache, int32_t(sizeof(Rect)*numRects), &m_err);
+			rectCache.m_num = numRects;
+		}
+
+		{
+			uint16_t numBlitItems = 0;
+			bx::read(&m_reader, numBlitItems, &m_err);
+
+			if (BGFX_CONFIG_MAX_BLIT_ITEMS < numBlitItems)
+			{
+				return false;
+			}
+
+			bx::read(&m_reader, frame->m_blitKeys, int32_t(sizeof(uint32_t)*numBlitItems), &m_err);
+			bx::read(&m_reader, frame->m_blitItem, int32_t(sizeof(BlitItem)*numBlitItems), &m_err);
+			frame->m_numBlitItems = numBlitItems;
+		}
+
+		{
+			uint16_t numEncoders = 0;
+			bx::read(&m_reader, numEncoders, &m_err);
+
+			for (uint32_t ii = 0; ii < numEncoders && m_err.isOk(); ++ii)
+			{
+				uint32_t uniformSize = 0;
+				bx::read(&m_reader, uniformSize, &m_err);
+
+				uint32_t uniformBlockSize = 0;
+
+				if (ii < g_caps.limits.maxEncoders)
+				{
+					frame->m_uniformBuffer[ii]->reset();
+					UniformBuffer::update(&frame->m_uniformBuffer[ii], uniformSize, uniformSize);
+					UniformBuffer* uniformBuffer = frame->m_uniformBuffer[ii];
+					bx::read(&m_reader, const_cast<char*>(uniformBuffer->getData(0) ), int32_t(uniformSize), &m_err);
+
+					bx::read(&m_reader, uniformBlockSize, &m_err);
+
+					frame->m_uniformBlockBuffer[ii]->reset();
+					UniformBuffer::update(&frame->m_uniformBlockBuffer[ii], uniformBlockSize, uniformBlockSize);
+					UniformBuffer* uniformBlockBuffer = frame->m_uniformBlockBuffer[ii];
+					bx::read(&m_reader, const_cast<char*>(uniformBlockBuffer->getData(0) ), int32_t(uniformBlockSize), &m_err);
+				}
+				else
+				{
+					bx::read(&m_reader, uniformBlockSize, &m_err);
+
+					if (0 != uniformSize
+					||  0 != uniformBlockSize)
+					{
+						BX_TRACE("Captured frame used more encoders than available, increase Init::limits::maxEncoders.");
+						return false;
+					}
+				}
+			}
+		}
+
+		{
+			IndexBufferHandle ibh;
+			bx::read(&m_reader, ibh, &m_err);
+
+			uint32_t iboffset = 0;
+			bx::read(&m_reader, iboffset, &m_err);
+
+			VertexBufferHandle vbh = BGFX_INVALID_HANDLE;
+			uint32_t vboffset = 0;
+
+			if (iboffset <= g_caps.limits.transientIbSize)
+			{
+				bx::read(&m_reader, _live->m_transientIb->data, int32_t(iboffset), &m_err);
+
+				bx::read(&m_reader, vbh, &m_err);
+				bx::read(&m_reader, vboffset, &m_err);
+			}
+
+			if (iboffset > g_caps.limits.transientIbSize
+			||  vboffset > g_caps.limits.transientVbSize)
+			{
+				BX_TRACE("Captured frame transient data doesn't fit, increase Init::limits transient buffer size.");
+				return false;
+			}
+
+			bx::read(&m_reader, _live->m_transientVb->data, int32_t(vboffset), &m_err);
+
+			frame->m_transientIb = _live->m_transientIb;
+			frame->m_transientVb = _live->m_transientVb;
+			frame->m_iboffset    = iboffset;
+			frame->m_vboffset    = vboffset;
+
+			// Transient buffers of capturing session might have different handles than
+			// transient buffers of this session.
+			const IndexBufferHandle  liveIbh = _live->m_transientIb->handle;
+			const VertexBufferHandle liveVbh = _live->m_transientVb->handle;
+
+			if (ibh.idx != liveIbh.idx
+			||  vbh.idx != liveVbh.idx)
+			{
+				const uint32_t numChunks = frame->m_numRenderItemChunks;
+
+				for (uint32_t ii = 0; ii < numChunks; ++ii)
+				{
+					RenderItemChunk* chunk = frame->m_renderItemChunk[ii];
+
+					for (uint32_t jj = 0, num = chunk->m_num; jj < num; ++jj)
+					{
+						if (0 == (chunk->m_key[jj] & kSortKeyDrawBit) )
+						{
+							continue;
+						}
+
+						RenderDraw& draw = chunk->m_item[jj].draw;
+
+						for (uint32_t idx = 0, streamMask = draw.m_streamMask
+							; 0 != streamMask
+							; streamMask >>= 1, idx += 1
+							)
+						{
+							const uint32_t ntz = bx::uint32_cnttz(streamMask);
+							streamMask >>= ntz;
+							idx         += ntz;
+
+							if (draw.m_stream[idx].m_handle.idx == vbh.idx)
+							{
+								draw.m_stream[idx].m_handle = liveVbh;
+							}
+						}
+
+						if (draw.m_instanceDataBuffer.idx == vbh.idx)
+						{
+							draw.m_instanceDataBuffer = liveVbh;
+						}
+
+						if (draw.m_indexBuffer.idx == ibh.idx)
+						{
+							draw.m_indexBuffer = liveIbh;
+						}
+					}
+				}
+			}
+		}
+
+		return m_err.isOk();
+	}
+
+} // namespace bgfx
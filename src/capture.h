@@ -0,0 +1,114 @@
+/*
+ * Copyright 2011-2024 Branimir Karadzic. All rights reserved.
+ * License: https://github.com/bkaradzic/bgfx/blob/master/LICENSE
+ */
+
+#ifndef BGFX_CAPTURE_H_HEADER_GUARD
+#define BGFX_CAPTURE_H_HEADER_GUARD
+
+#include <bgfx/bgfx.h>
+#include <bx/error.h>
+#include <bx/file.h>
+
+#include "config.h"
+
+namespace bgfx
+{
+	struct Frame;
+	class CommandBuffer;
+
+	/// Writes frames, as they are received by render thread, into capture file. Frame is
+	/// written in three steps, because resource commands are consumed by renderer as they
+	/// are executed, and view rects are modified by sort.
+	///
+	class FrameCaptureWriter
+	{
+	public:
+		///
+		FrameCaptureWriter();
+
+		///
+		~FrameCaptureWriter();
+
+		///
+		bool open(const char* _filePath);
+
+		/// Patch number of frames in header and close file.
+		void close();
+
+		/// Write frame resource commands, before they are executed.
+		void writeCommands(CommandBuffer& _cmdbuf);
+
+		/// Write frame views and render items, before frame is sorted.
+		void writeFrame(const Frame* _frame);
+
+		/// Mark end of frame, after frame post commands are written.
+		void endFrame();
+
+	private:
+		bx::FileWriter m_writer;
+		bx::Error m_err;
+		uint32_t m_numFrames;
+	};
+
+	/// Reads frames from capture file into frame owned by reader, in place of frame
+	/// submitted by API thread.
+	///
+	class FrameCaptureReader
+	{
+	public:
+		///
+		FrameCaptureReader();
+
+		///
+		~FrameCaptureReader();
+
+		/// Open capture file and validate it was written by compatible build.
+		bool open(const char* _filePath);
+
+		///
+		void close();
+
+		///
+		uint32_t getNumFrames() const
+		{
+			return m_numFrames;
+		}
+
+		/// Read next frame. Transient buffers of live frame are used to hold transient data
+		/// of captured frame.
+		///
+		/// @returns Captured frame, or NULL when there are no more frames or capture doesn't
+		///   fit into limits of this session.
+		///
+		Frame* read(const Frame* _live);
+
+		/// Render target size of frame buffer as it was in capturing session. Frame buffers used
+		/// by views of last read frame are known.
+		bool getFrameBufferSize(FrameBufferHandle _handle, uint16_t& _width, uint16_t& _height) const;
+
+		///
+		struct FrameBufferSize
+		{
+			FrameBufferHandle m_handle;
+			uint16_t m_width;
+			uint16_t m_height;
+		};
+
+	private:
+		void readCommands(CommandBuffer& _cmdbuf);
+		bool readFrame(const Frame* _live);
+
+		bx::FileReader m_reader;
+		bx::Error m_err;
+		Frame* m_frame;
+		uint32_t m_numFrames;
+		uint32_t m_numFramesRead;
+
+		FrameBufferSize m_frameBufferSize[BGFX_CONFIG_MAX_VIEWS];
+		uint16_t m_numFrameBufferSizes;
+	};
+
+} // namespace bgfx
+
+#endif // BGFX_CAPTURE_H_HEADER_GUARD
@@ -209,10 +209,38 @@
 #	define BGFX_CONFIG_MULTITHREADED ( (0 == BX_PLATFORM_EMSCRIPTEN) ? 1 : 0)
 #endif // BGFX_CONFIG_MULTITHREADED
 
+// Default value for `Init::Limits::maxDrawCalls`.
 #ifndef BGFX_CONFIG_MAX_DRAW_CALLS
 #	define BGFX_CONFIG_MAX_DRAW_CALLS ( (64<<10)-1)
 #endif // BGFX_CONFIG_MAX_DRAW_CALLS
 
+// Number of render items allocated at once. Each encoder reserves whole chunk and fills
+// it without synchronization with other encoders.
+#ifndef BGFX_CONFIG_RENDER_ITEM_CHUNK_SIZE
+#	define BGFX_CONFIG_RENDER_ITEM_CHUNK_SIZE 256
+#endif // BGFX_CONFIG_RENDER_ITEM_CHUNK_SIZE
+BX_STATIC_ASSERT(bx::isPowerOf2(BGFX_CONFIG_RENDER_ITEM_CHUNK_SIZE), "BGFX_CONFIG_RENDER_ITEM_CHUNK_SIZE must be power of 2.");
+
+// Number of unique binding sets per frame. Draw and compute items reference binding set by
+// 16-bit index.
+#ifndef BGFX_CONFIG_MAX_RENDER_BIND_SETS
+#	define BGFX_CONFIG_MAX_RENDER_BIND_SETS (16<<10)
+#endif // BGFX_CONFIG_MAX_RENDER_BIND_SETS
+BX_STATIC_ASSERT(BGFX_CONFIG_MAX_RENDER_BIND_SETS < UINT16_MAX, "BGFX_CONFIG_MAX_RENDER_BIND_SETS must fit 16-bit index.");
+
+// Number of binding sets allocated at once. Each encoder reserves whole chunk and fills it
+// without synchronization with other encoders.
+#ifndef BGFX_CONFIG_RENDER_BIND_CHUNK_SIZE
+#	define BGFX_CONFIG_RENDER_BIND_CHUNK_SIZE 64
+#endif // BGFX_CONFIG_RENDER_BIND_CHUNK_SIZE
+BX_STATIC_ASSERT(bx::isPowerOf2(BGFX_CONFIG_RENDER_BIND_CHUNK_SIZE), "BGFX_CONFIG_RENDER_BIND_CHUNK_SIZE must be power of 2.");
+
+// Size of per encoder binding set lookup table, used to find binding sets already stored
+// by the same encoder during frame.
+#ifndef BGFX_CONFIG_RENDER_BIND_CACHE_SIZE
+#	define BGFX_CONFIG_RENDER_BIND_CACHE_SIZE 1024
+#endif // BGFX_CONFIG_RENDER_BIND_CACHE_SIZE
+
 #ifndef BGFX_CONFIG_MAX_BLIT_ITEMS
 #	define BGFX_CONFIG_MAX_BLIT_ITEMS (1<<10)
 #endif // BGFX_CONFIG_MAX_BLIT_ITEMS
@@ -225,6 +253,16 @@
 #	define BGFX_CONFIG_MAX_RECT_CACHE (4<<10)
 #endif //  BGFX_CONFIG_MAX_RECT_CACHE
 
+// Number of matrix and rect cache entries reserved at once. Each encoder reserves whole block
+// and fills it without synchronization with other encoders.
+#ifndef BGFX_CONFIG_MATRIX_CACHE_BLOCK_SIZE
+#	define BGFX_CONFIG_MATRIX_CACHE_BLOCK_SIZE 256
+#endif // BGFX_CONFIG_MATRIX_CACHE_BLOCK_SIZE
+
+#ifndef BGFX_CONFIG_RECT_CACHE_BLOCK_SIZE
+#	define BGFX_CONFIG_RECT_CACHE_BLOCK_SIZE 64
+#endif // BGFX_CONFIG_RECT_CACHE_BLOCK_SIZE
+
 #ifndef BGFX_CONFIG_SORT_KEY_NUM_BITS_DEPTH
 #	define BGFX_CONFIG_SORT_KEY_NUM_BITS_DEPTH 32
 #endif // BGFX_CONFIG_SORT_KEY_NUM_BITS_DEPTH
@@ -237,6 +275,15 @@
 #	define BGFX_CONFIG_SORT_KEY_NUM_BITS_PROGRAM 9
 #endif // BGFX_CONFIG_SORT_KEY_NUM_BITS_PROGRAM
 
+// Number of bits of binding set hash, and render state hash used by ViewMode::State sort key.
+#ifndef BGFX_CONFIG_SORT_KEY_NUM_BITS_BIND
+#	define BGFX_CONFIG_SORT_KEY_NUM_BITS_BIND 16
+#endif // BGFX_CONFIG_SORT_KEY_NUM_BITS_BIND
+
+#ifndef BGFX_CONFIG_SORT_KEY_NUM_BITS_STATE
+#	define BGFX_CONFIG_SORT_KEY_NUM_BITS_STATE 10
+#endif // BGFX_CONFIG_SORT_KEY_NUM_BITS_STATE
+
 // Cannot be configured via compiler options.
 #define BGFX_CONFIG_MAX_PROGRAMS (1<<BGFX_CONFIG_SORT_KEY_NUM_BITS_PROGRAM)
 BX_STATIC_ASSERT(bx::isPowerOf2(BGFX_CONFIG_MAX_PROGRAMS), "BGFX_CONFIG_MAX_PROGRAMS must be power of 2.");
@@ -292,6 +339,18 @@ BX_STATIC_ASSERT(bx::isPowerOf2(BGFX_CONFIG_MAX_VIEWS), "BGFX_CONFIG_MAX_VIEWS m
 #	define BGFX_CONFIG_MAX_TEXTURES (4<<10)
 #endif // BGFX_CONFIG_MAX_TEXTURES
 
+#ifndef BGFX_CONFIG_TEXTURE_STREAMING_MIP_TAIL
+// Mips of streaming texture with both dimensions less or equal than this size are always
+// resident.
+#	define BGFX_CONFIG_TEXTURE_STREAMING_MIP_TAIL 64
+#endif // BGFX_CONFIG_TEXTURE_STREAMING_MIP_TAIL
+
+#ifndef BGFX_CONFIG_TEXTURE_STREAMING_MAX_LOADS
+// Maximum number of streaming textures getting finer mips loaded per frame, and maximum
+// number of streaming textures with mip reads in flight.
+#	define BGFX_CONFIG_TEXTURE_STREAMING_MAX_LOADS 4
+#endif // BGFX_CONFIG_TEXTURE_STREAMING_MAX_LOADS
+
 #ifndef BGFX_CONFIG_MAX_TEXTURE_SAMPLERS
 #	define BGFX_CONFIG_MAX_TEXTURE_SAMPLERS 16
 #endif // BGFX_CONFIG_MAX_TEXTURE_SAMPLERS
@@ -312,6 +371,18 @@ BX_STATIC_ASSERT(bx::isPowerOf2(BGFX_CONFIG_MAX_VIEWS), "BGFX_CONFIG_MAX_VIEWS m
 #	define BGFX_CONFIG_MAX_OCCLUSION_QUERIES 256
 #endif // BGFX_CONFIG_MAX_OCCLUSION_QUERIES
 
+#ifndef BGFX_CONFIG_MAX_DRAW_BUNDLES
+#	define BGFX_CONFIG_MAX_DRAW_BUNDLES 256
+#endif // BGFX_CONFIG_MAX_DRAW_BUNDLES
+
+#ifndef BGFX_CONFIG_MAX_UNIFORM_BLOCKS
+#	define BGFX_CONFIG_MAX_UNIFORM_BLOCKS 256
+#endif // BGFX_CONFIG_MAX_UNIFORM_BLOCKS
+
+#ifndef BGFX_CONFIG_MAX_UNIFORM_BLOCK_UNIFORMS
+#	define BGFX_CONFIG_MAX_UNIFORM_BLOCK_UNIFORMS 16
+#endif // BGFX_CONFIG_MAX_UNIFORM_BLOCK_UNIFORMS
+
 #ifndef BGFX_CONFIG_MIN_RESOURCE_COMMAND_BUFFER_SIZE
 #	define BGFX_CONFIG_MIN_RESOURCE_COMMAND_BUFFER_SIZE (64<<10)
 #endif // BGFX_CONFIG_MIN_RESOURCE_COMMAND_BUFFER_SIZE
@@ -324,6 +395,15 @@ BX_STATIC_ASSERT(bx::isPowerOf2(BGFX_CONFIG_MAX_VIEWS), "BGFX_CONFIG_MAX_VIEWS m
 #	define BGFX_CONFIG_TRANSIENT_INDEX_BUFFER_SIZE (2<<20)
 #endif // BGFX_CONFIG_TRANSIENT_INDEX_BUFFER_SIZE
 
+/// When renderer supports persistently mapped buffers, transient index/vertex buffer memory
+/// returned to application points directly into write-combined GPU memory, instead of being
+/// copied by render thread. Such memory should be only written sequentially, never read.
+/// Only OpenGL renderer supports it. While frame capture is active transient buffers are kept
+/// in CPU memory.
+#ifndef BGFX_CONFIG_TRANSIENT_BUFFER_ZERO_COPY
+#	define BGFX_CONFIG_TRANSIENT_BUFFER_ZERO_COPY 0
+#endif // BGFX_CONFIG_TRANSIENT_BUFFER_ZERO_COPY
+
 #ifndef BGFX_CONFIG_PER_FRAME_SCRATCH_STAGING_BUFFER_SIZE
 /// Amount of scratch buffer size (per in-flight frame) that will be reserved
 /// for staging data for copying to the device (such as vertex buffer data,
@@ -340,6 +420,22 @@ BX_STATIC_ASSERT(bx::isPowerOf2(BGFX_CONFIG_MAX_VIEWS), "BGFX_CONFIG_MAX_VIEWS m
 #   define BGFX_CONFIG_MAX_STAGING_SIZE_FOR_SCRATCH_BUFFER (16 << 20)
 #endif
 
+#ifndef BGFX_CONFIG_DEVICE_MEMORY_BLOCK_SIZE
+/// Size of device memory block from which buffers and textures are
+/// sub-allocated. Resources larger than half of the block size get their
+/// own dedicated device memory allocation.
+/// Note: Currently only used by the Vulkan backend.
+#   define BGFX_CONFIG_DEVICE_MEMORY_BLOCK_SIZE (64<<20)
+#endif
+
+#ifndef BGFX_CONFIG_PIPELINE_CACHE_FLUSH_FRAMES
+/// Number of frames without new pipeline creation after which modified
+/// pipeline cache is written back through `CallbackI::cacheWrite`. Cache
+/// is always written back on shutdown.
+/// Note: Currently only used by the Vulkan backend.
+#   define BGFX_CONFIG_PIPELINE_CACHE_FLUSH_FRAMES 120
+#endif
+
 #ifndef BGFX_CONFIG_MAX_INSTANCE_DATA_COUNT
 #	define BGFX_CONFIG_MAX_INSTANCE_DATA_COUNT 5
 #endif // BGFX_CONFIG_MAX_INSTANCE_DATA_COUNT
@@ -354,6 +450,11 @@ BX_STATIC_ASSERT(bx::isPowerOf2(BGFX_CONFIG_MAX_VIEWS), "BGFX_CONFIG_MAX_VIEWS m
 #	define BGFX_CONFIG_PROFILER 0
 #endif // BGFX_CONFIG_PROFILER
 
+/// Number of profiler scope events kept in ring buffer for `bgfx::saveProfilerTrace`.
+#ifndef BGFX_CONFIG_PROFILER_TIMELINE_NUM_EVENTS
+#	define BGFX_CONFIG_PROFILER_TIMELINE_NUM_EVENTS (32<<10)
+#endif // BGFX_CONFIG_PROFILER_TIMELINE_NUM_EVENTS
+
 #ifndef BGFX_CONFIG_RENDERDOC_LOG_FILEPATH
 #	define BGFX_CONFIG_RENDERDOC_LOG_FILEPATH "temp/bgfx"
 #endif // BGFX_CONFIG_RENDERDOC_LOG_FILEPATH
@@ -374,10 +475,41 @@ BX_STATIC_ASSERT(bx::isPowerOf2(BGFX_CONFIG_MAX_VIEWS), "BGFX_CONFIG_MAX_VIEWS m
 #	define BGFX_CONFIG_DEFAULT_MAX_ENCODERS ( (0 != BGFX_CONFIG_MULTITHREADED) ? 8 : 1)
 #endif // BGFX_CONFIG_DEFAULT_MAX_ENCODERS
 
+#ifndef BGFX_CONFIG_MAX_SORT_THREADS
+#	define BGFX_CONFIG_MAX_SORT_THREADS 8
+#endif // BGFX_CONFIG_MAX_SORT_THREADS
+
+#ifndef BGFX_CONFIG_SORT_PARALLEL_MIN_ITEMS
+#	define BGFX_CONFIG_SORT_PARALLEL_MIN_ITEMS (4<<10)
+#endif // BGFX_CONFIG_SORT_PARALLEL_MIN_ITEMS
+
+#ifndef BGFX_CONFIG_MAX_RECORD_THREADS
+#	define BGFX_CONFIG_MAX_RECORD_THREADS 8
+#endif // BGFX_CONFIG_MAX_RECORD_THREADS
+
+#ifndef BGFX_CONFIG_RECORD_PARALLEL_MIN_ITEMS
+#	define BGFX_CONFIG_RECORD_PARALLEL_MIN_ITEMS 64
+#endif // BGFX_CONFIG_RECORD_PARALLEL_MIN_ITEMS
+
+#ifndef BGFX_CONFIG_MAX_DECODE_THREADS
+#	define BGFX_CONFIG_MAX_DECODE_THREADS 8
+#endif // BGFX_CONFIG_MAX_DECODE_THREADS
+
+#ifndef BGFX_CONFIG_MAX_TEXTURE_DECODE_JOBS
+// Maximum number of textures decoded in parallel, textures created when there are no free
+// jobs are converted by renderer.
+#	define BGFX_CONFIG_MAX_TEXTURE_DECODE_JOBS 64
+#endif // BGFX_CONFIG_MAX_TEXTURE_DECODE_JOBS
+
 #ifndef BGFX_CONFIG_MAX_BACK_BUFFERS
 #	define BGFX_CONFIG_MAX_BACK_BUFFERS 4
 #endif // BGFX_CONFIG_MAX_BACK_BUFFERS
 
+/// Maximum number of frames API thread can submit ahead of render thread.
+#ifndef BGFX_CONFIG_MAX_FRAMES_IN_FLIGHT
+#	define BGFX_CONFIG_MAX_FRAMES_IN_FLIGHT 3
+#endif // BGFX_CONFIG_MAX_FRAMES_IN_FLIGHT
+
 #ifndef BGFX_CONFIG_MAX_FRAME_LATENCY
 #	define BGFX_CONFIG_MAX_FRAME_LATENCY 3
 #endif // BGFX_CONFIG_MAX_FRAME_LATENCY
@@ -392,6 +524,12 @@ BX_STATIC_ASSERT(bx::isPowerOf2(BGFX_CONFIG_MAX_VIEWS), "BGFX_CONFIG_MAX_VIEWS m
 #	define BGFX_CONFIG_MAX_SCREENSHOTS 4
 #endif // BGFX_CONFIG_MAX_SCREENSHOTS
 
+/// Maximum number of asynchronous readbacks waiting for GPU. When limit is reached
+/// readback is done synchronously.
+#ifndef BGFX_CONFIG_MAX_READBACKS
+#	define BGFX_CONFIG_MAX_READBACKS 256
+#endif // BGFX_CONFIG_MAX_READBACKS
+
 #ifndef BGFX_CONFIG_ENCODER_API_ONLY
 #	define BGFX_CONFIG_ENCODER_API_ONLY 0
 #endif // BGFX_CONFIG_ENCODER_API_ONLY
@@ -0,0 +1,415 @@
+/*
+ * Copyright 2011-2024 Branimir Karadzic. All rights reserved.
+ * License: https://github.com/bkaradzic/bgfx/blob/master/LICENSE
+ */
+
+#include "bgfx_p.h"
+#include "decode.h"
+
+namespace bgfx
+{
+	TextureDecoder::TextureDecoder()
+		: m_num(0)
+		, m_seq(0)
+		, m_wait(UINT16_MAX)
+		, m_numThreads(0)
+		, m_exit(false)
+	{
+	}
+
+	void TextureDecoder::init(uint32_t _numThreads)
+	{
+		m_num        = 0;
+		m_seq        = 0;
+		m_wait       = UINT16_MAX;
+		m_numThreads = bx::min<uint32_t>(_numThreads, BGFX_CONFIG_MAX_DECODE_THREADS);
+		m_exit       = false;
+
+		bx::memSet(m_lut, 0xff, sizeof(m_lut) );
+
+		for (uint32_t ii = 0; ii < BX_COUNTOF(m_job); ++ii)
+		{
+			m_job[ii].m_state = State::Free;
+		}
+
+		for (uint32_t ii = 0; ii < m_numThreads; ++ii)
+		{
+			m_thread[ii].init(workerThread, this, 0, "bgfx - decode worker thread");
+		}
+
+		BX_TRACE("Decode worker threads: %d", m_numThreads);
+	}
+
+	void TextureDecoder::shutdown()
+	{
+		BX_ASSERT(0 == m_num, "Texture decoder is not empty (%d jobs).", m_num);
+
+		if (0 == m_numThreads)
+		{
+			return;
+		}
+
+		m_exit = true;
+
+		for (uint32_t ii = 0; ii < m_numThreads; ++ii)
+		{
+			m_workSem.post();
+		}
+
+		for (uint32_t ii = 0; ii < m_numThreads; ++ii)
+		{
+			m_thread[ii].shutdown();
+		}
+
+		m_numThreads = 0;
+	}
+
+	TextureFormat::Enum TextureDecoder::getDecodeFormat(const bimg::ImageContainer& _imageContainer)
+	{
+		if (1 < _imageContainer.m_depth
+		||  getViableTextureFormat(_imageContainer) == TextureFormat::Enum(_imageContainer.m_format) )
+		{
+			return TextureFormat::Count;
+		}
+
+		// Decode to format renderer supports without another conversion on render thread.
+		const uint32_t formatCaps = _imageContainer.m_cubeMap
+			? BGFX_CAPS_FORMAT_TEXTURE_CUBE
+			: BGFX_CAPS_FORMAT_TEXTURE_2D
+			;
+
+		if (0 != (g_caps.formats[TextureFormat::BGRA8] & formatCaps) )
+		{
+			return TextureFormat::BGRA8;
+		}
+
+		if (0 != (g_caps.formats[TextureFormat::RGBA8] & formatCaps) )
+		{
+			return TextureFormat::RGBA8;
+		}
+
+		return TextureFormat::Count;
+	}
+
+	void TextureDecoder::push(TextureHandle _handle, const Memory* _mem, uint8_t _skip, TextureFormat::Enum _format)
+	{
+		BX_ASSERT(!isFull(), "Texture decoder is full.");
+		BX_ASSERT(!isPending(_handle), "Texture %d is already decoding.", _handle.idx);
+
+		{
+			bx::MutexScope lock(m_lock);
+
+			uint16_t idx = 0;
+			while (State::Free != m_job[idx].m_state)
+			{
+				++idx;
+			}
+
+			Job& job = m_job[idx];
+			job.m_mem    = _mem;
+			job.m_result = NULL;
+			job.m_seq    = m_seq++;
+			job.m_handle = _handle.idx;
+			job.m_skip   = _skip;
+			job.m_format = uint8_t(_format);
+			job.m_state  = State::Queued;
+
+			m_lut[_handle.idx] = idx;
+			++m_num;
+		}
+
+		m_workSem.post();
+	}
+
+	TextureHandle TextureDecoder::getDone()
+	{
+		const Job* oldest = NULL;
+
+		{
+			bx::MutexScope lock(m_lock);
+
+			for (uint32_t ii = 0; ii < BX_COUNTOF(m_job); ++ii)
+			{
+				const Job& job = m_job[ii];
+
+				if (State::Done == job.m_state
+				&&  (NULL == oldest || job.m_seq < oldest->m_seq) )
+				{
+					oldest = &job;
+				}
+			}
+		}
+
+		const TextureHandle handle = { NULL != oldest ? oldest->m_handle : kInvalidHandle };
+		return handle;
+	}
+
+	const Memory* TextureDecoder::finish(TextureHandle _handle, const Memory*& _src, uint8_t& _skip)
+	{
+		const uint16_t idx = m_lut[_handle.idx];
+		BX_ASSERT(UINT16_MAX != idx, "Texture %d is not decoding.", _handle.idx);
+
+		Job& job = m_job[idx];
+
+		m_lock.lock();
+
+		if (State::Queued == job.m_state)
+		{
+			// No worker picked it up yet, it's faster to decode it here than to wait.
+			job.m_state = State::Running;
+			m_lock.unlock();
+
+			decode(job);
+
+			m_lock.lock();
+			job.m_state = State::Done;
+		}
+
+		m_lock.unlock();
+
+		wait(idx);
+
+		_src  = job.m_mem;
+		_skip = job.m_skip;
+		return job.m_result;
+	}
+
+	void TextureDecoder::discard(TextureHandle _handle)
+	{
+		const uint16_t idx = m_lut[_handle.idx];
+		BX_ASSERT(UINT16_MAX != idx, "Texture %d is not decoding.", _handle.idx);
+
+		Job& job = m_job[idx];
+
+		{
+			bx::MutexScope lock(m_lock);
+
+			// Queued job is dropped before any worker picks it up.
+			if (State::Queued == job.m_state)
+			{
+				job.m_state = State::Done;
+			}
+		}
+
+		wait(idx);
+
+		if (NULL != job.m_result)
+		{
+			bx::MemoryReader reader(job.m_result->data, job.m_result->size);
+			bx::Error err;
+
+			uint32_t magic;
+			bx::read(&reader, magic, &err);
+
+			TextureCreate tc;
+			bx::read(&reader, tc, &err);
+
+			release(tc.m_mem);
+			release(job.m_result);
+		}
+	}
+
+	const Memory* TextureDecoder::decodeUpdate(
+		  const Memory* _mem
+		, uint16_t _width
+		, uint16_t _height
+		, uint16_t& _pitch
+		, TextureFormat::Enum _srcFormat
+		, TextureFormat::Enum _dstFormat
+		)
+	{
+		// Block compressed data is decoded whole blocks at the time.
+		const bimg::ImageBlockInfo& blockInfo = bimg::getBlockInfo(bimg::TextureFormat::Enum(_srcFormat) );
+		const uint32_t width  = (_width  + blockInfo.blockWidth  - 1) / blockInfo.blockWidth  * blockInfo.blockWidth;
+		const uint32_t height = (_height + blockInfo.blockHeight - 1) / blockInfo.blockHeight * blockInfo.blockHeight;
+		const uint32_t pitch  = width*4;
+
+		const Memory* mem = alloc(pitch*height);
+
+		if (TextureFormat::BGRA8 == _dstFormat)
+		{
+			bimg::imageDecodeToBgra8(g_allocator, mem->data, _mem->data, width, height, pitch, bimg::TextureFormat::Enum(_srcFormat) );
+		}
+		else
+		{
+			bimg::imageDecodeToRgba8(g_allocator, mem->data, _mem->data, width, height, pitch, bimg::TextureFormat::Enum(_srcFormat) );
+		}
+
+		_pitch = width == _width ? UINT16_MAX : uint16_t(pitch);
+		return mem;
+	}
+
+	void TextureDecoder::wait(uint16_t _idx)
+	{
+		Job& job = m_job[_idx];
+
+		m_lock.lock();
+
+		while (State::Done != job.m_state)
+		{
+			m_wait = _idx;
+			m_lock.unlock();
+
+			m_doneSem.wait();
+
+			m_lock.lock();
+		}
+
+		m_wait      = UINT16_MAX;
+		job.m_state = State::Free;
+		m_lock.unlock();
+
+		m_lut[job.m_handle] = UINT16_MAX;
+		--m_num;
+	}
+
+	int32_t TextureDecoder::workerThread(bx::Thread* /*_self*/, void* _userData)
+	{
+		BGFX_PROFILER_SET_CURRENT_THREAD_NAME("bgfx - Decode Worker Thread");
+
+		TextureDecoder* decoder = (TextureDecoder*)_userData;
+
+		for (;;)
+		{
+			decoder->m_workSem.wait();
+
+			if (decoder->m_exit)
+			{
+				break;
+			}
+
+			Job* job = NULL;
+
+			{
+				bx::MutexScope lock(decoder->m_lock);
+
+				for (uint32_t ii = 0; ii < BX_COUNTOF(decoder->m_job); ++ii)
+				{
+					Job& candidate = decoder->m_job[ii];
+
+					if (State::Queued == candidate.m_state
+					&&  (NULL == job || candidate.m_seq < job->m_seq) )
+					{
+						job = &candidate;
+					}
+				}
+
+				if (NULL != job)
+				{
+					job->m_state = State::Running;
+				}
+			}
+
+			// Job was already decoded on API thread.
+			if (NULL == job)
+			{
+				continue;
+			}
+
+			decode(*job);
+
+			bool wake;
+
+			{
+				bx::MutexScope lock(decoder->m_lock);
+				job->m_state = State::Done;
+				wake = decoder->m_wait == uint16_t(job - decoder->m_job);
+			}
+
+			if (wake)
+			{
+				decoder->m_doneSem.post();
+			}
+		}
+
+		return 0;
+	}
+
+	void TextureDecoder::decode(Job& _job)
+	{
+		BGFX_PROFILER_SCOPE("TextureDecoder::decode", 0xff2040ff);
+
+		const Memory* src = _job.m_mem;
+
+		bimg::ImageContainer imageContainer;
+		if (!bimg::imageParse(imageContainer, src->data, src->size) )
+		{
+			return;
+		}
+
+		const TextureFormat::Enum format = TextureFormat::Enum(_job.m_format);
+		const uint8_t startLod = bx::min<uint8_t>(_job.m_skip, imageContainer.m_numMips-1);
+
+		const uint16_t width  = uint16_t(bx::max<uint32_t>(1, imageContainer.m_width >>startLod) );
+		const uint16_t height = uint16_t(bx::max<uint32_t>(1, imageContainer.m_height>>startLod) );
+		const uint8_t numMips = uint8_t(imageContainer.m_numMips-startLod);
+
+		const uint16_t numSides = imageContainer.m_numLayers * (imageContainer.m_cubeMap ? 6 : 1);
+
+		uint32_t size = 0;
+		for (uint8_t lod = 0; lod < numMips; ++lod)
+		{
+			size += bx::max<uint32_t>(1, width>>lod) * bx::max<uint32_t>(1, height>>lod) * 4;
+		}
+
+		const Memory* mem = alloc(size*numSides);
+		uint8_t* dst = mem->data;
+		uint8_t* temp = NULL;
+
+		for (uint16_t side = 0; side < numSides; ++side)
+		{
+			for (uint8_t lod = 0; lod < numMips; ++lod)
+			{
+				const uint32_t dstWidth  = bx::max<uint32_t>(1, width >>lod);
+				const uint32_t dstHeight = bx::max<uint32_t>(1, height>>lod);
+				const uint32_t dstPitch  = dstWidth*4;
+
+				bimg::ImageMip mip;
+				if (!bimg::imageGetRawData(imageContainer, side, lod+startLod, src->data, src->size, mip) )
+				{
+					bx::free(g_allocator, temp);
+					release(mem);
+					return;
+				}
+
+				// Block compressed mips are decoded at block aligned size.
+				const uint32_t srcPitch = mip.m_width*4;
+				temp = (uint8_t*)bx::realloc(g_allocator, temp, srcPitch*mip.m_height);
+
+				if (TextureFormat::BGRA8 == format)
+				{
+					bimg::imageDecodeToBgra8(g_allocator, temp, mip.m_data, mip.m_width, mip.m_height, srcPitch, mip.m_format);
+				}
+				else
+				{
+					bimg::imageDecodeToRgba8(g_allocator, temp, mip.m_data, mip.m_width, mip.m_height, srcPitch, mip.m_format);
+				}
+
+				bx::memCopy(dst, dstPitch, temp, srcPitch, dstPitch, dstHeight);
+				dst += dstPitch*dstHeight;
+			}
+		}
+
+		bx::free(g_allocator, temp);
+
+		const Memory* chunk = alloc(sizeof(uint32_t)+sizeof(TextureCreate) );
+
+		bx::StaticMemoryBlockWriter writer(chunk->data, chunk->size);
+		uint32_t magic = BGFX_CHUNK_MAGIC_TEX;
+		bx::write(&writer, magic, bx::ErrorAssert{});
+
+		TextureCreate tc;
+		tc.m_width     = width;
+		tc.m_height    = height;
+		tc.m_depth     = 0;
+		tc.m_numLayers = imageContainer.m_numLayers;
+		tc.m_numMips   = numMips;
+		tc.m_format    = format;
+		tc.m_cubeMap   = imageContainer.m_cubeMap;
+		tc.m_mem       = mem;
+		bx::write(&writer, tc, bx::ErrorAssert{});
+
+		_job.m_result = chunk;
+	}
+
+} // namespace bgfx
@@ -0,0 +1,139 @@
+/*
+ * Copyright 2011-2024 Branimir Karadzic. All rights reserved.
+ * License: https://github.com/bkaradzic/bgfx/blob/master/LICENSE
+ */
+
+#ifndef BGFX_DECODE_H_HEADER_GUARD
+#define BGFX_DECODE_H_HEADER_GUARD
+
+#include <bgfx/bgfx.h>
+#include <bx/mutex.h>
+#include <bx/semaphore.h>
+#include <bx/thread.h>
+#include <bimg/bimg.h>
+
+#include "config.h"
+
+namespace bgfx
+{
+	/// Decodes textures in formats not supported by renderer on pool of worker threads, so that
+	/// render thread only copies decoded data to GPU. Jobs are pushed and removed by API
+	/// thread only, and decoding can span multiple frames.
+	///
+	class TextureDecoder
+	{
+	public:
+		///
+		TextureDecoder();
+
+		/// Zero threads keeps decoder disabled, and textures are decoded by renderer.
+		void init(uint32_t _numThreads);
+
+		///
+		void shutdown();
+
+		///
+		bool isEnabled() const
+		{
+			return 0 != m_numThreads;
+		}
+
+		/// Returns format texture should be decoded to, or `TextureFormat::Count` when
+		/// renderer supports texture format.
+		static TextureFormat::Enum getDecodeFormat(const bimg::ImageContainer& _imageContainer);
+
+		/// Queue texture for decoding. Decoder must not be full.
+		void push(TextureHandle _handle, const Memory* _mem, uint8_t _skip, TextureFormat::Enum _format);
+
+		///
+		bool isFull() const
+		{
+			return BGFX_CONFIG_MAX_TEXTURE_DECODE_JOBS == m_num;
+		}
+
+		///
+		bool isPending(TextureHandle _handle) const
+		{
+			return UINT16_MAX != m_lut[_handle.idx];
+		}
+
+		///
+		uint32_t getNum() const
+		{
+			return m_num;
+		}
+
+		/// Returns handle of oldest decoded texture, or invalid handle if no texture finished
+		/// decoding yet. It doesn't wait for worker threads.
+		TextureHandle getDone();
+
+		/// Wait until texture is decoded, decoding it on calling thread when no worker thread
+		/// started decoding it yet, and remove it from decoder.
+		///
+		/// @returns Texture create chunk with decoded data, or NULL if texture couldn't be
+		///   decoded and it should be created from source memory `_src` with mip skip `_skip`.
+		///
+		const Memory* finish(TextureHandle _handle, const Memory*& _src, uint8_t& _skip);
+
+		/// Remove texture from decoder without finishing it. Queued job is dropped, and only
+		/// job that is being decoded is waited for. Source memory is not released.
+		void discard(TextureHandle _handle);
+
+		/// Decode texture update data to format texture was decoded to, and set `_pitch` to
+		/// pitch of decoded data. Source memory is not released.
+		static const Memory* decodeUpdate(
+			  const Memory* _mem
+			, uint16_t _width
+			, uint16_t _height
+			, uint16_t& _pitch
+			, TextureFormat::Enum _srcFormat
+			, TextureFormat::Enum _dstFormat
+			);
+
+	private:
+		struct State
+		{
+			enum Enum
+			{
+				Free,
+				Queued,
+				Running,
+				Done,
+			};
+		};
+
+		struct Job
+		{
+			const Memory* m_mem;
+			const Memory* m_result;
+			uint32_t m_seq;
+			uint16_t m_handle;
+			uint8_t  m_skip;
+			uint8_t  m_format;
+			uint8_t  m_state;
+		};
+
+		/// Wait until job is done, and free it.
+		void wait(uint16_t _idx);
+
+		static int32_t workerThread(bx::Thread* _self, void* _userData);
+		static void decode(Job& _job);
+
+		bx::Thread    m_thread[BGFX_CONFIG_MAX_DECODE_THREADS];
+		bx::Semaphore m_workSem;
+		bx::Semaphore m_doneSem;
+		bx::Mutex     m_lock;
+
+		Job      m_job[BGFX_CONFIG_MAX_TEXTURE_DECODE_JOBS];
+		uint16_t m_lut[BGFX_CONFIG_MAX_TEXTURES];
+
+		uint32_t m_num;
+		uint32_t m_seq;
+		uint16_t m_wait; //!< Job API thread is waiting for.
+		uint32_t m_numThreads;
+		bool     m_exit;
+	};
+
+} // namespace bgfx
+
+#endif // BGFX_DECODE_H_HEADER_GUARD
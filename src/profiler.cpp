@@ -0,0 +1,247 @@
+/*
+ * Copyright 2011-2024 Branimir Karadzic. All rights reserved.
+ * License: https://github.com/bkaradzic/bgfx/blob/master/LICENSE
+ */
+
+#include <bx/cpu.h>
+#include <bx/string.h>
+#include <bx/timer.h>
+#include <bx/uint32_t.h>
+
+#include "config.h"
+#include "profiler.h"
+
+namespace bgfx
+{
+	static void writeJsonString(bx::WriterI* _writer, const char* _str, bx::Error* _err)
+	{
+		char temp[128];
+		uint32_t len = 0;
+
+		temp[len++] = '"';
+
+		for (const char* ch = _str; '\0' != *ch && len < sizeof(temp)-3; ++ch)
+		{
+			if ('"' == *ch
+			||  '\\' == *ch)
+			{
+				temp[len++] = '\\';
+				temp[len++] = *ch;
+			}
+			else if (uint8_t(*ch) >= 0x20)
+			{
+				temp[len++] = *ch;
+			}
+		}
+
+		temp[len++] = '"';
+
+		bx::write(_writer, temp, int32_t(len), _err);
+	}
+
+	ProfilerTimeline::ProfilerTimeline()
+		: m_allocator(NULL)
+		, m_events(NULL)
+		, m_mask(0)
+		, m_write(0)
+		, m_frame(0)
+		, m_startTime(0)
+		, m_numThreads(0)
+	{
+		bx::memSet(m_frameTime,  0, sizeof(m_frameTime) );
+		bx::memSet(m_threadName, 0, sizeof(m_threadName) );
+	}
+
+	ProfilerTimeline::~ProfilerTimeline()
+	{
+		BX_ASSERT(NULL == m_events, "ProfilerTimeline::shutdown must be called.");
+	}
+
+	void ProfilerTimeline::init(bx::AllocatorI* _allocator, uint32_t _numEvents)
+	{
+		const uint32_t numEvents = bx::uint32_nextpow2(bx::max<uint32_t>(_numEvents, 64) );
+
+		m_allocator = _allocator;
+		m_mask      = numEvents-1;
+		m_write     = 0;
+		m_frame     = 0;
+		m_startTime = bx::getHPCounter();
+
+		Event* events = (Event*)bx::alloc(m_allocator, sizeof(Event)*numEvents);
+		bx::memSet(events, 0, sizeof(Event)*numEvents);
+
+		bx::memSet(m_frameTime, 0, sizeof(m_frameTime) );
+
+		m_events = events;
+	}
+
+	void ProfilerTimeline::shutdown()
+	{
+		if (NULL != m_events)
+		{
+			bx::free(m_allocator, m_events);
+			m_events = NULL;
+		}
+	}
+
+	void ProfilerTimeline::begin(const char* _name)
+	{
+		push('B', _name);
+	}
+
+	void ProfilerTimeline::end()
+	{
+		push('E', "");
+	}
+
+	void ProfilerTimeline::frame()
+	{
+		m_frameTime[m_frame % kMaxFrames] = bx::getHPCounter();
+		m_frame++;
+	}
+
+	void ProfilerTimeline::setThreadName(const char* _name)
+	{
+		m_threadName[getThreadIndex()] = _name;
+	}
+
+	uint16_t ProfilerTimeline::getThreadIndex()
+	{
+		uintptr_t index = uintptr_t(m_threadIndex.get() );
+
+		if (0 == index)
+		{
+			index = bx::min<uint32_t>(bx::atomicFetchAndAdd<uint32_t>(&m_numThreads, 1), kMaxThreads-1) + 1;
+			m_threadIndex.set( (void*)index);
+		}
+
+		return uint16_t(index-1);
+	}
+
+	void ProfilerTimeline::push(uint8_t _phase, const char* _name)
+	{
+		if (NULL == m_events)
+		{
+			return;
+		}
+
+		const uint32_t idx = bx::atomicFetchAndAdd<uint32_t>(&m_write, 1);
+		Event& event = m_events[idx & m_mask];
+
+		// Sequence is cleared while event is being written, and set last, so that
+		// write() can detect slots overwritten while they are being read.
+		bx::atomicExchange<uint32_t>(&event.m_seq, 0);
+
+		event.m_time  = bx::getHPCounter();
+		event.m_tid   = getThreadIndex();
+		event.m_phase = _phase;
+		bx::strCopy(event.m_name, sizeof(event.m_name), _name);
+
+		bx::atomicExchange<uint32_t>(&event.m_seq, idx+1);
+	}
+
+	uint32_t ProfilerTimeline::write(bx::WriterI* _writer, uint16_t _numFrames)
+	{
+		if (NULL == m_events)
+		{
+			return 0;
+		}
+
+		bx::Error err;
+
+		const uint32_t end   = bx::atomicFetchAndAdd<uint32_t>(&m_write, 0);
+		const uint32_t size  = m_mask+1;
+		const uint32_t begin = end > size ? end - size : 0;
+
+		const uint32_t numFrames = bx::min<uint32_t>(bx::min<uint32_t>(_numFrames, m_frame), kMaxFrames-1);
+		const int64_t  startTime = 0 == numFrames
+			? m_startTime
+			: m_frameTime[(m_frame - numFrames) % kMaxFrames]
+			;
+
+		const double toUs = 1000000.0/double(bx::getHPFrequency() );
+
+		bx::write(_writer, &err, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+
+		const uint32_t numThreads = bx::min<uint32_t>(m_numThreads, kMaxThreads);
+		for (uint32_t ii = 0; ii < numThreads; ++ii)
+		{
+			bx::write(_writer, &err
+				, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":"
+				, ii
+				);
+
+			if (NULL != m_threadName[ii])
+			{
+				writeJsonString(_writer, m_threadName[ii], &err);
+			}
+			else
+			{
+				bx::write(_writer, &err, "\"bgfx - Thread %d\"", ii);
+			}
+
+			bx::write(_writer, &err, "}},\n");
+		}
+
+		for (uint32_t ii = m_frame - numFrames; ii < m_frame; ++ii)
+		{
+			const double ts = double(m_frameTime[ii % kMaxFrames] - m_startTime)*toUs;
+			bx::write(_writer, &err
+				, "{\"name\":\"frame %d\",\"cat\":\"bgfx\",\"ph\":\"i\",\"s\":\"g\",\"pid\":1,\"tid\":0,\"ts\":%.3f},\n"
+				, ii
+				, ts
+				);
+		}
+
+		uint32_t num = 0;
+
+		for (uint32_t ii = begin; ii < end; ++ii)
+		{
+			const Event& src = m_events[ii & m_mask];
+
+			const uint32_t seq = bx::atomicFetchAndAdd<uint32_t>(const_cast<uint32_t*>(&src.m_seq), 0);
+			Event event;
+			bx::memCopy(&event, &src, sizeof(Event) );
+			bx::readBarrier();
+
+			if (seq != ii+1
+			||  seq != bx::atomicFetchAndAdd<uint32_t>(const_cast<uint32_t*>(&src.m_seq), 0)
+			||  event.m_time < startTime)
+			{
+				continue;
+			}
+
+			const double ts = double(event.m_time - m_startTime)*toUs;
+
+			bx::write(_writer, &err
+				, "%s{\"ph\":\"%c\",\"pid\":1,\"tid\":%d,\"ts\":%.3f"
+				, 0 == num ? "" : ",\n"
+				, event.m_phase
+				, event.m_tid
+				, ts
+				);
+
+			if ('B' == event.m_phase)
+			{
+				event.m_name[sizeof(event.m_name)-1] = '\0';
+				bx::write(_writer, &err, ",\"cat\":\"bgfx\",\"name\":");
+				writeJsonString(_writer, event.m_name, &err);
+			}
+
+			bx::write(_writer, &err, "}");
+
+			++num;
+		}
+
+		if (0 == num)
+		{
+			// Metadata and frame markers above end with comma.
+			bx::write(_writer, &err, "{\"name\":\"empty\",\"ph\":\"i\",\"s\":\"g\",\"pid\":1,\"tid\":0,\"ts\":0}");
+		}
+
+		bx::write(_writer, &err, "\n]}\n");
+
+		return num;
+	}
+
+} // namespace bgfx
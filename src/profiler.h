@@ -0,0 +1,83 @@
+/*
+ * Copyright 2011-2024 Branimir Karadzic. All rights reserved.
+ * License: https://github.com/bkaradzic/bgfx/blob/master/LICENSE
+ */
+
+#ifndef BGFX_PROFILER_H_HEADER_GUARD
+#define BGFX_PROFILER_H_HEADER_GUARD
+
+#include <bx/allocator.h>
+#include <bx/readerwriter.h>
+#include <bx/thread.h>
+
+namespace bgfx
+{
+	/// Lock-free ring buffer of profiler scope begin/end events recorded from
+	/// any thread. Oldest events are overwritten once buffer is full.
+	///
+	class ProfilerTimeline
+	{
+	public:
+		///
+		ProfilerTimeline();
+
+		///
+		~ProfilerTimeline();
+
+		///
+		void init(bx::AllocatorI* _allocator, uint32_t _numEvents);
+
+		///
+		void shutdown();
+
+		///
+		void begin(const char* _name);
+
+		///
+		void end();
+
+		/// Mark start of new API thread frame.
+		void frame();
+
+		/// Set name of calling thread, `_name` must be string literal.
+		void setThreadName(const char* _name);
+
+		/// Write last `_numFrames` frames as Chrome trace event JSON.
+		///
+		/// @returns Number of events written.
+		///
+		uint32_t write(bx::WriterI* _writer, uint16_t _numFrames);
+
+	private:
+		struct Event
+		{
+			int64_t  m_time;
+			uint32_t m_seq;
+			uint16_t m_tid;
+			uint8_t  m_phase;
+			char     m_name[49];
+		};
+
+		void push(uint8_t _phase, const char* _name);
+		uint16_t getThreadIndex();
+
+		bx::AllocatorI* m_allocator;
+		Event*   m_events;
+		uint32_t m_mask;
+		uint32_t m_write;
+
+		static constexpr uint32_t kMaxFrames  = 256;
+		static constexpr uint32_t kMaxThreads = 64;
+
+		int64_t  m_frameTime[kMaxFrames];
+		uint32_t m_frame;
+		int64_t  m_startTime;
+
+		bx::TlsData m_threadIndex;
+		const char* m_threadName[kMaxThreads];
+		uint32_t m_numThreads;
+	};
+
+} // namespace bgfx
+
+#endif // BGFX_PROFILER_H_HEADER_GUARD
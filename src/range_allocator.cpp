@@ -0,0 +1,174 @@
+/*
+ * Copyright 2011-2024 Branimir Karadzic. All rights reserved.
+ * License: https://github.com/bkaradzic/bgfx/blob/master/LICENSE
+ */
+
+#include "range_allocator.h"
+
+#include <bx/bx.h>
+#include <bx/debug.h>
+#include <bx/math.h>
+
+namespace bgfx
+{
+	RangeAllocator::RangeAllocator()
+		: m_allocator(NULL)
+		, m_free(NULL)
+		, m_numFree(0)
+		, m_maxFree(0)
+		, m_size(0)
+		, m_used(0)
+	{
+	}
+
+	void RangeAllocator::create(bx::AllocatorI* _allocator, uint64_t _size)
+	{
+		BX_ASSERT(NULL == m_allocator || _allocator == m_allocator, "Allocator can't be changed without destroy.");
+
+		m_allocator = _allocator;
+		m_numFree   = 0;
+		m_size      = _size;
+		m_used      = 0;
+
+		if (0 != _size)
+		{
+			const Range range = { 0, _size };
+			insert(0, range);
+		}
+	}
+
+	void RangeAllocator::destroy()
+	{
+		if (NULL != m_free)
+		{
+			bx::free(m_allocator, m_free);
+		}
+
+		m_free    = NULL;
+		m_numFree = 0;
+		m_maxFree = 0;
+		m_size    = 0;
+		m_used    = 0;
+	}
+
+	bool RangeAllocator::alloc(uint64_t _size, uint64_t _align, uint64_t& _outOffset)
+	{
+		BX_ASSERT(0 == _align || bx::isPowerOf2(_align), "Alignment must be power of 2 (align %d).", uint32_t(_align) );
+
+		const uint64_t align = bx::max<uint64_t>(_align, 1);
+
+		// First fit, free ranges are sorted by offset.
+		for (uint32_t ii = 0; ii < m_numFree; ++ii)
+		{
+			Range& range = m_free[ii];
+
+			const uint64_t offset   = (range.m_offset + align - 1) & ~(align - 1);
+			const uint64_t end      = offset + _size;
+			const uint64_t rangeEnd = range.m_offset + range.m_size;
+
+			if (end > rangeEnd)
+			{
+				continue;
+			}
+
+			const uint64_t head = offset - range.m_offset;
+			const uint64_t tail = rangeEnd - end;
+
+			if (0 != head)
+			{
+				range.m_size = head;
+
+				if (0 != tail)
+				{
+					const Range tailRange = { end, tail };
+					insert(ii + 1, tailRange);
+				}
+			}
+			else if (0 != tail)
+			{
+				range.m_offset = end;
+				range.m_size   = tail;
+			}
+			else
+			{
+				erase(ii);
+			}
+
+			m_used    += _size;
+			_outOffset = offset;
+
+			return true;
+		}
+
+		return false;
+	}
+
+	void RangeAllocator::free(uint64_t _offset, uint64_t _size)
+	{
+		BX_ASSERT(_offset + _size <= m_size && _size <= m_used, "Freeing range outside of block.");
+
+		m_used -= _size;
+
+		uint32_t idx = 0;
+		for (; idx < m_numFree && m_free[idx].m_offset < _offset; ++idx)
+		{
+		}
+
+		const uint64_t end = _offset + _size;
+		const bool mergePrev = 0 != idx        && m_free[idx - 1].m_offset + m_free[idx - 1].m_size == _offset;
+		const bool mergeNext = idx < m_numFree && m_free[idx].m_offset == end;
+
+		if (mergePrev
+		&&  mergeNext)
+		{
+			m_free[idx - 1].m_size += _size + m_free[idx].m_size;
+			erase(idx);
+		}
+		else if (mergePrev)
+		{
+			m_free[idx - 1].m_size += _size;
+		}
+		else if (mergeNext)
+		{
+			m_free[idx].m_offset = _offset;
+			m_free[idx].m_size  += _size;
+		}
+		else
+		{
+			const Range range = { _offset, _size };
+			insert(idx, range);
+		}
+	}
+
+	uint64_t RangeAllocator::getLargestFree() const
+	{
+		uint64_t largest = 0;
+
+		for (uint32_t ii = 0; ii < m_numFree; ++ii)
+		{
+			largest = bx::max(largest, m_free[ii].m_size);
+		}
+
+		return largest;
+	}
+
+	void RangeAllocator::insert(uint32_t _idx, const Range& _range)
+	{
+		if (m_numFree == m_maxFree)
+		{
+			m_maxFree = bx::max<uint32_t>(m_maxFree*2, 16);
+			m_free    = (Range*)bx::realloc(m_allocator, m_free, m_maxFree*sizeof(Range) );
+		}
+
+		bx::memMove(&m_free[_idx + 1], &m_free[_idx], (m_numFree - _idx)*sizeof(Range) );
+		m_free[_idx] = _range;
+		++m_numFree;
+	}
+
+	void RangeAllocator::erase(uint32_t _idx)
+	{
+		--m_numFree;
+		bx::memMove(&m_free[_idx], &m_free[_idx + 1], (m_numFree - _idx)*sizeof(Range) );
+	}
+
+} // namespace bgfx
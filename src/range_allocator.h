@@ -0,0 +1,94 @@
+/*
+ * Copyright 2011-2024 Branimir Karadzic. All rights reserved.
+ * License: https://github.com/bkaradzic/bgfx/blob/master/LICENSE
+ */
+
+#ifndef BGFX_RANGE_ALLOCATOR_H_HEADER_GUARD
+#define BGFX_RANGE_ALLOCATOR_H_HEADER_GUARD
+
+#include <bx/allocator.h>
+
+namespace bgfx
+{
+	/// Keeps track of free ranges inside of one memory block. It only deals with offsets,
+	/// memory itself is owned by user. Used by renderers to sub-allocate device memory.
+	///
+	class RangeAllocator
+	{
+	public:
+		///
+		RangeAllocator();
+
+		/// Mark whole block as free.
+		///
+		/// @param[in] _allocator Allocator used for free ranges bookkeeping.
+		/// @param[in] _size Block size in bytes.
+		///
+		void create(bx::AllocatorI* _allocator, uint64_t _size);
+
+		/// Release free ranges bookkeeping.
+		///
+		void destroy();
+
+		/// Allocate range from the first free range it fits in.
+		///
+		/// @param[in] _size Size in bytes.
+		/// @param[in] _align Alignment of offset, must be power of 2. 0 means no alignment.
+		/// @param[out] _outOffset Offset of allocated range.
+		///
+		/// @returns True if allocation succeeded.
+		///
+		bool alloc(uint64_t _size, uint64_t _align, uint64_t& _outOffset);
+
+		/// Free range previously returned by `alloc`, and merge it with adjacent free ranges.
+		///
+		void free(uint64_t _offset, uint64_t _size);
+
+		///
+		uint64_t getLargestFree() const;
+
+		///
+		uint64_t getSize() const
+		{
+			return m_size;
+		}
+
+		///
+		uint64_t getUsed() const
+		{
+			return m_used;
+		}
+
+		///
+		uint32_t getNumFreeRanges() const
+		{
+			return m_numFree;
+		}
+
+		///
+		bool isEmpty() const
+		{
+			return 0 == m_used;
+		}
+
+	private:
+		struct Range
+		{
+			uint64_t m_offset;
+			uint64_t m_size;
+		};
+
+		void insert(uint32_t _idx, const Range& _range);
+		void erase(uint32_t _idx);
+
+		bx::AllocatorI* m_allocator;
+		Range*   m_free;
+		uint32_t m_numFree;
+		uint32_t m_maxFree;
+		uint64_t m_size;
+		uint64_t m_used;
+	};
+
+} // namespace bgfx
+
+#endif // BGFX_RANGE_ALLOCATOR_H_HEADER_GUARD
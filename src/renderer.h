@@ -78,16 +78,15 @@ namespace bgfx
 
 			m_view = m_viewTmp;
 
-			for (uint32_t ii = 0; ii < BGFX_CONFIG_MAX_VIEWS; ++ii)
+			for (uint32_t ii = 0, num = _frame->m_numActiveViews; ii < num; ++ii)
 			{
-				bx::memCopy(&m_view[ii].un.f4x4, &_frame->m_view[ii].m_view.un.f4x4, sizeof(Matrix4) );
-			}
+				const ViewId id = _frame->m_activeView[ii];
 
-			for (uint32_t ii = 0; ii < BGFX_CONFIG_MAX_VIEWS; ++ii)
-			{
-				bx::float4x4_mul(&m_viewProj[ii].un.f4x4
-					, &m_view[ii].un.f4x4
-					, &_frame->m_view[ii].m_proj.un.f4x4
+				bx::memCopy(&m_view[id].un.f4x4, &_frame->m_view[id].m_view.un.f4x4, sizeof(Matrix4) );
+
+				bx::float4x4_mul(&m_viewProj[id].un.f4x4
+					, &m_view[id].un.f4x4
+					, &_frame->m_view[id].m_proj.un.f4x4
 					);
 			}
 		}
@@ -508,6 +507,11 @@ namespace bgfx
 					, BGFX_CONFIG_MAX_VIEW_NAME
 					, &m_viewName[_view][BGFX_CONFIG_MAX_VIEW_NAME_RESERVED]
 					);
+
+				// State changes are only counted by counting Noop renderer.
+				viewStats.numStateChanges   = 0;
+				viewStats.numProgramChanges = 0;
+				viewStats.numBindChanges    = 0;
 			}
 		}
 
@@ -693,6 +693,8 @@ namespace bgfx { namespace d3d11
 			, m_currentDepthStencil(NULL)
 			, m_captureTexture(NULL)
 			, m_captureResolve(NULL)
+			, m_readback(NULL)
+			, m_readbackSize(0)
 			, m_maxAnisotropy(1)
 			, m_depthClamp(false)
 			, m_wireframe(false)
@@ -1706,6 +1708,7 @@ namespace bgfx { namespace d3d11
 				m_textures[ii].destroy();
 			}
 
+			DX_RELEASE(m_readback, 0);
 			DX_RELEASE(m_annotation, 1);
 			DX_RELEASE_W(m_infoQueue, 0);
 			DX_RELEASE(m_msaaRt, 0);
@@ -1806,6 +1809,59 @@ namespace bgfx { namespace d3d11
 			m_vertexBuffers[_handle.idx].destroy();
 		}
 
+		bool readBuffer(IndexBufferHandle _handle, uint32_t _offset, uint32_t _size, void* _data) override
+		{
+			readBuffer(m_indexBuffers[_handle.idx], _offset, _size, _data);
+			return true;
+		}
+
+		bool readBuffer(VertexBufferHandle _handle, uint32_t _offset, uint32_t _size, void* _data) override
+		{
+			readBuffer(m_vertexBuffers[_handle.idx], _offset, _size, _data);
+			return true;
+		}
+
+		void readBuffer(const BufferD3D11& _buffer, uint32_t _offset, uint32_t _size, void* _data)
+		{
+			if (0 == _size)
+			{
+				return;
+			}
+
+			// Staging buffer is reused by all buffer read backs, and only grows.
+			if (m_readbackSize < _size)
+			{
+				DX_RELEASE(m_readback, 0);
+
+				m_readbackSize = bx::uint32_nextpow2(_size);
+
+				D3D11_BUFFER_DESC desc;
+				desc.ByteWidth           = m_readbackSize;
+				desc.Usage               = D3D11_USAGE_STAGING;
+				desc.BindFlags           = 0;
+				desc.CPUAccessFlags      = D3D11_CPU_ACCESS_READ;
+				desc.MiscFlags           = 0;
+				desc.StructureByteStride = 0;
+
+				DX_CHECK(m_device->CreateBuffer(&desc, NULL, &m_readback) );
+			}
+
+			D3D11_BOX box;
+			box.left   = _offset;
+			box.top    = 0;
+			box.front  = 0;
+			box.right  = _offset + _size;
+			box.bottom = 1;
+			box.back   = 1;
+
+			m_deviceCtx->CopySubresourceRegion(m_readback, 0, 0, 0, 0, _buffer.m_ptr, 0, &box);
+
+			D3D11_MAPPED_SUBRESOURCE mapped;
+			DX_CHECK(m_deviceCtx->Map(m_readback, 0, D3D11_MAP_READ, 0, &mapped) );
+			bx::memCopy(_data, mapped.pData, _size);
+			m_deviceCtx->Unmap(m_readback, 0);
+		}
+
 		void createShader(ShaderHandle _handle, const Memory* _mem) override
 		{
 			m_shaders[_handle.idx].create(_mem);
@@ -1844,6 +1900,11 @@ namespace bgfx { namespace d3d11
 		{
 		}
 
+		bool readTextureAsync(TextureHandle /*_handle*/, void* /*_data*/, uint8_t /*_mip*/, uint32_t /*_ticket*/) override
+		{
+			return false;
+		}
+
 		void readTexture(TextureHandle _handle, void* _data, uint8_t _mip) override
 		{
 			const TextureD3D11& texture = m_textures[_handle.idx];
@@ -1900,6 +1961,32 @@ namespace bgfx { namespace d3d11
 			release(mem);
 		}
 
+		void resizeTextureMips(TextureHandle _handle, uint16_t _width, uint16_t _height, uint8_t _numMips, int8_t _srcMip) override
+		{
+			TextureD3D11& texture = m_textures[_handle.idx];
+
+			// Old texture is detached, so it's kept alive until mips that stay resident are
+			// copied from it.
+			ID3D11Resource* src = texture.m_ptr;
+			const uint8_t srcNumMips = texture.m_numMips;
+			texture.m_ptr = NULL;
+
+			resizeTexture(_handle, _width, _height, _numMips, 1);
+
+			for (uint8_t mip = 0; mip < _numMips; ++mip)
+			{
+				const int32_t srcMip = mip + _srcMip;
+
+				if (0 <= srcMip
+				&&  srcMip < srcNumMips)
+				{
+					m_deviceCtx->CopySubresourceRegion(texture.m_ptr, mip, 0, 0, 0, src, srcMip, NULL);
+				}
+			}
+
+			DX_RELEASE(src, 0);
+		}
+
 		void overrideInternal(TextureHandle _handle, uintptr_t _ptr) override
 		{
 			// Resource ref. counts might be messed up outside of bgfx.
@@ -2084,6 +2171,14 @@ namespace bgfx { namespace d3d11
 			m_occlusionQuery.invalidate(_handle);
 		}
 
+		void warmPipeline(FrameBufferHandle /*_fbh*/, ProgramHandle /*_program*/, const VertexLayout& /*_layout*/, uint64_t /*_state*/, uint64_t /*_stencil*/) override
+		{
+		}
+
+		void flushPipelineCache() override
+		{
+		}
+
 		void setMarker(const char* _marker, uint16_t _len) override
 		{
 			if (BX_ENABLED(BGFX_CONFIG_DEBUG_ANNOTATION) )
@@ -2460,6 +2555,7 @@ namespace bgfx { namespace d3d11
 				| BGFX_RESET_MAXANISOTROPY
 				| BGFX_RESET_DEPTH_CLAMP
 				| BGFX_RESET_SUSPEND
+				| BGFX_RESET_ASYNC_PIPELINE
 				);
 
 			if (m_resolution.width            !=  _resolution.width
@@ -3595,6 +3691,9 @@ namespace bgfx { namespace d3d11
 		ID3D11Texture2D* m_captureTexture;
 		ID3D11Texture2D* m_captureResolve;
 
+		ID3D11Buffer* m_readback;
+		uint32_t      m_readbackSize;
+
 		Resolution m_resolution;
 
 		SwapChainDesc m_scd;
@@ -5623,6 +5722,7 @@ namespace bgfx { namespace d3d11
 
 		RenderBind currentBind;
 		currentBind.clear();
+		uint16_t currentBindIdx = kInvalidHandle;
 
 		static ViewState viewState;
 		viewState.reset(_render);
@@ -5688,8 +5788,9 @@ namespace bgfx { namespace d3d11
 					;
 
 				const uint32_t itemIdx       = _render->m_sortValues[item];
-				const RenderItem& renderItem = _render->m_renderItem[itemIdx];
-				const RenderBind& renderBind = _render->m_renderItemBind[itemIdx];
+				const RenderItem& renderItem = _render->getRenderItem(itemIdx);
+				const uint16_t bindIdx       = isCompute ? renderItem.compute.m_bindIdx : renderItem.draw.m_bindIdx;
+				const RenderBind& renderBind = _render->getRenderBind(bindIdx);
 				++item;
 
 				if (viewChanged)
@@ -5929,6 +6030,7 @@ namespace bgfx { namespace d3d11
 							currentState.clear();
 							currentState.m_scissor = !draw.m_scissor;
 							currentBind.clear();
+							currentBindIdx = kInvalidHandle;
 						}
 
 						continue;
@@ -5957,6 +6059,7 @@ namespace bgfx { namespace d3d11
 					currentState.m_stencil    = newStencil;
 
 					currentBind.clear();
+					currentBindIdx = kInvalidHandle;
 
 					setBlendState(newFlags);
 					setDepthStencilState(newFlags, packStencil(BGFX_STENCIL_DEFAULT, BGFX_STENCIL_DEFAULT) );
@@ -6055,8 +6158,9 @@ namespace bgfx { namespace d3d11
 				}
 
 				bool programChanged = false;
-				bool constantsChanged = draw.m_uniformBegin < draw.m_uniformEnd;
+				bool constantsChanged = draw.m_uniformBegin < draw.m_uniformEnd || isValid(draw.m_uniformBlock);
 				rendererUpdateUniforms(this, _render->m_uniformBuffer[draw.m_uniformIdx], draw.m_uniformBegin, draw.m_uniformEnd);
+				rendererUpdateUniformBlock(this, _render, draw);
 
 				if (key.m_program.idx != currentProgram.idx)
 				{
@@ -6126,7 +6230,11 @@ namespace bgfx { namespace d3d11
 					}
 				}
 
+				if (programChanged
+				||  currentBindIdx != bindIdx)
 				{
+					currentBindIdx = bindIdx;
+
 					uint32_t changes = 0;
 					for (uint8_t stage = 0; stage < maxTextureSamplers; ++stage)
 					{
@@ -680,6 +680,8 @@ namespace bgfx { namespace d3d12
 			, m_winPixEvent(NULL)
 			, m_featureLevel(D3D_FEATURE_LEVEL(0) )
 			, m_swapChain(NULL)
+			, m_readback(NULL)
+			, m_readbackSize(0)
 			, m_wireframe(false)
 			, m_lost(false)
 			, m_maxAnisotropy(1)
@@ -1292,8 +1294,8 @@ namespace bgfx { namespace d3d12
 
 				for (uint32_t ii = 0; ii < BX_COUNTOF(m_scratchBuffer); ++ii)
 				{
-					m_scratchBuffer[ii].create(BGFX_CONFIG_MAX_DRAW_CALLS*1024
-						, BGFX_CONFIG_MAX_TEXTURES + BGFX_CONFIG_MAX_SHADERS + BGFX_CONFIG_MAX_DRAW_CALLS
+					m_scratchBuffer[ii].create(g_caps.limits.maxDrawCalls*1024
+						, BGFX_CONFIG_MAX_TEXTURES + BGFX_CONFIG_MAX_SHADERS + g_caps.limits.maxDrawCalls
 						);
 				}
 				m_samplerAllocator.create(D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER
@@ -1673,6 +1675,7 @@ namespace bgfx { namespace d3d12
 			}
 
 			DX_RELEASE(m_rootSignature, 0);
+			DX_RELEASE(m_readback, 0);
 			DX_RELEASE(m_msaaRt, 0);
 			DX_RELEASE(m_swapChain, 0);
 
@@ -1822,6 +1825,51 @@ namespace bgfx { namespace d3d12
 			m_vertexBuffers[_handle.idx].destroy();
 		}
 
+		bool readBuffer(IndexBufferHandle _handle, uint32_t _offset, uint32_t _size, void* _data) override
+		{
+			readBuffer(m_indexBuffers[_handle.idx], _offset, _size, _data);
+			return true;
+		}
+
+		bool readBuffer(VertexBufferHandle _handle, uint32_t _offset, uint32_t _size, void* _data) override
+		{
+			readBuffer(m_vertexBuffers[_handle.idx], _offset, _size, _data);
+			return true;
+		}
+
+		void readBuffer(BufferD3D12& _buffer, uint32_t _offset, uint32_t _size, void* _data)
+		{
+			if (0 == _size)
+			{
+				return;
+			}
+
+			// Read back heap buffer is reused by all buffer read backs, and only grows. Command
+			// list is finished before mapping, so buffer is never in use by GPU when replaced.
+			if (m_readbackSize < _size)
+			{
+				DX_RELEASE(m_readback, 0);
+
+				m_readbackSize = bx::uint32_nextpow2(_size);
+				m_readback     = createCommittedResource(m_device, HeapProperty::ReadBack, m_readbackSize);
+			}
+
+			D3D12_RESOURCE_STATES state = _buffer.setState(m_commandList, D3D12_RESOURCE_STATE_COPY_SOURCE);
+			m_commandList->CopyBufferRegion(m_readback, 0, _buffer.m_ptr, _offset, _size);
+			_buffer.setState(m_commandList, state);
+
+			finish();
+			m_commandList = m_cmd.alloc();
+
+			D3D12_RANGE readRange = { 0, _size };
+			uint8_t* src;
+			DX_CHECK(m_readback->Map(0, &readRange, (void**)&src) );
+			bx::memCopy(_data, src, _size);
+
+			D3D12_RANGE writeRange = { 0, 0 };
+			m_readback->Unmap(0, &writeRange);
+		}
+
 		void createShader(ShaderHandle _handle, const Memory* _mem) override
 		{
 			m_shaders[_handle.idx].create(_mem);
@@ -1860,6 +1908,11 @@ namespace bgfx { namespace d3d12
 		{
 		}
 
+		bool readTextureAsync(TextureHandle /*_handle*/, void* /*_data*/, uint8_t /*_mip*/, uint32_t /*_ticket*/) override
+		{
+			return false;
+		}
+
 		void readTexture(TextureHandle _handle, void* _data, uint8_t _mip ) override
 		{
 			const TextureD3D12& texture = m_textures[_handle.idx];
@@ -1953,6 +2006,49 @@ namespace bgfx { namespace d3d12
 			release(mem);
 		}
 
+		void resizeTextureMips(TextureHandle _handle, uint16_t _width, uint16_t _height, uint8_t _numMips, int8_t _srcMip) override
+		{
+			TextureD3D12& texture = m_textures[_handle.idx];
+
+			// Release of old texture is deferred until command list is executed, mips that
+			// stay resident are copied from it after resize.
+			ID3D12Resource* src = texture.m_ptr;
+			const D3D12_RESOURCE_STATES srcState = texture.m_state;
+			const uint8_t srcNumMips = texture.m_numMips;
+
+			resizeTexture(_handle, _width, _height, _numMips, 1);
+
+			if (D3D12_RESOURCE_STATE_COPY_SOURCE != srcState)
+			{
+				setResourceBarrier(m_commandList, src, srcState, D3D12_RESOURCE_STATE_COPY_SOURCE);
+			}
+
+			const D3D12_RESOURCE_STATES state = texture.setState(m_commandList, D3D12_RESOURCE_STATE_COPY_DEST);
+
+			for (uint8_t mip = 0; mip < _numMips; ++mip)
+			{
+				const int32_t srcMip = mip + _srcMip;
+
+				if (0 <= srcMip
+				&&  srcMip < srcNumMips)
+				{
+					D3D12_TEXTURE_COPY_LOCATION dstLocation;
+					dstLocation.pResource = texture.m_ptr;
+					dstLocation.Type      = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX;
+					dstLocation.SubresourceIndex = mip;
+
+					D3D12_TEXTURE_COPY_LOCATION srcLocation;
+					srcLocation.pResource = src;
+					srcLocation.Type      = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX;
+					srcLocation.SubresourceIndex = srcMip;
+
+					m_commandList->CopyTextureRegion(&dstLocation, 0, 0, 0, &srcLocation, NULL);
+				}
+			}
+
+			texture.setState(m_commandList, state);
+		}
+
 		void overrideInternal(TextureHandle _handle, uintptr_t _ptr) override
 		{
 			// Resource ref. counts might be messed up outside of bgfx.
@@ -2130,6 +2226,14 @@ namespace bgfx { namespace d3d12
 			m_occlusionQuery.invalidate(_handle);
 		}
 
+		void warmPipeline(FrameBufferHandle /*_fbh*/, ProgramHandle /*_program*/, const VertexLayout& /*_layout*/, uint64_t /*_state*/, uint64_t /*_stencil*/) override
+		{
+		}
+
+		void flushPipelineCache() override
+		{
+		}
+
 		void setMarker(const char* _marker, uint16_t _len) override
 		{
 			BX_UNUSED(_len);
@@ -2473,6 +2577,7 @@ namespace bgfx { namespace d3d12
 				| BGFX_RESET_MAXANISOTROPY
 				| BGFX_RESET_DEPTH_CLAMP
 				| BGFX_RESET_SUSPEND
+				| BGFX_RESET_ASYNC_PIPELINE
 				);
 
 			if (m_resolution.width            !=  _resolution.width
@@ -3584,6 +3689,9 @@ namespace bgfx { namespace d3d12
 		Dxgi::SwapChainI* m_swapChain;
 		ID3D12Resource*   m_msaaRt;
 
+		ID3D12Resource* m_readback;
+		uint32_t        m_readbackSize;
+
 #if BX_PLATFORM_WINDOWS
 		ID3D12InfoQueue* m_infoQueue;
 #endif // BX_PLATFORM_WINDOWS
@@ -6402,6 +6510,8 @@ namespace bgfx { namespace d3d12
 		uint16_t currentSamplerStateIdx = kInvalidHandle;
 		ProgramHandle currentProgram    = BGFX_INVALID_HANDLE;
 		uint32_t currentBindHash        = 0;
+		uint16_t hashedBindIdx          = kInvalidHandle;
+		uint32_t renderBindHash         = 0;
 		bool     hasPredefined          = false;
 		bool     commandListChanged     = false;
 		ID3D12PipelineState* currentPso = NULL;
@@ -6507,8 +6617,16 @@ namespace bgfx { namespace d3d12
 					;
 
 				const uint32_t itemIdx       = _render->m_sortValues[item];
-				const RenderItem& renderItem = _render->m_renderItem[itemIdx];
-				const RenderBind& renderBind = _render->m_renderItemBind[itemIdx];
+				const RenderItem& renderItem = _render->getRenderItem(itemIdx);
+				const uint16_t bindIdx       = isCompute ? renderItem.compute.m_bindIdx : renderItem.draw.m_bindIdx;
+				const RenderBind& renderBind = _render->getRenderBind(bindIdx);
+				if (hashedBindIdx != bindIdx)
+				{
+					// Binding set content doesn't change during frame, hash it only once per run
+					// of render items sharing it.
+					hashedBindIdx  = bindIdx;
+					renderBindHash = bx::hash<bx::HashMurmur2A>(renderBind.m_bind, sizeof(renderBind.m_bind) );
+				}
 				++item;
 
 				if (viewChanged)
@@ -6609,7 +6727,7 @@ namespace bgfx { namespace d3d12
 						currentBindHash = 0;
 					}
 
-					uint32_t bindHash = bx::hash<bx::HashMurmur2A>(renderBind.m_bind, sizeof(renderBind.m_bind) );
+					const uint32_t bindHash = renderBindHash;
 					if (currentBindHash != bindHash)
 					{
 						currentBindHash  = bindHash;
@@ -6854,8 +6972,9 @@ namespace bgfx { namespace d3d12
 						primIndex = uint8_t(pt>>BGFX_STATE_PT_SHIFT);
 					}
 
-					bool constantsChanged = draw.m_uniformBegin < draw.m_uniformEnd;
+					bool constantsChanged = draw.m_uniformBegin < draw.m_uniformEnd || isValid(draw.m_uniformBlock);
 					rendererUpdateUniforms(this, _render->m_uniformBuffer[draw.m_uniformIdx], draw.m_uniformBegin, draw.m_uniformEnd);
+					rendererUpdateUniformBlock(this, _render, draw);
 
 					currentState.m_streamMask             = draw.m_streamMask;
 					currentState.m_instanceDataBuffer.idx = draw.m_instanceDataBuffer.idx;
@@ -6908,7 +7027,7 @@ namespace bgfx { namespace d3d12
 						, uint8_t(draw.m_instanceDataStride/16)
 						);
 
-					const uint32_t bindHash = bx::hash<bx::HashMurmur2A>(renderBind.m_bind, sizeof(renderBind.m_bind) );
+					const uint32_t bindHash = renderBindHash;
 
 					if (currentBindHash != bindHash
 					||  0 != changedStencil
@@ -15,6 +15,10 @@ namespace bgfx { namespace gl
 {
 	static char s_viewName[BGFX_CONFIG_MAX_VIEWS][BGFX_CONFIG_MAX_VIEW_NAME];
 
+	// Size of DrawElementsIndirectCommand (count, instance count, first index, base vertex,
+	// base instance) used by multi-draw batching.
+	constexpr uint32_t kMultiDrawCmdSize = 5*sizeof(uint32_t);
+
 	inline void setViewType(ViewId _view, const bx::StringView _str)
 	{
 		if (BX_ENABLED(BGFX_CONFIG_DEBUG_ANNOTATION || BGFX_CONFIG_PROFILER) )
@@ -546,6 +550,8 @@ namespace bgfx { namespace gl
 			APPLE_texture_format_BGRA8888,
 			APPLE_texture_max_level,
 
+			ARB_base_instance,
+			ARB_buffer_storage,
 			ARB_clip_control,
 			ARB_compute_shader,
 			ARB_conservative_depth,
@@ -610,6 +616,7 @@ namespace bgfx { namespace gl
 			EXT_blend_color,
 			EXT_blend_minmax,
 			EXT_blend_subtract,
+			EXT_buffer_storage,
 			EXT_color_buffer_half_float,
 			EXT_color_buffer_float,
 			EXT_copy_image,
@@ -764,6 +771,8 @@ namespace bgfx { namespace gl
 		{ "APPLE_texture_format_BGRA8888",            false,                             true  },
 		{ "APPLE_texture_max_level",                  false,                             true  },
 
+		{ "ARB_base_instance",                        BGFX_CONFIG_RENDERER_OPENGL >= 42, true  },
+		{ "ARB_buffer_storage",                       BGFX_CONFIG_RENDERER_OPENGL >= 44, true  },
 		{ "ARB_clip_control",                         BGFX_CONFIG_RENDERER_OPENGL >= 43, true  },
 		{ "ARB_compute_shader",                       BGFX_CONFIG_RENDERER_OPENGL >= 43, true  },
 		{ "ARB_conservative_depth",                   BGFX_CONFIG_RENDERER_OPENGL >= 42, true  },
@@ -828,6 +837,7 @@ namespace bgfx { namespace gl
 		{ "EXT_blend_color",                          BGFX_CONFIG_RENDERER_OPENGL >= 31, true  },
 		{ "EXT_blend_minmax",                         BGFX_CONFIG_RENDERER_OPENGL >= 14, true  },
 		{ "EXT_blend_subtract",                       BGFX_CONFIG_RENDERER_OPENGL >= 14, true  },
+		{ "EXT_buffer_storage",                       false,                             true  }, // GLES3.1 extension.
 		{ "EXT_color_buffer_half_float",              false,                             true  }, // GLES2 extension.
 		{ "EXT_color_buffer_float",                   false,                             true  }, // GLES2 extension.
 		{ "EXT_copy_image",                           false,                             true  }, // GLES2 extension.
@@ -2223,6 +2233,13 @@ namespace bgfx { namespace gl
 	{
 		RendererContextGL()
 			: m_numWindows(1)
+			, m_transientIbSize(0)
+			, m_multiDrawBuffer(0)
+			, m_multiDrawBufferSize(0)
+			, m_multiDrawCmdOffset(0)
+			, m_multiDrawData(NULL)
+			, m_multiDrawDataSize(0)
+			, m_multiDrawSupport(false)
 			, m_rtMsaa(false)
 			, m_fbDiscard(BGFX_CLEAR_NONE)
 			, m_capture(NULL)
@@ -2861,6 +2878,15 @@ namespace bgfx { namespace gl
 					: 0
 					;
 
+				// Multi-draw batching relies on base instance from indirect draw arguments to
+				// fetch per draw transform, which is not available with GLES or stub.
+				m_multiDrawSupport = true
+					&& BX_ENABLED(BGFX_CONFIG_RENDERER_OPENGL)
+					&& s_extension[Extension::ARB_multi_draw_indirect].m_supported
+					&& s_extension[Extension::ARB_base_instance].m_supported
+					&& stubMultiDrawElementsIndirect != glMultiDrawElementsIndirect
+					;
+
 				g_caps.supported |= s_extension[Extension::ARB_indirect_parameters].m_supported
 					? BGFX_CAPS_DRAW_INDIRECT_COUNT
 					: 0
@@ -3193,6 +3219,24 @@ namespace bgfx { namespace gl
 					m_occlusionQuery.create();
 				}
 
+				if ( (s_extension[Extension::ARB_buffer_storage].m_supported
+				||    s_extension[Extension::EXT_buffer_storage].m_supported)
+				&&  NULL != glBufferStorage
+				&&  NULL != glMapBufferRange
+				&&  NULL != glUnmapBuffer
+				&&  NULL != glFenceSync
+				&&  NULL != glClientWaitSync
+				&&  NULL != glDeleteSync)
+				{
+					// Transient index and vertex data for one frame share one ring region,
+					// otherwise transient buffers are orphaned and updated each frame. Extra
+					// regions cover frames GPU is still reading from.
+					m_transientIbSize = bx::alignUp(g_caps.limits.transientIbSize, 16);
+					m_transientRing.create(m_transientIbSize + g_caps.limits.transientVbSize
+						, 1 + g_caps.limits.maxFramesInFlight + 2
+						);
+				}
+
 				// Init reserved part of view name.
 				for (uint32_t ii = 0; ii < BGFX_CONFIG_MAX_VIEWS; ++ii)
 				{
@@ -3240,6 +3284,19 @@ namespace bgfx { namespace gl
 				m_occlusionQuery.destroy();
 			}
 
+			m_transientRing.destroy();
+
+			if (0 != m_multiDrawBuffer)
+			{
+				GL_CHECK(glDeleteBuffers(1, &m_multiDrawBuffer) );
+				m_multiDrawBuffer     = 0;
+				m_multiDrawBufferSize = 0;
+			}
+
+			bx::free(g_allocator, m_multiDrawData);
+			m_multiDrawData     = NULL;
+			m_multiDrawDataSize = 0;
+
 			destroyMsaaFbo();
 			m_glctx.destroy();
 
@@ -3355,6 +3412,73 @@ namespace bgfx { namespace gl
 			m_vertexBuffers[_handle.idx].destroy();
 		}
 
+		bool readBuffer(IndexBufferHandle _handle, uint32_t _offset, uint32_t _size, void* _data) override
+		{
+			const IndexBufferGL& ib = m_indexBuffers[_handle.idx];
+			return readBuffer(ib.m_id, ib.m_offset + _offset, _size, _data);
+		}
+
+		bool readBuffer(VertexBufferHandle _handle, uint32_t _offset, uint32_t _size, void* _data) override
+		{
+			const VertexBufferGL& vb = m_vertexBuffers[_handle.idx];
+			return readBuffer(vb.m_id, vb.m_offset + _offset, _size, _data);
+		}
+
+		// Buffer read back requires glMapBufferRange (GL 3.0, GLES 3.0, EXT_map_buffer_range) or
+		// glGetBufferSubData (desktop GL only). WebGL 1.0 and GLES 2.0 without extension can't
+		// read back buffers.
+		bool readBuffer(GLuint _id, uint32_t _offset, uint32_t _size, void* _data)
+		{
+			if (0 == _size)
+			{
+				return true;
+			}
+
+			const bool map = true
+				&& NULL != glMapBufferRange
+				&& NULL != glUnmapBuffer
+				;
+
+			if (!map
+			&&  NULL == glGetBufferSubData)
+			{
+				BX_TRACE("Buffer read back is not supported.");
+				return false;
+			}
+
+			// Make compute shader writes visible to mapping.
+			if (0 != (g_caps.supported & BGFX_CAPS_COMPUTE) )
+			{
+				GL_CHECK(glMemoryBarrier(GL_BUFFER_UPDATE_BARRIER_BIT) );
+			}
+
+			// Driver copies mapped range through its own staging memory. Array buffer target is
+			// used for index buffers too, since binding element array buffer changes bound VAO.
+			GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, _id) );
+
+			bool result = true;
+
+			if (map)
+			{
+				const void* src = glMapBufferRange(GL_ARRAY_BUFFER, _offset, _size, GL_MAP_READ_BIT);
+				result = NULL != src;
+
+				if (result)
+				{
+					bx::memCopy(_data, src, _size);
+					GL_CHECK(glUnmapBuffer(GL_ARRAY_BUFFER) );
+				}
+			}
+			else
+			{
+				GL_CHECK(glGetBufferSubData(GL_ARRAY_BUFFER, _offset, _size, _data) );
+			}
+
+			GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, 0) );
+
+			return result;
+		}
+
 		void createShader(ShaderHandle _handle, const Memory* _mem) override
 		{
 			m_shaders[_handle.idx].create(_mem);
@@ -3395,6 +3519,11 @@ namespace bgfx { namespace gl
 		{
 		}
 
+		bool readTextureAsync(TextureHandle /*_handle*/, void* /*_data*/, uint8_t /*_mip*/, uint32_t /*_ticket*/) override
+		{
+			return false;
+		}
+
 		void readTexture(TextureHandle _handle, void* _data, uint8_t _mip) override
 		{
 			if (m_readBackSupported)
@@ -3495,6 +3624,89 @@ namespace bgfx { namespace gl
 			release(mem);
 		}
 
+		void resizeTextureMips(TextureHandle _handle, uint16_t _width, uint16_t _height, uint8_t _numMips, int8_t _srcMip) override
+		{
+			TextureGL& texture = m_textures[_handle.idx];
+
+			// Old texture is detached, so it's kept alive until mips that stay resident are
+			// copied from it.
+			GLuint src = texture.m_id;
+			const uint8_t srcNumMips = texture.m_numMips;
+			texture.m_id = 0;
+
+			resizeTexture(_handle, _width, _height, _numMips, 1);
+
+			for (uint8_t mip = 0; mip < _numMips; ++mip)
+			{
+				const int32_t srcMip = mip + _srcMip;
+
+				if (0 > srcMip
+				||  srcMip >= srcNumMips)
+				{
+					continue;
+				}
+
+				const GLsizei width  = bx::max(1, _width  >> mip);
+				const GLsizei height = bx::max(1, _height >> mip);
+
+				if (m_blitSupported)
+				{
+					GL_CHECK(glCopyImageSubData(src
+						, texture.m_target
+						, srcMip
+						, 0
+						, 0
+						, 0
+						, texture.m_id
+						, texture.m_target
+						, mip
+						, 0
+						, 0
+						, 0
+						, width
+						, height
+						, 1
+						) );
+				}
+				else if (BX_ENABLED(BGFX_GL_CONFIG_BLIT_EMULATION) )
+				{
+					GLuint fbo;
+					GL_CHECK(glGenFramebuffers(1, &fbo) );
+
+					GL_CHECK(glBindFramebuffer(GL_FRAMEBUFFER, fbo) );
+
+					GL_CHECK(glFramebufferTexture2D(GL_FRAMEBUFFER
+						, GL_COLOR_ATTACHMENT0
+						, GL_TEXTURE_2D
+						, src
+						, srcMip
+						) );
+
+					GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+					BX_ASSERT(GL_FRAMEBUFFER_COMPLETE == status, "glCheckFramebufferStatus failed 0x%08x", status);
+					BX_UNUSED(status);
+
+					GL_CHECK(glActiveTexture(GL_TEXTURE0) );
+					GL_CHECK(glBindTexture(GL_TEXTURE_2D, texture.m_id) );
+
+					GL_CHECK(glCopyTexSubImage2D(GL_TEXTURE_2D
+						, mip
+						, 0
+						, 0
+						, 0
+						, 0
+						, width
+						, height
+						) );
+
+					GL_CHECK(glDeleteFramebuffers(1, &fbo) );
+					GL_CHECK(glBindFramebuffer(GL_FRAMEBUFFER, m_currentFbo) );
+				}
+			}
+
+			GL_CHECK(glDeleteTextures(1, &src) );
+		}
+
 		void overrideInternal(TextureHandle _handle, uintptr_t _ptr) override
 		{
 			m_textures[_handle.idx].overrideInternal(_ptr);
@@ -3624,6 +3836,14 @@ namespace bgfx { namespace gl
 			m_occlusionQuery.invalidate(_handle);
 		}
 
+		void warmPipeline(FrameBufferHandle /*_fbh*/, ProgramHandle /*_program*/, const VertexLayout& /*_layout*/, uint64_t /*_state*/, uint64_t /*_stencil*/) override
+		{
+		}
+
+		void flushPipelineCache() override
+		{
+		}
+
 		void setMarker(const char* _marker, uint16_t _len) override
 		{
 			GL_CHECK(glInsertEventMarker(_len, _marker) );
@@ -3759,6 +3979,7 @@ namespace bgfx { namespace gl
 				| BGFX_RESET_MAXANISOTROPY
 				| BGFX_RESET_DEPTH_CLAMP
 				| BGFX_RESET_SUSPEND
+				| BGFX_RESET_ASYNC_PIPELINE
 				);
 
 			if (m_resolution.width            !=  _resolution.width
@@ -4496,6 +4717,68 @@ namespace bgfx { namespace gl
 			}
 		}
 
+		// Uploads model transforms (instance data) followed by indirect draw arguments for all
+		// multi-draw runs in frame. Base instance of each draw selects its transform.
+		void updateMultiDraw(const Frame* _render)
+		{
+			BGFX_PROFILER_SCOPE("bgfx/Update multi-draw buffer", kColorResource);
+
+			const uint32_t num  = _render->m_numMultiDrawItems;
+			const uint32_t size = num*(sizeof(Matrix4) + kMultiDrawCmdSize);
+
+			if (m_multiDrawDataSize < size)
+			{
+				m_multiDrawDataSize = bx::max(size, m_multiDrawDataSize*2);
+				m_multiDrawData     = (uint8_t*)bx::realloc(g_allocator, m_multiDrawData, m_multiDrawDataSize);
+			}
+
+			m_multiDrawCmdOffset = num*sizeof(Matrix4);
+
+			float*    mtx = (float*)m_multiDrawData;
+			uint32_t* cmd = (uint32_t*)&m_multiDrawData[m_multiDrawCmdOffset];
+
+			for (uint32_t ii = 0, numRuns = _render->m_numMultiDrawRuns; ii < numRuns; ++ii)
+			{
+				const MultiDrawRun& run = _render->m_multiDrawRun[ii];
+				const RenderDraw& first = _render->getRenderItem(_render->m_sortValues[run.m_item]).draw;
+
+				for (uint32_t jj = 0; jj < run.m_num; ++jj)
+				{
+					const RenderDraw& draw   = _render->getRenderItem(_render->m_sortValues[run.m_item+jj]).draw;
+					const IndexBufferGL& ib  = m_indexBuffers[draw.m_indexBuffer.idx];
+					const uint32_t indexSize = draw.isIndex16() ? 2 : 4;
+
+					bx::memCopy(mtx, _render->m_frameCache.m_matrixCache.m_cache[draw.m_startMatrix].un.val, sizeof(Matrix4) );
+					mtx += 16;
+
+					// Vertex attributes are bound at first draw's start vertex.
+					cmd[0] = draw.m_numIndices;
+					cmd[1] = 1;
+					cmd[2] = ib.m_offset/indexSize + draw.m_startIndex;
+					cmd[3] = uint32_t(int32_t(draw.m_stream[0].m_startVertex - first.m_stream[0].m_startVertex) );
+					cmd[4] = run.m_first + jj;
+					cmd += kMultiDrawCmdSize/sizeof(uint32_t);
+				}
+			}
+
+			if (m_multiDrawBufferSize < size)
+			{
+				if (0 != m_multiDrawBuffer)
+				{
+					GL_CHECK(glDeleteBuffers(1, &m_multiDrawBuffer) );
+				}
+
+				m_multiDrawBufferSize = bx::max(size, m_multiDrawBufferSize*2);
+				GL_CHECK(glGenBuffers(1, &m_multiDrawBuffer) );
+			}
+
+			// Orphan buffer, GPU might still be reading previous frame's data.
+			GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, m_multiDrawBuffer) );
+			GL_CHECK(glBufferData(GL_ARRAY_BUFFER, m_multiDrawBufferSize, NULL, GL_DYNAMIC_DRAW) );
+			GL_CHECK(glBufferSubData(GL_ARRAY_BUFFER, 0, size, m_multiDrawData) );
+			GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, 0) );
+		}
+
 		void clearQuad(ClearQuad& _clearQuad, const Rect& _rect, const Clear& _clear, uint32_t _height, const float _palette[][4])
 		{
 			uint32_t numMrt = 1;
@@ -4766,6 +5049,15 @@ namespace bgfx { namespace gl
 
 		TimerQueryGL m_gpuTimer;
 		OcclusionQueryGL m_occlusionQuery;
+		RingBufferGL m_transientRing;
+		uint32_t m_transientIbSize;
+
+		GLuint   m_multiDrawBuffer;
+		uint32_t m_multiDrawBufferSize;
+		uint32_t m_multiDrawCmdOffset;
+		uint8_t* m_multiDrawData;
+		uint32_t m_multiDrawDataSize;
+		bool     m_multiDrawSupport;
 
 		SamplerStateCache m_samplerStateCache;
 		UniformStateCache m_uniformStateCache;
@@ -5414,7 +5706,7 @@ namespace bgfx { namespace gl
 		bx::memCopy(m_unboundUsedAttrib, m_used, sizeof(m_unboundUsedAttrib) );
 	}
 
-	void ProgramGL::bindAttributes(const VertexLayout& _layout, uint32_t _baseVertex)
+	void ProgramGL::bindAttributes(const VertexLayout& _layout, uint32_t _baseVertex, uint32_t _offset)
 	{
 		for (uint32_t ii = 0, iiEnd = m_usedCount; ii < iiEnd; ++ii)
 		{
@@ -5434,7 +5726,7 @@ namespace bgfx { namespace gl
 					lazyEnableVertexAttribArray(loc);
 					GL_CHECK(glVertexAttribDivisor(loc, 0) );
 
-					uint32_t baseVertex = _baseVertex*_layout.m_stride + _layout.m_offset[attr];
+					uint32_t baseVertex = _offset + _baseVertex*_layout.m_stride + _layout.m_offset[attr];
 					if ( (BX_ENABLED(BGFX_CONFIG_RENDERER_OPENGL >= 30) || s_renderGL->m_gles3)
 					&&  !isFloat(type)
 					&&  !normalized)
@@ -5513,16 +5805,153 @@ namespace bgfx { namespace gl
 		}
 	}
 
+	void IndexBufferGL::setRing(GLuint _id, uint32_t _offset)
+	{
+		if (!m_ring)
+		{
+			destroy();
+			m_ring = true;
+		}
+
+		m_id     = _id;
+		m_offset = _offset;
+	}
+
 	void IndexBufferGL::destroy()
 	{
 		GL_CHECK(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0) );
-		GL_CHECK(glDeleteBuffers(1, &m_id) );
+
+		if (!m_ring)
+		{
+			GL_CHECK(glDeleteBuffers(1, &m_id) );
+		}
+	}
+
+	void VertexBufferGL::setRing(GLuint _id, uint32_t _offset)
+	{
+		if (!m_ring)
+		{
+			destroy();
+			m_ring = true;
+		}
+
+		m_id     = _id;
+		m_offset = _offset;
 	}
 
 	void VertexBufferGL::destroy()
 	{
 		GL_CHECK(glBindBuffer(m_target, 0) );
+
+		if (!m_ring)
+		{
+			GL_CHECK(glDeleteBuffers(1, &m_id) );
+		}
+	}
+
+	bool RingBufferGL::create(uint32_t _regionSize, uint32_t _numRegions)
+	{
+		m_regionSize = bx::alignUp(_regionSize, 256);
+		m_numRegions = bx::min<uint32_t>(_numRegions, kMaxRegions);
+		m_next       = 0;
+
+		const uint32_t size = m_regionSize*m_numRegions;
+		const GLbitfield flags = 0
+			| GL_MAP_WRITE_BIT
+			| GL_MAP_PERSISTENT_BIT
+			| GL_MAP_COHERENT_BIT
+			;
+
+		GL_CHECK(glGenBuffers(1, &m_id) );
+		GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, m_id) );
+		GL_CHECK(glBufferStorage(GL_ARRAY_BUFFER, size, NULL, flags) );
+		m_data = (uint8_t*)glMapBufferRange(GL_ARRAY_BUFFER, 0, size, flags);
+		GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, 0) );
+
+		if (NULL == m_data)
+		{
+			BX_TRACE("Failed to map transient ring buffer, falling back to buffer orphaning.");
+			GL_CHECK(glDeleteBuffers(1, &m_id) );
+			m_id = 0;
+			return false;
+		}
+
+		return true;
+	}
+
+	void RingBufferGL::destroy()
+	{
+		if (0 == m_id)
+		{
+			return;
+		}
+
+		for (uint32_t ii = 0; ii < m_numRegions; ++ii)
+		{
+			if (NULL != m_sync[ii])
+			{
+				GL_CHECK(glDeleteSync(m_sync[ii]) );
+				m_sync[ii] = NULL;
+			}
+		}
+
+		GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, m_id) );
+		GL_CHECK(glUnmapBuffer(GL_ARRAY_BUFFER) );
+		GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, 0) );
 		GL_CHECK(glDeleteBuffers(1, &m_id) );
+
+		m_id   = 0;
+		m_data = NULL;
+	}
+
+	uint32_t RingBufferGL::acquire()
+	{
+		const uint32_t region = m_next;
+		m_next = (m_next + 1) % m_numRegions;
+
+		GLsync sync = m_sync[region];
+
+		if (NULL != sync)
+		{
+			BGFX_PROFILER_SCOPE("bgfx/Wait transient ring", kColorResource);
+
+			GLenum result;
+			do
+			{
+				result = glClientWaitSync(sync, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+			}
+			while (GL_TIMEOUT_EXPIRED == result);
+
+			BX_WARN(GL_WAIT_FAILED != result, "glClientWaitSync failed.");
+
+			GL_CHECK(glDeleteSync(sync) );
+			m_sync[region] = NULL;
+		}
+
+		return region;
+	}
+
+	uint32_t RingBufferGL::find(const void* _ptr) const
+	{
+		const uint8_t* ptr = (const uint8_t*)_ptr;
+
+		if (ptr <  m_data
+		||  ptr >= m_data + m_regionSize*m_numRegions)
+		{
+			return UINT32_MAX;
+		}
+
+		return uint32_t(ptr - m_data) / m_regionSize;
+	}
+
+	void RingBufferGL::fence(uint32_t _region)
+	{
+		if (NULL != m_sync[_region])
+		{
+			GL_CHECK(glDeleteSync(m_sync[_region]) );
+		}
+
+		m_sync[_region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
 	}
 
 	bool TextureGL::init(GLenum _target, uint32_t _width, uint32_t _height, uint32_t _depth, uint8_t _numMips, uint64_t _flags)
@@ -7492,18 +7921,55 @@ namespace bgfx { namespace gl
 			frameQueryIdx = m_gpuTimer.begin(BGFX_CONFIG_MAX_VIEWS, _render->m_frameNum);
 		}
 
+		uint32_t transientRegion = UINT32_MAX;
+
+		if (m_transientRing.isValid() )
+		{
+			if (BX_ENABLED(BGFX_CONFIG_TRANSIENT_BUFFER_ZERO_COPY) )
+			{
+				// Transient data was written by application directly into ring region handed
+				// out to this frame at the end of its previous use.
+				transientRegion = m_transientRing.find(_render->m_transientIb->data);
+			}
+			else
+			{
+				transientRegion = m_transientRing.acquire();
+				uint8_t* ptr = m_transientRing.getPtr(transientRegion);
+				bx::memCopy(ptr, _render->m_transientIb->data, _render->m_iboffset);
+				bx::memCopy(ptr + m_transientIbSize, _render->m_transientVb->data, _render->m_vboffset);
+			}
+		}
+
 		if (0 < _render->m_iboffset)
 		{
 			BGFX_PROFILER_SCOPE("bgfx/Update transient index buffer", kColorResource);
 			TransientIndexBuffer* ib = _render->m_transientIb;
-			m_indexBuffers[ib->handle.idx].update(0, _render->m_iboffset, ib->data, true);
+			IndexBufferGL& indexBuffer = m_indexBuffers[ib->handle.idx];
+
+			if (UINT32_MAX != transientRegion)
+			{
+				indexBuffer.setRing(m_transientRing.m_id, m_transientRing.getOffset(transientRegion) );
+			}
+			else
+			{
+				indexBuffer.update(0, _render->m_iboffset, ib->data, true);
+			}
 		}
 
 		if (0 < _render->m_vboffset)
 		{
 			BGFX_PROFILER_SCOPE("bgfx/Update transient vertex buffer", kColorResource);
 			TransientVertexBuffer* vb = _render->m_transientVb;
-			m_vertexBuffers[vb->handle.idx].update(0, _render->m_vboffset, vb->data, true);
+			VertexBufferGL& vertexBuffer = m_vertexBuffers[vb->handle.idx];
+
+			if (UINT32_MAX != transientRegion)
+			{
+				vertexBuffer.setRing(m_transientRing.m_id, m_transientRing.getOffset(transientRegion) + m_transientIbSize);
+			}
+			else
+			{
+				vertexBuffer.update(0, _render->m_vboffset, vb->data, true);
+			}
 		}
 
 		_render->sort();
@@ -7515,6 +7981,7 @@ namespace bgfx { namespace gl
 
 		RenderBind currentBind;
 		currentBind.clear();
+		uint16_t currentBindIdx = kInvalidHandle;
 
 		static ViewState viewState;
 		viewState.reset(_render);
@@ -7561,6 +8028,8 @@ namespace bgfx { namespace gl
 		uint32_t statsNumInstances[BX_COUNTOF(s_primInfo)] = {};
 		uint32_t statsNumIndices = 0;
 		uint32_t statsKeyType[2] = {};
+		uint32_t statsNumMultiDraw = 0;
+		uint32_t statsNumMultiDrawItems = 0;
 
 		Profiler<TimerQueryGL> profiler(
 			  _render
@@ -7581,6 +8050,15 @@ namespace bgfx { namespace gl
 			viewState.m_rect = _render->m_view[0].m_rect;
 			int32_t numItems = _render->m_numRenderItems;
 
+			const bool multiDrawEnabled = m_multiDrawSupport && 0 != _render->m_numMultiDrawRuns;
+			uint32_t multiDrawIdx = 0;
+			bool multiDrawBound = false;
+
+			if (multiDrawEnabled)
+			{
+				updateMultiDraw(_render);
+			}
+
 			for (int32_t item = 0; item < numItems;)
 			{
 				const uint64_t encodedKey = _render->m_sortKeys[item];
@@ -7593,8 +8071,9 @@ namespace bgfx { namespace gl
 					;
 
 				const uint32_t itemIdx       = _render->m_sortValues[item];
-				const RenderItem& renderItem = _render->m_renderItem[itemIdx];
-				const RenderBind& renderBind = _render->m_renderItemBind[itemIdx];
+				const RenderItem& renderItem = _render->getRenderItem(itemIdx);
+				const uint16_t bindIdx       = isCompute ? renderItem.compute.m_bindIdx : renderItem.draw.m_bindIdx;
+				const RenderBind& renderBind = _render->getRenderBind(bindIdx);
 				++item;
 
 				if (viewChanged)
@@ -7783,6 +8262,19 @@ namespace bgfx { namespace gl
 
 				const RenderDraw& draw = renderItem.draw;
 
+				const MultiDrawRun* multiDraw = NULL;
+
+				if (multiDrawEnabled
+				&&  multiDrawIdx < _render->m_numMultiDrawRuns
+				&&  _render->m_multiDrawRun[multiDrawIdx].m_item == uint32_t(item-1) )
+				{
+					// Runs are made only of draw calls using programs enabled with
+					// `bgfx::setProgramMultiDraw`, which read model transform from instance data.
+					multiDraw = &_render->m_multiDrawRun[multiDrawIdx++];
+					item += multiDraw->m_num-1;
+					statsKeyType[0] += multiDraw->m_num-1;
+				}
+
 				const bool hasOcclusionQuery = 0 != (draw.m_stateFlags & BGFX_STATE_INTERNAL_OCCLUSION_QUERY);
 				{
 					const bool occluded = true
@@ -7799,6 +8291,7 @@ namespace bgfx { namespace gl
 							currentState.clear();
 							currentState.m_scissor = !draw.m_scissor;
 							currentBind.clear();
+							currentBindIdx = kInvalidHandle;
 						}
 
 						continue;
@@ -7823,6 +8316,7 @@ namespace bgfx { namespace gl
 					currentState.m_stencil    = newStencil;
 
 					currentBind.clear();
+					currentBindIdx = kInvalidHandle;
 				}
 
 				uint16_t scissor = draw.m_scissor;
@@ -8153,9 +8647,10 @@ namespace bgfx { namespace gl
 				}
 
 				bool programChanged = false;
-				bool constantsChanged = draw.m_uniformBegin < draw.m_uniformEnd;
+				bool constantsChanged = draw.m_uniformBegin < draw.m_uniformEnd || isValid(draw.m_uniformBlock);
 				bool bindAttribs = false;
 				rendererUpdateUniforms(this, _render->m_uniformBuffer[draw.m_uniformIdx], draw.m_uniformBegin, draw.m_uniformEnd);
+				rendererUpdateUniformBlock(this, _render, draw);
 
 				if (key.m_program.idx != currentProgram.idx)
 				{
@@ -8183,7 +8678,11 @@ namespace bgfx { namespace gl
 
 					viewState.setPredefined<1>(this, view, program, _render, draw);
 
+					if (programChanged
+					||  currentBindIdx != bindIdx)
 					{
+						currentBindIdx = bindIdx;
+
 						GLbitfield barrier = 0;
 						for (uint32_t stage = 0; stage < BGFX_CONFIG_MAX_TEXTURE_SAMPLERS; ++stage)
 						{
@@ -8273,12 +8772,14 @@ namespace bgfx { namespace gl
 						||  currentState.m_streamMask             != draw.m_streamMask
 						||  currentState.m_instanceDataBuffer.idx != draw.m_instanceDataBuffer.idx
 						||  currentState.m_instanceDataOffset     != draw.m_instanceDataOffset
-						||  currentState.m_instanceDataStride     != draw.m_instanceDataStride)
+						||  currentState.m_instanceDataStride     != draw.m_instanceDataStride
+						||  multiDrawBound                        != (NULL != multiDraw) )
 						{
 							currentState.m_streamMask         = draw.m_streamMask;
 							currentState.m_instanceDataBuffer = draw.m_instanceDataBuffer;
 							currentState.m_instanceDataOffset = draw.m_instanceDataOffset;
 							currentState.m_instanceDataStride = draw.m_instanceDataStride;
+							multiDrawBound = NULL != multiDraw;
 
 							bindAttribs = true;
 						}
@@ -8333,14 +8834,20 @@ namespace bgfx { namespace gl
 											? draw.m_stream[idx].m_layoutHandle.idx
 											: vb.m_layoutHandle.idx;
 										GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, vb.m_id) );
-										program.bindAttributes(m_vertexLayouts[decl], draw.m_stream[idx].m_startVertex);
+										program.bindAttributes(m_vertexLayouts[decl], draw.m_stream[idx].m_startVertex, vb.m_offset);
 									}
 								}
 
 								if (isValid(draw.m_instanceDataBuffer) )
 								{
-									GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, m_vertexBuffers[draw.m_instanceDataBuffer.idx].m_id) );
-									program.bindInstanceData(draw.m_instanceDataStride, draw.m_instanceDataOffset);
+									const VertexBufferGL& vb = m_vertexBuffers[draw.m_instanceDataBuffer.idx];
+									GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, vb.m_id) );
+									program.bindInstanceData(draw.m_instanceDataStride, draw.m_instanceDataOffset + vb.m_offset);
+								}
+								else if (NULL != multiDraw)
+								{
+									GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, m_multiDrawBuffer) );
+									program.bindInstanceData(sizeof(Matrix4), 0);
 								}
 
 								program.bindAttributesEnd();
@@ -8381,7 +8888,44 @@ namespace bgfx { namespace gl
 							m_occlusionQuery.begin(_render, draw.m_occlusionQuery);
 						}
 
-						if (isValid(draw.m_indirectBuffer) )
+						if (NULL != multiDraw)
+						{
+							for (uint32_t ii = 0; ii < multiDraw->m_num; ++ii)
+							{
+								const RenderDraw& batched = _render->getRenderItem(_render->m_sortValues[multiDraw->m_item+ii]).draw;
+
+								if (prim.m_min <= batched.m_numIndices)
+								{
+									numIndices        += batched.m_numIndices;
+									numPrimsSubmitted += batched.m_numIndices/prim.m_div - prim.m_sub;
+								}
+							}
+
+							numInstances     = multiDraw->m_num;
+							numPrimsRendered = numPrimsSubmitted;
+
+							const GLenum indexFormat = draw.isIndex16()
+								? GL_UNSIGNED_SHORT
+								: GL_UNSIGNED_INT
+								;
+
+							// Indirect arguments live in the same buffer as transforms.
+							currentState.m_indirectBuffer.idx = kInvalidHandle;
+							GL_CHECK(glBindBuffer(GL_DRAW_INDIRECT_BUFFER, m_multiDrawBuffer) );
+
+							const uintptr_t args = m_multiDrawCmdOffset + multiDraw->m_first*kMultiDrawCmdSize;
+							GL_CHECK(glMultiDrawElementsIndirect(prim.m_type, indexFormat
+								, (void*)args
+								, multiDraw->m_num
+								, kMultiDrawCmdSize
+								) );
+
+							GL_CHECK(glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0) );
+
+							statsNumMultiDraw++;
+							statsNumMultiDrawItems += multiDraw->m_num;
+						}
+						else if (isValid(draw.m_indirectBuffer) )
 						{
 							const VertexBufferGL& vb = m_vertexBuffers[draw.m_indirectBuffer.idx];
 							if (currentState.m_indirectBuffer.idx != draw.m_indirectBuffer.idx)
@@ -8499,7 +9043,7 @@ namespace bgfx { namespace gl
 									GL_CHECK(glDrawElementsInstanced(prim.m_type
 										, numIndices
 										, indexFormat
-										, (void*)0
+										, (void*)(uintptr_t)ib.m_offset
 										, draw.m_numInstances
 										) );
 								}
@@ -8513,7 +9057,7 @@ namespace bgfx { namespace gl
 									GL_CHECK(glDrawElementsInstanced(prim.m_type
 										, numIndices
 										, indexFormat
-										, (void*)(uintptr_t)(draw.m_startIndex*indexSize)
+										, (void*)(uintptr_t)(ib.m_offset + draw.m_startIndex*indexSize)
 										, draw.m_numInstances
 										) );
 								}
@@ -8583,6 +9127,21 @@ namespace bgfx { namespace gl
 			}
 		}
 
+		if (UINT32_MAX != transientRegion)
+		{
+			m_transientRing.fence(transientRegion);
+		}
+
+		if (m_transientRing.isValid()
+		&&  BX_ENABLED(BGFX_CONFIG_TRANSIENT_BUFFER_ZERO_COPY) )
+		{
+			// Frame goes back to API thread, hand it out next region so that application
+			// writes transient data directly into mapped memory.
+			uint8_t* ptr = m_transientRing.getPtr(m_transientRing.acquire() );
+			_render->m_transientIb->data = ptr;
+			_render->m_transientVb->data = ptr + m_transientIbSize;
+		}
+
 		BGFX_GL_PROFILER_END();
 
 		m_glctx.makeCurrent(NULL);
@@ -8629,6 +9188,9 @@ namespace bgfx { namespace gl
 		perfStats.gpuMemoryMax  = -INT64_MAX;
 		perfStats.gpuMemoryUsed = -INT64_MAX;
 
+		perfStats.numMultiDraw      = statsNumMultiDraw;
+		perfStats.numMultiDrawItems = statsNumMultiDrawItems;
+
 		if (_render->m_debug & (BGFX_DEBUG_IFH|BGFX_DEBUG_STATS) )
 		{
 			BGFX_GL_PROFILER_BEGIN_LITERAL("debugstats", kColorFrame);
@@ -8695,6 +9257,11 @@ namespace bgfx { namespace gl
 				maxGpuLatency = 0;
 				maxGpuElapsed = 0.0;
 
+				tvm.printf(10, pos++, 0x8b, "   Multi-draw: %5d (batched draw %5d) "
+					, statsNumMultiDraw
+					, statsNumMultiDrawItems
+					);
+
 				for (uint32_t ii = 0; ii < BX_COUNTOF(s_primInfo); ++ii)
 				{
 					tvm.printf(10, pos++, 0x8b, "   %10s: %7d (#inst: %5d), submitted: %7d "
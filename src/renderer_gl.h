@@ -86,6 +86,7 @@ typedef double GLdouble;
 #		include <GLES2/gl2ext.h>
 typedef int64_t  GLint64;
 typedef uint64_t GLuint64;
+typedef struct __GLsync* GLsync;
 #		define GL_PROGRAM_BINARY_LENGTH GL_PROGRAM_BINARY_LENGTH_OES
 #		define GL_HALF_FLOAT GL_HALF_FLOAT_OES
 #		define GL_RGBA8 GL_RGBA8_OES
@@ -868,6 +869,10 @@ typedef uint64_t GLuint64;
 #	define GL_SHADER_IMAGE_ACCESS_BARRIER_BIT 0x00000020
 #endif // GL_SHADER_IMAGE_ACCESS_BARRIER_BIT
 
+#ifndef GL_BUFFER_UPDATE_BARRIER_BIT
+#	define GL_BUFFER_UPDATE_BARRIER_BIT 0x00000200
+#endif // GL_BUFFER_UPDATE_BARRIER_BIT
+
 #ifndef GL_SHADER_STORAGE_BARRIER_BIT
 #	define GL_SHADER_STORAGE_BARRIER_BIT 0x00002000
 #endif // GL_SHADER_STORAGE_BARRIER_BIT
@@ -1127,6 +1132,38 @@ typedef uint64_t GLuint64;
 #	define GL_TEXTURE_LOD_BIAS 0x8501
 #endif // GL_TEXTURE_LOD_BIAS
 
+#ifndef GL_MAP_READ_BIT
+#	define GL_MAP_READ_BIT 0x0001
+#endif // GL_MAP_READ_BIT
+
+#ifndef GL_MAP_WRITE_BIT
+#	define GL_MAP_WRITE_BIT 0x0002
+#endif // GL_MAP_WRITE_BIT
+
+#ifndef GL_MAP_PERSISTENT_BIT
+#	define GL_MAP_PERSISTENT_BIT 0x0040
+#endif // GL_MAP_PERSISTENT_BIT
+
+#ifndef GL_MAP_COHERENT_BIT
+#	define GL_MAP_COHERENT_BIT 0x0080
+#endif // GL_MAP_COHERENT_BIT
+
+#ifndef GL_SYNC_GPU_COMMANDS_COMPLETE
+#	define GL_SYNC_GPU_COMMANDS_COMPLETE 0x9117
+#endif // GL_SYNC_GPU_COMMANDS_COMPLETE
+
+#ifndef GL_SYNC_FLUSH_COMMANDS_BIT
+#	define GL_SYNC_FLUSH_COMMANDS_BIT 0x00000001
+#endif // GL_SYNC_FLUSH_COMMANDS_BIT
+
+#ifndef GL_TIMEOUT_EXPIRED
+#	define GL_TIMEOUT_EXPIRED 0x911B
+#endif // GL_TIMEOUT_EXPIRED
+
+#ifndef GL_WAIT_FAILED
+#	define GL_WAIT_FAILED 0x911D
+#endif // GL_WAIT_FAILED
+
 #if BGFX_USE_EGL
 #	include "glcontext_egl.h"
 #elif BGFX_USE_HTML5
@@ -1325,8 +1362,10 @@ namespace bgfx { namespace gl
 	{
 		void create(uint32_t _size, void* _data, uint16_t _flags)
 		{
-			m_size  = _size;
-			m_flags = _flags;
+			m_size   = _size;
+			m_offset = 0;
+			m_flags  = _flags;
+			m_ring   = false;
 
 			GL_CHECK(glGenBuffers(1, &m_id) );
 			BX_ASSERT(0 != m_id, "Failed to generate buffer id.");
@@ -1359,18 +1398,23 @@ namespace bgfx { namespace gl
 			GL_CHECK(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0) );
 		}
 
+		void setRing(GLuint _id, uint32_t _offset);
 		void destroy();
 
 		GLuint m_id;
 		uint32_t m_size;
+		uint32_t m_offset;
 		uint16_t m_flags;
+		bool m_ring;
 	};
 
 	struct VertexBufferGL
 	{
 		void create(uint32_t _size, void* _data, VertexLayoutHandle _layoutHandle, uint16_t _flags)
 		{
-			m_size = _size;
+			m_size   = _size;
+			m_offset = 0;
+			m_ring   = false;
 			m_layoutHandle = _layoutHandle;
 			const bool drawIndirect = 0 != (_flags & BGFX_BUFFER_DRAW_INDIRECT);
 
@@ -1407,12 +1451,66 @@ namespace bgfx { namespace gl
 			GL_CHECK(glBindBuffer(m_target, 0) );
 		}
 
+		void setRing(GLuint _id, uint32_t _offset);
 		void destroy();
 
 		GLuint m_id;
 		GLenum m_target;
 		uint32_t m_size;
+		uint32_t m_offset;
 		VertexLayoutHandle m_layoutHandle;
+		bool m_ring;
+	};
+
+	// Persistently mapped buffer (ARB_buffer_storage) split into per-frame regions. Region is
+	// handed out again only once fence inserted at the end of frame that used it is signaled.
+	struct RingBufferGL
+	{
+		RingBufferGL()
+			: m_id(0)
+			, m_data(NULL)
+			, m_regionSize(0)
+			, m_numRegions(0)
+			, m_next(0)
+		{
+			bx::memSet(m_sync, 0, sizeof(m_sync) );
+		}
+
+		bool create(uint32_t _regionSize, uint32_t _numRegions);
+		void destroy();
+
+		bool isValid() const
+		{
+			return 0 != m_id;
+		}
+
+		// Returns next region in order, waits while GPU is still reading from it.
+		uint32_t acquire();
+
+		// Returns region containing pointer, or UINT32_MAX if pointer is not in mapped memory.
+		uint32_t find(const void* _ptr) const;
+
+		// Insert fence for region.
+		void fence(uint32_t _region);
+
+		uint32_t getOffset(uint32_t _region) const
+		{
+			return _region*m_regionSize;
+		}
+
+		uint8_t* getPtr(uint32_t _region) const
+		{
+			return &m_data[getOffset(_region)];
+		}
+
+		static constexpr uint32_t kMaxRegions = BGFX_CONFIG_MAX_FRAMES_IN_FLIGHT + 3;
+
+		GLuint   m_id;
+		uint8_t* m_data;
+		uint32_t m_regionSize;
+		uint32_t m_numRegions;
+		uint32_t m_next;
+		GLsync   m_sync[kMaxRegions];
 	};
 
 	struct TextureGL
@@ -1523,7 +1621,7 @@ namespace bgfx { namespace gl
 		void init();
 
 		void bindAttributesBegin();
-		void bindAttributes(const VertexLayout& _layout, uint32_t _baseVertex = 0);
+		void bindAttributes(const VertexLayout& _layout, uint32_t _baseVertex = 0, uint32_t _offset = 0);
 		void bindInstanceData(uint32_t _stride, uint32_t _baseVertex = 0) const;
 		void bindAttributesEnd();
 		void unbindInstanceData() const;
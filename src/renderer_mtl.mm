@@ -485,6 +485,7 @@ BX_STATIC_ASSERT(BX_COUNTOF(s_accessNames) == Access::Count, "Invalid s_accessNa
 			, m_rtMsaa(false)
 			, m_capture(NULL)
 			, m_captureSize(0)
+			, m_readbackSize(0)
 		{
 			bx::memSet(&m_windows, 0xff, sizeof(m_windows) );
 		}
@@ -916,6 +917,12 @@ BX_STATIC_ASSERT(BX_COUNTOF(s_accessNames) == Access::Count, "Invalid s_accessNa
 
 			captureFinish();
 
+			if (0 < m_readbackSize)
+			{
+				MTL_RELEASE(m_readback);
+				m_readbackSize = 0;
+			}
+
 			MTL_RELEASE(m_depthStencilDescriptor);
 			MTL_RELEASE(m_frontFaceStencilDescriptor);
 			MTL_RELEASE(m_backFaceStencilDescriptor);
@@ -1016,6 +1023,48 @@ BX_STATIC_ASSERT(BX_COUNTOF(s_accessNames) == Access::Count, "Invalid s_accessNa
 			m_vertexBuffers[_handle.idx].destroy();
 		}
 
+		bool readBuffer(IndexBufferHandle _handle, uint32_t _offset, uint32_t _size, void* _data) override
+		{
+			readBuffer(m_indexBuffers[_handle.idx], _offset, _size, _data);
+			return true;
+		}
+
+		bool readBuffer(VertexBufferHandle _handle, uint32_t _offset, uint32_t _size, void* _data) override
+		{
+			readBuffer(m_vertexBuffers[_handle.idx], _offset, _size, _data);
+			return true;
+		}
+
+		void readBuffer(const BufferMtl& _buffer, uint32_t _offset, uint32_t _size, void* _data)
+		{
+			if (0 == _size)
+			{
+				return;
+			}
+
+			// Read back buffer is reused by all buffer read backs, and only grows. Command
+			// buffer is waited on before reading, so buffer is never in use by GPU when replaced.
+			if (m_readbackSize < _size)
+			{
+				if (0 < m_readbackSize)
+				{
+					MTL_RELEASE(m_readback);
+				}
+
+				m_readbackSize = bx::uint32_nextpow2(_size);
+				m_readback     = m_device.newBufferWithLength(m_readbackSize, 0);
+			}
+
+			BlitCommandEncoder bce = getBlitCommandEncoder();
+			bce.copyFromBuffer(_buffer.m_ptr, _offset, m_readback, 0, _size);
+			endEncoding();
+
+			m_cmd.kick(false, true);
+			m_commandBuffer = m_cmd.alloc();
+
+			bx::memCopy(_data, m_readback.contents(), _size);
+		}
+
 		void createShader(ShaderHandle _handle, const Memory* _mem) override
 		{
 			m_shaders[_handle.idx].create(_mem);
@@ -1081,6 +1130,11 @@ BX_STATIC_ASSERT(BX_COUNTOF(s_accessNames) == Access::Count, "Invalid s_accessNa
 			return swapChain->m_metalLayer.pixelFormat;
 		}
 
+		bool readTextureAsync(TextureHandle /*_handle*/, void* /*_data*/, uint8_t /*_mip*/, uint32_t /*_ticket*/) override
+		{
+			return false;
+		}
+
 		void readTexture(TextureHandle _handle, void* _data, uint8_t _mip) override
 		{
 			const TextureMtl& texture = m_textures[_handle.idx];
@@ -1137,6 +1191,46 @@ BX_STATIC_ASSERT(BX_COUNTOF(s_accessNames) == Access::Count, "Invalid s_accessNa
 			release(mem);
 		}
 
+		void resizeTextureMips(TextureHandle _handle, uint16_t _width, uint16_t _height, uint8_t _numMips, int8_t _srcMip) override
+		{
+			TextureMtl& texture = m_textures[_handle.idx];
+
+			// Old texture is detached, and its release is deferred until mips that stay
+			// resident are copied from it.
+			Texture src = texture.m_ptr;
+			const uint8_t srcNumMips = texture.m_numMips;
+			texture.m_ptr = NULL;
+
+			resizeTexture(_handle, _width, _height, _numMips, 1);
+
+			BlitCommandEncoder bce = getBlitCommandEncoder();
+
+			for (uint8_t mip = 0; mip < _numMips; ++mip)
+			{
+				const int32_t srcMip = mip + _srcMip;
+
+				if (0 <= srcMip
+				&&  srcMip < srcNumMips)
+				{
+					bce.copyFromTexture(
+						  src
+						, 0
+						, srcMip
+						, MTLOriginMake(0, 0, 0)
+						, MTLSizeMake(bx::max(1, _width >> mip), bx::max(1, _height >> mip), 1)
+						, texture.m_ptr
+						, 0
+						, mip
+						, MTLOriginMake(0, 0, 0)
+						);
+				}
+			}
+
+			endEncoding();
+
+			m_cmd.release(src);
+		}
+
 		void overrideInternal(TextureHandle _handle, uintptr_t _ptr) override
 		{
 			m_textures[_handle.idx].overrideInternal(_ptr);
@@ -1282,6 +1376,14 @@ BX_STATIC_ASSERT(BX_COUNTOF(s_accessNames) == Access::Count, "Invalid s_accessNa
 			m_occlusionQuery.invalidate(_handle);
 		}
 
+		void warmPipeline(FrameBufferHandle /*_fbh*/, ProgramHandle /*_program*/, const VertexLayout& /*_layout*/, uint64_t /*_state*/, uint64_t /*_stencil*/) override
+		{
+		}
+
+		void flushPipelineCache() override
+		{
+		}
+
 		void setMarker(const char* _marker, uint16_t _len) override
 		{
 			BX_UNUSED(_len);
@@ -1559,6 +1661,7 @@ BX_STATIC_ASSERT(BX_COUNTOF(s_accessNames) == Access::Count, "Invalid s_accessNa
 				| BGFX_RESET_MAXANISOTROPY
 				| BGFX_RESET_DEPTH_CLAMP
 				| BGFX_RESET_SUSPEND
+				| BGFX_RESET_ASYNC_PIPELINE
 				);
 
 			if (m_resolution.width            !=  _resolution.width
@@ -2794,6 +2897,9 @@ BX_STATIC_ASSERT(BX_COUNTOF(s_accessNames) == Access::Count, "Invalid s_accessNa
 		Resolution m_resolution;
 		void* m_capture;
 		uint32_t m_captureSize;
+
+		Buffer   m_readback;
+		uint32_t m_readbackSize;
 #if BX_PLATFORM_VISIONOS
 		ar_session_t m_arSession;
 		ar_world_tracking_provider_t m_worldTracking;
@@ -4345,6 +4451,7 @@ BX_STATIC_ASSERT(BX_COUNTOF(s_accessNames) == Access::Count, "Invalid s_accessNa
 
 		RenderBind currentBind;
 		currentBind.clear();
+		uint16_t currentBindIdx = kInvalidHandle;
 
 		static ViewState viewState;
 		viewState.reset(_render);
@@ -4405,8 +4512,9 @@ BX_STATIC_ASSERT(BX_COUNTOF(s_accessNames) == Access::Count, "Invalid s_accessNa
 					;
 
 				const uint32_t itemIdx       = _render->m_sortValues[item];
-				const RenderItem& renderItem = _render->m_renderItem[itemIdx];
-				const RenderBind& renderBind = _render->m_renderItemBind[itemIdx];
+				const RenderItem& renderItem = _render->getRenderItem(itemIdx);
+				const uint16_t bindIdx       = isCompute ? renderItem.compute.m_bindIdx : renderItem.draw.m_bindIdx;
+				const RenderBind& renderBind = _render->getRenderBind(bindIdx);
 				++item;
 
 				if (viewChanged
@@ -4831,6 +4939,7 @@ BX_STATIC_ASSERT(BX_COUNTOF(s_accessNames) == Access::Count, "Invalid s_accessNa
 							currentState.clear();
 							currentState.m_scissor = !draw.m_scissor;
 							currentBind.clear();
+							currentBindIdx = kInvalidHandle;
 						}
 
 						continue;
@@ -4855,6 +4964,7 @@ BX_STATIC_ASSERT(BX_COUNTOF(s_accessNames) == Access::Count, "Invalid s_accessNa
 					currentState.m_stencil    = newStencil;
 
 					currentBind.clear();
+					currentBindIdx = kInvalidHandle;
 
 					currentProgram = BGFX_INVALID_HANDLE;
 					setDepthStencilState(newFlags, packStencil(BGFX_STENCIL_DEFAULT, BGFX_STENCIL_DEFAULT) );
@@ -4965,6 +5075,7 @@ BX_STATIC_ASSERT(BX_COUNTOF(s_accessNames) == Access::Count, "Invalid s_accessNa
 
 				bool programChanged = false;
 				rendererUpdateUniforms(this, _render->m_uniformBuffer[draw.m_uniformIdx], draw.m_uniformBegin, draw.m_uniformEnd);
+				rendererUpdateUniformBlock(this, _render, draw);
 
 				bool vertexStreamChanged = hasVertexStreamChanged(currentState, draw);
 
@@ -5106,8 +5217,11 @@ BX_STATIC_ASSERT(BX_COUNTOF(s_accessNames) == Access::Count, "Invalid s_accessNa
 					m_uniformBufferVertexOffset    = m_uniformBufferFragmentOffset;
 				}
 
-				if (isValid(currentProgram) )
+				if (isValid(currentProgram)
+				&& (programChanged || currentBindIdx != bindIdx) )
 				{
+					currentBindIdx = bindIdx;
+
 					uint8_t* bindingTypes = currentPso->m_bindingTypes;
 					for (uint8_t stage = 0; stage < maxTextureSamplers; ++stage)
 					{
@@ -9,8 +9,14 @@ namespace bgfx { namespace noop
 {
 	struct RendererContextNOOP : public RendererContextI
 	{
-		RendererContextNOOP()
+		RendererContextNOOP(bool _counting)
+			: m_counting(_counting)
+			, m_numUniformUpdates(0)
+			, m_numUniformRedundant(0)
 		{
+			bx::memSet(m_uniforms, 0, sizeof(m_uniforms) );
+			bx::memSet(m_viewName, 0, sizeof(m_viewName) );
+
 			// Pretend all features are available.
 			g_caps.supported = 0
 				| BGFX_CAPS_ALPHA_TO_COVERAGE
@@ -79,6 +85,10 @@ namespace bgfx { namespace noop
 
 		~RendererContextNOOP()
 		{
+			for (uint32_t ii = 0; ii < BX_COUNTOF(m_uniforms); ++ii)
+			{
+				bx::free(g_allocator, m_uniforms[ii]);
+			}
 		}
 
 		RendererType::Enum getRendererType() const override
@@ -148,6 +158,16 @@ namespace bgfx { namespace noop
 		{
 		}
 
+		bool readBuffer(IndexBufferHandle /*_handle*/, uint32_t /*_offset*/, uint32_t /*_size*/, void* /*_data*/) override
+		{
+			return false;
+		}
+
+		bool readBuffer(VertexBufferHandle /*_handle*/, uint32_t /*_offset*/, uint32_t /*_size*/, void* /*_data*/) override
+		{
+			return false;
+		}
+
 		void createShader(ShaderHandle /*_handle*/, const Memory* /*_mem*/) override
 		{
 		}
@@ -181,6 +201,11 @@ namespace bgfx { namespace noop
 		{
 		}
 
+		bool readTextureAsync(TextureHandle /*_handle*/, void* /*_data*/, uint8_t /*_mip*/, uint32_t /*_ticket*/) override
+		{
+			return false;
+		}
+
 		void readTexture(TextureHandle /*_handle*/, void* /*_data*/, uint8_t /*_mip*/) override
 		{
 		}
@@ -189,6 +214,10 @@ namespace bgfx { namespace noop
 		{
 		}
 
+		void resizeTextureMips(TextureHandle /*_handle*/, uint16_t /*_width*/, uint16_t /*_height*/, uint8_t /*_numMips*/, int8_t /*_srcMip*/) override
+		{
+		}
+
 		void overrideInternal(TextureHandle /*_handle*/, uintptr_t /*_ptr*/) override
 		{
 		}
@@ -214,30 +243,65 @@ namespace bgfx { namespace noop
 		{
 		}
 
-		void createUniform(UniformHandle /*_handle*/, UniformType::Enum /*_type*/, uint16_t /*_num*/, const char* /*_name*/) override
+		void createUniform(UniformHandle _handle, UniformType::Enum _type, uint16_t _num, const char* /*_name*/) override
 		{
+			if (m_counting)
+			{
+				bx::free(g_allocator, m_uniforms[_handle.idx]);
+
+				const uint32_t size = g_uniformTypeSize[_type]*_num;
+				void* data = bx::alloc(g_allocator, size);
+				bx::memSet(data, 0, size);
+				m_uniforms[_handle.idx] = data;
+			}
 		}
 
-		void destroyUniform(UniformHandle /*_handle*/) override
+		void destroyUniform(UniformHandle _handle) override
 		{
+			bx::free(g_allocator, m_uniforms[_handle.idx]);
+			m_uniforms[_handle.idx] = NULL;
 		}
 
 		void requestScreenShot(FrameBufferHandle /*_handle*/, const char* /*_filePath*/) override
 		{
 		}
 
-		void updateViewName(ViewId /*_id*/, const char* /*_name*/) override
+		void updateViewName(ViewId _id, const char* _name) override
 		{
+			bx::strCopy(m_viewName[_id], BX_COUNTOF(m_viewName[0]), _name);
 		}
 
-		void updateUniform(uint16_t /*_loc*/, const void* /*_data*/, uint32_t /*_size*/) override
+		void updateUniform(uint16_t _loc, const void* _data, uint32_t _size) override
 		{
+			void* uniform = m_uniforms[_loc];
+
+			if (NULL != uniform)
+			{
+				if (0 == bx::memCmp(uniform, _data, _size) )
+				{
+					++m_numUniformRedundant;
+				}
+				else
+				{
+					bx::memCopy(uniform, _data, _size);
+				}
+
+				++m_numUniformUpdates;
+			}
 		}
 
 		void invalidateOcclusionQuery(OcclusionQueryHandle /*_handle*/) override
 		{
 		}
 
+		void warmPipeline(FrameBufferHandle /*_fbh*/, ProgramHandle /*_program*/, const VertexLayout& /*_layout*/, uint64_t /*_state*/, uint64_t /*_stencil*/) override
+		{
+		}
+
+		void flushPipelineCache() override
+		{
+		}
+
 		void setMarker(const char* /*_marker*/, uint16_t /*_len*/) override
 		{
 		}
@@ -251,9 +315,19 @@ namespace bgfx { namespace noop
 			const int64_t timerFreq = bx::getHPFrequency();
 			const int64_t timeBegin = bx::getHPCounter();
 
+			_render->sort();
+
 			Stats& perfStats = _render->m_perfStats;
+
+			if (m_counting)
+			{
+				count(_render, perfStats);
+			}
+
+			const int64_t timeEnd = bx::getHPCounter();
+
 			perfStats.cpuTimeBegin  = timeBegin;
-			perfStats.cpuTimeEnd    = timeBegin;
+			perfStats.cpuTimeEnd    = timeEnd;
 			perfStats.cpuTimerFreq  = timerFreq;
 
 			perfStats.gpuTimeBegin  = 0;
@@ -267,6 +341,153 @@ namespace bgfx { namespace noop
 			perfStats.gpuMemoryUsed = -INT64_MAX;
 		}
 
+		// Walks sorted frame the same way as other renderers do, decodes uniforms, and counts
+		// state, program, and binding changes that would reach graphics API, in total and per
+		// view.
+		void count(Frame* _render, Stats& _perfStats)
+		{
+			BGFX_PROFILER_SCOPE("bgfx/Noop count", 0xff2040ff);
+
+			m_numUniformUpdates   = 0;
+			m_numUniformRedundant = 0;
+
+			RenderDraw currentState;
+			currentState.clear();
+			currentState.m_stateFlags = BGFX_STATE_NONE;
+			currentState.m_stencil    = packStencil(BGFX_STENCIL_NONE, BGFX_STENCIL_NONE);
+
+			RenderBind currentBind;
+			currentBind.clear();
+			uint16_t currentBindIdx = kInvalidHandle;
+
+			ProgramHandle currentProgram = BGFX_INVALID_HANDLE;
+			SortKey key;
+			uint16_t view = UINT16_MAX;
+			bool wasCompute = false;
+
+			uint32_t statsKeyType[2] = {};
+			uint32_t numStateChanges   = 0;
+			uint32_t numProgramChanges = 0;
+			uint32_t numBindChanges    = 0;
+
+			ViewStats* viewStats = NULL;
+			uint16_t   numViews  = 0;
+
+			for (uint32_t item = 0, numItems = _render->m_numRenderItems; item < numItems; ++item)
+			{
+				const uint64_t encodedKey = _render->m_sortKeys[item];
+				const bool isCompute = key.decode(encodedKey, _render->m_viewRemap);
+				statsKeyType[isCompute]++;
+
+				const bool viewChanged = key.m_view != view;
+
+				const uint32_t itemIdx       = _render->m_sortValues[item];
+				const RenderItem& renderItem = _render->getRenderItem(itemIdx);
+				const uint16_t bindIdx       = isCompute ? renderItem.compute.m_bindIdx : renderItem.draw.m_bindIdx;
+				const RenderBind& renderBind = _render->getRenderBind(bindIdx);
+
+				if (viewChanged)
+				{
+					view = key.m_view;
+					currentProgram = BGFX_INVALID_HANDLE;
+
+					viewStats = &_perfStats.viewStats[numViews++];
+					viewStats->view = key.m_view;
+					bx::strCopy(viewStats->name, BX_COUNTOF(viewStats->name), m_viewName[key.m_view]);
+					viewStats->cpuTimeBegin      = 0;
+					viewStats->cpuTimeEnd        = 0;
+					viewStats->gpuTimeBegin      = 0;
+					viewStats->gpuTimeEnd        = 0;
+					viewStats->gpuFrameNum       = 0;
+					viewStats->numStateChanges   = 0;
+					viewStats->numProgramChanges = 0;
+					viewStats->numBindChanges    = 0;
+				}
+
+				const bool resetState = viewChanged || wasCompute != isCompute;
+				wasCompute = isCompute;
+
+				if (resetState)
+				{
+					currentState.clear();
+					currentBind.clear();
+					currentBindIdx = kInvalidHandle;
+				}
+
+				if (isCompute)
+				{
+					const RenderCompute& compute = renderItem.compute;
+					rendererUpdateUniforms(this, _render->m_uniformBuffer[compute.m_uniformIdx], compute.m_uniformBegin, compute.m_uniformEnd);
+				}
+				else
+				{
+					const RenderDraw& draw = renderItem.draw;
+					rendererUpdateUniforms(this, _render->m_uniformBuffer[draw.m_uniformIdx], draw.m_uniformBegin, draw.m_uniformEnd);
+					rendererUpdateUniformBlock(this, _render, draw);
+
+					if (resetState
+					||  currentState.m_stateFlags != draw.m_stateFlags
+					||  currentState.m_stencil    != draw.m_stencil
+					||  currentState.m_rgba       != draw.m_rgba
+					||  currentState.m_scissor    != draw.m_scissor)
+					{
+						currentState.m_stateFlags = draw.m_stateFlags;
+						currentState.m_stencil    = draw.m_stencil;
+						currentState.m_rgba       = draw.m_rgba;
+						currentState.m_scissor    = draw.m_scissor;
+						++numStateChanges;
+						++viewStats->numStateChanges;
+					}
+				}
+
+				bool programChanged = false;
+
+				if (key.m_program.idx != currentProgram.idx)
+				{
+					currentProgram = key.m_program;
+					programChanged = true;
+					++numProgramChanges;
+					++viewStats->numProgramChanges;
+				}
+
+				if (programChanged
+				||  currentBindIdx != bindIdx)
+				{
+					currentBindIdx = bindIdx;
+
+					for (uint32_t stage = 0; stage < BGFX_CONFIG_MAX_TEXTURE_SAMPLERS; ++stage)
+					{
+						const Binding& bind = renderBind.m_bind[stage];
+						Binding& current = currentBind.m_bind[stage];
+
+						if (current.m_idx          != bind.m_idx
+						||  current.m_type         != bind.m_type
+						||  current.m_samplerFlags != bind.m_samplerFlags
+						||  programChanged)
+						{
+							if (kInvalidHandle != bind.m_idx)
+							{
+								++numBindChanges;
+								++viewStats->numBindChanges;
+							}
+						}
+
+						current = bind;
+					}
+				}
+			}
+
+			_perfStats.numDraw             = statsKeyType[0];
+			_perfStats.numCompute          = statsKeyType[1];
+			_perfStats.numBlit             = _render->m_numBlitItems;
+			_perfStats.numStateChanges     = numStateChanges;
+			_perfStats.numProgramChanges   = numProgramChanges;
+			_perfStats.numBindChanges      = numBindChanges;
+			_perfStats.numUniformUpdates   = m_numUniformUpdates;
+			_perfStats.numUniformRedundant = m_numUniformRedundant;
+			_perfStats.numViews            = numViews;
+		}
+
 		void blitSetup(TextVideoMemBlitter& /*_blitter*/) override
 		{
 		}
@@ -274,14 +495,21 @@ namespace bgfx { namespace noop
 		void blitRender(TextVideoMemBlitter& /*_blitter*/, uint32_t /*_numIndices*/) override
 		{
 		}
+
+		void* m_uniforms[BGFX_CONFIG_MAX_UNIFORMS];
+		char m_viewName[BGFX_CONFIG_MAX_VIEWS][BGFX_CONFIG_MAX_VIEW_NAME];
+		bool m_counting;
+		uint32_t m_numUniformUpdates;
+		uint32_t m_numUniformRedundant;
 	};
 
 	static RendererContextNOOP* s_renderNOOP;
 
 	RendererContextI* rendererCreate(const Init& _init)
 	{
-		BX_UNUSED(_init);
-		s_renderNOOP = BX_NEW(g_allocator, RendererContextNOOP);
+		// Profiling Noop renderer walks each frame and counts state changes, so that CPU side of
+		// render thread can be measured without graphics API.
+		s_renderNOOP = BX_NEW(g_allocator, RendererContextNOOP)(_init.noopCounting);
 		return s_renderNOOP;
 	}
 
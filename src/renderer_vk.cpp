@@ -1130,20 +1130,68 @@ VK_IMPORT_DEVICE
 			);
 	}
 
+#define BGFX_PIPELINE_CACHE_MAGIC   BX_MAKEFOURCC('V', 'K', 'P', 'C')
+#define BGFX_PIPELINE_CACHE_VERSION 1
+
+	struct PipelineCacheHeaderVK
+	{
+		uint32_t m_magic;
+		uint32_t m_version;
+		uint32_t m_vendorId;
+		uint32_t m_deviceId;
+		uint32_t m_driverVersion;
+		uint8_t  m_uuid[VK_UUID_SIZE];
+		uint32_t m_size;
+	};
+
+	static void initPipelineCacheHeader(PipelineCacheHeaderVK& _header, const VkPhysicalDeviceProperties& _properties, uint32_t _size)
+	{
+		bx::memSet(&_header, 0, sizeof(_header) );
+		_header.m_magic         = BGFX_PIPELINE_CACHE_MAGIC;
+		_header.m_version       = BGFX_PIPELINE_CACHE_VERSION;
+		_header.m_vendorId      = _properties.vendorID;
+		_header.m_deviceId      = _properties.deviceID;
+		_header.m_driverVersion = _properties.driverVersion;
+		bx::memCopy(_header.m_uuid, _properties.pipelineCacheUUID, VK_UUID_SIZE);
+		_header.m_size          = _size;
+	}
+
+	static uint64_t getPipelineCacheId(const VkPhysicalDeviceProperties& _properties)
+	{
+		bx::HashMurmur2A murmur;
+		murmur.begin();
+		murmur.add(BGFX_PIPELINE_CACHE_MAGIC);
+		murmur.add(_properties.vendorID);
+		murmur.add(_properties.deviceID);
+		const uint64_t hash = murmur.end();
+
+		return (uint64_t(BGFX_PIPELINE_CACHE_MAGIC) << 32) | hash;
+	}
+
 #define MAX_DESCRIPTOR_SETS (1024 * BGFX_CONFIG_MAX_FRAME_LATENCY)
 
 	struct RendererContextVK : public RendererContextI
 	{
 		RendererContextVK()
 			: m_allocatorCb(NULL)
+			, m_pipelineCacheId(0)
+			, m_pipelineCacheIdleFrames(0)
+			, m_pipelineCacheDirty(false)
+			, m_multiDrawBuffer(VK_NULL_HANDLE)
+			, m_multiDrawCmdOffset(0)
+			, m_multiDrawSupport(false)
 			, m_renderDocDll(NULL)
 			, m_vulkan1Dll(NULL)
 			, m_maxAnisotropy(1.0f)
 			, m_depthClamp(false)
 			, m_wireframe(false)
+			, m_asyncPipeline(false)
 			, m_captureBuffer(VK_NULL_HANDLE)
 			, m_captureMemory(VK_NULL_HANDLE)
 			, m_captureSize(0)
+			, m_readbackBuffer(VK_NULL_HANDLE)
+			, m_readbackMemory(VK_NULL_HANDLE)
+			, m_readbackSize(0)
 		{
 		}
 
@@ -1181,6 +1229,8 @@ VK_IMPORT_DEVICE
 
 			m_fbh.idx = kInvalidHandle;
 			bx::memSet(m_uniforms, 0, sizeof(m_uniforms) );
+			bx::memSet(m_uniformSize, 0, sizeof(m_uniformSize) );
+			m_record.m_uniforms = m_uniforms;
 			bx::memSet(&m_resolution, 0, sizeof(m_resolution) );
 
 			bool imported = true;
@@ -1744,6 +1794,7 @@ VK_IMPORT_INSTANCE
 				}
 
 				vkGetPhysicalDeviceMemoryProperties(m_physicalDevice, &m_memoryProperties);
+				m_memoryAllocator.init(BGFX_CONFIG_DEVICE_MEMORY_BLOCK_SIZE);
 			}
 
 			{
@@ -1991,14 +2042,59 @@ VK_IMPORT_DEVICE
 					goto error;
 				}
 
+				m_pipelineCacheId = getPipelineCacheId(m_deviceProperties);
+				m_pipelineCacheDirty = false;
+				m_pipelineCacheIdleFrames = 0;
+
+				void* cachedData = NULL;
+
 				VkPipelineCacheCreateInfo pcci;
 				pcci.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
 				pcci.pNext = NULL;
 				pcci.flags = 0;
 				pcci.initialDataSize = 0;
 				pcci.pInitialData    = NULL;
+
+				const uint32_t length = g_callback->cacheReadSize(m_pipelineCacheId);
+
+				if (sizeof(PipelineCacheHeaderVK) < length)
+				{
+					cachedData = bx::alloc(g_allocator, length);
+
+					if (g_callback->cacheRead(m_pipelineCacheId, cachedData, length) )
+					{
+						PipelineCacheHeaderVK expected;
+						initPipelineCacheHeader(expected, m_deviceProperties, uint32_t(length - sizeof(PipelineCacheHeaderVK) ) );
+
+						if (0 == bx::memCmp(cachedData, &expected, sizeof(PipelineCacheHeaderVK) ) )
+						{
+							BX_TRACE("Loading cached pipeline state (size %d).", expected.m_size);
+							pcci.initialDataSize = expected.m_size;
+							pcci.pInitialData    = (const uint8_t*)cachedData + sizeof(PipelineCacheHeaderVK);
+						}
+						else
+						{
+							BX_TRACE("Cached pipeline state doesn't match device or driver, ignoring.");
+						}
+					}
+				}
+
 				result = vkCreatePipelineCache(m_device, &pcci, m_allocatorCb, &m_pipelineCache);
 
+				if (VK_SUCCESS != result
+				&&  0 != pcci.initialDataSize)
+				{
+					BX_TRACE("Cached pipeline state rejected by driver %d: %s.", result, getName(result) );
+					pcci.initialDataSize = 0;
+					pcci.pInitialData    = NULL;
+					result = vkCreatePipelineCache(m_device, &pcci, m_allocatorCb, &m_pipelineCache);
+				}
+
+				if (NULL != cachedData)
+				{
+					bx::free(g_allocator, cachedData);
+				}
+
 				if (VK_SUCCESS != result)
 				{
 					BX_TRACE("Init error: vkCreatePipelineCache failed %d: %s.", result, getName(result) );
@@ -2008,7 +2104,7 @@ VK_IMPORT_DEVICE
 
 			{
 				const uint32_t size = 128;
-				const uint32_t count = BGFX_CONFIG_MAX_DRAW_CALLS;
+				const uint32_t count = g_caps.limits.maxDrawCalls;
 
 				for (uint32_t ii = 0; ii < m_numFramesInFlight; ++ii)
 				{
@@ -2021,10 +2117,31 @@ VK_IMPORT_DEVICE
 					BX_TRACE("Create scratch staging buffer %d", ii);
 					m_scratchStagingBuffer[ii].createStaging(BGFX_CONFIG_PER_FRAME_SCRATCH_STAGING_BUFFER_SIZE);
 				}
+
+				// Multi-draw needs non-zero first instance in indirect draw arguments.
+				m_multiDrawSupport = 0 != (g_caps.supported & BGFX_CAPS_DRAW_INDIRECT);
+
+				for (uint32_t ii = 0, num = m_multiDrawSupport ? m_numFramesInFlight : 0; ii < num; ++ii)
+				{
+					BX_TRACE("Create scratch multi-draw buffer %d", ii);
+					m_scratchMultiDrawBuffer[ii].createMultiDraw(count);
+				}
 			}
 
 			errorState = ErrorState::DescriptorCreated;
 
+			result = m_recordThreadPool.init(_init.limits.numRecordThreads, m_numFramesInFlight);
+
+			if (VK_SUCCESS != result)
+			{
+				BX_TRACE("Init error: creating record threads failed %d: %s.", result, getName(result) );
+				goto error;
+			}
+
+			g_caps.limits.numRecordThreads = m_recordThreadPool.getNumThreads();
+
+			m_pipelineCompiler.init();
+
 			if (NULL == vkSetDebugUtilsObjectNameEXT)
 			{
 				vkSetDebugUtilsObjectNameEXT = stubSetDebugUtilsObjectNameEXT;
@@ -2084,11 +2201,19 @@ VK_IMPORT_DEVICE
 				[[fallthrough]];
 
 			case ErrorState::DescriptorCreated:
+				m_pipelineCompiler.shutdown();
+				m_recordThreadPool.shutdown();
+
 				for (uint32_t ii = 0; ii < m_numFramesInFlight; ++ii)
 				{
 					m_scratchBuffer[ii].destroy();
 					m_scratchStagingBuffer[ii].destroy();
 				}
+
+				for (uint32_t ii = 0, num = m_multiDrawSupport ? m_numFramesInFlight : 0; ii < num; ++ii)
+				{
+					m_scratchMultiDrawBuffer[ii].destroy();
+				}
 				vkDestroy(m_pipelineCache);
 				vkDestroy(m_descriptorPool);
 				[[fallthrough]];
@@ -2099,6 +2224,7 @@ VK_IMPORT_DEVICE
 
 			case ErrorState::CommandQueueCreated:
 				m_cmd.shutdown();
+				m_memoryAllocator.shutdown();
 				[[fallthrough]];
 
 			case ErrorState::DeviceCreated:
@@ -2132,12 +2258,17 @@ VK_IMPORT_DEVICE
 		{
 			VK_CHECK(vkDeviceWaitIdle(m_device) );
 
+			completeTextureReadbacks(UINT64_MAX);
+
 			if (m_timerQuerySupport)
 			{
 				m_gpuTimer.shutdown();
 			}
 			m_occlusionQuery.shutdown();
 
+			m_pipelineCompiler.shutdown();
+			m_recordThreadPool.shutdown();
+
 			preReset();
 
 			m_pipelineStateCache.invalidate();
@@ -2157,6 +2288,11 @@ VK_IMPORT_DEVICE
 				m_scratchStagingBuffer[ii].destroy();
 			}
 
+			for (uint32_t ii = 0, num = m_multiDrawSupport ? m_numFramesInFlight : 0; ii < num; ++ii)
+			{
+				m_scratchMultiDrawBuffer[ii].destroy();
+			}
+
 			for (uint32_t ii = 0; ii < BX_COUNTOF(m_frameBuffers); ++ii)
 			{
 				m_frameBuffers[ii].destroy();
@@ -2182,10 +2318,19 @@ VK_IMPORT_DEVICE
 				m_textures[ii].destroy();
 			}
 
+			if (0 < m_readbackSize)
+			{
+				release(m_readbackBuffer);
+				release(m_readbackMemory);
+				m_readbackSize = 0;
+			}
+
 			m_backBuffer.destroy();
 
 			m_cmd.shutdown();
+			m_memoryAllocator.shutdown();
 
+			flushPipelineCache();
 			vkDestroy(m_pipelineCache);
 			vkDestroy(m_descriptorPool);
 
@@ -2300,6 +2445,64 @@ VK_IMPORT_DEVICE
 			m_vertexBuffers[_handle.idx].destroy();
 		}
 
+		bool readBuffer(IndexBufferHandle _handle, uint32_t _offset, uint32_t _size, void* _data) override
+		{
+			readBuffer(m_indexBuffers[_handle.idx], _offset, _size, _data);
+			return true;
+		}
+
+		bool readBuffer(VertexBufferHandle _handle, uint32_t _offset, uint32_t _size, void* _data) override
+		{
+			readBuffer(m_vertexBuffers[_handle.idx], _offset, _size, _data);
+			return true;
+		}
+
+		void readBuffer(const BufferVK& _buffer, uint32_t _offset, uint32_t _size, void* _data)
+		{
+			if (0 == _size)
+			{
+				return;
+			}
+
+			// Read back buffer is reused by all buffer read backs, and only grows.
+			if (m_readbackSize < _size)
+			{
+				if (0 < m_readbackSize)
+				{
+					release(m_readbackBuffer);
+					release(m_readbackMemory);
+				}
+
+				m_readbackSize = bx::uint32_nextpow2(_size);
+				VK_CHECK(createReadbackBuffer(m_readbackSize, &m_readbackBuffer, &m_readbackMemory) );
+			}
+
+			setMemoryBarrier(
+				  m_commandBuffer
+				, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT
+				, VK_PIPELINE_STAGE_TRANSFER_BIT
+				);
+
+			VkBufferCopy region;
+			region.srcOffset = _offset;
+			region.dstOffset = 0;
+			region.size      = _size;
+			vkCmdCopyBuffer(m_commandBuffer, _buffer.m_buffer, m_readbackBuffer, 1, &region);
+
+			setMemoryBarrier(
+				  m_commandBuffer
+				, VK_PIPELINE_STAGE_TRANSFER_BIT
+				, VK_PIPELINE_STAGE_HOST_BIT
+				);
+
+			kick(true);
+
+			uint8_t* src;
+			VK_CHECK(vkMapMemory(m_device, m_readbackMemory, 0, _size, 0, (void**)&src) );
+			bx::memCopy(_data, src, _size);
+			vkUnmapMemory(m_device, m_readbackMemory);
+		}
+
 		void createShader(ShaderHandle _handle, const Memory* _mem) override
 		{
 			m_shaders[_handle.idx].create(_mem);
@@ -2307,6 +2510,7 @@ VK_IMPORT_DEVICE
 
 		void destroyShader(ShaderHandle _handle) override
 		{
+			m_pipelineCompiler.wait();
 			m_shaders[_handle.idx].destroy();
 		}
 
@@ -2317,6 +2521,7 @@ VK_IMPORT_DEVICE
 
 		void destroyProgram(ProgramHandle _handle) override
 		{
+			m_pipelineCompiler.wait();
 			m_program[_handle.idx].destroy();
 		}
 
@@ -2338,6 +2543,63 @@ VK_IMPORT_DEVICE
 		{
 		}
 
+		bool readTextureAsync(TextureHandle _handle, void* _data, uint8_t _mip, uint32_t _ticket) override
+		{
+			TextureVK& texture = m_textures[_handle.idx];
+
+			const uint32_t height = bx::uint32_max(1, texture.m_height >> _mip);
+			const uint32_t size   = height * texture.m_readback.pitch(_mip);
+
+			TextureReadbackVK readback;
+			readback.m_readback  = texture.m_readback;
+			readback.m_data      = _data;
+			readback.m_submitted = m_cmd.m_submitted;
+			readback.m_ticket    = _ticket;
+			readback.m_mip       = _mip;
+
+			if (VK_SUCCESS != createReadbackBuffer(size, &readback.m_buffer, &readback.m_memory) )
+			{
+				return false;
+			}
+
+			texture.m_readback.copyImageToBuffer(
+				  m_commandBuffer
+				, readback.m_buffer
+				, texture.m_currentImageLayout
+				, texture.m_aspectMask
+				, _mip
+				);
+
+			m_textureReadback.push_back(readback);
+
+			return true;
+		}
+
+		// Completes texture read backs recorded into first `_numSubmitted` command buffers.
+		void completeTextureReadbacks(uint64_t _numSubmitted)
+		{
+			uint32_t num = 0;
+
+			for (uint32_t end = uint32_t(m_textureReadback.size() ); num < end; ++num)
+			{
+				TextureReadbackVK& readback = m_textureReadback[num];
+
+				if (readback.m_submitted >= _numSubmitted)
+				{
+					break;
+				}
+
+				readback.m_readback.readback(readback.m_memory, 0, readback.m_data, readback.m_mip);
+
+				vkDestroy(readback.m_buffer);
+				vkDestroy(readback.m_memory);
+
+				rendererReadbackComplete(readback.m_ticket);
+			}
+
+			m_textureReadback.erase(m_textureReadback.begin(), m_textureReadback.begin() + num);
+		}
+
 		void readTexture(TextureHandle _handle, void* _data, uint8_t _mip) override
 		{
 			TextureVK& texture = m_textures[_handle.idx];
@@ -2397,6 +2659,67 @@ VK_IMPORT_DEVICE
 			bgfx::release(mem);
 		}
 
+		void resizeTextureMips(TextureHandle _handle, uint16_t _width, uint16_t _height, uint8_t _numMips, int8_t _srcMip) override
+		{
+			TextureVK& texture = m_textures[_handle.idx];
+
+			// Release of old image is deferred until command buffer is executed, mips that stay
+			// resident are copied from it after resize.
+			const VkImage srcImage = texture.m_textureImage;
+			const VkImageLayout srcLayout = texture.m_currentImageLayout;
+			const uint8_t srcNumMips = texture.m_numMips;
+
+			resizeTexture(_handle, _width, _height, _numMips, 1);
+
+			setImageMemoryBarrier(
+				  m_commandBuffer
+				, srcImage
+				, texture.m_aspectMask
+				, srcLayout
+				, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL
+				);
+
+			texture.setImageMemoryBarrier(m_commandBuffer, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+
+			for (uint8_t mip = 0; mip < _numMips; ++mip)
+			{
+				const int32_t srcMip = mip + _srcMip;
+
+				if (0 > srcMip
+				||  srcMip >= srcNumMips)
+				{
+					continue;
+				}
+
+				VkImageCopy copyInfo;
+				copyInfo.srcSubresource.aspectMask     = texture.m_aspectMask;
+				copyInfo.srcSubresource.mipLevel       = uint32_t(srcMip);
+				copyInfo.srcSubresource.baseArrayLayer = 0;
+				copyInfo.srcSubresource.layerCount     = 1;
+				copyInfo.srcOffset = { 0, 0, 0 };
+				copyInfo.dstSubresource.aspectMask     = texture.m_aspectMask;
+				copyInfo.dstSubresource.mipLevel       = mip;
+				copyInfo.dstSubresource.baseArrayLayer = 0;
+				copyInfo.dstSubresource.layerCount     = 1;
+				copyInfo.dstOffset = { 0, 0, 0 };
+				copyInfo.extent.width  = bx::max<uint32_t>(1, _width  >> mip);
+				copyInfo.extent.height = bx::max<uint32_t>(1, _height >> mip);
+				copyInfo.extent.depth  = 1;
+
+				vkCmdCopyImage(
+					  m_commandBuffer
+					, srcImage
+					, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL
+					, texture.m_textureImage
+					, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL
+					, 1
+					, &copyInfo
+					);
+			}
+
+			texture.setImageMemoryBarrier(m_commandBuffer, texture.m_sampledLayout);
+		}
+
 		void overrideInternal(TextureHandle /*_handle*/, uintptr_t /*_ptr*/) override
 		{
 		}
@@ -2436,6 +2759,8 @@ VK_IMPORT_DEVICE
 
 		void destroyFrameBuffer(FrameBufferHandle _handle) override
 		{
+			m_pipelineCompiler.wait();
+
 			FrameBufferVK& frameBuffer = m_frameBuffers[_handle.idx];
 
 			if (_handle.idx == m_fbh.idx)
@@ -2471,6 +2796,7 @@ VK_IMPORT_DEVICE
 			void* data = bx::alloc(g_allocator, size);
 			bx::memSet(data, 0, size);
 			m_uniforms[_handle.idx] = data;
+			m_uniformSize[_handle.idx] = size;
 			m_uniformReg.add(_handle, _name);
 		}
 
@@ -2478,6 +2804,7 @@ VK_IMPORT_DEVICE
 		{
 			bx::free(g_allocator, m_uniforms[_handle.idx]);
 			m_uniforms[_handle.idx] = NULL;
+			m_uniformSize[_handle.idx] = 0;
 		}
 
 		void requestScreenShot(FrameBufferHandle _fbh, const char* _filePath) override
@@ -2539,6 +2866,14 @@ VK_IMPORT_DEVICE
 			m_occlusionQuery.invalidate(_handle);
 		}
 
+		void warmPipeline(FrameBufferHandle _fbh, ProgramHandle _program, const VertexLayout& _layout, uint64_t _state, uint64_t _stencil) override
+		{
+			const VertexLayout* layouts[1] = { &_layout };
+			const uint8_t numStreams = 0 != _layout.m_stride ? 1 : 0;
+
+			getPipeline(_state, _stencil, numStreams, layouts, _program, 0, _fbh, m_asyncPipeline);
+		}
+
 		void setMarker(const char* _marker, uint16_t _len) override
 		{
 			if (BX_ENABLED(BGFX_CONFIG_DEBUG_ANNOTATION) )
@@ -2601,8 +2936,23 @@ VK_IMPORT_DEVICE
 			}
 		}
 
+		void release(DeviceMemoryAllocationVK& _alloc)
+		{
+			if (VK_NULL_HANDLE != _alloc.m_mem)
+			{
+				m_cmd.release(_alloc);
+				_alloc = DeviceMemoryAllocationVK();
+			}
+		}
+
 		void submitBlit(BlitState& _bs, uint16_t _view);
 
+		Rect setViewRect(RecordStateVK& _rs, const Frame* _render, uint16_t _view, const FrameBufferVK& _fb);
+
+		void submitDraw(RecordStateVK& _rs, Frame* _render, const SortKey& _key, const RenderDraw& _draw, const RenderBind& _renderBind, uint32_t _renderBindHash, const MultiDrawRun* _multiDraw);
+
+		void recordDraws(RecordStateVK& _rs, Frame* _render, const RecordJobVK& _job);
+
 		void submit(Frame* _render, ClearQuad& _clearQuad, TextVideoMemBlitter& _textVideoMemBlitter) override;
 
 		void blitSetup(TextVideoMemBlitter& _blitter) override
@@ -2642,6 +2992,7 @@ VK_IMPORT_DEVICE
 				, &layout
 				, _blitter.m_program
 				, 0
+				, m_fbh
 				);
 			vkCmdBindPipeline(m_commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pso);
 
@@ -2651,17 +3002,17 @@ VK_IMPORT_DEVICE
 
 			PredefinedUniform& predefined = m_program[_blitter.m_program.idx].m_predefined[0];
 			uint8_t flags = predefined.m_type;
-			setShaderUniform(flags, predefined.m_loc, proj, 4);
+			m_record.setShaderUniform(flags, predefined.m_loc, proj, 4);
 
 			UniformBuffer* vcb = program.m_vsh->m_constantBuffer;
 
 			if (NULL != vcb)
 			{
-				commit(*vcb);
+				m_record.commit(*vcb);
 			}
 
 			ScratchBufferVK& scratchBuffer = m_scratchBuffer[m_cmd.m_currentFrameInFlight];
-			const uint32_t bufferOffset = scratchBuffer.write(m_vsScratch, program.m_vsh->m_size);
+			const uint32_t bufferOffset = scratchBuffer.write(m_record.m_vsScratch, program.m_vsh->m_size);
 
 			const TextureVK& texture = m_textures[_blitter.m_texture.idx];
 
@@ -2671,7 +3022,7 @@ VK_IMPORT_DEVICE
 			bind.m_bind[0].m_idx = _blitter.m_texture.idx;
 			bind.m_bind[0].m_samplerFlags = (uint32_t)(texture.m_flags & BGFX_SAMPLER_BITS_MASK);
 
-			const VkDescriptorSet descriptorSet = getDescriptorSet(program, bind, scratchBuffer, NULL);
+			const VkDescriptorSet descriptorSet = getDescriptorSet(program, bind, scratchBuffer, m_descriptorPool, NULL);
 
 			vkCmdBindDescriptorSets(
 				  m_commandBuffer
@@ -2727,6 +3078,8 @@ VK_IMPORT_DEVICE
 
 		void preReset()
 		{
+			m_pipelineCompiler.wait();
+
 			for (uint32_t ii = 0; ii < BX_COUNTOF(m_frameBuffers); ++ii)
 			{
 				m_frameBuffers[ii].preReset();
@@ -2791,10 +3144,13 @@ VK_IMPORT_DEVICE
 
 			if (m_depthClamp != depthClamp)
 			{
+				m_pipelineCompiler.wait();
 				m_depthClamp = depthClamp;
 				m_pipelineStateCache.invalidate();
 			}
 
+			m_asyncPipeline = !!(_resolution.reset & BGFX_RESET_ASYNC_PIPELINE);
+
 			if (NULL == m_backBuffer.m_nwh)
 			{
 				return suspended;
@@ -2804,6 +3160,7 @@ VK_IMPORT_DEVICE
 				| BGFX_RESET_SUSPEND
 				| BGFX_RESET_MAXANISOTROPY
 				| BGFX_RESET_DEPTH_CLAMP
+				| BGFX_RESET_ASYNC_PIPELINE
 				);
 
 			if (false
@@ -2841,28 +3198,6 @@ VK_IMPORT_DEVICE
 			return suspended;
 		}
 
-		void setShaderUniform(uint8_t _flags, uint32_t _regIndex, const void* _val, uint32_t _numRegs)
-		{
-			if (_flags & kUniformFragmentBit)
-			{
-				bx::memCopy(&m_fsScratch[_regIndex], _val, _numRegs*16);
-			}
-			else
-			{
-				bx::memCopy(&m_vsScratch[_regIndex], _val, _numRegs*16);
-			}
-		}
-
-		void setShaderUniform4f(uint8_t _flags, uint32_t _regIndex, const void* _val, uint32_t _numRegs)
-		{
-			setShaderUniform(_flags, _regIndex, _val, _numRegs);
-		}
-
-		void setShaderUniform4x4f(uint8_t _flags, uint32_t _regIndex, const void* _val, uint32_t _numRegs)
-		{
-			setShaderUniform(_flags, _regIndex, _val, _numRegs);
-		}
-
 		void setFrameBuffer(FrameBufferHandle _fbh, bool _acquire = true)
 		{
 			BGFX_PROFILER_SCOPE("Vk::setFrameBuffer()", kColorFrame);
@@ -2954,6 +3289,7 @@ VK_IMPORT_DEVICE
 			const bool wireframe = m_deviceFeatures.fillModeNonSolid && _wireframe;
 			if (m_wireframe != wireframe)
 			{
+				m_pipelineCompiler.wait();
 				m_wireframe = wireframe;
 				m_pipelineStateCache.invalidate();
 			}
@@ -3391,6 +3727,8 @@ VK_IMPORT_DEVICE
 
 		VkSampler getSampler(uint32_t _flags, VkFormat _format, const float _palette[][4])
 		{
+			BGFX_MUTEX_SCOPE(m_recordMutex);
+
 			uint32_t index = ((_flags & BGFX_SAMPLER_BORDER_COLOR_MASK) >> BGFX_SAMPLER_BORDER_COLOR_SHIFT);
 			index = bx::min<uint32_t>(BGFX_CONFIG_MAX_COLOR_PALETTE - 1, index);
 
@@ -3498,6 +3836,8 @@ VK_IMPORT_DEVICE
 
 		VkImageView getCachedImageView(TextureHandle _handle, uint32_t _mip, uint32_t _numMips, VkImageViewType _type, bool _stencil = false)
 		{
+			BGFX_MUTEX_SCOPE(m_recordMutex);
+
 			const TextureVK& texture = m_textures[_handle.idx];
 
 			_stencil = _stencil && !!(texture.m_aspectMask & VK_IMAGE_ASPECT_STENCIL_BIT);
@@ -3532,6 +3872,8 @@ VK_IMPORT_DEVICE
 
 		VkPipeline getPipeline(ProgramHandle _program)
 		{
+			BGFX_MUTEX_SCOPE(m_recordMutex);
+
 			ProgramVK& program = m_program[_program.idx];
 
 			bx::HashMurmur2A murmur;
@@ -3565,13 +3907,18 @@ VK_IMPORT_DEVICE
 
 			VK_CHECK(vkCreateComputePipelines(m_device, m_pipelineCache, 1, &cpci, m_allocatorCb, &pipeline) );
 
+			m_pipelineCacheDirty = true;
+			m_pipelineCacheIdleFrames = 0;
+
 			m_pipelineStateCache.add(hash, pipeline);
 
 			return pipeline;
 		}
 
-		VkPipeline getPipeline(uint64_t _state, uint64_t _stencil, uint8_t _numStreams, const VertexLayout** _layouts, ProgramHandle _program, uint8_t _numInstanceData)
+		VkPipeline getPipeline(uint64_t _state, uint64_t _stencil, uint8_t _numStreams, const VertexLayout** _layouts, ProgramHandle _program, uint8_t _numInstanceData, FrameBufferHandle _fbh, bool _async = false)
 		{
+			BGFX_MUTEX_SCOPE(m_recordMutex);
+
 			ProgramVK& program = m_program[_program.idx];
 
 			_state &= 0
@@ -3605,8 +3952,8 @@ VK_IMPORT_DEVICE
 				}
 			}
 
-			const FrameBufferVK& frameBuffer = isValid(m_fbh)
-				? m_frameBuffers[m_fbh.idx]
+			const FrameBufferVK& frameBuffer = isValid(_fbh)
+				? m_frameBuffers[_fbh.idx]
 				: m_backBuffer
 				;
 
@@ -3639,6 +3986,78 @@ VK_IMPORT_DEVICE
 				return pipeline;
 			}
 
+			if (_async)
+			{
+				if (!m_pipelineCompiler.isPending(hash) )
+				{
+					PipelineCompileJobVK job;
+					job.m_hash    = hash;
+					job.m_state   = _state;
+					job.m_stencil = _stencil;
+					job.m_program = _program;
+					job.m_fbh     = _fbh;
+					job.m_numStreams      = _numStreams;
+					job.m_numInstanceData = _numInstanceData;
+
+					for (uint8_t ii = 0; ii < _numStreams; ++ii)
+					{
+						bx::memCopy(&job.m_layout[ii], _layouts[ii], sizeof(VertexLayout) );
+					}
+
+					m_pipelineCompiler.request(job);
+				}
+
+				return VK_NULL_HANDLE;
+			}
+
+			pipeline = createPipeline(_state, _stencil, _numStreams, _layouts, _program, _numInstanceData, _fbh);
+			m_pipelineStateCache.add(hash, pipeline);
+
+			m_pipelineCacheDirty = true;
+			m_pipelineCacheIdleFrames = 0;
+
+			return pipeline;
+		}
+
+		void compilePipeline(const PipelineCompileJobVK& _job)
+		{
+			BGFX_PROFILER_SCOPE("bgfx/Compile pipeline", 0xff2040ff);
+
+			const VertexLayout* layouts[BGFX_CONFIG_MAX_VERTEX_STREAMS];
+
+			for (uint8_t ii = 0; ii < _job.m_numStreams; ++ii)
+			{
+				layouts[ii] = &_job.m_layout[ii];
+			}
+
+			VkPipeline pipeline = createPipeline(
+				  _job.m_state
+				, _job.m_stencil
+				, _job.m_numStreams
+				, layouts
+				, _job.m_program
+				, _job.m_numInstanceData
+				, _job.m_fbh
+				);
+
+			BGFX_MUTEX_SCOPE(m_recordMutex);
+
+			m_pipelineStateCache.add(_job.m_hash, pipeline);
+			m_pipelineCompiler.complete(_job.m_hash);
+
+			m_pipelineCacheDirty = true;
+			m_pipelineCacheIdleFrames = 0;
+		}
+
+		VkPipeline createPipeline(uint64_t _state, uint64_t _stencil, uint8_t _numStreams, const VertexLayout** _layouts, ProgramHandle _program, uint8_t _numInstanceData, FrameBufferHandle _fbh)
+		{
+			const ProgramVK& program = m_program[_program.idx];
+
+			const FrameBufferVK& frameBuffer = isValid(_fbh)
+				? m_frameBuffers[_fbh.idx]
+				: m_backBuffer
+				;
+
 			VkPipelineColorBlendAttachmentState blendAttachmentState[BGFX_CONFIG_MAX_FRAME_BUFFER_ATTACHMENTS];
 			VkPipelineColorBlendStateCreateInfo colorBlendState;
 			colorBlendState.pAttachments = blendAttachmentState;
@@ -3759,77 +4178,145 @@ VK_IMPORT_DEVICE
 			graphicsPipeline.basePipelineHandle = VK_NULL_HANDLE;
 			graphicsPipeline.basePipelineIndex  = 0;
 
-			uint32_t length = g_callback->cacheReadSize(hash);
-			bool cached = length > 0;
-
-			void* cachedData = NULL;
-
-			VkPipelineCacheCreateInfo pcci;
-			pcci.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
-			pcci.pNext = NULL;
-			pcci.flags = 0;
-			pcci.initialDataSize = 0;
-			pcci.pInitialData    = NULL;
-
-			if (cached)
-			{
-				cachedData = bx::alloc(g_allocator, length);
-				if (g_callback->cacheRead(hash, cachedData, length) )
-				{
-					BX_TRACE("Loading cached pipeline state (size %d).", length);
-					bx::MemoryReader reader(cachedData, length);
-
-					pcci.initialDataSize = (size_t)reader.remaining();
-					pcci.pInitialData    = reader.getDataPtr();
-				}
-			}
-
-			VkPipelineCache cache;
-			VK_CHECK(vkCreatePipelineCache(m_device, &pcci, m_allocatorCb, &cache) );
-
+			VkPipeline pipeline;
 			VK_CHECK(vkCreateGraphicsPipelines(
 				  m_device
-				, cache
+				, m_pipelineCache
 				, 1
 				, &graphicsPipeline
 				, m_allocatorCb
 				, &pipeline
 				) );
-			m_pipelineStateCache.add(hash, pipeline);
+
+			return pipeline;
+		}
+
+		void flushPipelineCache() override
+		{
+			if (!m_pipelineCacheDirty
+			||  VK_NULL_HANDLE == m_pipelineCache)
+			{
+				return;
+			}
+
+			m_pipelineCacheDirty = false;
+			m_pipelineCacheIdleFrames = 0;
 
 			size_t dataSize;
-			VK_CHECK(vkGetPipelineCacheData(m_device, cache, &dataSize, NULL) );
+			VK_CHECK(vkGetPipelineCacheData(m_device, m_pipelineCache, &dataSize, NULL) );
 
 			if (0 < dataSize)
 			{
-				if (length < dataSize)
-				{
-					cachedData = bx::realloc(g_allocator, cachedData, dataSize);
-				}
+				uint8_t* cachedData = (uint8_t*)bx::alloc(g_allocator, sizeof(PipelineCacheHeaderVK) + dataSize);
 
-				VK_CHECK(vkGetPipelineCacheData(m_device, cache, &dataSize, cachedData) );
-				g_callback->cacheWrite(hash, cachedData, (uint32_t)dataSize);
-			}
+				VkResult result = vkGetPipelineCacheData(m_device, m_pipelineCache, &dataSize, cachedData + sizeof(PipelineCacheHeaderVK) );
+
+				if (VK_SUCCESS == result)
+				{
+					PipelineCacheHeaderVK header;
+					initPipelineCacheHeader(header, m_deviceProperties, uint32_t(dataSize) );
+					bx::memCopy(cachedData, &header, sizeof(PipelineCacheHeaderVK) );
 
-			VK_CHECK(vkMergePipelineCaches(m_device, m_pipelineCache, 1, &cache) );
-			vkDestroy(cache);
+					BX_TRACE("Writing pipeline cache (size %d).", header.m_size);
+					g_callback->cacheWrite(m_pipelineCacheId, cachedData, uint32_t(sizeof(PipelineCacheHeaderVK) + dataSize) );
+				}
 
-			if (NULL != cachedData)
-			{
 				bx::free(g_allocator, cachedData);
 			}
-
-			return pipeline;
 		}
 
-		VkDescriptorSet getDescriptorSet(const ProgramVK& program, const RenderBind& renderBind, const ScratchBufferVK& scratchBuffer, const float _palette[][4])
+		// Writes model transforms (instance data) followed by indirect draw arguments for all
+		// multi-draw runs in frame. First instance of each draw selects its transform.
+		void updateMultiDraw(const Frame* _render)
 		{
-			VkDescriptorSet descriptorSet;
+			BGFX_PROFILER_SCOPE("bgfx/Update multi-draw buffer", kColorResource);
 
-			VkDescriptorSetAllocateInfo dsai;
-			dsai.sType              = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+			ScratchBufferVK& scratchBuffer = m_scratchMultiDrawBuffer[m_cmd.m_currentFrameInFlight];
+			scratchBuffer.reset();
+
+			const uint32_t num = _render->m_numMultiDrawItems;
+
+			// Transforms are at the beginning of buffer, instance data is bound at offset 0.
+			const uint32_t mtxOffset = scratchBuffer.alloc(num*sizeof(Matrix4) );
+			m_multiDrawCmdOffset = scratchBuffer.alloc(num*sizeof(VkDrawIndexedIndirectCommand) );
+			m_multiDrawBuffer    = scratchBuffer.m_buffer;
+
+			float* mtx = (float*)&scratchBuffer.m_data[mtxOffset];
+			VkDrawIndexedIndirectCommand* cmd = (VkDrawIndexedIndirectCommand*)&scratchBuffer.m_data[m_multiDrawCmdOffset];
+
+			for (uint32_t ii = 0, numRuns = _render->m_numMultiDrawRuns; ii < numRuns; ++ii)
+			{
+				const MultiDrawRun& run = _render->m_multiDrawRun[ii];
+				const RenderDraw& first = _render->getRenderItem(_render->m_sortValues[run.m_item]).draw;
+
+				for (uint32_t jj = 0; jj < run.m_num; ++jj)
+				{
+					const RenderDraw& draw = _render->getRenderItem(_render->m_sortValues[run.m_item+jj]).draw;
+
+					bx::memCopy(mtx, _render->m_frameCache.m_matrixCache.m_cache[draw.m_startMatrix].un.val, sizeof(Matrix4) );
+					mtx += 16;
+
+					// Vertex buffer is bound at first draw's start vertex.
+					cmd->indexCount    = draw.m_numIndices;
+					cmd->instanceCount = 1;
+					cmd->firstIndex    = draw.m_startIndex;
+					cmd->vertexOffset  = int32_t(draw.m_stream[0].m_startVertex - first.m_stream[0].m_startVertex);
+					cmd->firstInstance = run.m_first + jj;
+					++cmd;
+				}
+			}
+
+			scratchBuffer.flush();
+		}
+
+		// Returns multi-draw run starting at sorted item. Runs before it were skipped, with
+		// their view or as recorded by other thread.
+		const MultiDrawRun* findMultiDrawRun(const Frame* _render, uint32_t& _idx, uint32_t _item) const
+		{
+			if (!m_multiDrawSupport)
+			{
+				return NULL;
+			}
+
+			const uint32_t numRuns = _render->m_numMultiDrawRuns;
+
+			while (_idx < numRuns
+			&&     _render->m_multiDrawRun[_idx].m_item < _item)
+			{
+				++_idx;
+			}
+
+			if (_idx < numRuns
+			&&  _render->m_multiDrawRun[_idx].m_item == _item)
+			{
+				return &_render->m_multiDrawRun[_idx++];
+			}
+
+			return NULL;
+		}
+
+		void updatePipelineCache()
+		{
+			if (m_pipelineCacheDirty
+			&&  ++m_pipelineCacheIdleFrames >= BGFX_CONFIG_PIPELINE_CACHE_FLUSH_FRAMES)
+			{
+				flushPipelineCache();
+			}
+		}
+
+		VkDescriptorSet getDescriptorSet(const ProgramVK& program, const RenderBind& renderBind, const ScratchBufferVK& scratchBuffer, VkDescriptorPool _descriptorPool, const float _palette[][4])
+		{
+			VkDescriptorSet descriptorSet;
+
+			// Image layouts are tracked on render thread. Recording threads can run ahead
+			// of it, and check only sets allocated from the shared pool.
+			const bool checkLayout = m_descriptorPool == _descriptorPool;
+			BX_UNUSED(checkLayout);
+
+			VkDescriptorSetAllocateInfo dsai;
+			dsai.sType              = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
 			dsai.pNext              = NULL;
-			dsai.descriptorPool     = m_descriptorPool;
+			dsai.descriptorPool     = _descriptorPool;
 			dsai.descriptorSetCount = 1;
 			dsai.pSetLayouts        = &program.m_descriptorSetLayout;
 
@@ -3887,7 +4374,7 @@ VK_IMPORT_DEVICE
 							}
 
 							BX_ASSERT(
-								  texture.m_currentImageLayout == texture.m_sampledLayout
+								  !checkLayout || texture.m_currentImageLayout == texture.m_sampledLayout
 								, "Mismatching image layout. Texture currently used as a framebuffer attachment?"
 								);
 
@@ -3951,7 +4438,7 @@ VK_IMPORT_DEVICE
 								;
 
 							BX_ASSERT(
-								  texture.m_currentImageLayout == texture.m_sampledLayout
+								  !checkLayout || texture.m_currentImageLayout == texture.m_sampledLayout
 								, "Mismatching image layout. Texture currently used as a framebuffer attachment?"
 								);
 
@@ -4041,8 +4528,12 @@ VK_IMPORT_DEVICE
 
 			vkUpdateDescriptorSets(m_device, wdsCount, wds, 0, NULL);
 
-			VkDescriptorSet temp = descriptorSet;
-			release(temp);
+			// Sets allocated from per thread pools are recycled by resetting the pool.
+			if (m_descriptorPool == _descriptorPool)
+			{
+				VkDescriptorSet temp = descriptorSet;
+				release(temp);
+			}
 
 			return descriptorSet;
 		}
@@ -4137,87 +4628,6 @@ VK_IMPORT_DEVICE
 			return _visible == (0 != _render->m_occlusion[_handle.idx]);
 		}
 
-		void commit(UniformBuffer& _uniformBuffer)
-		{
-			_uniformBuffer.reset();
-
-			for (;;)
-			{
-				uint32_t opcode = _uniformBuffer.read();
-
-				if (UniformType::End == opcode)
-				{
-					break;
-				}
-
-				UniformType::Enum type;
-				uint16_t loc;
-				uint16_t num;
-				uint16_t copy;
-				UniformBuffer::decodeOpcode(opcode, type, loc, num, copy);
-
-				const char* data;
-				if (copy)
-				{
-					data = _uniformBuffer.read(g_uniformTypeSize[type]*num);
-				}
-				else
-				{
-					UniformHandle handle;
-					bx::memCopy(&handle, _uniformBuffer.read(sizeof(UniformHandle) ), sizeof(UniformHandle) );
-					data = (const char*)m_uniforms[handle.idx];
-				}
-
-				switch ( (uint32_t)type)
-				{
-				case UniformType::Mat3:
-				case UniformType::Mat3|kUniformFragmentBit:
-					{
-						 float* value = (float*)data;
-						 for (uint32_t ii = 0, count = num/3; ii < count; ++ii,  loc += 3*16, value += 9)
-						{
-							 Matrix4 mtx;
-							 mtx.un.val[ 0] = value[0];
-							 mtx.un.val[ 1] = value[1];
-							 mtx.un.val[ 2] = value[2];
-							 mtx.un.val[ 3] = 0.0f;
-							 mtx.un.val[ 4] = value[3];
-							 mtx.un.val[ 5] = value[4];
-							 mtx.un.val[ 6] = value[5];
-							 mtx.un.val[ 7] = 0.0f;
-							 mtx.un.val[ 8] = value[6];
-							 mtx.un.val[ 9] = value[7];
-							 mtx.un.val[10] = value[8];
-							 mtx.un.val[11] = 0.0f;
-							 setShaderUniform(uint8_t(type), loc, &mtx.un.val[0], 3);
-						 }
-					}
-					break;
-
-				case UniformType::Sampler:
-				case UniformType::Sampler|kUniformFragmentBit:
-					// do nothing, but VkDescriptorSetImageInfo would be set before drawing
-					break;
-
-				case UniformType::Vec4:
-				case UniformType::Vec4 | kUniformFragmentBit:
-				case UniformType::Mat4:
-				case UniformType::Mat4 | kUniformFragmentBit:
-					{
-						setShaderUniform(uint8_t(type), loc, data, num);
-					}
-					break;
-
-				case UniformType::End:
-					break;
-
-				default:
-					BX_TRACE("%4d: INVALID 0x%08x, t %d, l %d, n %d, c %d", _uniformBuffer.getPos(), opcode, type, loc, num, copy);
-					break;
-				}
-			}
-		}
-
 		void clearQuad(const Rect& _rect, const Clear& _clear, const float _palette[][4])
 		{
 			VkClearRect rect[1];
@@ -4336,6 +4746,14 @@ VK_IMPORT_DEVICE
 			m_cmd.kick(_finishAll);
 			VK_CHECK(m_cmd.alloc(&m_commandBuffer) );
 			m_cmd.finish(_finishAll);
+
+			// Command buffer allocation waited for the oldest command buffer in flight, only the
+			// newer ones can still be executing.
+			const uint64_t numSubmitted = _finishAll
+				? m_cmd.m_submitted
+				: m_cmd.m_submitted - bx::min<uint64_t>(m_cmd.m_submitted, m_cmd.m_numFramesInFlight - 1)
+				;
+			completeTextureReadbacks(numSubmitted);
 		}
 
 		int32_t selectMemoryType(uint32_t _memoryTypeBits, uint32_t _propertyFlags, int32_t _startIndex = 0) const
@@ -4515,6 +4933,7 @@ VK_IMPORT_DEVICE
 
 		VkPhysicalDeviceProperties       m_deviceProperties;
 		VkPhysicalDeviceMemoryProperties m_memoryProperties;
+		DeviceMemoryAllocatorVK m_memoryAllocator;
 		VkPhysicalDeviceFeatures         m_deviceFeatures;
 
 		bool m_lineAASupport;
@@ -4530,6 +4949,7 @@ VK_IMPORT_DEVICE
 
 		ScratchBufferVK m_scratchBuffer[BGFX_CONFIG_MAX_FRAME_LATENCY];
 		ScratchBufferVK m_scratchStagingBuffer[BGFX_CONFIG_MAX_FRAME_LATENCY];
+		ScratchBufferVK m_scratchMultiDrawBuffer[BGFX_CONFIG_MAX_FRAME_LATENCY];
 
 		uint32_t        m_numFramesInFlight;
 		CommandQueueVK  m_cmd;
@@ -4540,6 +4960,13 @@ VK_IMPORT_DEVICE
 		VkQueue  m_globalQueue;
 		VkDescriptorPool m_descriptorPool;
 		VkPipelineCache  m_pipelineCache;
+		uint64_t m_pipelineCacheId;
+		uint32_t m_pipelineCacheIdleFrames;
+		bool     m_pipelineCacheDirty;
+
+		VkBuffer m_multiDrawBuffer;
+		uint32_t m_multiDrawCmdOffset;
+		bool     m_multiDrawSupport;
 
 		TimerQueryVK m_gpuTimer;
 		OcclusionQueryVK m_occlusionQuery;
@@ -4556,6 +4983,7 @@ VK_IMPORT_DEVICE
 		FrameBufferVK  m_frameBuffers[BGFX_CONFIG_MAX_FRAME_BUFFERS];
 
 		void* m_uniforms[BGFX_CONFIG_MAX_UNIFORMS];
+		uint32_t m_uniformSize[BGFX_CONFIG_MAX_UNIFORMS];
 		Matrix4 m_predefinedUniforms[PredefinedUniform::Count];
 		UniformRegistry m_uniformReg;
 
@@ -4570,15 +4998,38 @@ VK_IMPORT_DEVICE
 		float m_maxAnisotropy;
 		bool m_depthClamp;
 		bool m_wireframe;
+		bool m_asyncPipeline;
 
 		VkBuffer m_captureBuffer;
 		VkDeviceMemory m_captureMemory;
 		uint32_t m_captureSize;
 
+		VkBuffer m_readbackBuffer;
+		VkDeviceMemory m_readbackMemory;
+		uint32_t m_readbackSize;
+
+		// Texture read back recorded into command buffer, its staging buffer is read once command
+		// buffer is executed.
+		struct TextureReadbackVK
+		{
+			ReadbackVK     m_readback;
+			VkBuffer       m_buffer;
+			VkDeviceMemory m_memory;
+			void*          m_data;
+			uint64_t       m_submitted;
+			uint32_t       m_ticket;
+			uint8_t        m_mip;
+		};
+
+		typedef stl::vector<TextureReadbackVK> TextureReadbackArray;
+		TextureReadbackArray m_textureReadback;
+
 		TextVideoMem m_textVideoMem;
 
-		uint8_t m_fsScratch[64<<10];
-		uint8_t m_vsScratch[64<<10];
+		RecordStateVK      m_record;
+		RecordThreadPoolVK m_recordThreadPool;
+		bx::Mutex          m_recordMutex;
+		PipelineCompilerVK m_pipelineCompiler;
 
 		FrameBufferHandle m_fbh;
 	};
@@ -4665,6 +5116,221 @@ VK_DESTROY
 		s_renderVK->release(_obj);
 	}
 
+	DeviceMemoryAllocatorVK::DeviceMemoryAllocatorVK()
+		: m_blockSize(0)
+		, m_dedicatedSize(0)
+		, m_numDedicated(0)
+	{
+	}
+
+	void DeviceMemoryAllocatorVK::init(VkDeviceSize _blockSize)
+	{
+		m_blockSize     = _blockSize;
+		m_dedicatedSize = 0;
+		m_numDedicated  = 0;
+	}
+
+	void DeviceMemoryAllocatorVK::shutdown()
+	{
+		for (uint32_t ii = 0; ii < BX_COUNTOF(m_pool); ++ii)
+		{
+			BlockArray& pool = m_pool[ii];
+
+			for (uint32_t jj = 0, num = uint32_t(pool.size() ); jj < num; ++jj)
+			{
+				Block& block = pool[jj];
+				BX_WARN(VK_NULL_HANDLE == block.m_mem || block.m_ranges.isEmpty()
+					, "Device memory block %d/%d still has %d bytes allocated."
+					, ii
+					, jj
+					, uint32_t(block.m_ranges.getUsed() )
+					);
+				vkDestroy(block.m_mem);
+				block.m_ranges.destroy();
+			}
+
+			pool.clear();
+		}
+
+		BX_WARN(0 == m_numDedicated, "%d dedicated device memory allocations leaked.", m_numDedicated);
+	}
+
+	VkResult DeviceMemoryAllocatorVK::alloc(const VkMemoryRequirements& _requirements, VkMemoryPropertyFlags _flags, bool _image, DeviceMemoryAllocationVK& _outAlloc)
+	{
+		BGFX_PROFILER_SCOPE("DeviceMemoryAllocatorVK::alloc", kColorResource);
+
+		if (_requirements.size <= m_blockSize/2)
+		{
+			const VkDevice device = s_renderVK->m_device;
+			const VkAllocationCallbacks* allocatorCb = s_renderVK->m_allocatorCb;
+
+			for (int32_t memoryType = s_renderVK->selectMemoryType(_requirements.memoryTypeBits, _flags, 0)
+				; 0 <= memoryType
+				; memoryType = s_renderVK->selectMemoryType(_requirements.memoryTypeBits, _flags, memoryType + 1)
+				)
+			{
+				const uint16_t poolIdx = uint16_t(memoryType*2 + (_image ? 1 : 0) );
+				BlockArray& pool = m_pool[poolIdx];
+
+				uint32_t unused = UINT32_MAX;
+
+				for (uint32_t ii = 0, num = uint32_t(pool.size() ); ii < num; ++ii)
+				{
+					Block& block = pool[ii];
+
+					if (VK_NULL_HANDLE == block.m_mem)
+					{
+						unused = bx::min(unused, ii);
+						continue;
+					}
+
+					VkDeviceSize offset;
+					if (block.m_ranges.alloc(_requirements.size, _requirements.alignment, offset) )
+					{
+						_outAlloc.m_mem    = block.m_mem;
+						_outAlloc.m_offset = offset;
+						_outAlloc.m_size   = _requirements.size;
+						_outAlloc.m_pool   = poolIdx;
+						_outAlloc.m_block  = uint16_t(ii);
+						return VK_SUCCESS;
+					}
+				}
+
+				VkMemoryAllocateInfo ma;
+				ma.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+				ma.pNext = NULL;
+				ma.allocationSize  = m_blockSize;
+				ma.memoryTypeIndex = memoryType;
+
+				::VkDeviceMemory mem;
+				if (VK_SUCCESS != vkAllocateMemory(device, &ma, allocatorCb, &mem) )
+				{
+					continue;
+				}
+
+				if (UINT32_MAX == unused)
+				{
+					unused = uint32_t(pool.size() );
+					pool.push_back(Block() );
+				}
+
+				Block& block = pool[unused];
+				block.m_mem = mem;
+				block.m_ranges.create(g_allocator, m_blockSize);
+
+				VkDeviceSize offset = 0;
+				block.m_ranges.alloc(_requirements.size, _requirements.alignment, offset);
+
+				_outAlloc.m_mem    = block.m_mem;
+				_outAlloc.m_offset = offset;
+				_outAlloc.m_size   = _requirements.size;
+				_outAlloc.m_pool   = poolIdx;
+				_outAlloc.m_block  = uint16_t(unused);
+				return VK_SUCCESS;
+			}
+		}
+
+		// Large resource, or there is no room for another block in any of compatible heaps.
+		VkResult result = s_renderVK->allocateMemory(&_requirements, _flags, &_outAlloc.m_mem);
+
+		if (VK_SUCCESS == result)
+		{
+			_outAlloc.m_offset = 0;
+			_outAlloc.m_size   = _requirements.size;
+			_outAlloc.m_pool   = UINT16_MAX;
+			_outAlloc.m_block  = UINT16_MAX;
+
+			m_dedicatedSize += _requirements.size;
+			++m_numDedicated;
+		}
+
+		return result;
+	}
+
+	void DeviceMemoryAllocatorVK::free(const DeviceMemoryAllocationVK& _alloc)
+	{
+		if (UINT16_MAX == _alloc.m_pool)
+		{
+			VkDeviceMemory mem = _alloc.m_mem;
+			vkDestroy(mem);
+
+			m_dedicatedSize -= _alloc.m_size;
+			--m_numDedicated;
+			return;
+		}
+
+		Block& block = m_pool[_alloc.m_pool][_alloc.m_block];
+		block.m_ranges.free(_alloc.m_offset, _alloc.m_size);
+	}
+
+	void DeviceMemoryAllocatorVK::trim()
+	{
+		for (uint32_t ii = 0; ii < BX_COUNTOF(m_pool); ++ii)
+		{
+			BlockArray& pool = m_pool[ii];
+			bool keep = true;
+
+			for (uint32_t jj = 0, num = uint32_t(pool.size() ); jj < num; ++jj)
+			{
+				Block& block = pool[jj];
+
+				if (VK_NULL_HANDLE != block.m_mem
+				&&  block.m_ranges.isEmpty() )
+				{
+					if (keep)
+					{
+						keep = false;
+					}
+					else
+					{
+						vkDestroy(block.m_mem);
+						block.m_ranges.destroy();
+					}
+				}
+			}
+
+			while (!pool.empty()
+			&&     VK_NULL_HANDLE == pool.back().m_mem)
+			{
+				pool.pop_back();
+			}
+		}
+	}
+
+	void DeviceMemoryAllocatorVK::getStats(DeviceMemoryStatsVK& _outStats) const
+	{
+		bx::memSet(&_outStats, 0, sizeof(_outStats) );
+		_outStats.m_numDedicated  = m_numDedicated;
+		_outStats.m_dedicatedSize = m_dedicatedSize;
+
+		for (uint32_t ii = 0; ii < BX_COUNTOF(m_pool); ++ii)
+		{
+			const BlockArray& pool = m_pool[ii];
+
+			for (uint32_t jj = 0, num = uint32_t(pool.size() ); jj < num; ++jj)
+			{
+				const Block& block = pool[jj];
+
+				if (VK_NULL_HANDLE != block.m_mem)
+				{
+					_outStats.m_numBlocks++;
+					_outStats.m_numFreeRanges += block.m_ranges.getNumFreeRanges();
+					_outStats.m_blockSize     += block.m_ranges.getSize();
+					_outStats.m_blockUsed     += block.m_ranges.getUsed();
+					_outStats.m_largestFree    = bx::max(_outStats.m_largestFree, block.m_ranges.getLargestFree() );
+				}
+			}
+		}
+	}
+
+	VkDeviceSize DeviceMemoryAllocatorVK::getUsed() const
+	{
+		DeviceMemoryStatsVK stats;
+		getStats(stats);
+
+		return stats.m_blockSize + stats.m_dedicatedSize;
+	}
+
 	void ScratchBufferVK::create(uint32_t _size, uint32_t _count, VkBufferUsageFlags usage, uint32_t _align)
 	{
 		const VkAllocationCallbacks* allocatorCb = s_renderVK->m_allocatorCb;
@@ -4731,6 +5397,12 @@ VK_DESTROY
 		create(_size, 1, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, align);
 	}
 
+	void ScratchBufferVK::createMultiDraw(uint32_t _count)
+	{
+		// Model transform used as instance data, and indirect draw arguments per batched draw call.
+		create(sizeof(Matrix4) + sizeof(VkDrawIndexedIndirectCommand), _count, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT, 16);
+	}
+
 	void ScratchBufferVK::destroy()
 	{
 		reset();
@@ -4811,6 +5483,7 @@ VK_DESTROY
 			| (_vertex              ? VK_BUFFER_USAGE_VERTEX_BUFFER_BIT   : VK_BUFFER_USAGE_INDEX_BUFFER_BIT)
 			| (storage || indirect  ? VK_BUFFER_USAGE_STORAGE_BUFFER_BIT  : 0)
 			| (indirect             ? VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT : 0)
+			| VK_BUFFER_USAGE_TRANSFER_SRC_BIT
 			| VK_BUFFER_USAGE_TRANSFER_DST_BIT
 			;
 		bci.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
@@ -4824,9 +5497,9 @@ VK_DESTROY
 		VkMemoryRequirements mr;
 		vkGetBufferMemoryRequirements(device, m_buffer, &mr);
 
-		VK_CHECK(s_renderVK->allocateMemory(&mr, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, &m_deviceMem) );
+		VK_CHECK(s_renderVK->m_memoryAllocator.alloc(mr, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, false, m_deviceMem) );
 
-		VK_CHECK(vkBindBufferMemory(device, m_buffer, m_deviceMem, 0) );
+		VK_CHECK(vkBindBufferMemory(device, m_buffer, m_deviceMem.m_mem, m_deviceMem.m_offset) );
 
 		if (!m_dynamic)
 		{
@@ -5925,14 +6598,14 @@ VK_DESTROY
 		VkMemoryRequirements imageMemReq;
 		vkGetImageMemoryRequirements(device, m_textureImage, &imageMemReq);
 
-		result = s_renderVK->allocateMemory(&imageMemReq, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, &m_textureDeviceMem);
+		result = s_renderVK->m_memoryAllocator.alloc(imageMemReq, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, true, m_textureDeviceMem);
 		if (VK_SUCCESS != result)
 		{
 			BX_TRACE("Create texture image error: allocateMemory failed %d: %s.", result, getName(result) );
 			return result;
 		}
 
-		result = vkBindImageMemory(device, m_textureImage, m_textureDeviceMem, 0);
+		result = vkBindImageMemory(device, m_textureImage, m_textureDeviceMem.m_mem, m_textureDeviceMem.m_offset);
 		if (VK_SUCCESS != result)
 		{
 			BX_TRACE("Create texture image error: vkBindImageMemory failed %d: %s.", result, getName(result) );
@@ -5968,14 +6641,14 @@ VK_DESTROY
 			VkMemoryRequirements imageMemReq_resolve;
 			vkGetImageMemoryRequirements(device, m_singleMsaaImage, &imageMemReq_resolve);
 
-			result = s_renderVK->allocateMemory(&imageMemReq_resolve, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, &m_singleMsaaDeviceMem);
+			result = s_renderVK->m_memoryAllocator.alloc(imageMemReq_resolve, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, true, m_singleMsaaDeviceMem);
 			if (VK_SUCCESS != result)
 			{
 				BX_TRACE("Create texture image error: allocateMemory failed %d: %s.", result, getName(result) );
 				return result;
 			}
 
-			result = vkBindImageMemory(device, m_singleMsaaImage, m_singleMsaaDeviceMem, 0);
+			result = vkBindImageMemory(device, m_singleMsaaImage, m_singleMsaaDeviceMem.m_mem, m_singleMsaaDeviceMem.m_offset);
 			if (VK_SUCCESS != result)
 			{
 				BX_TRACE("Create texture image error: vkBindImageMemory failed %d: %s.", result, getName(result) );
@@ -8261,6 +8934,11 @@ VK_DESTROY
 		m_release[m_currentFrameInFlight].push_back(resource);
 	}
 
+	void CommandQueueVK::release(const DeviceMemoryAllocationVK& _alloc)
+	{
+		m_releaseMemory[m_currentFrameInFlight].push_back(_alloc);
+	}
+
 	void CommandQueueVK::consume()
 	{
 		BGFX_PROFILER_SCOPE("CommandQueueVK::consume", kColorResource);
@@ -8291,64 +8969,1482 @@ VK_DESTROY
 		}
 
 		m_release[m_consumeIndex].clear();
+
+		for (const DeviceMemoryAllocationVK& alloc : m_releaseMemory[m_consumeIndex])
+		{
+			s_renderVK->m_memoryAllocator.free(alloc);
+		}
+
+		m_releaseMemory[m_consumeIndex].clear();
 	}
 
-	void RendererContextVK::submitBlit(BlitState& _bs, uint16_t _view)
+	static void updateUniforms(void* const* _uniforms, const UniformBuffer& _uniformBuffer, uint32_t _begin, uint32_t _end)
 	{
-		BGFX_PROFILER_SCOPE("RendererContextVK::submitBlit", kColorFrame);
-		VkImageLayout srcLayouts[BGFX_CONFIG_MAX_BLIT_ITEMS];
-		VkImageLayout dstLayouts[BGFX_CONFIG_MAX_BLIT_ITEMS];
+		for (uint32_t pos = _begin; pos < _end;)
+		{
+			uint32_t opcode;
+			bx::memCopy(&opcode, _uniformBuffer.getData(pos), sizeof(uint32_t) );
+			pos += sizeof(uint32_t);
 
-		BlitState bs0 = _bs;
+			if (UniformType::End == opcode)
+			{
+				break;
+			}
 
-		while (bs0.hasItem(_view) )
-		{
-			uint16_t item = bs0.m_item;
+			UniformType::Enum type;
+			uint16_t loc;
+			uint16_t num;
+			uint16_t copy;
+			UniformBuffer::decodeOpcode(opcode, type, loc, num, copy);
 
-			const BlitItem& blit = bs0.advance();
+			const uint32_t size = g_uniformTypeSize[type]*num;
+			const char* data = _uniformBuffer.getData(pos);
+			pos += size;
 
-			TextureVK& src = m_textures[blit.m_src.idx];
-			TextureVK& dst = m_textures[blit.m_dst.idx];
+			if (UniformType::Count > type)
+			{
+				bx::memCopy(_uniforms[loc], copy ? data : *(const char**)(data), size);
+			}
+		}
+	}
 
-			srcLayouts[item] = VK_NULL_HANDLE != src.m_singleMsaaImage ? src.m_currentSingleMsaaImageLayout : src.m_currentImageLayout;
-			dstLayouts[item] = dst.m_currentImageLayout;
+	static void updateUniformBlock(void* const* _uniforms, const Frame* _render, const RenderDraw& _draw)
+	{
+		if (!isValid(_draw.m_uniformBlock) )
+		{
+			return;
 		}
 
-		bs0 = _bs;
+		const UniformBlock& block = rendererGetUniformBlock(_draw.m_uniformBlock);
+		const uint8_t* data = _render->getUniformBlockData(_draw);
 
-		while (bs0.hasItem(_view) )
+		for (uint32_t ii = 0, num = block.m_num; ii < num; ++ii)
 		{
-			const BlitItem& blit = bs0.advance();
+			const UniformBlock::Uniform& uniform = block.m_uniform[ii];
 
-			TextureVK& src = m_textures[blit.m_src.idx];
-			TextureVK& dst = m_textures[blit.m_dst.idx];
+			if (UniformType::Mat3 == uniform.m_type)
+			{
+				UniformBlock::unpackMat3( (float*)_uniforms[uniform.m_handle.idx], &data[uniform.m_offset], uniform.m_num);
+			}
+			else
+			{
+				bx::memCopy(_uniforms[uniform.m_handle.idx], &data[uniform.m_offset], uniform.m_size);
+			}
+		}
+	}
 
-			src.setImageMemoryBarrier(
-				  m_commandBuffer
-				, blit.m_src.idx == blit.m_dst.idx ? VK_IMAGE_LAYOUT_GENERAL : VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL
-				, VK_NULL_HANDLE != src.m_singleMsaaImage
-				);
+	// Uniform block can be copied directly into shader constants when every uniform shader
+	// uses is in block, at the same offset shader expects it.
+	static bool isUniformBlockCompatible(const UniformBuffer& _constantBuffer, const UniformBlock& _block)
+	{
+		for (uint32_t pos = 0;;)
+		{
+			uint32_t opcode;
+			bx::memCopy(&opcode, _constantBuffer.getData(pos), sizeof(uint32_t) );
+			pos += sizeof(uint32_t);
 
-			if (blit.m_src.idx != blit.m_dst.idx)
+			if (UniformType::End == opcode)
 			{
-				dst.setImageMemoryBarrier(m_commandBuffer, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+				break;
 			}
 
-			const uint16_t srcSamples = VK_NULL_HANDLE != src.m_singleMsaaImage ? 1 : src.m_sampler.Count;
-			const uint16_t dstSamples = dst.m_sampler.Count;
-			BX_UNUSED(srcSamples, dstSamples);
+			UniformType::Enum type;
+			uint16_t loc;
+			uint16_t num;
+			uint16_t copy;
+			UniformBuffer::decodeOpcode(opcode, type, loc, num, copy);
 
-			BX_ASSERT(
-				  srcSamples == dstSamples
-				, "Mismatching texture sample count (%d != %d)."
-				, srcSamples
-				, dstSamples
-				);
+			if (copy)
+			{
+				return false;
+			}
 
-			VkImageCopy copyInfo;
-			copyInfo.srcSubresource.aspectMask     = src.m_aspectMask;
-			copyInfo.srcSubresource.mipLevel       = blit.m_srcMip;
-			copyInfo.srcSubresource.baseArrayLayer = 0;
+			UniformHandle handle;
+			bx::memCopy(&handle, _constantBuffer.getData(pos), sizeof(UniformHandle) );
+			pos += sizeof(UniformHandle);
+
+			if (UniformType::Sampler == (type & ~kUniformFragmentBit) )
+			{
+				continue;
+			}
+
+			bool found = false;
+			for (uint32_t ii = 0, numUniforms = _block.m_num; ii < numUniforms && !found; ++ii)
+			{
+				const UniformBlock::Uniform& uniform = _block.m_uniform[ii];
+				found = uniform.m_handle.idx == handle.idx
+					&&  uniform.m_offset     == loc
+					&&  uniform.m_size       >= uint32_t(num)*16
+					;
+			}
+
+			if (!found)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	void RecordStateVK::reset()
+	{
+		m_currentState.clear();
+		m_currentState.m_stateFlags = BGFX_STATE_NONE;
+		m_currentState.m_stencil    = packStencil(BGFX_STENCIL_NONE, BGFX_STENCIL_NONE);
+
+		m_currentProgram       = BGFX_INVALID_HANDLE;
+		m_currentPipeline      = VK_NULL_HANDLE;
+		m_currentDescriptorSet = VK_NULL_HANDLE;
+		m_currentIndexFormat   = VK_INDEX_TYPE_MAX_ENUM;
+		m_blendFactor          = UINT64_MAX;
+		m_currentBindHash      = 0;
+		m_hasPredefined        = false;
+		m_multiDrawBound       = false;
+
+		bx::memSet(m_uniformBlockCache, 0, sizeof(m_uniformBlockCache) );
+	}
+
+	void RecordStateVK::resetStats()
+	{
+		bx::memSet(m_numPrimsSubmitted, 0, sizeof(m_numPrimsSubmitted) );
+		bx::memSet(m_numPrimsRendered,  0, sizeof(m_numPrimsRendered) );
+		bx::memSet(m_numInstances,      0, sizeof(m_numInstances) );
+		m_numIndices        = 0;
+		m_numDescriptorSets = 0;
+		m_numDrawsFallback  = 0;
+		m_numDrawsSkipped   = 0;
+		m_numMultiDraw      = 0;
+		m_numMultiDrawItems = 0;
+	}
+
+	void RecordStateVK::setShaderUniform(uint8_t _flags, uint32_t _regIndex, const void* _val, uint32_t _numRegs)
+	{
+		if (_flags & kUniformFragmentBit)
+		{
+			bx::memCopy(&m_fsScratch[_regIndex], _val, _numRegs*16);
+		}
+		else
+		{
+			bx::memCopy(&m_vsScratch[_regIndex], _val, _numRegs*16);
+		}
+	}
+
+	void RecordStateVK::setShaderUniform4f(uint8_t _flags, uint32_t _regIndex, const void* _val, uint32_t _numRegs)
+	{
+		setShaderUniform(_flags, _regIndex, _val, _numRegs);
+	}
+
+	void RecordStateVK::setShaderUniform4x4f(uint8_t _flags, uint32_t _regIndex, const void* _val, uint32_t _numRegs)
+	{
+		setShaderUniform(_flags, _regIndex, _val, _numRegs);
+	}
+
+	void RecordStateVK::commit(const UniformBuffer& _uniformBuffer)
+	{
+		// Shader constant buffers are shared between threads, read them without moving
+		// buffer position.
+		for (uint32_t pos = 0;;)
+		{
+			uint32_t opcode;
+			bx::memCopy(&opcode, _uniformBuffer.getData(pos), sizeof(uint32_t) );
+			pos += sizeof(uint32_t);
+
+			if (UniformType::End == opcode)
+			{
+				break;
+			}
+
+			UniformType::Enum type;
+			uint16_t loc;
+			uint16_t num;
+			uint16_t copy;
+			UniformBuffer::decodeOpcode(opcode, type, loc, num, copy);
+
+			const char* data;
+			if (copy)
+			{
+				data = _uniformBuffer.getData(pos);
+				pos += g_uniformTypeSize[type]*num;
+			}
+			else
+			{
+				UniformHandle handle;
+				bx::memCopy(&handle, _uniformBuffer.getData(pos), sizeof(UniformHandle) );
+				pos += sizeof(UniformHandle);
+				data = (const char*)m_uniforms[handle.idx];
+			}
+
+			switch ( (uint32_t)type)
+			{
+			case UniformType::Mat3:
+			case UniformType::Mat3|kUniformFragmentBit:
+				{
+					 float* value = (float*)data;
+					 for (uint32_t ii = 0, count = num/3; ii < count; ++ii,  loc += 3*16, value += 9)
+					{
+						 Matrix4 mtx;
+						 mtx.un.val[ 0] = value[0];
+						 mtx.un.val[ 1] = value[1];
+						 mtx.un.val[ 2] = value[2];
+						 mtx.un.val[ 3] = 0.0f;
+						 mtx.un.val[ 4] = value[3];
+						 mtx.un.val[ 5] = value[4];
+						 mtx.un.val[ 6] = value[5];
+						 mtx.un.val[ 7] = 0.0f;
+						 mtx.un.val[ 8] = value[6];
+						 mtx.un.val[ 9] = value[7];
+						 mtx.un.val[10] = value[8];
+						 mtx.un.val[11] = 0.0f;
+						 setShaderUniform(uint8_t(type), loc, &mtx.un.val[0], 3);
+					 }
+				}
+				break;
+
+			case UniformType::Sampler:
+			case UniformType::Sampler|kUniformFragmentBit:
+				// do nothing, but VkDescriptorSetImageInfo would be set before drawing
+				break;
+
+			case UniformType::Vec4:
+			case UniformType::Vec4 | kUniformFragmentBit:
+			case UniformType::Mat4:
+			case UniformType::Mat4 | kUniformFragmentBit:
+				{
+					setShaderUniform(uint8_t(type), loc, data, num);
+				}
+				break;
+
+			case UniformType::End:
+				break;
+
+			default:
+				BX_TRACE("%4d: INVALID 0x%08x, t %d, l %d, n %d, c %d", pos, opcode, type, loc, num, copy);
+				break;
+			}
+		}
+	}
+
+	bool RecordStateVK::commit(uint8_t _stage, const ShaderVK& _shader, const UniformBlock& _block, const uint8_t* _data)
+	{
+		UniformBlockCache& cache = m_uniformBlockCache[_stage];
+
+		if (cache.m_shader != &_shader
+		||  cache.m_hash   != _block.m_hash)
+		{
+			cache.m_shader     = &_shader;
+			cache.m_hash       = _block.m_hash;
+			cache.m_compatible = isUniformBlockCompatible(*_shader.m_constantBuffer, _block);
+		}
+
+		if (!cache.m_compatible)
+		{
+			return false;
+		}
+
+		uint8_t* scratch = 0 == _stage ? m_vsScratch : m_fsScratch;
+		bx::memCopy(scratch, _data, bx::min<uint32_t>(_block.m_size, _shader.m_size) );
+
+		return true;
+	}
+
+	RecordThreadPoolVK::RecordThreadPoolVK()
+		: m_render(NULL)
+		, m_frameInFlight(0)
+		, m_numFramesInFlight(0)
+		, m_numThreads(0)
+		, m_numJobs(0)
+		, m_next(0)
+		, m_numWaited(0)
+		, m_exit(false)
+		, m_active(false)
+		, m_uniformData(NULL)
+		, m_uniformDataSize(0)
+	{
+	}
+
+	VkResult RecordThreadPoolVK::init(uint32_t _numThreads, uint32_t _numFramesInFlight)
+	{
+		m_exit              = false;
+		m_active            = false;
+		m_numFramesInFlight = _numFramesInFlight;
+
+		const uint32_t numThreads = bx::min<uint32_t>(_numThreads, BGFX_CONFIG_MAX_RECORD_THREADS);
+		const uint32_t maxSets    = MAX_DESCRIPTOR_SETS / BGFX_CONFIG_MAX_FRAME_LATENCY;
+
+		VkDescriptorPoolSize dps[] =
+		{
+			{ VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE,          maxSets * BGFX_CONFIG_MAX_TEXTURE_SAMPLERS },
+			{ VK_DESCRIPTOR_TYPE_SAMPLER,                maxSets * BGFX_CONFIG_MAX_TEXTURE_SAMPLERS },
+			{ VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, maxSets * 2                                },
+			{ VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,         maxSets * BGFX_CONFIG_MAX_TEXTURE_SAMPLERS },
+			{ VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,          maxSets * BGFX_CONFIG_MAX_TEXTURE_SAMPLERS },
+		};
+
+		VkDescriptorPoolCreateInfo dpci;
+		dpci.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+		dpci.pNext = NULL;
+		dpci.flags = 0;
+		dpci.maxSets       = maxSets;
+		dpci.poolSizeCount = BX_COUNTOF(dps);
+		dpci.pPoolSizes    = dps;
+
+		VkCommandPoolCreateInfo cpci;
+		cpci.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+		cpci.pNext = NULL;
+		cpci.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+		cpci.queueFamilyIndex = s_renderVK->m_globalQueueFamily;
+
+		const VkDevice device = s_renderVK->m_device;
+		const VkAllocationCallbacks* allocatorCb = s_renderVK->m_allocatorCb;
+
+		for (uint32_t ii = 0; ii < numThreads; ++ii)
+		{
+			RecordThreadVK& thread = m_thread[ii];
+
+			for (uint32_t jj = 0; jj < m_numFramesInFlight; ++jj)
+			{
+				thread.m_commandPool[jj]    = VK_NULL_HANDLE;
+				thread.m_descriptorPool[jj] = VK_NULL_HANDLE;
+			}
+		}
+
+		for (uint32_t ii = 0; ii < numThreads; ++ii)
+		{
+			RecordThreadVK& thread = m_thread[ii];
+
+			for (uint32_t jj = 0; jj < m_numFramesInFlight; ++jj)
+			{
+				VkResult result = vkCreateCommandPool(device, &cpci, allocatorCb, &thread.m_commandPool[jj]);
+
+				if (VK_SUCCESS == result)
+				{
+					result = vkCreateDescriptorPool(device, &dpci, allocatorCb, &thread.m_descriptorPool[jj]);
+				}
+
+				if (VK_SUCCESS != result)
+				{
+					BX_TRACE("Create record thread %d pools error: %d: %s.", ii, result, getName(result) );
+
+					for (uint32_t kk = 0; kk < numThreads; ++kk)
+					{
+						for (uint32_t ll = 0; ll < m_numFramesInFlight; ++ll)
+						{
+							vkDestroy(m_thread[kk].m_commandPool[ll]);
+							vkDestroy(m_thread[kk].m_descriptorPool[ll]);
+						}
+					}
+
+					return result;
+				}
+			}
+		}
+
+		for (uint32_t ii = 0; ii < numThreads; ++ii)
+		{
+			RecordThreadVK& thread = m_thread[ii];
+
+			for (uint32_t jj = 0; jj < m_numFramesInFlight; ++jj)
+			{
+				thread.m_scratchBuffer[jj].createUniform(128, g_caps.limits.maxDrawCalls);
+			}
+
+			thread.m_numCommandBuffers = 0;
+			thread.m_state.m_uniforms  = thread.m_uniforms;
+			thread.m_pool              = this;
+			thread.m_thread.init(workerThread, &thread, 0, "bgfx - record worker thread");
+		}
+
+		m_numThreads = numThreads;
+
+		BX_TRACE("Record worker threads: %d", m_numThreads);
+
+		return VK_SUCCESS;
+	}
+
+	void RecordThreadPoolVK::shutdown()
+	{
+		if (0 == m_numThreads)
+		{
+			return;
+		}
+
+		m_exit = true;
+		m_workSem.post(m_numThreads);
+
+		for (uint32_t ii = 0; ii < m_numThreads; ++ii)
+		{
+			RecordThreadVK& thread = m_thread[ii];
+			thread.m_thread.shutdown();
+
+			for (uint32_t jj = 0; jj < m_numFramesInFlight; ++jj)
+			{
+				// Destroying command pool frees all command buffers allocated from it.
+				vkDestroy(thread.m_commandPool[jj]);
+				vkDestroy(thread.m_descriptorPool[jj]);
+				thread.m_scratchBuffer[jj].destroy();
+				thread.m_commandBuffers[jj].clear();
+			}
+		}
+
+		bx::free(g_allocator, m_uniformData);
+		m_uniformData     = NULL;
+		m_uniformDataSize = 0;
+
+		m_numThreads = 0;
+	}
+
+	int32_t RecordThreadPoolVK::workerThread(bx::Thread* /*_self*/, void* _userData)
+	{
+		BGFX_PROFILER_SET_CURRENT_THREAD_NAME("bgfx - Record Worker Thread");
+
+		RecordThreadVK& thread = *(RecordThreadVK*)_userData;
+		RecordThreadPoolVK* pool = thread.m_pool;
+
+		for (;;)
+		{
+			pool->m_workSem.wait();
+
+			if (pool->m_exit)
+			{
+				break;
+			}
+
+			thread.m_state.m_viewState.reset(pool->m_render);
+
+			pool->work(thread);
+			pool->m_doneSem.post();
+		}
+
+		return 0;
+	}
+
+	void RecordThreadPoolVK::work(RecordThreadVK& _thread)
+	{
+		for (uint32_t idx = bx::atomicFetchAndAdd<uint32_t>(&m_next, 1)
+			; idx < m_numJobs
+			; idx = bx::atomicFetchAndAdd<uint32_t>(&m_next, 1)
+			)
+		{
+			RecordJobVK& job = m_job[idx];
+
+			RecordThreadVK::CommandBufferArray& commandBuffers = _thread.m_commandBuffers[m_frameInFlight];
+
+			if (_thread.m_numCommandBuffers == commandBuffers.size() )
+			{
+				VkCommandBufferAllocateInfo cbai;
+				cbai.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+				cbai.pNext = NULL;
+				cbai.commandPool = _thread.m_commandPool[m_frameInFlight];
+				cbai.level = VK_COMMAND_BUFFER_LEVEL_SECONDARY;
+				cbai.commandBufferCount = 1;
+
+				VkCommandBuffer commandBuffer;
+				VK_CHECK(vkAllocateCommandBuffers(s_renderVK->m_device, &cbai, &commandBuffer) );
+				commandBuffers.push_back(commandBuffer);
+			}
+
+			uint8_t* uniformData = &m_uniformData[job.m_uniformOffset];
+			for (uint32_t ii = 0; ii < BGFX_CONFIG_MAX_UNIFORMS; ++ii)
+			{
+				_thread.m_uniforms[ii] = &uniformData[m_uniformOffset[ii] ];
+			}
+
+			_thread.m_state.m_commandBuffer = commandBuffers[_thread.m_numCommandBuffers++];
+
+			BGFX_PROFILER_BEGIN(s_viewName[job.m_view], 0xff2040ff);
+			s_renderVK->recordDraws(_thread.m_state, m_render, job);
+			BGFX_PROFILER_END();
+
+			job.m_commandBuffer = _thread.m_state.m_commandBuffer;
+
+			bx::atomicFetchAndAdd<int32_t>(&job.m_done, 1);
+			m_jobSem.post();
+		}
+	}
+
+	void RecordThreadPoolVK::reserveUniformData(uint32_t _size)
+	{
+		if (m_uniformDataSize < _size)
+		{
+			m_uniformDataSize = bx::max<uint32_t>(_size, m_uniformDataSize*2);
+			m_uniformData     = (uint8_t*)bx::realloc(g_allocator, m_uniformData, m_uniformDataSize);
+		}
+
+		for (uint32_t ii = 0; ii < BGFX_CONFIG_MAX_UNIFORMS; ++ii)
+		{
+			m_shadow[ii] = &m_uniformData[m_uniformOffset[ii] ];
+		}
+	}
+
+	uint32_t RecordThreadPoolVK::begin(Frame* _render, uint32_t _frameInFlight)
+	{
+		m_numJobs = 0;
+
+		if (0 == m_numThreads)
+		{
+			return 0;
+		}
+
+		BGFX_PROFILER_SCOPE("bgfx/Record jobs", kColorView);
+
+		const uint32_t* uniformSize = s_renderVK->m_uniformSize;
+		void* const*    uniforms    = s_renderVK->m_uniforms;
+
+		uint32_t blockSize = 0;
+		for (uint32_t ii = 0; ii < BGFX_CONFIG_MAX_UNIFORMS; ++ii)
+		{
+			m_uniformOffset[ii] = blockSize;
+			blockSize += uniformSize[ii];
+		}
+
+		// Uniform data holds live shadow of renderer's uniforms in the first block, followed by
+		// snapshot of shadow at the beginning of each job.
+		const uint32_t shadowSize = bx::max<uint32_t>(blockSize, 16);
+
+		reserveUniformData(2*shadowSize);
+
+		for (uint32_t ii = 0; ii < BGFX_CONFIG_MAX_UNIFORMS; ++ii)
+		{
+			if (0 != uniformSize[ii])
+			{
+				bx::memCopy(m_shadow[ii], uniforms[ii], uniformSize[ii]);
+			}
+		}
+
+		SortKey key;
+		uint16_t view = UINT16_MAX;
+		bool eligible = false;
+		RecordJobVK* job = NULL;
+		uint32_t multiDrawRun = 0;
+
+		const uint32_t numItems = _render->m_numRenderItems;
+		for (uint32_t item = 0; item <= numItems; ++item)
+		{
+			const bool isCompute = item < numItems
+				? key.decode(_render->m_sortKeys[item], _render->m_viewRemap)
+				: false
+				;
+
+			if (item == numItems
+			||  key.m_view != view)
+			{
+				if (NULL != job
+				&&  eligible
+				&&  BGFX_CONFIG_RECORD_PARALLEL_MIN_ITEMS <= item - job->m_begin)
+				{
+					job->m_end = item;
+					++m_numJobs;
+				}
+
+				if (item == numItems)
+				{
+					break;
+				}
+
+				view = key.m_view;
+
+				while (multiDrawRun < _render->m_numMultiDrawRuns
+				&&     _render->m_multiDrawRun[multiDrawRun].m_item < item)
+				{
+					++multiDrawRun;
+				}
+
+				job = &m_job[m_numJobs];
+				job->m_begin         = item;
+				job->m_end           = item;
+				job->m_multiDrawRun  = multiDrawRun;
+				job->m_view          = view;
+				job->m_fbh           = _render->m_view[view].m_fbh;
+				job->m_commandBuffer = VK_NULL_HANDLE;
+				job->m_done          = 0;
+
+				const FrameBufferVK& fb = isValid(job->m_fbh)
+					? s_renderVK->m_frameBuffers[job->m_fbh.idx]
+					: s_renderVK->m_backBuffer
+					;
+
+				eligible = fb.isRenderable();
+
+				if (eligible)
+				{
+					reserveUniformData( (m_numJobs + 2) * shadowSize);
+
+					job->m_uniformOffset = (m_numJobs + 1) * shadowSize;
+					bx::memCopy(&m_uniformData[job->m_uniformOffset], m_uniformData, blockSize);
+				}
+			}
+
+			const RenderItem& renderItem = _render->getRenderItem(_render->m_sortValues[item]);
+
+			if (isCompute)
+			{
+				// Compute and occlusion queries are recorded only by render thread.
+				eligible = false;
+
+				const RenderCompute& compute = renderItem.compute;
+				updateUniforms(m_shadow, _render->m_uniformBuffer[compute.m_uniformIdx], compute.m_uniformBegin, compute.m_uniformEnd);
+				continue;
+			}
+
+			const RenderDraw& draw = renderItem.draw;
+
+			if (0 != (draw.m_stateFlags & BGFX_STATE_INTERNAL_OCCLUSION_QUERY) )
+			{
+				eligible = false;
+			}
+
+			updateUniforms(m_shadow, _render->m_uniformBuffer[draw.m_uniformIdx], draw.m_uniformBegin, draw.m_uniformEnd);
+		}
+
+		if (0 < m_numJobs)
+		{
+			const VkDevice device = s_renderVK->m_device;
+
+			m_frameInFlight = _frameInFlight;
+
+			for (uint32_t ii = 0; ii < m_numThreads; ++ii)
+			{
+				RecordThreadVK& thread = m_thread[ii];
+
+				VK_CHECK(vkResetCommandPool(device, thread.m_commandPool[m_frameInFlight], 0) );
+				VK_CHECK(vkResetDescriptorPool(device, thread.m_descriptorPool[m_frameInFlight], 0) );
+
+				ScratchBufferVK& scratchBuffer = thread.m_scratchBuffer[m_frameInFlight];
+				scratchBuffer.reset();
+
+				thread.m_numCommandBuffers      = 0;
+				thread.m_state.m_scratchBuffer  = &scratchBuffer;
+				thread.m_state.m_descriptorPool = thread.m_descriptorPool[m_frameInFlight];
+				thread.m_state.resetStats();
+			}
+
+			m_render    = _render;
+			m_next      = 0;
+			m_numWaited = 0;
+			m_active    = true;
+
+			m_workSem.post(m_numThreads);
+		}
+
+		return m_numJobs;
+	}
+
+	VkCommandBuffer RecordThreadPoolVK::wait(uint32_t _idx)
+	{
+		RecordJobVK& job = m_job[_idx];
+
+		while (0 == bx::atomicFetchAndAdd<int32_t>(&job.m_done, 0) )
+		{
+			m_jobSem.wait();
+			++m_numWaited;
+		}
+
+		return job.m_commandBuffer;
+	}
+
+	void RecordThreadPoolVK::end()
+	{
+		if (!m_active)
+		{
+			return;
+		}
+
+		for (; m_numWaited < m_numJobs; ++m_numWaited)
+		{
+			m_jobSem.wait();
+		}
+
+		for (uint32_t ii = 0; ii < m_numThreads; ++ii)
+		{
+			m_doneSem.wait();
+		}
+
+		for (uint32_t ii = 0; ii < m_numThreads; ++ii)
+		{
+			m_thread[ii].m_scratchBuffer[m_frameInFlight].flush();
+		}
+
+		m_active = false;
+	}
+
+	PipelineCompilerVK::PipelineCompilerVK()
+		: m_exit(false)
+	{
+	}
+
+	void PipelineCompilerVK::init()
+	{
+		m_exit = false;
+		m_thread.init(compilerThread, this, 0, "bgfx - pipeline compiler thread");
+	}
+
+	void PipelineCompilerVK::shutdown()
+	{
+		if (!m_thread.isRunning() )
+		{
+			return;
+		}
+
+		wait();
+
+		m_exit = true;
+		m_workSem.post();
+		m_thread.shutdown();
+	}
+
+	bool PipelineCompilerVK::isPending(uint64_t _hash)
+	{
+		bx::MutexScope lock(m_mutex);
+		return m_pending.end() != m_pending.find(_hash);
+	}
+
+	void PipelineCompilerVK::request(const PipelineCompileJobVK& _job)
+	{
+		{
+			bx::MutexScope lock(m_mutex);
+			m_pending.insert(_job.m_hash);
+			m_jobs.push_back(_job);
+		}
+
+		m_workSem.post();
+	}
+
+	void PipelineCompilerVK::complete(uint64_t _hash)
+	{
+		{
+			bx::MutexScope lock(m_mutex);
+
+			HashSet::iterator it = m_pending.find(_hash);
+			if (it != m_pending.end() )
+			{
+				m_pending.erase(it);
+			}
+		}
+
+		m_doneSem.post();
+	}
+
+	void PipelineCompilerVK::wait()
+	{
+		while (0 != getNumPending() )
+		{
+			m_doneSem.wait();
+		}
+	}
+
+	uint32_t PipelineCompilerVK::getNumPending()
+	{
+		bx::MutexScope lock(m_mutex);
+		return uint32_t(m_pending.size() );
+	}
+
+	int32_t PipelineCompilerVK::compilerThread(bx::Thread* /*_self*/, void* _userData)
+	{
+		BGFX_PROFILER_SET_CURRENT_THREAD_NAME("bgfx - Pipeline Compiler Thread");
+
+		PipelineCompilerVK* compiler = (PipelineCompilerVK*)_userData;
+
+		for (;;)
+		{
+			compiler->m_workSem.wait();
+
+			if (compiler->m_exit)
+			{
+				break;
+			}
+
+			PipelineCompileJobVK job;
+
+			{
+				bx::MutexScope lock(compiler->m_mutex);
+				job = compiler->m_jobs[0];
+				compiler->m_jobs.erase(compiler->m_jobs.begin() );
+			}
+
+			s_renderVK->compilePipeline(job);
+		}
+
+		return 0;
+	}
+
+	Rect RendererContextVK::setViewRect(RecordStateVK& _rs, const Frame* _render, uint16_t _view, const FrameBufferVK& _fb)
+	{
+		_rs.m_view = _view;
+		_rs.m_viewState.m_rect = _render->m_view[_view].m_rect;
+
+		Rect rect        = _render->m_view[_view].m_rect;
+		Rect scissorRect = _render->m_view[_view].m_scissor;
+		_rs.m_viewHasScissor  = !scissorRect.isZero();
+		_rs.m_viewScissorRect = _rs.m_viewHasScissor ? scissorRect : rect;
+		_rs.m_restoreScissor  = false;
+
+		// Clamp the rect to what's valid according to Vulkan.
+		rect.m_width = bx::min(rect.m_width, _fb.m_width - rect.m_x);
+		rect.m_height = bx::min(rect.m_height, _fb.m_height - rect.m_y);
+
+		VkViewport vp;
+		vp.x        =  float(rect.m_x);
+		vp.y        =  float(rect.m_y + rect.m_height);
+		vp.width    =  float(rect.m_width);
+		vp.height   = -float(rect.m_height);
+		vp.minDepth = 0.0f;
+		vp.maxDepth = 1.0f;
+		vkCmdSetViewport(_rs.m_commandBuffer, 0, 1, &vp);
+
+		VkRect2D rc;
+		rc.offset.x      = _rs.m_viewScissorRect.m_x;
+		rc.offset.y      = _rs.m_viewScissorRect.m_y;
+		rc.extent.width  = _rs.m_viewScissorRect.m_width;
+		rc.extent.height = _rs.m_viewScissorRect.m_height;
+		vkCmdSetScissor(_rs.m_commandBuffer, 0, 1, &rc);
+
+		return rect;
+	}
+
+	void RendererContextVK::submitDraw(RecordStateVK& _rs, Frame* _render, const SortKey& _key, const RenderDraw& _draw, const RenderBind& _renderBind, uint32_t _renderBindHash, const MultiDrawRun* _multiDraw)
+	{
+		const uint64_t f0 = BGFX_STATE_BLEND_FACTOR;
+		const uint64_t f1 = BGFX_STATE_BLEND_INV_FACTOR;
+		const uint64_t f2 = BGFX_STATE_BLEND_FACTOR<<4;
+		const uint64_t f3 = BGFX_STATE_BLEND_INV_FACTOR<<4;
+
+		const bool hasOcclusionQuery = 0 != (_draw.m_stateFlags & BGFX_STATE_INTERNAL_OCCLUSION_QUERY);
+
+		const uint64_t changedFlags = _rs.m_currentState.m_stateFlags ^ _draw.m_stateFlags;
+		_rs.m_currentState.m_stateFlags = _draw.m_stateFlags;
+
+		if (0 != _draw.m_streamMask)
+		{
+			const bool bindAttribs = false
+				|| hasVertexStreamChanged(_rs.m_currentState, _draw)
+				|| _rs.m_multiDrawBound != (NULL != _multiDraw)
+				;
+
+			_rs.m_multiDrawBound = NULL != _multiDraw;
+
+			_rs.m_currentState.m_streamMask         = _draw.m_streamMask;
+			_rs.m_currentState.m_instanceDataBuffer = _draw.m_instanceDataBuffer;
+			_rs.m_currentState.m_instanceDataOffset = _draw.m_instanceDataOffset;
+			_rs.m_currentState.m_instanceDataStride = _draw.m_instanceDataStride;
+
+			const VertexLayout* layouts[BGFX_CONFIG_MAX_VERTEX_STREAMS];
+			VkBuffer streamBuffers[BGFX_CONFIG_MAX_VERTEX_STREAMS + 1];
+			VkDeviceSize streamOffsets[BGFX_CONFIG_MAX_VERTEX_STREAMS + 1];
+			uint8_t numStreams = 0;
+			uint32_t numVertices = _draw.m_numVertices;
+			if (UINT8_MAX != _draw.m_streamMask)
+			{
+				for (uint32_t idx = 0, streamMask = _draw.m_streamMask
+					; 0 != streamMask
+					; streamMask >>= 1, idx += 1, ++numStreams
+					)
+				{
+					const uint32_t ntz = bx::uint32_cnttz(streamMask);
+					streamMask >>= ntz;
+					idx         += ntz;
+
+					_rs.m_currentState.m_stream[idx] = _draw.m_stream[idx];
+
+					const VertexBufferHandle handle = _draw.m_stream[idx].m_handle;
+					const VertexBufferVK& vb = m_vertexBuffers[handle.idx];
+					const uint16_t decl = isValid(_draw.m_stream[idx].m_layoutHandle)
+						? _draw.m_stream[idx].m_layoutHandle.idx
+						: vb.m_layoutHandle.idx
+						;
+					const VertexLayout& layout = m_vertexLayouts[decl];
+					const uint32_t stride = layout.m_stride;
+
+					streamBuffers[numStreams] = m_vertexBuffers[handle.idx].m_buffer;
+					streamOffsets[numStreams] = _draw.m_stream[idx].m_startVertex * stride;
+					layouts[numStreams]       = &layout;
+
+					numVertices = bx::uint32_min(UINT32_MAX == _draw.m_numVertices
+						? vb.m_size/stride
+						: _draw.m_numVertices
+						, numVertices
+						);
+				}
+			}
+
+			if (bindAttribs)
+			{
+				uint32_t numVertexBuffers = numStreams;
+
+				if (isValid(_draw.m_instanceDataBuffer) )
+				{
+					streamOffsets[numVertexBuffers] = _draw.m_instanceDataOffset;
+					streamBuffers[numVertexBuffers] = m_vertexBuffers[_draw.m_instanceDataBuffer.idx].m_buffer;
+					numVertexBuffers++;
+				}
+				else if (NULL != _multiDraw)
+				{
+					streamOffsets[numVertexBuffers] = 0;
+					streamBuffers[numVertexBuffers] = m_multiDrawBuffer;
+					numVertexBuffers++;
+				}
+
+				if (0 < numVertexBuffers)
+				{
+					vkCmdBindVertexBuffers(
+						  _rs.m_commandBuffer
+						, 0
+						, numVertexBuffers
+						, &streamBuffers[0]
+						, streamOffsets
+						);
+				}
+			}
+
+			ProgramHandle programHandle = _key.m_program;
+
+			const uint8_t numInstanceData = NULL != _multiDraw
+				? uint8_t(sizeof(Matrix4)/16)
+				: uint8_t(_draw.m_instanceDataStride/16)
+				;
+			const uint32_t numDraws = NULL != _multiDraw ? _multiDraw->m_num : 1;
+
+			VkPipeline pipeline =
+				getPipeline(_draw.m_stateFlags
+					, _draw.m_stencil
+					, numStreams
+					, layouts
+					, programHandle
+					, numInstanceData
+					, _rs.m_fbh
+					, m_asyncPipeline
+					);
+
+			if (VK_NULL_HANDLE == pipeline)
+			{
+				// Multi-draw run can be substituted only by program that also reads model
+				// transform from instance data.
+				if (isValid(_render->m_fallbackProgram)
+				&&  (NULL == _multiDraw || _render->isMultiDrawProgram(_render->m_fallbackProgram) ) )
+				{
+					programHandle = _render->m_fallbackProgram;
+					pipeline = getPipeline(_draw.m_stateFlags
+						, _draw.m_stencil
+						, numStreams
+						, layouts
+						, programHandle
+						, numInstanceData
+						, _rs.m_fbh
+						, m_asyncPipeline
+						);
+				}
+
+				if (VK_NULL_HANDLE == pipeline)
+				{
+					// Pipeline is still being compiled, force uniforms to be committed by
+					// the next draw call since this one is skipped.
+					_rs.m_currentProgram = BGFX_INVALID_HANDLE;
+					_rs.m_numDrawsSkipped += numDraws;
+					return;
+				}
+
+				_rs.m_numDrawsFallback += numDraws;
+			}
+
+			if (_rs.m_currentPipeline != pipeline)
+			{
+				_rs.m_currentPipeline = pipeline;
+				vkCmdBindPipeline(_rs.m_commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
+			}
+
+			const bool hasStencil = 0 != _draw.m_stencil;
+
+			if (hasStencil
+			&&  _rs.m_currentState.m_stencil != _draw.m_stencil)
+			{
+				_rs.m_currentState.m_stencil = _draw.m_stencil;
+
+				const uint32_t fstencil = unpackStencil(0, _draw.m_stencil);
+				const uint32_t ref = (fstencil&BGFX_STENCIL_FUNC_REF_MASK)>>BGFX_STENCIL_FUNC_REF_SHIFT;
+				vkCmdSetStencilReference(_rs.m_commandBuffer, VK_STENCIL_FRONT_AND_BACK, ref);
+			}
+
+			const bool hasFactor = 0
+				|| f0 == (_draw.m_stateFlags & f0)
+				|| f1 == (_draw.m_stateFlags & f1)
+				|| f2 == (_draw.m_stateFlags & f2)
+				|| f3 == (_draw.m_stateFlags & f3)
+				;
+
+			if (hasFactor
+			&&  _rs.m_blendFactor != _draw.m_rgba)
+			{
+				_rs.m_blendFactor = _draw.m_rgba;
+
+				float bf[4];
+				bf[0] = ( (_draw.m_rgba>>24)     )/255.0f;
+				bf[1] = ( (_draw.m_rgba>>16)&0xff)/255.0f;
+				bf[2] = ( (_draw.m_rgba>> 8)&0xff)/255.0f;
+				bf[3] = ( (_draw.m_rgba    )&0xff)/255.0f;
+				vkCmdSetBlendConstants(_rs.m_commandBuffer, bf);
+			}
+
+			const uint16_t scissor = _draw.m_scissor;
+
+			if (_rs.m_currentState.m_scissor != scissor)
+			{
+				_rs.m_currentState.m_scissor = scissor;
+
+				if (UINT16_MAX == scissor)
+				{
+					if (_rs.m_restoreScissor
+					||  _rs.m_viewHasScissor)
+					{
+						_rs.m_restoreScissor = false;
+						VkRect2D rc;
+						rc.offset.x      = _rs.m_viewScissorRect.m_x;
+						rc.offset.y      = _rs.m_viewScissorRect.m_y;
+						rc.extent.width  = _rs.m_viewScissorRect.m_width;
+						rc.extent.height = _rs.m_viewScissorRect.m_height;
+						vkCmdSetScissor(_rs.m_commandBuffer, 0, 1, &rc);
+					}
+				}
+				else
+				{
+					_rs.m_restoreScissor = true;
+					Rect scissorRect;
+					scissorRect.setIntersect(_rs.m_viewScissorRect, _render->m_frameCache.m_rectCache.m_cache[scissor]);
+
+					VkRect2D rc;
+					rc.offset.x      = scissorRect.m_x;
+					rc.offset.y      = scissorRect.m_y;
+					rc.extent.width  = scissorRect.m_width;
+					rc.extent.height = scissorRect.m_height;
+					vkCmdSetScissor(_rs.m_commandBuffer, 0, 1, &rc);
+				}
+			}
+
+			const bool hasUniformBlock = isValid(_draw.m_uniformBlock);
+
+			bool constantsChanged = false;
+			if (_draw.m_uniformBegin < _draw.m_uniformEnd
+			||  hasUniformBlock
+			||  _rs.m_currentProgram.idx != programHandle.idx
+			||  BGFX_STATE_ALPHA_REF_MASK & changedFlags)
+			{
+				_rs.m_currentProgram = programHandle;
+				ProgramVK& program = m_program[_rs.m_currentProgram.idx];
+
+				// When shader constants match uniform block layout, block data is copied into
+				// constants as is, instead of committing uniform by uniform.
+				const UniformBlock* block = NULL;
+				const uint8_t* blockData  = NULL;
+
+				if (hasUniformBlock
+				&&  _draw.m_uniformBegin == _draw.m_uniformEnd)
+				{
+					block     = &rendererGetUniformBlock(_draw.m_uniformBlock);
+					blockData = _render->getUniformBlockData(_draw);
+				}
+
+				UniformBuffer* vcb = program.m_vsh->m_constantBuffer;
+				if (NULL != vcb
+				&& (NULL == block || !_rs.commit(0, *program.m_vsh, *block, blockData) ) )
+				{
+					_rs.commit(*vcb);
+				}
+
+				if (NULL != program.m_fsh)
+				{
+					UniformBuffer* fcb = program.m_fsh->m_constantBuffer;
+					if (NULL != fcb
+					&& (NULL == block || !_rs.commit(1, *program.m_fsh, *block, blockData) ) )
+					{
+						_rs.commit(*fcb);
+					}
+				}
+
+				_rs.m_hasPredefined = 0 < program.m_numPredefined;
+				constantsChanged = true;
+			}
+
+			const ProgramVK& program = m_program[_rs.m_currentProgram.idx];
+
+			if (_rs.m_hasPredefined)
+			{
+				uint32_t ref = (_draw.m_stateFlags & BGFX_STATE_ALPHA_REF_MASK) >> BGFX_STATE_ALPHA_REF_SHIFT;
+				_rs.m_viewState.m_alphaRef = ref / 255.0f;
+				_rs.m_viewState.setPredefined<4>(&_rs, _rs.m_view, program, _render, _draw);
+			}
+
+			if (VK_NULL_HANDLE != program.m_descriptorSetLayout)
+			{
+				const uint32_t vsize = program.m_vsh->m_size;
+				const uint32_t fsize = NULL != program.m_fsh ? program.m_fsh->m_size : 0;
+				uint32_t numOffset = 0;
+				uint32_t offsets[2] = { 0, 0 };
+
+				if (constantsChanged
+				||  _rs.m_hasPredefined)
+				{
+					if (vsize > 0)
+					{
+						offsets[numOffset++] = _rs.m_scratchBuffer->write(_rs.m_vsScratch, vsize);
+					}
+
+					if (fsize > 0)
+					{
+						offsets[numOffset++] = _rs.m_scratchBuffer->write(_rs.m_fsScratch, fsize);
+					}
+				}
+
+				bx::HashMurmur2A hash;
+				hash.begin();
+				hash.add(program.m_descriptorSetLayout);
+				hash.add(_renderBindHash);
+				hash.add(vsize);
+				hash.add(fsize);
+				const uint32_t bindHash = hash.end();
+
+				if (_rs.m_currentBindHash != bindHash)
+				{
+					_rs.m_currentBindHash = bindHash;
+
+					_rs.m_currentDescriptorSet = getDescriptorSet(
+						  program
+						, _renderBind
+						, *_rs.m_scratchBuffer
+						, _rs.m_descriptorPool
+						, _render->m_colorPalette
+					);
+
+					_rs.m_numDescriptorSets++;
+				}
+
+				vkCmdBindDescriptorSets(
+					  _rs.m_commandBuffer
+					, VK_PIPELINE_BIND_POINT_GRAPHICS
+					, program.m_pipelineLayout
+					, 0
+					, 1
+					, &_rs.m_currentDescriptorSet
+					, numOffset
+					, offsets
+					);
+			}
+
+			VkBuffer bufferIndirect = VK_NULL_HANDLE;
+			VkBuffer bufferNumIndirect = VK_NULL_HANDLE;
+			uint32_t numDrawIndirect = 0;
+			uint32_t bufferOffsetIndirect = 0;
+			uint32_t bufferNumOffsetIndirect = 0;
+			if (isValid(_draw.m_indirectBuffer) )
+			{
+				const VertexBufferVK& vb = m_vertexBuffers[_draw.m_indirectBuffer.idx];
+				bufferIndirect = vb.m_buffer;
+				numDrawIndirect = UINT32_MAX == _draw.m_numIndirect
+					? vb.m_size / BGFX_CONFIG_DRAW_INDIRECT_STRIDE
+					: _draw.m_numIndirect
+					;
+				bufferOffsetIndirect = _draw.m_startIndirect * BGFX_CONFIG_DRAW_INDIRECT_STRIDE;
+
+				if (isValid(_draw.m_numIndirectBuffer) )
+				{
+					bufferNumIndirect = m_indexBuffers[_draw.m_numIndirectBuffer.idx].m_buffer;
+					bufferNumOffsetIndirect = _draw.m_numIndirectIndex * sizeof(uint32_t);
+				}
+			}
+
+			if (hasOcclusionQuery)
+			{
+				m_occlusionQuery.begin(_draw.m_occlusionQuery);
+			}
+
+			const uint8_t primIndex = uint8_t((_draw.m_stateFlags & BGFX_STATE_PT_MASK) >> BGFX_STATE_PT_SHIFT);
+			const PrimInfo& prim = s_primInfo[primIndex];
+
+			uint32_t numPrimsSubmitted = 0;
+			uint32_t numIndices = 0;
+
+			if (!isValid(_draw.m_indexBuffer) )
+			{
+				numPrimsSubmitted = numVertices / prim.m_div - prim.m_sub;
+
+				if (isValid(_draw.m_indirectBuffer) )
+				{
+					if (isValid(_draw.m_numIndirectBuffer) )
+					{
+						vkCmdDrawIndirectCountKHR(
+							  _rs.m_commandBuffer
+							, bufferIndirect
+							, bufferOffsetIndirect
+							, bufferNumIndirect
+							, bufferNumOffsetIndirect
+							, numDrawIndirect
+							, BGFX_CONFIG_DRAW_INDIRECT_STRIDE
+							);
+					}
+					else
+					{
+						vkCmdDrawIndirect(
+							  _rs.m_commandBuffer
+							, bufferIndirect
+							, bufferOffsetIndirect
+							, numDrawIndirect
+							, BGFX_CONFIG_DRAW_INDIRECT_STRIDE
+							);
+					}
+				}
+				else
+				{
+					vkCmdDraw(
+						  _rs.m_commandBuffer
+						, numVertices
+						, _draw.m_numInstances
+						, 0
+						, 0
+						);
+				}
+			}
+			else
+			{
+				const bool isIndex16          = _draw.isIndex16();
+				const uint32_t indexSize      = isIndex16 ? 2 : 4;
+				const VkIndexType indexFormat = isIndex16 ? VK_INDEX_TYPE_UINT16 : VK_INDEX_TYPE_UINT32;
+				const BufferVK& ib            = m_indexBuffers[_draw.m_indexBuffer.idx];
+
+				numIndices = UINT32_MAX == _draw.m_numIndices
+					? ib.m_size / indexSize
+					: _draw.m_numIndices
+					;
+
+				numPrimsSubmitted = numIndices / prim.m_div - prim.m_sub;
+
+				if (_rs.m_currentState.m_indexBuffer.idx != _draw.m_indexBuffer.idx
+				||  _rs.m_currentIndexFormat != indexFormat)
+				{
+					_rs.m_currentState.m_indexBuffer = _draw.m_indexBuffer;
+					_rs.m_currentIndexFormat = indexFormat;
+
+					vkCmdBindIndexBuffer(
+						  _rs.m_commandBuffer
+						, m_indexBuffers[_draw.m_indexBuffer.idx].m_buffer
+						, 0
+						, indexFormat
+						);
+				}
+
+				if (NULL != _multiDraw)
+				{
+					numIndices        = 0;
+					numPrimsSubmitted = 0;
+
+					for (uint32_t ii = 0; ii < _multiDraw->m_num; ++ii)
+					{
+						const RenderDraw& batched = _render->getRenderItem(_render->m_sortValues[_multiDraw->m_item+ii]).draw;
+						numIndices        += batched.m_numIndices;
+						numPrimsSubmitted += batched.m_numIndices / prim.m_div - prim.m_sub;
+					}
+
+					vkCmdDrawIndexedIndirect(
+						  _rs.m_commandBuffer
+						, m_multiDrawBuffer
+						, m_multiDrawCmdOffset + _multiDraw->m_first*sizeof(VkDrawIndexedIndirectCommand)
+						, _multiDraw->m_num
+						, sizeof(VkDrawIndexedIndirectCommand)
+						);
+
+					_rs.m_numMultiDraw++;
+					_rs.m_numMultiDrawItems += _multiDraw->m_num;
+				}
+				else if (isValid(_draw.m_indirectBuffer) )
+				{
+					if (isValid(_draw.m_numIndirectBuffer) )
+					{
+						vkCmdDrawIndexedIndirectCountKHR(
+							  _rs.m_commandBuffer
+							, bufferIndirect
+							, bufferOffsetIndirect
+							, bufferNumIndirect
+							, bufferNumOffsetIndirect
+							, numDrawIndirect
+							, BGFX_CONFIG_DRAW_INDIRECT_STRIDE
+							);
+					}
+					else
+					{
+						vkCmdDrawIndexedIndirect(
+							  _rs.m_commandBuffer
+							, bufferIndirect
+							, bufferOffsetIndirect
+							, numDrawIndirect
+							, BGFX_CONFIG_DRAW_INDIRECT_STRIDE
+							);
+					}
+				}
+				else
+				{
+					vkCmdDrawIndexed(
+						  _rs.m_commandBuffer
+						, numIndices
+						, _draw.m_numInstances
+						, _draw.m_startIndex
+						, 0
+						, 0
+						);
+				}
+			}
+
+			uint32_t numPrimsRendered  = numPrimsSubmitted*_draw.m_numInstances;
+
+			_rs.m_numPrimsSubmitted[primIndex] += numPrimsSubmitted;
+			_rs.m_numPrimsRendered[primIndex]  += numPrimsRendered;
+			_rs.m_numInstances[primIndex]      += _draw.m_numInstances*numDraws;
+			_rs.m_numIndices                   += numIndices;
+
+			if (hasOcclusionQuery)
+			{
+				m_occlusionQuery.end();
+			}
+		}
+	}
+
+	void RendererContextVK::recordDraws(RecordStateVK& _rs, Frame* _render, const RecordJobVK& _job)
+	{
+		const FrameBufferVK& fb = isValid(_job.m_fbh)
+			? m_frameBuffers[_job.m_fbh.idx]
+			: m_backBuffer
+			;
+
+		VkCommandBufferInheritanceInfo cbii;
+		cbii.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+		cbii.pNext = NULL;
+		cbii.renderPass  = fb.m_renderPass;
+		cbii.subpass     = 0;
+		cbii.framebuffer = VK_NULL_HANDLE;
+		cbii.occlusionQueryEnable = VK_FALSE;
+		cbii.queryFlags           = 0;
+		cbii.pipelineStatistics   = 0;
+
+		VkCommandBufferBeginInfo cbbi;
+		cbbi.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+		cbbi.pNext = NULL;
+		cbbi.flags = 0
+			| VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT
+			| VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT
+			;
+		cbbi.pInheritanceInfo = &cbii;
+
+		VK_CHECK(vkBeginCommandBuffer(_rs.m_commandBuffer, &cbbi) );
+
+		_rs.m_fbh = _job.m_fbh;
+		_rs.reset();
+		setViewRect(_rs, _render, _job.m_view, fb);
+
+		SortKey key;
+		uint16_t hashedBindIdx  = kInvalidHandle;
+		uint32_t renderBindHash = 0;
+		uint32_t multiDrawIdx   = _job.m_multiDrawRun;
+		bool first = true;
+
+		for (uint32_t item = _job.m_begin; item < _job.m_end; ++item)
+		{
+			key.decode(_render->m_sortKeys[item], _render->m_viewRemap);
+
+			const RenderItem& renderItem = _render->getRenderItem(_render->m_sortValues[item]);
+			const RenderDraw& draw       = renderItem.draw;
+			const RenderBind& renderBind = _render->getRenderBind(draw.m_bindIdx);
+			if (hashedBindIdx != draw.m_bindIdx)
+			{
+				hashedBindIdx  = draw.m_bindIdx;
+				renderBindHash = bx::hash<bx::HashMurmur2A>(renderBind.m_bind, sizeof(renderBind.m_bind) );
+			}
+
+			updateUniforms(_rs.m_uniforms, _render->m_uniformBuffer[draw.m_uniformIdx], draw.m_uniformBegin, draw.m_uniformEnd);
+			updateUniformBlock(_rs.m_uniforms, _render, draw);
+
+			const bool occluded = true
+				&& isValid(draw.m_occlusionQuery)
+				&& !isVisible(_render, draw.m_occlusionQuery, 0 != (draw.m_submitFlags & BGFX_SUBMIT_INTERNAL_OCCLUSION_VISIBLE) )
+				;
+
+			if (occluded
+			||  0 == draw.m_streamMask
+			||  _render->m_frameCache.isZeroArea(_rs.m_viewScissorRect, draw.m_scissor) )
+			{
+				continue;
+			}
+
+			if (first)
+			{
+				first = false;
+				_rs.m_currentState.m_scissor = !draw.m_scissor;
+			}
+
+			const MultiDrawRun* multiDraw = findMultiDrawRun(_render, multiDrawIdx, item);
+
+			if (NULL != multiDraw)
+			{
+				item += multiDraw->m_num-1;
+			}
+
+			submitDraw(_rs, _render, key, draw, renderBind, renderBindHash, multiDraw);
+		}
+
+		VK_CHECK(vkEndCommandBuffer(_rs.m_commandBuffer) );
+	}
+
+	void RendererContextVK::submitBlit(BlitState& _bs, uint16_t _view)
+	{
+		BGFX_PROFILER_SCOPE("RendererContextVK::submitBlit", kColorFrame);
+		VkImageLayout srcLayouts[BGFX_CONFIG_MAX_BLIT_ITEMS];
+		VkImageLayout dstLayouts[BGFX_CONFIG_MAX_BLIT_ITEMS];
+
+		BlitState bs0 = _bs;
+
+		while (bs0.hasItem(_view) )
+		{
+			uint16_t item = bs0.m_item;
+
+			const BlitItem& blit = bs0.advance();
+
+			TextureVK& src = m_textures[blit.m_src.idx];
+			TextureVK& dst = m_textures[blit.m_dst.idx];
+
+			srcLayouts[item] = VK_NULL_HANDLE != src.m_singleMsaaImage ? src.m_currentSingleMsaaImageLayout : src.m_currentImageLayout;
+			dstLayouts[item] = dst.m_currentImageLayout;
+		}
+
+		bs0 = _bs;
+
+		while (bs0.hasItem(_view) )
+		{
+			const BlitItem& blit = bs0.advance();
+
+			TextureVK& src = m_textures[blit.m_src.idx];
+			TextureVK& dst = m_textures[blit.m_dst.idx];
+
+			src.setImageMemoryBarrier(
+				  m_commandBuffer
+				, blit.m_src.idx == blit.m_dst.idx ? VK_IMAGE_LAYOUT_GENERAL : VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL
+				, VK_NULL_HANDLE != src.m_singleMsaaImage
+				);
+
+			if (blit.m_src.idx != blit.m_dst.idx)
+			{
+				dst.setImageMemoryBarrier(m_commandBuffer, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+			}
+
+			const uint16_t srcSamples = VK_NULL_HANDLE != src.m_singleMsaaImage ? 1 : src.m_sampler.Count;
+			const uint16_t dstSamples = dst.m_sampler.Count;
+			BX_UNUSED(srcSamples, dstSamples);
+
+			BX_ASSERT(
+				  srcSamples == dstSamples
+				, "Mismatching texture sample count (%d != %d)."
+				, srcSamples
+				, dstSamples
+				);
+
+			VkImageCopy copyInfo;
+			copyInfo.srcSubresource.aspectMask     = src.m_aspectMask;
+			copyInfo.srcSubresource.mipLevel       = blit.m_srcMip;
+			copyInfo.srcSubresource.baseArrayLayer = 0;
 			copyInfo.srcSubresource.layerCount     = 1;
 			copyInfo.srcOffset.x = blit.m_srcX;
 			copyInfo.srcOffset.y = blit.m_srcY;
@@ -8455,57 +10551,48 @@ VK_DESTROY
 
 		_render->sort();
 
-		RenderDraw currentState;
-		currentState.clear();
-		currentState.m_stateFlags = BGFX_STATE_NONE;
-		currentState.m_stencil    = packStencil(BGFX_STENCIL_NONE, BGFX_STENCIL_NONE);
-
-		static ViewState viewState;
-		viewState.reset(_render);
+		if (m_multiDrawSupport
+		&&  0 != _render->m_numMultiDrawRuns)
+		{
+			updateMultiDraw(_render);
+		}
 
 		bool wireframe = !!(_render->m_debug&BGFX_DEBUG_WIREFRAME);
 		setDebugWireframe(wireframe);
 
-		ProgramHandle currentProgram = BGFX_INVALID_HANDLE;
-		bool hasPredefined = false;
-		VkPipeline currentPipeline = VK_NULL_HANDLE;
-		VkDescriptorSet currentDescriptorSet = VK_NULL_HANDLE;
-		uint32_t currentBindHash = 0;
-		uint32_t descriptorSetCount = 0;
-		VkIndexType currentIndexFormat = VK_INDEX_TYPE_MAX_ENUM;
+		uint16_t hashedBindIdx   = kInvalidHandle;
+		uint32_t renderBindHash  = 0;
 		SortKey key;
 		uint16_t view = UINT16_MAX;
 		FrameBufferHandle fbh = { BGFX_CONFIG_MAX_FRAME_BUFFERS };
 
 		BlitState bs(_render);
 
-		uint64_t blendFactor = UINT64_MAX;
-
-		bool wasCompute     = false;
-		bool viewHasScissor = false;
-		bool restoreScissor = false;
-		Rect viewScissorRect;
-		viewScissorRect.clear();
+		bool wasCompute = false;
 
 		bool isFrameBufferValid = false;
 
-		uint32_t statsNumPrimsSubmitted[BX_COUNTOF(s_primInfo)] = {};
-		uint32_t statsNumPrimsRendered[BX_COUNTOF(s_primInfo)] = {};
-		uint32_t statsNumInstances[BX_COUNTOF(s_primInfo)] = {};
-		uint32_t statsNumIndices = 0;
 		uint32_t statsKeyType[2] = {};
 
-		const uint64_t f0 = BGFX_STATE_BLEND_FACTOR;
-		const uint64_t f1 = BGFX_STATE_BLEND_INV_FACTOR;
-		const uint64_t f2 = BGFX_STATE_BLEND_FACTOR<<4;
-		const uint64_t f3 = BGFX_STATE_BLEND_INV_FACTOR<<4;
-
 		ScratchBufferVK& scratchBuffer = m_scratchBuffer[m_cmd.m_currentFrameInFlight];
 		scratchBuffer.reset();
 
 		ScratchBufferVK& scratchStagingBuffer = m_scratchStagingBuffer[m_cmd.m_currentFrameInFlight];
 		scratchStagingBuffer.reset();
 
+		RecordStateVK& rs = m_record;
+		rs.m_commandBuffer  = m_commandBuffer;
+		rs.m_scratchBuffer  = &scratchBuffer;
+		rs.m_descriptorPool = m_descriptorPool;
+		rs.m_fbh            = m_fbh;
+		rs.m_view           = UINT16_MAX;
+		rs.m_viewHasScissor = false;
+		rs.m_restoreScissor = false;
+		rs.m_viewScissorRect.clear();
+		rs.m_viewState.reset(_render);
+		rs.reset();
+		rs.resetStats();
+
 		setMemoryBarrier(
 			  m_commandBuffer
 			, VK_PIPELINE_STAGE_TRANSFER_BIT
@@ -8531,7 +10618,13 @@ VK_DESTROY
 
 		if (0 == (_render->m_debug&BGFX_DEBUG_IFH) )
 		{
-			viewState.m_rect = _render->m_view[0].m_rect;
+			rs.m_viewState.m_rect = _render->m_view[0].m_rect;
+
+			// Views which contain only draw calls are recorded on worker threads into
+			// secondary command buffers while render thread records everything else.
+			const uint32_t numRecordJobs = m_recordThreadPool.begin(_render, m_cmd.m_currentFrameInFlight);
+			uint32_t recordJob = 0;
+			uint32_t multiDrawIdx = 0;
 
 			int32_t numItems = _render->m_numRenderItems;
 			for (int32_t item = 0; item < numItems;)
@@ -8546,8 +10639,16 @@ VK_DESTROY
 					;
 
 				const uint32_t itemIdx       = _render->m_sortValues[item];
-				const RenderItem& renderItem = _render->m_renderItem[itemIdx];
-				const RenderBind& renderBind = _render->m_renderItemBind[itemIdx];
+				const RenderItem& renderItem = _render->getRenderItem(itemIdx);
+				const uint16_t bindIdx       = isCompute ? renderItem.compute.m_bindIdx : renderItem.draw.m_bindIdx;
+				const RenderBind& renderBind = _render->getRenderBind(bindIdx);
+				if (hashedBindIdx != bindIdx)
+				{
+					// Binding set content doesn't change during frame, hash it only once per run
+					// of render items sharing it.
+					hashedBindIdx  = bindIdx;
+					renderBindHash = bx::hash<bx::HashMurmur2A>(renderBind.m_bind, sizeof(renderBind.m_bind) );
+				}
 				++item;
 
 				if (viewChanged)
@@ -8559,8 +10660,8 @@ VK_DESTROY
 					}
 
 					view = key.m_view;
-					currentProgram = BGFX_INVALID_HANDLE;
-					hasPredefined  = false;
+					rs.m_currentProgram = BGFX_INVALID_HANDLE;
+					rs.m_hasPredefined  = false;
 
 					if (item > 1)
 					{
@@ -8579,6 +10680,8 @@ VK_DESTROY
 						setFrameBuffer(fbh);
 					}
 
+					rs.m_fbh = m_fbh;
+
 					const FrameBufferVK& fb = isValid(m_fbh)
 						? m_frameBuffers[m_fbh.idx]
 						: m_backBuffer
@@ -8588,16 +10691,8 @@ VK_DESTROY
 
 					if (isFrameBufferValid)
 					{
-						viewState.m_rect = _render->m_view[view].m_rect;
-						Rect rect        = _render->m_view[view].m_rect;
-						Rect scissorRect = _render->m_view[view].m_scissor;
-						viewHasScissor  = !scissorRect.isZero();
-						viewScissorRect = viewHasScissor ? scissorRect : rect;
-						restoreScissor = false;
-
-						// Clamp the rect to what's valid according to Vulkan.
-						rect.m_width = bx::min(rect.m_width, fb.m_width - rect.m_x);
-						rect.m_height = bx::min(rect.m_height, fb.m_height - rect.m_y);
+						const Rect rect = setViewRect(rs, _render, view, fb);
+
 						if (_render->m_view[view].m_rect.m_width != rect.m_width
 						 || _render->m_view[view].m_rect.m_height != rect.m_height)
 						{
@@ -8616,29 +10711,13 @@ VK_DESTROY
 						rpbi.renderArea.extent.width  = rect.m_width;
 						rpbi.renderArea.extent.height = rect.m_height;
 
-						VkViewport vp;
-						vp.x        =  float(rect.m_x);
-						vp.y        =  float(rect.m_y + rect.m_height);
-						vp.width    =  float(rect.m_width);
-						vp.height   = -float(rect.m_height);
-						vp.minDepth = 0.0f;
-						vp.maxDepth = 1.0f;
-						vkCmdSetViewport(m_commandBuffer, 0, 1, &vp);
-
-						VkRect2D rc;
-						rc.offset.x      = viewScissorRect.m_x;
-						rc.offset.y      = viewScissorRect.m_y;
-						rc.extent.width  = viewScissorRect.m_width;
-						rc.extent.height = viewScissorRect.m_height;
-						vkCmdSetScissor(m_commandBuffer, 0, 1, &rc);
-
 						const Clear& clr = _render->m_view[view].m_clear;
 						if (BGFX_CLEAR_NONE != clr.m_flags)
 						{
 							vkCmdBeginRenderPass(m_commandBuffer, &rpbi, VK_SUBPASS_CONTENTS_INLINE);
 
 							Rect clearRect = rect;
-							clearRect.setIntersect(rect, viewScissorRect);
+							clearRect.setIntersect(rect, rs.m_viewScissorRect);
 							clearQuad(clearRect, clr, _render->m_colorPalette);
 
 							vkCmdEndRenderPass(m_commandBuffer);
@@ -8646,6 +10725,46 @@ VK_DESTROY
 
 						submitBlit(bs, view);
 					}
+
+					if (recordJob < numRecordJobs
+					&&  m_recordThreadPool.getJob(recordJob).m_begin == uint32_t(item-1) )
+					{
+						const RecordJobVK& job = m_recordThreadPool.getJob(recordJob);
+
+						// Worker recorded draws from its own copy of uniforms, keep renderer's
+						// uniforms in sync for views that follow.
+						for (uint32_t ii = job.m_begin; ii < job.m_end; ++ii)
+						{
+							const RenderDraw& draw = _render->getRenderItem(_render->m_sortValues[ii]).draw;
+							rendererUpdateUniforms(this, _render->m_uniformBuffer[draw.m_uniformIdx], draw.m_uniformBegin, draw.m_uniformEnd);
+							rendererUpdateUniformBlock(this, _render, draw);
+						}
+
+						statsKeyType[0] += job.m_end - job.m_begin - 1;
+
+						if (wasCompute)
+						{
+							wasCompute = false;
+							rs.m_currentBindHash = 0;
+						}
+
+						BGFX_VK_PROFILER_END();
+						setViewType(view, " ");
+						BGFX_VK_PROFILER_BEGIN(view, kColorDraw);
+
+						const VkCommandBuffer commandBuffer = m_recordThreadPool.wait(recordJob);
+
+						vkCmdBeginRenderPass(m_commandBuffer, &rpbi, VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
+						vkCmdExecuteCommands(m_commandBuffer, 1, &commandBuffer);
+						vkCmdEndRenderPass(m_commandBuffer);
+
+						// Bound state is undefined after executing secondary command buffer.
+						rs.reset();
+
+						item = int32_t(job.m_end);
+						++recordJob;
+						continue;
+					}
 				}
 
 				if (isCompute)
@@ -8653,7 +10772,7 @@ VK_DESTROY
 					if (!wasCompute)
 					{
 						wasCompute = true;
-						currentBindHash = 0;
+						rs.m_currentBindHash = 0;
 
 						BGFX_VK_PROFILER_END();
 						setViewType(view, "C");
@@ -8672,39 +10791,39 @@ VK_DESTROY
 
 					const VkPipeline pipeline = getPipeline(key.m_program);
 
-					if (currentPipeline != pipeline)
+					if (rs.m_currentPipeline != pipeline)
 					{
-						currentPipeline = pipeline;
+						rs.m_currentPipeline = pipeline;
 						vkCmdBindPipeline(m_commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipeline);
 					}
 
 					bool constantsChanged = false;
 
 					if (compute.m_uniformBegin < compute.m_uniformEnd
-					||  currentProgram.idx != key.m_program.idx)
+					||  rs.m_currentProgram.idx != key.m_program.idx)
 					{
 						rendererUpdateUniforms(this, _render->m_uniformBuffer[compute.m_uniformIdx], compute.m_uniformBegin, compute.m_uniformEnd);
 
-						currentProgram = key.m_program;
-						ProgramVK& program = m_program[currentProgram.idx];
+						rs.m_currentProgram = key.m_program;
+						ProgramVK& program = m_program[rs.m_currentProgram.idx];
 
 						UniformBuffer* vcb = program.m_vsh->m_constantBuffer;
 
 						if (NULL != vcb)
 						{
-							commit(*vcb);
+							rs.commit(*vcb);
 						}
 
-						hasPredefined = 0 < program.m_numPredefined;
+						rs.m_hasPredefined = 0 < program.m_numPredefined;
 						constantsChanged = true;
 					}
 
-					const ProgramVK& program = m_program[currentProgram.idx];
+					const ProgramVK& program = m_program[rs.m_currentProgram.idx];
 
 					if (constantsChanged
-					||  hasPredefined)
+					||  rs.m_hasPredefined)
 					{
-						viewState.setPredefined<4>(this, view, program, _render, compute);
+						rs.m_viewState.setPredefined<4>(&rs, view, program, _render, compute);
 					}
 
 					if (VK_NULL_HANDLE != program.m_descriptorSetLayout)
@@ -8714,11 +10833,11 @@ VK_DESTROY
 						uint32_t offset = 0;
 
 						if (constantsChanged
-						||  hasPredefined)
+						||  rs.m_hasPredefined)
 						{
 							if (vsize > 0)
 							{
-								offset = scratchBuffer.write(m_vsScratch, vsize);
+								offset = scratchBuffer.write(rs.m_vsScratch, vsize);
 								++numOffset;
 							}
 						}
@@ -8726,23 +10845,24 @@ VK_DESTROY
 						bx::HashMurmur2A hash;
 						hash.begin();
 						hash.add(program.m_descriptorSetLayout);
-						hash.add(renderBind.m_bind, sizeof(renderBind.m_bind) );
+						hash.add(renderBindHash);
 						hash.add(vsize);
 						hash.add(0);
 						const uint32_t bindHash = hash.end();
 
-						if (currentBindHash != bindHash)
+						if (rs.m_currentBindHash != bindHash)
 						{
-							currentBindHash = bindHash;
+							rs.m_currentBindHash = bindHash;
 
-							currentDescriptorSet = getDescriptorSet(
+							rs.m_currentDescriptorSet = getDescriptorSet(
 								  program
 								, renderBind
 								, scratchBuffer
+								, m_descriptorPool
 								, _render->m_colorPalette
 							);
 
-							descriptorSetCount++;
+							rs.m_numDescriptorSets++;
 						}
 
 						vkCmdBindDescriptorSets(
@@ -8751,7 +10871,7 @@ VK_DESTROY
 							, program.m_pipelineLayout
 							, 0
 							, 1
-							, &currentDescriptorSet
+							, &rs.m_currentDescriptorSet
 							, numOffset
 							, &offset
 							);
@@ -8784,6 +10904,7 @@ VK_DESTROY
 				const RenderDraw& draw = renderItem.draw;
 
 				rendererUpdateUniforms(this, _render->m_uniformBuffer[draw.m_uniformIdx], draw.m_uniformBegin, draw.m_uniformEnd);
+				rendererUpdateUniformBlock(this, _render, draw);
 
 				const bool hasOcclusionQuery = 0 != (draw.m_stateFlags & BGFX_STATE_INTERNAL_OCCLUSION_QUERY);
 				{
@@ -8796,21 +10917,18 @@ VK_DESTROY
 					if (occluded
 					||  !isFrameBufferValid
 					||  0 == draw.m_streamMask
-					||  _render->m_frameCache.isZeroArea(viewScissorRect, draw.m_scissor) )
+					||  _render->m_frameCache.isZeroArea(rs.m_viewScissorRect, draw.m_scissor) )
 					{
 						continue;
 					}
 				}
 
-				const uint64_t changedFlags = currentState.m_stateFlags ^ draw.m_stateFlags;
-				currentState.m_stateFlags = draw.m_stateFlags;
-
 				if (!beginRenderPass)
 				{
 					if (wasCompute)
 					{
 						wasCompute = false;
-						currentBindHash = 0;
+						rs.m_currentBindHash = 0;
 					}
 
 					BGFX_VK_PROFILER_END();
@@ -8820,405 +10938,40 @@ VK_DESTROY
 					vkCmdBeginRenderPass(m_commandBuffer, &rpbi, VK_SUBPASS_CONTENTS_INLINE);
 					beginRenderPass = true;
 
-					currentProgram = BGFX_INVALID_HANDLE;
-					currentState.m_scissor = !draw.m_scissor;
+					rs.m_currentProgram = BGFX_INVALID_HANDLE;
+					rs.m_currentState.m_scissor = !draw.m_scissor;
 				}
 
-				if (0 != draw.m_streamMask)
-				{
-					const bool bindAttribs = hasVertexStreamChanged(currentState, draw);
-
-					currentState.m_streamMask         = draw.m_streamMask;
-					currentState.m_instanceDataBuffer = draw.m_instanceDataBuffer;
-					currentState.m_instanceDataOffset = draw.m_instanceDataOffset;
-					currentState.m_instanceDataStride = draw.m_instanceDataStride;
-
-					const VertexLayout* layouts[BGFX_CONFIG_MAX_VERTEX_STREAMS];
-					VkBuffer streamBuffers[BGFX_CONFIG_MAX_VERTEX_STREAMS + 1];
-					VkDeviceSize streamOffsets[BGFX_CONFIG_MAX_VERTEX_STREAMS + 1];
-					uint8_t numStreams = 0;
-					uint32_t numVertices = draw.m_numVertices;
-					if (UINT8_MAX != draw.m_streamMask)
-					{
-						for (uint32_t idx = 0, streamMask = draw.m_streamMask
-							; 0 != streamMask
-							; streamMask >>= 1, idx += 1, ++numStreams
-							)
-						{
-							const uint32_t ntz = bx::uint32_cnttz(streamMask);
-							streamMask >>= ntz;
-							idx         += ntz;
-
-							currentState.m_stream[idx] = draw.m_stream[idx];
-
-							const VertexBufferHandle handle = draw.m_stream[idx].m_handle;
-							const VertexBufferVK& vb = m_vertexBuffers[handle.idx];
-							const uint16_t decl = isValid(draw.m_stream[idx].m_layoutHandle)
-								? draw.m_stream[idx].m_layoutHandle.idx
-								: vb.m_layoutHandle.idx
-								;
-							const VertexLayout& layout = m_vertexLayouts[decl];
-							const uint32_t stride = layout.m_stride;
-
-							streamBuffers[numStreams] = m_vertexBuffers[handle.idx].m_buffer;
-							streamOffsets[numStreams] = draw.m_stream[idx].m_startVertex * stride;
-							layouts[numStreams]       = &layout;
-
-							numVertices = bx::uint32_min(UINT32_MAX == draw.m_numVertices
-								? vb.m_size/stride
-								: draw.m_numVertices
-								, numVertices
-								);
-						}
-					}
-
-					if (bindAttribs)
-					{
-						uint32_t numVertexBuffers = numStreams;
-
-						if (isValid(draw.m_instanceDataBuffer) )
-						{
-							streamOffsets[numVertexBuffers] = draw.m_instanceDataOffset;
-							streamBuffers[numVertexBuffers] = m_vertexBuffers[draw.m_instanceDataBuffer.idx].m_buffer;
-							numVertexBuffers++;
-						}
-
-						if (0 < numVertexBuffers)
-						{
-							vkCmdBindVertexBuffers(
-								  m_commandBuffer
-								, 0
-								, numVertexBuffers
-								, &streamBuffers[0]
-								, streamOffsets
-								);
-						}
-					}
-
-					const VkPipeline pipeline =
-						getPipeline(draw.m_stateFlags
-							, draw.m_stencil
-							, numStreams
-							, layouts
-							, key.m_program
-							, uint8_t(draw.m_instanceDataStride/16)
-							);
-
-					if (currentPipeline != pipeline)
-					{
-						currentPipeline = pipeline;
-						vkCmdBindPipeline(m_commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
-					}
-
-					const bool hasStencil = 0 != draw.m_stencil;
-
-					if (hasStencil
-					&&  currentState.m_stencil != draw.m_stencil)
-					{
-						currentState.m_stencil = draw.m_stencil;
-
-						const uint32_t fstencil = unpackStencil(0, draw.m_stencil);
-						const uint32_t ref = (fstencil&BGFX_STENCIL_FUNC_REF_MASK)>>BGFX_STENCIL_FUNC_REF_SHIFT;
-						vkCmdSetStencilReference(m_commandBuffer, VK_STENCIL_FRONT_AND_BACK, ref);
-					}
-
-					const bool hasFactor = 0
-						|| f0 == (draw.m_stateFlags & f0)
-						|| f1 == (draw.m_stateFlags & f1)
-						|| f2 == (draw.m_stateFlags & f2)
-						|| f3 == (draw.m_stateFlags & f3)
-						;
-
-					if (hasFactor
-					&&  blendFactor != draw.m_rgba)
-					{
-						blendFactor = draw.m_rgba;
-
-						float bf[4];
-						bf[0] = ( (draw.m_rgba>>24)     )/255.0f;
-						bf[1] = ( (draw.m_rgba>>16)&0xff)/255.0f;
-						bf[2] = ( (draw.m_rgba>> 8)&0xff)/255.0f;
-						bf[3] = ( (draw.m_rgba    )&0xff)/255.0f;
-						vkCmdSetBlendConstants(m_commandBuffer, bf);
-					}
-
-					const uint16_t scissor = draw.m_scissor;
-
-					if (currentState.m_scissor != scissor)
-					{
-						currentState.m_scissor = scissor;
-
-						if (UINT16_MAX == scissor)
-						{
-							if (restoreScissor
-							||  viewHasScissor)
-							{
-								restoreScissor = false;
-								VkRect2D rc;
-								rc.offset.x      = viewScissorRect.m_x;
-								rc.offset.y      = viewScissorRect.m_y;
-								rc.extent.width  = viewScissorRect.m_width;
-								rc.extent.height = viewScissorRect.m_height;
-								vkCmdSetScissor(m_commandBuffer, 0, 1, &rc);
-							}
-						}
-						else
-						{
-							restoreScissor = true;
-							Rect scissorRect;
-							scissorRect.setIntersect(viewScissorRect, _render->m_frameCache.m_rectCache.m_cache[scissor]);
-
-							VkRect2D rc;
-							rc.offset.x      = scissorRect.m_x;
-							rc.offset.y      = scissorRect.m_y;
-							rc.extent.width  = scissorRect.m_width;
-							rc.extent.height = scissorRect.m_height;
-							vkCmdSetScissor(m_commandBuffer, 0, 1, &rc);
-						}
-					}
-
-					bool constantsChanged = false;
-					if (draw.m_uniformBegin < draw.m_uniformEnd
-					||  currentProgram.idx != key.m_program.idx
-					||  BGFX_STATE_ALPHA_REF_MASK & changedFlags)
-					{
-						currentProgram = key.m_program;
-						ProgramVK& program = m_program[currentProgram.idx];
-
-						UniformBuffer* vcb = program.m_vsh->m_constantBuffer;
-						if (NULL != vcb)
-						{
-							commit(*vcb);
-						}
-
-						if (NULL != program.m_fsh)
-						{
-							UniformBuffer* fcb = program.m_fsh->m_constantBuffer;
-							if (NULL != fcb)
-							{
-								commit(*fcb);
-							}
-						}
-
-						hasPredefined = 0 < program.m_numPredefined;
-						constantsChanged = true;
-					}
-
-					const ProgramVK& program = m_program[currentProgram.idx];
-
-					if (hasPredefined)
-					{
-						uint32_t ref = (draw.m_stateFlags & BGFX_STATE_ALPHA_REF_MASK) >> BGFX_STATE_ALPHA_REF_SHIFT;
-						viewState.m_alphaRef = ref / 255.0f;
-						viewState.setPredefined<4>(this, view, program, _render, draw);
-					}
-
-					if (VK_NULL_HANDLE != program.m_descriptorSetLayout)
-					{
-						const uint32_t vsize = program.m_vsh->m_size;
-						const uint32_t fsize = NULL != program.m_fsh ? program.m_fsh->m_size : 0;
-						uint32_t numOffset = 0;
-						uint32_t offsets[2] = { 0, 0 };
-
-						if (constantsChanged
-						||  hasPredefined)
-						{
-							if (vsize > 0)
-							{
-								offsets[numOffset++] = scratchBuffer.write(m_vsScratch, vsize);
-							}
-
-							if (fsize > 0)
-							{
-								offsets[numOffset++] = scratchBuffer.write(m_fsScratch, fsize);
-							}
-						}
-
-						bx::HashMurmur2A hash;
-						hash.begin();
-						hash.add(program.m_descriptorSetLayout);
-						hash.add(renderBind.m_bind, sizeof(renderBind.m_bind) );
-						hash.add(vsize);
-						hash.add(fsize);
-						const uint32_t bindHash = hash.end();
-
-						if (currentBindHash != bindHash)
-						{
-							currentBindHash = bindHash;
-
-							currentDescriptorSet = getDescriptorSet(
-								  program
-								, renderBind
-								, scratchBuffer
-								, _render->m_colorPalette
-							);
-
-							descriptorSetCount++;
-						}
-
-						vkCmdBindDescriptorSets(
-							  m_commandBuffer
-							, VK_PIPELINE_BIND_POINT_GRAPHICS
-							, program.m_pipelineLayout
-							, 0
-							, 1
-							, &currentDescriptorSet
-							, numOffset
-							, offsets
-							);
-					}
-
-					VkBuffer bufferIndirect = VK_NULL_HANDLE;
-					VkBuffer bufferNumIndirect = VK_NULL_HANDLE;
-					uint32_t numDrawIndirect = 0;
-					uint32_t bufferOffsetIndirect = 0;
-					uint32_t bufferNumOffsetIndirect = 0;
-					if (isValid(draw.m_indirectBuffer) )
-					{
-						const VertexBufferVK& vb = m_vertexBuffers[draw.m_indirectBuffer.idx];
-						bufferIndirect = vb.m_buffer;
-						numDrawIndirect = UINT32_MAX == draw.m_numIndirect
-							? vb.m_size / BGFX_CONFIG_DRAW_INDIRECT_STRIDE
-							: draw.m_numIndirect
-							;
-						bufferOffsetIndirect = draw.m_startIndirect * BGFX_CONFIG_DRAW_INDIRECT_STRIDE;
-
-						if (isValid(draw.m_numIndirectBuffer) )
-						{
-							bufferNumIndirect = m_indexBuffers[draw.m_numIndirectBuffer.idx].m_buffer;
-							bufferNumOffsetIndirect = draw.m_numIndirectIndex * sizeof(uint32_t);
-						}
-					}
-
-					if (hasOcclusionQuery)
-					{
-						m_occlusionQuery.begin(draw.m_occlusionQuery);
-					}
-
-					const uint8_t primIndex = uint8_t((draw.m_stateFlags & BGFX_STATE_PT_MASK) >> BGFX_STATE_PT_SHIFT);
-					const PrimInfo& prim = s_primInfo[primIndex];
-
-					uint32_t numPrimsSubmitted = 0;
-					uint32_t numIndices = 0;
-
-					if (!isValid(draw.m_indexBuffer) )
-					{
-						numPrimsSubmitted = numVertices / prim.m_div - prim.m_sub;
-
-						if (isValid(draw.m_indirectBuffer) )
-						{
-							if (isValid(draw.m_numIndirectBuffer) )
-							{
-								vkCmdDrawIndirectCountKHR(
-									  m_commandBuffer
-									, bufferIndirect
-									, bufferOffsetIndirect
-									, bufferNumIndirect
-									, bufferNumOffsetIndirect
-									, numDrawIndirect
-									, BGFX_CONFIG_DRAW_INDIRECT_STRIDE
-									);
-							}
-							else
-							{
-								vkCmdDrawIndirect(
-									  m_commandBuffer
-									, bufferIndirect
-									, bufferOffsetIndirect
-									, numDrawIndirect
-									, BGFX_CONFIG_DRAW_INDIRECT_STRIDE
-									);
-							}
-						}
-						else
-						{
-							vkCmdDraw(
-								  m_commandBuffer
-								, numVertices
-								, draw.m_numInstances
-								, 0
-								, 0
-								);
-						}
-					}
-					else
-					{
-						const bool isIndex16          = draw.isIndex16();
-						const uint32_t indexSize      = isIndex16 ? 2 : 4;
-						const VkIndexType indexFormat = isIndex16 ? VK_INDEX_TYPE_UINT16 : VK_INDEX_TYPE_UINT32;
-						const BufferVK& ib            = m_indexBuffers[draw.m_indexBuffer.idx];
-
-						numIndices = UINT32_MAX == draw.m_numIndices
-							? ib.m_size / indexSize
-							: draw.m_numIndices
-							;
-
-						numPrimsSubmitted = numIndices / prim.m_div - prim.m_sub;
-
-						if (currentState.m_indexBuffer.idx != draw.m_indexBuffer.idx
-						||  currentIndexFormat != indexFormat)
-						{
-							currentState.m_indexBuffer = draw.m_indexBuffer;
-							currentIndexFormat = indexFormat;
+				const MultiDrawRun* multiDraw = findMultiDrawRun(_render, multiDrawIdx, uint32_t(item-1) );
 
-							vkCmdBindIndexBuffer(
-								  m_commandBuffer
-								, m_indexBuffers[draw.m_indexBuffer.idx].m_buffer
-								, 0
-								, indexFormat
-								);
-						}
+				if (NULL != multiDraw)
+				{
+					item += multiDraw->m_num-1;
+					statsKeyType[0] += multiDraw->m_num-1;
+				}
 
-						if (isValid(draw.m_indirectBuffer) )
-						{
-							if (isValid(draw.m_numIndirectBuffer) )
-							{
-								vkCmdDrawIndexedIndirectCountKHR(
-									  m_commandBuffer
-									, bufferIndirect
-									, bufferOffsetIndirect
-									, bufferNumIndirect
-									, bufferNumOffsetIndirect
-									, numDrawIndirect
-									, BGFX_CONFIG_DRAW_INDIRECT_STRIDE
-									);
-							}
-							else
-							{
-								vkCmdDrawIndexedIndirect(
-									  m_commandBuffer
-									, bufferIndirect
-									, bufferOffsetIndirect
-									, numDrawIndirect
-									, BGFX_CONFIG_DRAW_INDIRECT_STRIDE
-									);
-							}
-						}
-						else
-						{
-							vkCmdDrawIndexed(
-								  m_commandBuffer
-								, numIndices
-								, draw.m_numInstances
-								, draw.m_startIndex
-								, 0
-								, 0
-								);
-						}
-					}
+				submitDraw(rs, _render, key, draw, renderBind, renderBindHash, multiDraw);
+			}
 
-					uint32_t numPrimsRendered  = numPrimsSubmitted*draw.m_numInstances;
+			m_recordThreadPool.end();
 
-					statsNumPrimsSubmitted[primIndex] += numPrimsSubmitted;
-					statsNumPrimsRendered[primIndex]  += numPrimsRendered;
-					statsNumInstances[primIndex]      += draw.m_numInstances;
-					statsNumIndices                   += numIndices;
+			for (uint32_t ii = 0, num = 0 < numRecordJobs ? m_recordThreadPool.getNumThreads() : 0; ii < num; ++ii)
+			{
+				const RecordStateVK& state = m_recordThreadPool.getState(ii);
 
-					if (hasOcclusionQuery)
-					{
-						m_occlusionQuery.end();
-					}
+				for (uint32_t jj = 0; jj < BX_COUNTOF(s_primInfo); ++jj)
+				{
+					rs.m_numPrimsSubmitted[jj] += state.m_numPrimsSubmitted[jj];
+					rs.m_numPrimsRendered[jj]  += state.m_numPrimsRendered[jj];
+					rs.m_numInstances[jj]      += state.m_numInstances[jj];
 				}
+
+				rs.m_numIndices        += state.m_numIndices;
+				rs.m_numDescriptorSets += state.m_numDescriptorSets;
+				rs.m_numDrawsFallback  += state.m_numDrawsFallback;
+				rs.m_numDrawsSkipped   += state.m_numDrawsSkipped;
+				rs.m_numMultiDraw      += state.m_numMultiDraw;
+				rs.m_numMultiDrawItems += state.m_numMultiDrawItems;
 			}
 
 			if (beginRenderPass)
@@ -9286,7 +11039,7 @@ VK_DESTROY
 		dmbp.pNext = NULL;
 
 		int64_t gpuMemoryAvailable = -INT64_MAX;
-		int64_t gpuMemoryUsed      = -INT64_MAX;
+		int64_t gpuMemoryUsed      = int64_t(m_memoryAllocator.getUsed() );
 
 		if (s_extension[Extension::EXT_memory_budget].m_supported)
 		{
@@ -9322,9 +11075,14 @@ VK_DESTROY
 		perfStats.numBlit       = _render->m_numBlitItems;
 		perfStats.maxGpuLatency = maxGpuLatency;
 		perfStats.gpuFrameNum   = result.m_frameNum;
-		bx::memCopy(perfStats.numPrims, statsNumPrimsRendered, sizeof(perfStats.numPrims) );
+		bx::memCopy(perfStats.numPrims, rs.m_numPrimsRendered, sizeof(perfStats.numPrims) );
 		perfStats.gpuMemoryMax  = gpuMemoryAvailable;
 		perfStats.gpuMemoryUsed = gpuMemoryUsed;
+		perfStats.numPipelinesPending = m_pipelineCompiler.getNumPending();
+		perfStats.numDrawsFallback    = rs.m_numDrawsFallback;
+		perfStats.numDrawsSkipped     = rs.m_numDrawsSkipped;
+		perfStats.numMultiDraw        = rs.m_numMultiDraw;
+		perfStats.numMultiDrawItems   = rs.m_numMultiDrawItems;
 
 		if (_render->m_debug & (BGFX_DEBUG_IFH|BGFX_DEBUG_STATS) )
 		{
@@ -9413,13 +11171,18 @@ VK_DESTROY
 					, maxGpuLatency
 					);
 
+				tvm.printf(10, pos++, 0x8b, "  Multi-draw: %5d (batched draw %5d) "
+					, rs.m_numMultiDraw
+					, rs.m_numMultiDrawItems
+					);
+
 				for (uint32_t ii = 0; ii < Topology::Count; ++ii)
 				{
 					tvm.printf(10, pos++, 0x8b, "   %9s: %7d (#inst: %5d), submitted: %7d "
 						, getName(Topology::Enum(ii) )
-						, statsNumPrimsRendered[ii]
-						, statsNumInstances[ii]
-						, statsNumPrimsSubmitted[ii]
+						, rs.m_numPrimsRendered[ii]
+						, rs.m_numInstances[ii]
+						, rs.m_numPrimsSubmitted[ii]
 						);
 				}
 
@@ -9428,21 +11191,60 @@ VK_DESTROY
 					tvm.printf(tvm.m_width-27, 0, 0x4f, " [F11 - RenderDoc capture] ");
 				}
 
-				tvm.printf(10, pos++, 0x8b, "      Indices: %7d ", statsNumIndices);
+				tvm.printf(10, pos++, 0x8b, "      Indices: %7d ", rs.m_numIndices);
 				tvm.printf(10, pos++, 0x8b, "     DVB size: %7d ", _render->m_vboffset);
 				tvm.printf(10, pos++, 0x8b, "     DIB size: %7d ", _render->m_iboffset);
 
 				pos++;
 				tvm.printf(10, pos++, 0x8b, " Occlusion queries: %3d ", m_occlusionQuery.m_control.available() );
 
+				{
+					DeviceMemoryStatsVK dms;
+					m_memoryAllocator.getStats(dms);
+
+					char blockSize[16];
+					bx::prettify(blockSize, BX_COUNTOF(blockSize), dms.m_blockSize);
+
+					char blockUsed[16];
+					bx::prettify(blockUsed, BX_COUNTOF(blockUsed), dms.m_blockUsed);
+
+					char largestFree[16];
+					bx::prettify(largestFree, BX_COUNTOF(largestFree), dms.m_largestFree);
+
+					char dedicatedSize[16];
+					bx::prettify(dedicatedSize, BX_COUNTOF(dedicatedSize), dms.m_dedicatedSize);
+
+					pos++;
+					tvm.printf(10, pos++, 0x8b, " Device memory blocks: %4d, used %12s / %12s, %5d free ranges, largest %12s "
+						, dms.m_numBlocks
+						, blockUsed
+						, blockSize
+						, dms.m_numFreeRanges
+						, largestFree
+						);
+					tvm.printf(10, pos++, 0x8b, " Dedicated allocations: %3d, %12s "
+						, dms.m_numDedicated
+						, dedicatedSize
+						);
+				}
+
 				pos++;
 				tvm.printf(10, pos++, 0x8b, " State cache:             ");
 				tvm.printf(10, pos++, 0x8b, " PSO    | DSL    |  DS    ");
 				tvm.printf(10, pos++, 0x8b, " %6d | %6d | %6d "
 					, m_pipelineStateCache.getCount()
 					, m_descriptorSetLayoutCache.getCount()
-					, descriptorSetCount
+					, rs.m_numDescriptorSets
 					);
+
+				if (m_asyncPipeline)
+				{
+					tvm.printf(10, pos++, 0x8b, " PSO pending: %4d, fallback: %5d, skipped: %5d "
+						, m_pipelineCompiler.getNumPending()
+						, rs.m_numDrawsFallback
+						, rs.m_numDrawsSkipped
+						);
+				}
 				pos++;
 
 				double captureMs = double(captureElapsed)*toMs;
@@ -9485,6 +11287,9 @@ VK_DESTROY
 			scratchStagingBuffer.flush();
 		}
 
+		m_memoryAllocator.trim();
+		updatePipelineCache();
+
 		for (uint16_t ii = 0; ii < m_numWindows; ++ii)
 		{
 			FrameBufferVK& fb = isValid(m_windows[ii])
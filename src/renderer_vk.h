@@ -47,6 +47,7 @@
 
 #include "renderer.h"
 #include "debug_renderdoc.h"
+#include "range_allocator.h"
 
 #define VK_IMPORT                                                          \
 			VK_IMPORT_FUNC(false, vkCreateInstance);                       \
@@ -171,6 +172,7 @@
 			VK_IMPORT_DEVICE_FUNC(false, vkCmdPipelineBarrier);             \
 			VK_IMPORT_DEVICE_FUNC(false, vkCmdBeginRenderPass);             \
 			VK_IMPORT_DEVICE_FUNC(false, vkCmdEndRenderPass);               \
+			VK_IMPORT_DEVICE_FUNC(false, vkCmdExecuteCommands);             \
 			VK_IMPORT_DEVICE_FUNC(false, vkCmdSetViewport);                 \
 			VK_IMPORT_DEVICE_FUNC(false, vkCmdDraw);                        \
 			VK_IMPORT_DEVICE_FUNC(false, vkCmdDrawIndexed);                 \
@@ -372,6 +374,73 @@ VK_DESTROY_FUNC(DescriptorSet);
 		HashMap m_hashMap;
 	};
 
+	struct DeviceMemoryAllocationVK
+	{
+		DeviceMemoryAllocationVK()
+			: m_mem(VK_NULL_HANDLE)
+			, m_offset(0)
+			, m_size(0)
+			, m_pool(UINT16_MAX)
+			, m_block(UINT16_MAX)
+		{
+		}
+
+		VkDeviceMemory m_mem;
+		VkDeviceSize   m_offset;
+		VkDeviceSize   m_size;
+		uint16_t       m_pool;
+		uint16_t       m_block;
+	};
+
+	struct DeviceMemoryStatsVK
+	{
+		uint32_t     m_numBlocks;
+		uint32_t     m_numDedicated;
+		uint32_t     m_numFreeRanges;
+		VkDeviceSize m_blockSize;
+		VkDeviceSize m_blockUsed;
+		VkDeviceSize m_dedicatedSize;
+		VkDeviceSize m_largestFree;
+	};
+
+	// Sub-allocates buffers and images from large device memory blocks. There is one pool of
+	// blocks per memory type for buffers and one for images, so linear and optimal resources
+	// never share a block and buffer-image granularity doesn't need to be tracked.
+	class DeviceMemoryAllocatorVK
+	{
+	public:
+		DeviceMemoryAllocatorVK();
+
+		void init(VkDeviceSize _blockSize);
+
+		void shutdown();
+
+		VkResult alloc(const VkMemoryRequirements& _requirements, VkMemoryPropertyFlags _flags, bool _image, DeviceMemoryAllocationVK& _outAlloc);
+
+		void free(const DeviceMemoryAllocationVK& _alloc);
+
+		// Releases empty blocks, keeps one empty block per pool to avoid allocation churn.
+		void trim();
+
+		void getStats(DeviceMemoryStatsVK& _outStats) const;
+
+		VkDeviceSize getUsed() const;
+
+	private:
+		struct Block
+		{
+			VkDeviceMemory m_mem;
+			RangeAllocator m_ranges;
+		};
+
+		typedef stl::vector<Block> BlockArray;
+		BlockArray m_pool[VK_MAX_MEMORY_TYPES*2];
+
+		VkDeviceSize m_blockSize;
+		VkDeviceSize m_dedicatedSize;
+		uint32_t     m_numDedicated;
+	};
+
 	struct StagingBufferVK
 	{
 		VkBuffer m_buffer;
@@ -397,6 +466,7 @@ VK_DESTROY_FUNC(DescriptorSet);
 		void create(uint32_t _size, uint32_t _count, VkBufferUsageFlags _usage, uint32_t align);
 		void createUniform(uint32_t _size, uint32_t _count);
 		void createStaging(uint32_t _size);
+		void createMultiDraw(uint32_t _count);
 		void destroy();
 		void reset();
 		uint32_t alloc(uint32_t _size, uint32_t _minAlign = 1);
@@ -416,7 +486,6 @@ VK_DESTROY_FUNC(DescriptorSet);
 	{
 		BufferVK()
 			: m_buffer(VK_NULL_HANDLE)
-			, m_deviceMem(VK_NULL_HANDLE)
 			, m_size(0)
 			, m_flags(BGFX_BUFFER_NONE)
 			, m_dynamic(false)
@@ -428,7 +497,7 @@ VK_DESTROY_FUNC(DescriptorSet);
 		void destroy();
 
 		VkBuffer m_buffer;
-		VkDeviceMemory m_deviceMem;
+		DeviceMemoryAllocationVK m_deviceMem;
 		uint32_t m_size;
 		uint16_t m_flags;
 		bool m_dynamic;
@@ -641,10 +710,8 @@ VK_DESTROY_FUNC(DescriptorSet);
 			, m_sampler({ 1, VK_SAMPLE_COUNT_1_BIT })
 			, m_format(VK_FORMAT_UNDEFINED)
 			, m_textureImage(VK_NULL_HANDLE)
-			, m_textureDeviceMem(VK_NULL_HANDLE)
 			, m_currentImageLayout(VK_IMAGE_LAYOUT_UNDEFINED)
 			, m_singleMsaaImage(VK_NULL_HANDLE)
-			, m_singleMsaaDeviceMem(VK_NULL_HANDLE)
 			, m_currentSingleMsaaImageLayout(VK_IMAGE_LAYOUT_UNDEFINED)
 		{
 		}
@@ -681,13 +748,13 @@ VK_DESTROY_FUNC(DescriptorSet);
 		VkComponentMapping m_components;
 		VkImageAspectFlags m_aspectMask;
 
-		VkImage        m_textureImage;
-		VkDeviceMemory m_textureDeviceMem;
-		VkImageLayout  m_currentImageLayout;
+		VkImage                  m_textureImage;
+		DeviceMemoryAllocationVK m_textureDeviceMem;
+		VkImageLayout            m_currentImageLayout;
 
-		VkImage        m_singleMsaaImage;
-		VkDeviceMemory m_singleMsaaDeviceMem;
-		VkImageLayout  m_currentSingleMsaaImageLayout;
+		VkImage                  m_singleMsaaImage;
+		DeviceMemoryAllocationVK m_singleMsaaDeviceMem;
+		VkImageLayout            m_currentSingleMsaaImageLayout;
 
 		VkImageLayout m_sampledLayout;
 
@@ -842,6 +909,7 @@ VK_DESTROY_FUNC(DescriptorSet);
 		void finish(bool _finishAll = false);
 
 		void release(uint64_t _handle, VkObjectType _type);
+		void release(const DeviceMemoryAllocationVK& _alloc);
 		void consume();
 
 		uint32_t m_queueFamily;
@@ -883,6 +951,9 @@ VK_DESTROY_FUNC(DescriptorSet);
 		typedef stl::vector<Resource> ResourceArray;
 		ResourceArray m_release[BGFX_CONFIG_MAX_FRAME_LATENCY];
 
+		typedef stl::vector<DeviceMemoryAllocationVK> MemoryArray;
+		MemoryArray m_releaseMemory[BGFX_CONFIG_MAX_FRAME_LATENCY];
+
 	private:
 		template<typename Ty>
 		void destroy(uint64_t _handle)
@@ -893,6 +964,203 @@ VK_DESTROY_FUNC(DescriptorSet);
 		}
 	};
 
+	struct RecordStateVK
+	{
+		void reset();
+		void resetStats();
+
+		void setShaderUniform(uint8_t _flags, uint32_t _regIndex, const void* _val, uint32_t _numRegs);
+		void setShaderUniform4f(uint8_t _flags, uint32_t _regIndex, const void* _val, uint32_t _numRegs);
+		void setShaderUniform4x4f(uint8_t _flags, uint32_t _regIndex, const void* _val, uint32_t _numRegs);
+		void commit(const UniformBuffer& _uniformBuffer);
+		bool commit(uint8_t _stage, const ShaderVK& _shader, const UniformBlock& _block, const uint8_t* _data);
+
+		// Uniform block layout compatibility with last shader constant buffer, per stage.
+		struct UniformBlockCache
+		{
+			const ShaderVK* m_shader;
+			uint32_t        m_hash;
+			bool            m_compatible;
+		};
+
+		VkCommandBuffer   m_commandBuffer;
+		ScratchBufferVK*  m_scratchBuffer;
+		VkDescriptorPool  m_descriptorPool;
+		void* const*      m_uniforms;
+		FrameBufferHandle m_fbh;
+		ViewState         m_viewState;
+
+		RenderDraw      m_currentState;
+		ProgramHandle   m_currentProgram;
+		VkPipeline      m_currentPipeline;
+		VkDescriptorSet m_currentDescriptorSet;
+		VkIndexType     m_currentIndexFormat;
+		uint64_t        m_blendFactor;
+		uint32_t        m_currentBindHash;
+		Rect            m_viewScissorRect;
+		uint16_t        m_view;
+		bool            m_hasPredefined;
+		bool            m_viewHasScissor;
+		bool            m_restoreScissor;
+		bool            m_multiDrawBound;
+
+		uint32_t m_numPrimsSubmitted[Topology::Count+1];
+		uint32_t m_numPrimsRendered[Topology::Count+1];
+		uint32_t m_numInstances[Topology::Count+1];
+		uint32_t m_numIndices;
+		uint32_t m_numDescriptorSets;
+		uint32_t m_numDrawsFallback;
+		uint32_t m_numDrawsSkipped;
+		uint32_t m_numMultiDraw;
+		uint32_t m_numMultiDrawItems;
+
+		UniformBlockCache m_uniformBlockCache[2];
+
+		uint8_t m_fsScratch[64<<10];
+		uint8_t m_vsScratch[64<<10];
+	};
+
+	struct RecordJobVK
+	{
+		uint32_t          m_begin;
+		uint32_t          m_end;
+		uint32_t          m_uniformOffset;
+		uint32_t          m_multiDrawRun;
+		uint16_t          m_view;
+		FrameBufferHandle m_fbh;
+		VkCommandBuffer   m_commandBuffer;
+		int32_t           m_done;
+	};
+
+	class RecordThreadPoolVK;
+
+	struct RecordThreadVK
+	{
+		typedef stl::vector<VkCommandBuffer> CommandBufferArray;
+
+		RecordStateVK       m_state;
+		VkCommandPool       m_commandPool[BGFX_CONFIG_MAX_FRAME_LATENCY];
+		CommandBufferArray  m_commandBuffers[BGFX_CONFIG_MAX_FRAME_LATENCY];
+		VkDescriptorPool    m_descriptorPool[BGFX_CONFIG_MAX_FRAME_LATENCY];
+		ScratchBufferVK     m_scratchBuffer[BGFX_CONFIG_MAX_FRAME_LATENCY];
+		uint32_t            m_numCommandBuffers;
+		void*               m_uniforms[BGFX_CONFIG_MAX_UNIFORMS];
+		RecordThreadPoolVK* m_pool;
+		bx::Thread          m_thread;
+	};
+
+	// Records views which contain only draw calls into secondary command buffers on a
+	// pool of worker threads. Render thread records everything else, and executes
+	// secondary command buffers inside view's render pass in sort order.
+	class RecordThreadPoolVK
+	{
+	public:
+		RecordThreadPoolVK();
+
+		VkResult init(uint32_t _numThreads, uint32_t _numFramesInFlight);
+
+		void shutdown();
+
+		uint32_t getNumThreads() const
+		{
+			return m_numThreads;
+		}
+
+		const RecordStateVK& getState(uint32_t _idx) const
+		{
+			return m_thread[_idx].m_state;
+		}
+
+		const RecordJobVK& getJob(uint32_t _idx) const
+		{
+			return m_job[_idx];
+		}
+
+		uint32_t begin(Frame* _render, uint32_t _frameInFlight);
+
+		VkCommandBuffer wait(uint32_t _idx);
+
+		void end();
+
+	private:
+		void work(RecordThreadVK& _thread);
+
+		void reserveUniformData(uint32_t _size);
+
+		static int32_t workerThread(bx::Thread* _self, void* _userData);
+
+		RecordThreadVK m_thread[BGFX_CONFIG_MAX_RECORD_THREADS];
+		bx::Semaphore  m_workSem;
+		bx::Semaphore  m_doneSem;
+		bx::Semaphore  m_jobSem;
+
+		Frame*   m_render;
+		uint32_t m_frameInFlight;
+		uint32_t m_numFramesInFlight;
+		uint32_t m_numThreads;
+		uint32_t m_numJobs;
+		uint32_t m_next;
+		uint32_t m_numWaited;
+		bool     m_exit;
+		bool     m_active;
+
+		uint8_t* m_uniformData;
+		uint32_t m_uniformDataSize;
+		uint32_t m_uniformOffset[BGFX_CONFIG_MAX_UNIFORMS];
+		void*    m_shadow[BGFX_CONFIG_MAX_UNIFORMS];
+
+		RecordJobVK m_job[BGFX_CONFIG_MAX_VIEWS];
+	};
+
+	struct PipelineCompileJobVK
+	{
+		uint64_t          m_hash;
+		uint64_t          m_state;
+		uint64_t          m_stencil;
+		VertexLayout      m_layout[BGFX_CONFIG_MAX_VERTEX_STREAMS];
+		ProgramHandle     m_program;
+		FrameBufferHandle m_fbh;
+		uint8_t           m_numStreams;
+		uint8_t           m_numInstanceData;
+	};
+
+	// Creates graphics pipelines which missed pipeline state cache on background thread, so
+	// that render thread doesn't stall on first use of new state combination. Resources
+	// referenced by pending jobs must not be destroyed before wait() returns.
+	class PipelineCompilerVK
+	{
+	public:
+		PipelineCompilerVK();
+
+		void init();
+
+		void shutdown();
+
+		bool isPending(uint64_t _hash);
+
+		void request(const PipelineCompileJobVK& _job);
+
+		void complete(uint64_t _hash);
+
+		void wait();
+
+		uint32_t getNumPending();
+
+	private:
+		static int32_t compilerThread(bx::Thread* _self, void* _userData);
+
+		typedef stl::vector<PipelineCompileJobVK> JobArray;
+		typedef stl::unordered_set<uint64_t> HashSet;
+
+		bx::Thread    m_thread;
+		bx::Mutex     m_mutex;
+		bx::Semaphore m_workSem;
+		bx::Semaphore m_doneSem;
+		JobArray      m_jobs;
+		HashSet       m_pending;
+		bool          m_exit;
+	};
+
 } /* namespace bgfx */ } // namespace vk
 
 #endif // BGFX_RENDERER_VK_H_HEADER_GUARD
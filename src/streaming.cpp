@@ -0,0 +1,578 @@
+/*
+ * Copyright 2011-2024 Branimir Karadzic. All rights reserved.
+ * License: https://github.com/bkaradzic/bgfx/blob/master/LICENSE
+ */
+
+#include "bgfx_p.h"
+#include "streaming.h"
+
+namespace bgfx
+{
+	TextureStreaming::TextureStreaming()
+		: m_texture(NULL)
+		, m_change(NULL)
+		, m_num(0)
+		, m_capacity(0)
+		, m_numChanges(0)
+		, m_seq(0)
+		, m_budget(0)
+		, m_used(0)
+		, m_wait(UINT8_MAX)
+		, m_exit(false)
+	{
+	}
+
+	TextureStreaming::~TextureStreaming()
+	{
+		BX_ASSERT(NULL == m_texture, "TextureStreaming::shutdown must be called.");
+	}
+
+	void TextureStreaming::init(uint64_t _budget)
+	{
+		m_budget     = _budget;
+		m_num        = 0;
+		m_numChanges = 0;
+		m_seq        = 0;
+		m_used       = 0;
+		m_wait       = UINT8_MAX;
+		m_exit       = false;
+
+		bx::memSet(m_lut, 0xff, sizeof(m_lut) );
+
+		for (uint32_t ii = 0; ii < BX_COUNTOF(m_read); ++ii)
+		{
+			m_read[ii].m_state = State::Free;
+		}
+
+#if BGFX_CONFIG_MULTITHREADED
+		m_thread.init(readerThread, this, 0, "bgfx - streaming thread");
+#endif // BGFX_CONFIG_MULTITHREADED
+	}
+
+	void TextureStreaming::shutdown()
+	{
+		for (uint8_t ii = 0; ii < BX_COUNTOF(m_read); ++ii)
+		{
+			cancel(ii);
+		}
+
+#if BGFX_CONFIG_MULTITHREADED
+		if (m_thread.isRunning() )
+		{
+			m_exit = true;
+			m_workSem.post();
+			m_thread.shutdown();
+		}
+#endif // BGFX_CONFIG_MULTITHREADED
+
+		bx::free(g_allocator, m_texture);
+		bx::free(g_allocator, m_change);
+		m_texture  = NULL;
+		m_change   = NULL;
+		m_num      = 0;
+		m_capacity = 0;
+	}
+
+	uint8_t TextureStreaming::calcTailMip(uint16_t _width, uint16_t _height, uint8_t _numMips)
+	{
+		uint8_t mip = 0;
+
+		for (; mip < _numMips-1; ++mip)
+		{
+			if (bx::max(_width >> mip, _height >> mip) <= BGFX_CONFIG_TEXTURE_STREAMING_MIP_TAIL)
+			{
+				break;
+			}
+		}
+
+		return mip;
+	}
+
+	uint32_t TextureStreaming::calcMipSize(uint16_t _width, uint16_t _height, uint8_t _mip, TextureFormat::Enum _format)
+	{
+		TextureInfo ti;
+		calcTextureSize(ti
+			, uint16_t(bx::max(1, _width  >> _mip) )
+			, uint16_t(bx::max(1, _height >> _mip) )
+			, 1
+			, false
+			, false
+			, 1
+			, _format
+			);
+
+		return ti.storageSize;
+	}
+
+	void TextureStreaming::add(
+		  TextureHandle _handle
+		, uint16_t _width
+		, uint16_t _height
+		, uint8_t _numMips
+		, TextureFormat::Enum _format
+		, TextureMipReadFn _readFn
+		, void* _userData
+		)
+	{
+		BX_ASSERT(!isStreaming(_handle), "Texture %d is already streaming.", _handle.idx);
+		BX_ASSERT(_numMips <= BX_COUNTOF(Texture::m_size), "Too many mips %d.", _numMips);
+
+		if (m_num == m_capacity)
+		{
+			m_capacity = bx::max<uint32_t>(64, m_capacity*2);
+			m_texture  = (Texture*)bx::realloc(g_allocator, m_texture, m_capacity*sizeof(Texture) );
+			m_change   = (Change* )bx::realloc(g_allocator, m_change,  m_capacity*sizeof(Change) );
+		}
+
+		m_lut[_handle.idx] = uint16_t(m_num);
+
+		Texture& texture = m_texture[m_num++];
+		texture.m_readFn   = _readFn;
+		texture.m_userData = _userData;
+		texture.m_handle   = _handle.idx;
+		texture.m_width    = _width;
+		texture.m_height   = _height;
+		texture.m_format   = uint8_t(_format);
+		texture.m_numMips  = _numMips;
+		texture.m_tail     = calcTailMip(_width, _height, _numMips);
+		texture.m_desired  = texture.m_tail;
+		texture.m_resident = texture.m_tail;
+		texture.m_planned  = texture.m_tail;
+		texture.m_read     = UINT8_MAX;
+		texture.m_loadSkip = false;
+
+		uint32_t size = 0;
+		for (int32_t mip = _numMips-1; mip >= 0; --mip)
+		{
+			size += calcMipSize(_width, _height, uint8_t(mip), _format);
+			texture.m_size[mip] = size;
+		}
+
+		m_used += texture.m_size[texture.m_resident];
+	}
+
+	void TextureStreaming::remove(TextureHandle _handle)
+	{
+		const uint16_t idx = m_lut[_handle.idx];
+		BX_ASSERT(UINT16_MAX != idx, "Texture %d is not streaming.", _handle.idx);
+
+		const Texture& texture = m_texture[idx];
+		m_used -= texture.m_size[texture.m_resident];
+
+		if (UINT8_MAX != texture.m_read)
+		{
+			cancel(texture.m_read);
+		}
+
+		m_lut[_handle.idx] = UINT16_MAX;
+
+		--m_num;
+		if (idx != m_num)
+		{
+			m_texture[idx] = m_texture[m_num];
+			m_lut[m_texture[idx].m_handle] = idx;
+		}
+	}
+
+	void TextureStreaming::setDesiredMip(TextureHandle _handle, uint8_t _mip)
+	{
+		Texture& texture = get(_handle);
+		texture.m_desired = bx::min(_mip, texture.m_tail);
+	}
+
+	uint8_t TextureStreaming::getResidentMip(TextureHandle _handle) const
+	{
+		return get(_handle).m_resident;
+	}
+
+	void TextureStreaming::getResidentSize(TextureHandle _handle, uint8_t _mip, uint16_t& _width, uint16_t& _height, uint8_t& _numMips, uint32_t& _storageSize) const
+	{
+		const Texture& texture = get(_handle);
+		_width       = uint16_t(bx::max(1, texture.m_width  >> _mip) );
+		_height      = uint16_t(bx::max(1, texture.m_height >> _mip) );
+		_numMips     = texture.m_numMips - _mip;
+		_storageSize = texture.m_size[_mip];
+	}
+
+	void TextureStreaming::setResident(TextureHandle _handle, uint8_t _mip)
+	{
+		Texture& texture = get(_handle);
+		m_used += int64_t(texture.m_size[_mip]) - int64_t(texture.m_size[texture.m_resident]);
+		texture.m_resident = _mip;
+
+		if (UINT8_MAX != texture.m_read)
+		{
+			bx::MutexScope lock(m_lock);
+			m_read[texture.m_read].m_state = State::Free;
+			texture.m_read = UINT8_MAX;
+		}
+	}
+
+	uint32_t TextureStreaming::update(bool _copyMips)
+	{
+		m_numChanges = 0;
+
+		{
+			bx::MutexScope lock(m_lock);
+
+			for (uint32_t ii = 0; ii < BX_COUNTOF(m_read); ++ii)
+			{
+				Read& read = m_read[ii];
+
+				// Failed read is dropped, and texture is planned again next frame.
+				if (State::Done == read.m_state
+				&&  !validate(read) )
+				{
+					read.m_state = State::Free;
+
+					const TextureHandle handle = { read.m_handle };
+					get(handle).m_read = UINT8_MAX;
+				}
+			}
+		}
+
+		int64_t used = 0;
+
+		for (uint32_t ii = 0; ii < m_num; ++ii)
+		{
+			Texture& texture = m_texture[ii];
+
+			if (UINT8_MAX != texture.m_read)
+			{
+				// Mips being read are counted into budget, they are resident once read.
+				texture.m_planned  = m_read[texture.m_read].m_first;
+				texture.m_loadSkip = true;
+			}
+			else
+			{
+				texture.m_planned  = bx::max(texture.m_resident, texture.m_desired);
+				texture.m_loadSkip = false;
+			}
+
+			used += texture.m_size[texture.m_planned];
+		}
+
+		// Over budget, drop finest mip of texture that frees the most memory, until everything
+		// fits. Tail mips are never evicted.
+		while (0 != m_budget
+		&&     uint64_t(used) > m_budget)
+		{
+			Texture* evict = NULL;
+			uint32_t evictSize = 0;
+
+			for (uint32_t ii = 0; ii < m_num; ++ii)
+			{
+				Texture& texture = m_texture[ii];
+
+				if (UINT8_MAX == texture.m_read
+				&&  texture.m_planned < texture.m_tail)
+				{
+					const uint32_t size = texture.m_size[texture.m_planned] - texture.m_size[texture.m_planned+1];
+
+					if (size > evictSize)
+					{
+						evict     = &texture;
+						evictSize = size;
+					}
+				}
+			}
+
+			if (NULL == evict)
+			{
+				break;
+			}
+
+			evict->m_planned++;
+			used -= evictSize;
+		}
+
+		// Load textures that are furthest from desired mip first. Texture is loaded to desired
+		// mip, or to finest mip that fits into budget.
+		for (uint32_t load = 0; load < BGFX_CONFIG_TEXTURE_STREAMING_MAX_LOADS; ++load)
+		{
+			Texture* texture = NULL;
+
+			for (uint32_t ii = 0; ii < m_num; ++ii)
+			{
+				Texture& candidate = m_texture[ii];
+
+				if (!candidate.m_loadSkip
+				&&  candidate.m_planned == candidate.m_resident
+				&&  candidate.m_planned >  candidate.m_desired
+				&&  (NULL == texture || candidate.m_planned - candidate.m_desired > texture->m_planned - texture->m_desired) )
+				{
+					texture = &candidate;
+				}
+			}
+
+			if (NULL == texture)
+			{
+				break;
+			}
+
+			texture->m_loadSkip = true;
+
+			for (uint8_t mip = texture->m_desired; mip < texture->m_planned; ++mip)
+			{
+				const int64_t size = int64_t(texture->m_size[mip]) - int64_t(texture->m_size[texture->m_planned]);
+
+				if (0 == m_budget
+				||  uint64_t(used + size) <= m_budget)
+				{
+					texture->m_planned = mip;
+					used += size;
+					break;
+				}
+			}
+		}
+
+		for (uint32_t ii = 0; ii < m_num; ++ii)
+		{
+			Texture& texture = m_texture[ii];
+
+			if (UINT8_MAX != texture.m_read)
+			{
+				const Read& read = m_read[texture.m_read];
+
+				if (State::Ready == read.m_state)
+				{
+					Change& change = m_change[m_numChanges++];
+					change.m_mem    = read.m_mem;
+					change.m_handle = texture.m_handle;
+					change.m_mip    = read.m_first;
+				}
+			}
+			else if (texture.m_planned > texture.m_resident
+			&&       _copyMips)
+			{
+				// Evicted mips are dropped by renderer without reading anything.
+				Change& change = m_change[m_numChanges++];
+				change.m_mem    = NULL;
+				change.m_handle = texture.m_handle;
+				change.m_mip    = texture.m_planned;
+			}
+			else if (texture.m_planned != texture.m_resident)
+			{
+				// Only newly resident mips are read when renderer copies mips that stay
+				// resident, otherwise whole resident chain is read again.
+				const uint8_t last = _copyMips
+					? texture.m_resident
+					: texture.m_numMips
+					;
+
+				push(texture, texture.m_planned, last);
+			}
+		}
+
+		return m_numChanges;
+	}
+
+	TextureStreaming::Texture& TextureStreaming::get(TextureHandle _handle)
+	{
+		BX_ASSERT(isStreaming(_handle), "Texture %d is not streaming.", _handle.idx);
+		return m_texture[m_lut[_handle.idx] ];
+	}
+
+	const TextureStreaming::Texture& TextureStreaming::get(TextureHandle _handle) const
+	{
+		BX_ASSERT(isStreaming(_handle), "Texture %d is not streaming.", _handle.idx);
+		return m_texture[m_lut[_handle.idx] ];
+	}
+
+	void TextureStreaming::push(Texture& _texture, uint8_t _first, uint8_t _last)
+	{
+		uint8_t idx = 0;
+
+		{
+			bx::MutexScope lock(m_lock);
+
+			while (idx < BX_COUNTOF(m_read)
+			&&     State::Free != m_read[idx].m_state)
+			{
+				++idx;
+			}
+
+			// All reads are in flight, texture is planned again next frame.
+			if (BX_COUNTOF(m_read) == idx)
+			{
+				return;
+			}
+
+			Read& read = m_read[idx];
+			read.m_readFn   = _texture.m_readFn;
+			read.m_userData = _texture.m_userData;
+			read.m_seq      = m_seq++;
+			read.m_handle   = _texture.m_handle;
+			read.m_width    = _texture.m_width;
+			read.m_height   = _texture.m_height;
+			read.m_format   = _texture.m_format;
+			read.m_first    = _first;
+			read.m_last     = _last;
+			read.m_state    = State::Queued;
+			bx::memSet(read.m_mem, 0, sizeof(read.m_mem) );
+		}
+
+		_texture.m_read = idx;
+
+#if BGFX_CONFIG_MULTITHREADED
+		m_workSem.post();
+#else
+		Read& read = m_read[idx];
+		read.m_state = State::Running;
+		TextureStreaming::read(read);
+		read.m_state = State::Done;
+#endif // BGFX_CONFIG_MULTITHREADED
+	}
+
+	void TextureStreaming::cancel(uint8_t _idx)
+	{
+		Read& read = m_read[_idx];
+
+		m_lock.lock();
+
+		while (State::Running == read.m_state)
+		{
+			m_wait = _idx;
+			m_lock.unlock();
+
+			m_doneSem.wait();
+
+			m_lock.lock();
+		}
+
+		m_wait = UINT8_MAX;
+
+		if (State::Free != read.m_state)
+		{
+			for (uint32_t ii = 0; ii < BX_COUNTOF(read.m_mem); ++ii)
+			{
+				if (NULL != read.m_mem[ii])
+				{
+					release(read.m_mem[ii]);
+				}
+			}
+
+			read.m_state = State::Free;
+		}
+
+		m_lock.unlock();
+	}
+
+	bool TextureStreaming::validate(Read& _read)
+	{
+		bool ok = true;
+
+		for (uint8_t mip = _read.m_first; mip < _read.m_last; ++mip)
+		{
+			const Memory* mem = _read.m_mem[mip];
+
+			if (NULL == mem)
+			{
+				ok = false;
+				continue;
+			}
+
+			const uint32_t size = calcMipSize(_read.m_width, _read.m_height, mip, TextureFormat::Enum(_read.m_format) );
+			BX_WARN(size == mem->size
+				, "Texture %d mip %d: Mip storage size doesn't match read memory size (storage size: %d, memory size: %d)."
+				, _read.m_handle
+				, mip
+				, size
+				, mem->size
+				);
+
+			ok &= size == mem->size;
+		}
+
+		if (ok)
+		{
+			_read.m_state = State::Ready;
+			return true;
+		}
+
+		for (uint8_t mip = _read.m_first; mip < _read.m_last; ++mip)
+		{
+			if (NULL != _read.m_mem[mip])
+			{
+				release(_read.m_mem[mip]);
+				_read.m_mem[mip] = NULL;
+			}
+		}
+
+		return false;
+	}
+
+	int32_t TextureStreaming::readerThread(bx::Thread* /*_self*/, void* _userData)
+	{
+		BGFX_PROFILER_SET_CURRENT_THREAD_NAME("bgfx - Streaming Thread");
+
+		TextureStreaming* streaming = (TextureStreaming*)_userData;
+
+		for (;;)
+		{
+			streaming->m_workSem.wait();
+
+			if (streaming->m_exit)
+			{
+				break;
+			}
+
+			Read* read = NULL;
+
+			{
+				bx::MutexScope lock(streaming->m_lock);
+
+				for (uint32_t ii = 0; ii < BX_COUNTOF(streaming->m_read); ++ii)
+				{
+					Read& candidate = streaming->m_read[ii];
+
+					if (State::Queued == candidate.m_state
+					&&  (NULL == read || candidate.m_seq < read->m_seq) )
+					{
+						read = &candidate;
+					}
+				}
+
+				if (NULL != read)
+				{
+					read->m_state = State::Running;
+				}
+			}
+
+			// Read was canceled before it started.
+			if (NULL == read)
+			{
+				continue;
+			}
+
+			TextureStreaming::read(*read);
+
+			bool wake;
+
+			{
+				bx::MutexScope lock(streaming->m_lock);
+				read->m_state = State::Done;
+				wake = streaming->m_wait == uint8_t(read - streaming->m_read);
+			}
+
+			if (wake)
+			{
+				streaming->m_doneSem.post();
+			}
+		}
+
+		return 0;
+	}
+
+	void TextureStreaming::read(Read& _read)
+	{
+		BGFX_PROFILER_SCOPE("TextureStreaming::read", 0xff2040ff);
+
+		// Coarser mips are read first.
+		for (int32_t mip = _read.m_last-1; mip >= _read.m_first; --mip)
+		{
+			_read.m_mem[mip] = _read.m_readFn(uint8_t(mip), _read.m_userData);
+		}
+	}
+
+} // namespace bgfx
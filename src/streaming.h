@@ -0,0 +1,189 @@
+/*
+ * Copyright 2011-2024 Branimir Karadzic. All rights reserved.
+ * License: https://github.com/bkaradzic/bgfx/blob/master/LICENSE
+ */
+
+#ifndef BGFX_STREAMING_H_HEADER_GUARD
+#define BGFX_STREAMING_H_HEADER_GUARD
+
+#include <bgfx/bgfx.h>
+#include <bx/mutex.h>
+#include <bx/semaphore.h>
+#include <bx/thread.h>
+
+#include "config.h"
+
+namespace bgfx
+{
+	/// Residency of streaming textures. Streaming texture is created only with tail mips, and
+	/// finer mips are read with user callback on streaming thread when requested, while total
+	/// size of resident mips is kept inside memory budget. Textures are tracked by API thread
+	/// only.
+	///
+	class TextureStreaming
+	{
+	public:
+		/// Change of finest resident mip of streaming texture.
+		///
+		struct Change
+		{
+			const Memory* const* m_mem; //!< Mips read for change indexed by mip, or NULL.
+			uint16_t m_handle;
+			uint8_t  m_mip;
+		};
+
+		///
+		TextureStreaming();
+
+		///
+		~TextureStreaming();
+
+		/// Memory budget in bytes for all resident streaming mips, 0 is unlimited.
+		void init(uint64_t _budget);
+
+		///
+		void shutdown();
+
+		/// Returns index of first mip which is always resident.
+		static uint8_t calcTailMip(uint16_t _width, uint16_t _height, uint8_t _numMips);
+
+		/// Returns storage size of single mip.
+		static uint32_t calcMipSize(uint16_t _width, uint16_t _height, uint8_t _mip, TextureFormat::Enum _format);
+
+		/// Start tracking residency of texture created with tail mips resident.
+		void add(
+			  TextureHandle _handle
+			, uint16_t _width
+			, uint16_t _height
+			, uint8_t _numMips
+			, TextureFormat::Enum _format
+			, TextureMipReadFn _readFn
+			, void* _userData
+			);
+
+		///
+		void remove(TextureHandle _handle);
+
+		///
+		bool isStreaming(TextureHandle _handle) const
+		{
+			return UINT16_MAX != m_lut[_handle.idx];
+		}
+
+		/// Set finest mip application wants to be resident.
+		void setDesiredMip(TextureHandle _handle, uint8_t _mip);
+
+		/// Returns finest resident mip.
+		uint8_t getResidentMip(TextureHandle _handle) const;
+
+		/// Get size of texture when `_mip` is finest resident mip.
+		void getResidentSize(TextureHandle _handle, uint8_t _mip, uint16_t& _width, uint16_t& _height, uint8_t& _numMips, uint32_t& _storageSize) const;
+
+		/// Mark `_mip` as finest resident mip after texture was resized. Ownership of memory
+		/// read for change is passed to caller.
+		void setResident(TextureHandle _handle, uint8_t _mip);
+
+		/// Plan residency changes for this frame. First mips that are not desired anymore, or
+		/// don't fit into budget are evicted, then finer mips are loaded while they fit into
+		/// budget. Loaded mips are read on streaming thread, and change is returned once they
+		/// are read. Texture with read in flight is not planned again until its change is
+		/// applied with `setResident`.
+		///
+		/// @param[in] _copyMips Renderer copies mips that stay resident when texture is
+		///   resized. Otherwise all resident mips are read again, evictions included.
+		///
+		/// @returns Number of changes ready to be applied.
+		///
+		uint32_t update(bool _copyMips);
+
+		///
+		const Change& getChange(uint32_t _idx) const
+		{
+			return m_change[_idx];
+		}
+
+		/// Size of resident streaming mips in bytes.
+		int64_t getUsed() const
+		{
+			return m_used;
+		}
+
+	private:
+		struct State
+		{
+			enum Enum
+			{
+				Free,
+				Queued,
+				Running,
+				Done,
+				Ready,
+			};
+		};
+
+		struct Read
+		{
+			TextureMipReadFn m_readFn;
+			void*    m_userData;
+			const Memory* m_mem[16];
+			uint32_t m_seq;
+			uint16_t m_handle;
+			uint16_t m_width;
+			uint16_t m_height;
+			uint8_t  m_format;
+			uint8_t  m_first;
+			uint8_t  m_last;
+			uint8_t  m_state;
+		};
+
+		struct Texture
+		{
+			TextureMipReadFn m_readFn;
+			void*    m_userData;
+			uint32_t m_size[16]; //!< Storage size when mip is finest resident.
+			uint16_t m_handle;
+			uint16_t m_width;
+			uint16_t m_height;
+			uint8_t  m_format;
+			uint8_t  m_numMips;
+			uint8_t  m_tail;
+			uint8_t  m_desired;
+			uint8_t  m_resident;
+			uint8_t  m_planned;
+			uint8_t  m_read; //!< Read in flight, or UINT8_MAX.
+			bool     m_loadSkip;
+		};
+
+		Texture& get(TextureHandle _handle);
+		const Texture& get(TextureHandle _handle) const;
+
+		void push(Texture& _texture, uint8_t _first, uint8_t _last);
+		void cancel(uint8_t _idx);
+
+		static int32_t readerThread(bx::Thread* _self, void* _userData);
+		static bool validate(Read& _read);
+		static void read(Read& _read);
+
+		bx::Thread    m_thread;
+		bx::Semaphore m_workSem;
+		bx::Semaphore m_doneSem;
+		bx::Mutex     m_lock;
+
+		Read     m_read[BGFX_CONFIG_TEXTURE_STREAMING_MAX_LOADS];
+		uint16_t m_lut[BGFX_CONFIG_MAX_TEXTURES];
+
+		Texture* m_texture;
+		Change*  m_change;
+		uint32_t m_num;
+		uint32_t m_capacity;
+		uint32_t m_numChanges;
+		uint32_t m_seq;
+		uint64_t m_budget;
+		int64_t  m_used;
+		uint8_t  m_wait; //!< Read API thread is waiting for.
+		bool     m_exit;
+	};
+
+} // namespace bgfx
+
+#endif // BGFX_STREAMING_H_HEADER_GUARD
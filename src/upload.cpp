@@ -0,0 +1,352 @@
+/*
+ * Copyright 2011-2024 Branimir Karadzic. All rights reserved.
+ * License: https://github.com/bkaradzic/bgfx/blob/master/LICENSE
+ */
+
+#include "bgfx_p.h"
+#include "upload.h"
+
+namespace bgfx
+{
+	constexpr uint8_t kUploadDefaultPriority = 128;
+
+	static int32_t compareUploadItem(const void* _lhs, const void* _rhs)
+	{
+		const UploadQueue::Item& lhs = *(const UploadQueue::Item*)_lhs;
+		const UploadQueue::Item& rhs = *(const UploadQueue::Item*)_rhs;
+
+		if (lhs.m_priority != rhs.m_priority)
+		{
+			return lhs.m_priority > rhs.m_priority ? -1 : 1;
+		}
+
+		return lhs.m_seq < rhs.m_seq ? -1 : 1;
+	}
+
+	UploadQueue::UploadQueue()
+		: m_items(NULL)
+		, m_num(0)
+		, m_capacity(0)
+		, m_seq(0)
+		, m_budget(0)
+		, m_numBlocked(0)
+		, m_numCreateQueued(0)
+		, m_size(0)
+	{
+	}
+
+	UploadQueue::~UploadQueue()
+	{
+		BX_ASSERT(NULL == m_items, "UploadQueue::shutdown must be called.");
+	}
+
+	void UploadQueue::init(uint32_t _budget)
+	{
+		m_budget = _budget;
+		m_num    = 0;
+		m_seq    = 0;
+		m_size   = 0;
+
+		m_numBlocked      = 0;
+		m_numCreateQueued = 0;
+
+		const HandleState initial = { 0, 0, kUploadDefaultPriority, false };
+
+		for (uint32_t ii = 0; ii < BX_COUNTOF(m_texture); ++ii)
+		{
+			m_texture[ii] = initial;
+		}
+
+		for (uint32_t ii = 0; ii < BX_COUNTOF(m_vertexBuffer); ++ii)
+		{
+			m_vertexBuffer[ii] = initial;
+		}
+
+		for (uint32_t ii = 0; ii < BX_COUNTOF(m_indexBuffer); ++ii)
+		{
+			m_indexBuffer[ii] = initial;
+		}
+	}
+
+	void UploadQueue::shutdown()
+	{
+		BX_ASSERT(0 == m_num, "Upload queue is not empty (%d items).", m_num);
+
+		bx::free(g_allocator, m_items);
+		m_items    = NULL;
+		m_num      = 0;
+		m_capacity = 0;
+		m_budget   = 0;
+	}
+
+	UploadQueue::Item& UploadQueue::push(UploadType::Enum _type, uint16_t _handle, uint8_t _cmd, bool _create, const Memory* _mem)
+	{
+		if (m_num == m_capacity)
+		{
+			m_capacity = bx::max<uint32_t>(64, m_capacity*2);
+			m_items    = (Item*)bx::realloc(g_allocator, m_items, m_capacity*sizeof(Item) );
+		}
+
+		HandleState& state = getState(_type, _handle);
+		++state.m_numQueued;
+
+		if (_create)
+		{
+			setCreateQueued(state, true);
+		}
+
+		Item& item = m_items[m_num++];
+		bx::memSet(&item, 0, sizeof(Item) );
+		item.m_mem      = _mem;
+		item.m_seq      = m_seq++;
+		item.m_handle   = _handle;
+		item.m_type     = uint8_t(_type);
+		item.m_cmd      = _cmd;
+		item.m_priority = state.m_priority;
+		item.m_create   = _create;
+
+		m_size += NULL != _mem ? _mem->size : 0;
+
+		return item;
+	}
+
+	bool UploadQueue::isReady(UploadType::Enum _type, uint16_t _handle) const
+	{
+		return 0 == getState(_type, _handle).m_numQueued;
+	}
+
+	bool UploadQueue::isCreatePending(UploadType::Enum _type, uint16_t _handle) const
+	{
+		HandleState& state = const_cast<UploadQueue*>(this)->getState(_type, _handle);
+		return 0 != bx::atomicFetchAndAdd<uint32_t>(&state.m_createQueued, 0);
+	}
+
+	bool UploadQueue::hasCreatePending() const
+	{
+		return 0 != bx::atomicFetchAndAdd<uint32_t>(const_cast<uint32_t*>(&m_numCreateQueued), 0);
+	}
+
+	UploadQueue::Item& UploadQueue::setCreateMem(UploadType::Enum _type, uint16_t _handle, const Memory* _mem)
+	{
+		BX_ASSERT(isCreatePending(_type, _handle), "Create of handle %d is not queued.", _handle);
+
+		uint32_t ii = 0;
+		for (; ii < m_num; ++ii)
+		{
+			const Item& item = m_items[ii];
+
+			if (item.m_create
+			&&  item.m_type   == _type
+			&&  item.m_handle == _handle)
+			{
+				break;
+			}
+		}
+
+		return setMem(ii, _mem);
+	}
+
+	UploadQueue::Item& UploadQueue::setMem(uint32_t _idx, const Memory* _mem)
+	{
+		BX_ASSERT(_idx < m_num, "Invalid item index %d (queued %d).", _idx, m_num);
+
+		Item& item = m_items[_idx];
+		m_size -= NULL != item.m_mem ? item.m_mem->size : 0;
+		m_size += NULL != _mem       ? _mem->size       : 0;
+		item.m_mem = _mem;
+
+		return item;
+	}
+
+	void UploadQueue::setBlocked(UploadType::Enum _type, uint16_t _handle, bool _blocked)
+	{
+		HandleState& state = getState(_type, _handle);
+
+		if (state.m_blocked == _blocked)
+		{
+			return;
+		}
+
+		state.m_blocked = _blocked;
+
+		if (_blocked)
+		{
+			++m_numBlocked;
+		}
+		else
+		{
+			--m_numBlocked;
+		}
+	}
+
+	void UploadQueue::setPriority(UploadType::Enum _type, uint16_t _handle, uint8_t _priority)
+	{
+		HandleState& state = getState(_type, _handle);
+		state.m_priority = _priority;
+
+		// All uploads of the same handle share priority, this keeps their order of submission.
+		for (uint32_t ii = 0, num = 0 == state.m_numQueued ? 0 : m_num; ii < num; ++ii)
+		{
+			Item& item = m_items[ii];
+
+			if (item.m_type   == _type
+			&&  item.m_handle == _handle)
+			{
+				item.m_priority = _priority;
+			}
+		}
+	}
+
+	uint32_t UploadQueue::select()
+	{
+		if (0 == m_num)
+		{
+			return 0;
+		}
+
+		bx::quickSort(m_items, m_num, sizeof(Item), compareUploadItem);
+
+		uint32_t numUnblocked = m_num;
+
+		if (0 != m_numBlocked)
+		{
+			// Move items of unblocked handles to the front, keeping their order.
+			numUnblocked = 0;
+
+			for (uint32_t ii = 0; ii < m_num; ++ii)
+			{
+				if (!getState(UploadType::Enum(m_items[ii].m_type), m_items[ii].m_handle).m_blocked)
+				{
+					const Item item = m_items[ii];
+					bx::memMove(&m_items[numUnblocked+1], &m_items[numUnblocked], (ii-numUnblocked)*sizeof(Item) );
+					m_items[numUnblocked++] = item;
+				}
+			}
+
+			if (0 == numUnblocked)
+			{
+				return 0;
+			}
+		}
+
+		if (!isEnabled() )
+		{
+			return numUnblocked;
+		}
+
+		uint32_t num  = 1;
+		uint64_t size = NULL != m_items[0].m_mem ? m_items[0].m_mem->size : 0;
+
+		for (; num < numUnblocked; ++num)
+		{
+			const Memory* mem = m_items[num].m_mem;
+			size += NULL != mem ? mem->size : 0;
+
+			if (size > m_budget)
+			{
+				break;
+			}
+		}
+
+		return num;
+	}
+
+	uint32_t UploadQueue::select(UploadType::Enum _type, uint16_t _handle)
+	{
+		if (isReady(_type, _handle) )
+		{
+			return 0;
+		}
+
+		// Move items of handle to the front, keeping order of submission.
+		uint32_t num = 0;
+
+		for (uint32_t ii = 0; ii < m_num; ++ii)
+		{
+			if (m_items[ii].m_type   == _type
+			&&  m_items[ii].m_handle == _handle)
+			{
+				const Item item = m_items[ii];
+				bx::memMove(&m_items[num+1], &m_items[num], (ii-num)*sizeof(Item) );
+				m_items[num++] = item;
+			}
+		}
+
+		return num;
+	}
+
+	void UploadQueue::pop(uint32_t _num)
+	{
+		BX_ASSERT(_num <= m_num, "Popping more items than queued (%d > %d).", _num, m_num);
+
+		for (uint32_t ii = 0; ii < _num; ++ii)
+		{
+			const Item& item = m_items[ii];
+
+			HandleState& state = getState(UploadType::Enum(item.m_type), item.m_handle);
+			--state.m_numQueued;
+
+			if (item.m_create)
+			{
+				setCreateQueued(state, false);
+			}
+
+			m_size -= NULL != item.m_mem ? item.m_mem->size : 0;
+		}
+
+		m_num -= _num;
+		bx::memMove(m_items, &m_items[_num], m_num*sizeof(Item) );
+	}
+
+	void UploadQueue::reset(UploadType::Enum _type, uint16_t _handle)
+	{
+		HandleState& state = getState(_type, _handle);
+		BX_ASSERT(0 == state.m_numQueued, "Resetting handle %d with queued uploads.", _handle);
+
+		setBlocked(_type, _handle, false);
+
+		setCreateQueued(state, false);
+
+		state.m_numQueued = 0;
+		state.m_priority  = kUploadDefaultPriority;
+	}
+
+	void UploadQueue::setCreateQueued(HandleState& _state, bool _queued)
+	{
+		// Only API thread modifies queue. Flag is set before handle is returned to user, so
+		// encoder can't observe handle before its create is queued.
+		if (_queued == (0 != _state.m_createQueued) )
+		{
+			return;
+		}
+
+		bx::atomicExchange<uint32_t>(&_state.m_createQueued, _queued);
+
+		if (_queued)
+		{
+			bx::atomicFetchAndAdd<uint32_t>(&m_numCreateQueued, 1);
+		}
+		else
+		{
+			bx::atomicFetchAndSub<uint32_t>(&m_numCreateQueued, 1);
+		}
+	}
+
+	UploadQueue::HandleState& UploadQueue::getState(UploadType::Enum _type, uint16_t _handle)
+	{
+		switch (_type)
+		{
+		case UploadType::VertexBuffer: return m_vertexBuffer[_handle];
+		case UploadType::IndexBuffer:  return m_indexBuffer[_handle];
+		default:                       break;
+		}
+
+		return m_texture[_handle];
+	}
+
+	const UploadQueue::HandleState& UploadQueue::getState(UploadType::Enum _type, uint16_t _handle) const
+	{
+		return const_cast<UploadQueue*>(this)->getState(_type, _handle);
+	}
+
+} // namespace bgfx
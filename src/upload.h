@@ -0,0 +1,178 @@
+/*
+ * Copyright 2011-2024 Branimir Karadzic. All rights reserved.
+ * License: https://github.com/bkaradzic/bgfx/blob/master/LICENSE
+ */
+
+#ifndef BGFX_UPLOAD_H_HEADER_GUARD
+#define BGFX_UPLOAD_H_HEADER_GUARD
+
+#include <bgfx/bgfx.h>
+
+#include "config.h"
+
+namespace bgfx
+{
+	/// Type of resource handle upload is queued for.
+	///
+	struct UploadType
+	{
+		enum Enum
+		{
+			Texture,
+			VertexBuffer,
+			IndexBuffer,
+
+			Count
+		};
+	};
+
+	/// Resource creation and update commands deferred by API thread. Each frame queue hands
+	/// out commands, in order of priority, until frame upload budget is exhausted.
+	///
+	class UploadQueue
+	{
+	public:
+		/// Deferred command, which fields are used depends on command.
+		///
+		struct Item
+		{
+			const Memory* m_mem;
+			uint64_t m_flags;
+			uint32_t m_seq;
+			uint16_t m_handle;
+			uint16_t m_layout;
+			uint16_t m_x;
+			uint16_t m_y;
+			uint16_t m_z;
+			uint16_t m_width;
+			uint16_t m_height;
+			uint16_t m_depth;
+			uint16_t m_pitch;
+			uint8_t  m_type;
+			uint8_t  m_cmd;
+			uint8_t  m_priority;
+			uint8_t  m_side;
+			uint8_t  m_mip;
+			uint8_t  m_skip;
+			bool     m_create;
+		};
+
+		///
+		UploadQueue();
+
+		///
+		~UploadQueue();
+
+		/// Enable queue with upload budget in bytes per frame. Zero budget keeps queue disabled,
+		/// and all uploads are issued immediately, except uploads of blocked handles.
+		void init(uint32_t _budget);
+
+		/// Queue must be empty before shutdown.
+		void shutdown();
+
+		///
+		bool isEnabled() const
+		{
+			return 0 != m_budget;
+		}
+
+		/// Add command to the end of queue. Returned item must be filled with command arguments
+		/// by caller.
+		Item& push(UploadType::Enum _type, uint16_t _handle, uint8_t _cmd, bool _create, const Memory* _mem);
+
+		/// Returns true if there are no uploads queued for handle.
+		bool isReady(UploadType::Enum _type, uint16_t _handle) const;
+
+		/// Returns true if resource is not created yet, and it must not be used by draw calls.
+		/// Safe to call from encoder threads while API thread modifies queue.
+		bool isCreatePending(UploadType::Enum _type, uint16_t _handle) const;
+
+		/// Returns true if any create is queued. Safe to call from encoder threads while API
+		/// thread modifies queue.
+		bool hasCreatePending() const;
+
+		/// Replace memory of queued create command. Returned item must be updated by caller if
+		/// command arguments depend on memory.
+		Item& setCreateMem(UploadType::Enum _type, uint16_t _handle, const Memory* _mem);
+
+		/// Replace memory of selected item. Returned item must be updated by caller if command
+		/// arguments depend on memory.
+		Item& setMem(uint32_t _idx, const Memory* _mem);
+
+		/// Uploads of blocked handle are not selected, until handle is unblocked or reset. Used
+		/// while create memory is not ready yet.
+		void setBlocked(UploadType::Enum _type, uint16_t _handle, bool _blocked);
+
+		/// Higher priority uploads are issued first. Priority is kept until handle is reset.
+		void setPriority(UploadType::Enum _type, uint16_t _handle, uint8_t _priority);
+
+		/// Select items to be issued in this frame, in order of priority and submission. At least
+		/// one item is selected when queue has items of unblocked handles, even when it's larger
+		/// than budget. All items of unblocked handles are selected when queue is disabled.
+		///
+		/// @returns Number of selected items.
+		///
+		uint32_t select();
+
+		/// Select all items queued for handle, in order of submission, regardless of budget and
+		/// blocking.
+		///
+		/// @returns Number of selected items.
+		///
+		uint32_t select(UploadType::Enum _type, uint16_t _handle);
+
+		/// Get selected item.
+		const Item& get(uint32_t _idx) const
+		{
+			return m_items[_idx];
+		}
+
+		/// Remove first `_num` selected items from queue.
+		void pop(uint32_t _num);
+
+		/// Reset state of destroyed handle.
+		void reset(UploadType::Enum _type, uint16_t _handle);
+
+		/// Number of queued uploads.
+		uint32_t getNum() const
+		{
+			return m_num;
+		}
+
+		/// Size of queued upload data in bytes.
+		int64_t getSize() const
+		{
+			return m_size;
+		}
+
+	private:
+		struct HandleState
+		{
+			uint32_t m_createQueued; // Accessed atomically, read by encoder threads.
+			uint16_t m_numQueued;
+			uint8_t  m_priority;
+			bool     m_blocked;
+		};
+
+		void setCreateQueued(HandleState& _state, bool _queued);
+
+		HandleState& getState(UploadType::Enum _type, uint16_t _handle);
+		const HandleState& getState(UploadType::Enum _type, uint16_t _handle) const;
+
+		HandleState m_texture[BGFX_CONFIG_MAX_TEXTURES];
+		HandleState m_vertexBuffer[BGFX_CONFIG_MAX_VERTEX_BUFFERS];
+		HandleState m_indexBuffer[BGFX_CONFIG_MAX_INDEX_BUFFERS];
+
+		Item*    m_items;
+		uint32_t m_num;
+		uint32_t m_capacity;
+		uint32_t m_seq;
+		uint32_t m_budget;
+		uint32_t m_numBlocked;
+		uint32_t m_numCreateQueued; // Accessed atomically, read by encoder threads.
+		int64_t  m_size;
+	};
+
+} // namespace bgfx
+
+#endif // BGFX_UPLOAD_H_HEADER_GUARD
@@ -0,0 +1,227 @@
+/*
+ * Copyright 2011-2024 Branimir Karadzic. All rights reserved.
+ * License: https://github.com/bkaradzic/bgfx/blob/master/LICENSE
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <bx/allocator.h>
+
+#include "range_allocator.h"
+
+static uint32_t s_numChecks = 0;
+static uint32_t s_numFailed = 0;
+
+#define CHECK(_condition)                                                    \
+	BX_MACRO_BLOCK_BEGIN                                                     \
+		++s_numChecks;                                                       \
+		if (!(_condition) )                                                  \
+		{                                                                    \
+			++s_numFailed;                                                   \
+			fprintf(stderr, "%s(%d): CHECK(%s) failed.\n", __FILE__, __LINE__, #_condition); \
+		}                                                                    \
+	BX_MACRO_BLOCK_END
+
+static bx::DefaultAllocator s_allocator;
+
+static void testAlloc()
+{
+	bgfx::RangeAllocator ra;
+	ra.create(&s_allocator, 1024);
+
+	CHECK(1024 == ra.getSize() );
+	CHECK(ra.isEmpty() );
+	CHECK(1 == ra.getNumFreeRanges() );
+	CHECK(1024 == ra.getLargestFree() );
+
+	uint64_t offset0 = UINT64_MAX;
+	uint64_t offset1 = UINT64_MAX;
+	CHECK(ra.alloc(100, 0, offset0) );
+	CHECK(ra.alloc(200, 0, offset1) );
+	CHECK(0   == offset0);
+	CHECK(100 == offset1);
+	CHECK(300 == ra.getUsed() );
+	CHECK(1   == ra.getNumFreeRanges() );
+	CHECK(724 == ra.getLargestFree() );
+	CHECK(!ra.isEmpty() );
+
+	ra.free(offset0, 100);
+	ra.free(offset1, 200);
+	CHECK(ra.isEmpty() );
+
+	ra.destroy();
+	CHECK(0 == ra.getSize() );
+	CHECK(0 == ra.getNumFreeRanges() );
+}
+
+static void testAlign()
+{
+	bgfx::RangeAllocator ra;
+	ra.create(&s_allocator, 1024);
+
+	uint64_t offset0 = UINT64_MAX;
+	uint64_t offset1 = UINT64_MAX;
+	uint64_t offset2 = UINT64_MAX;
+	CHECK(ra.alloc(10, 1, offset0) );
+	CHECK(0 == offset0);
+
+	// Padding in front of aligned allocation stays free.
+	CHECK(ra.alloc(64, 256, offset1) );
+	CHECK(256 == offset1);
+	CHECK(2 == ra.getNumFreeRanges() );
+	CHECK(74 == ra.getUsed() );
+
+	// Padding is reused by allocation that fits in it.
+	CHECK(ra.alloc(16, 16, offset2) );
+	CHECK(16 == offset2);
+	CHECK(3 == ra.getNumFreeRanges() );
+
+	// Alignment can't be satisfied inside of block.
+	uint64_t offset3 = UINT64_MAX;
+	CHECK(!ra.alloc(1, 2048, offset3) );
+	CHECK(UINT64_MAX == offset3);
+
+	ra.free(offset1, 64);
+	ra.free(offset0, 10);
+	ra.free(offset2, 16);
+	CHECK(ra.isEmpty() );
+	CHECK(1 == ra.getNumFreeRanges() );
+	CHECK(1024 == ra.getLargestFree() );
+
+	ra.destroy();
+}
+
+static void testMerge()
+{
+	bgfx::RangeAllocator ra;
+	ra.create(&s_allocator, 400);
+
+	uint64_t offset[4];
+	for (uint32_t ii = 0; ii < BX_COUNTOF(offset); ++ii)
+	{
+		CHECK(ra.alloc(100, 0, offset[ii]) );
+		CHECK(ii*100 == offset[ii]);
+	}
+
+	CHECK(0 == ra.getNumFreeRanges() );
+
+	// No neighbours free, new range is inserted.
+	ra.free(offset[1], 100);
+	CHECK(1 == ra.getNumFreeRanges() );
+	CHECK(100 == ra.getLargestFree() );
+
+	// Merge with previous free range.
+	ra.free(offset[2], 100);
+	CHECK(1 == ra.getNumFreeRanges() );
+	CHECK(200 == ra.getLargestFree() );
+
+	// Merge with next free range.
+	ra.free(offset[0], 100);
+	CHECK(1 == ra.getNumFreeRanges() );
+	CHECK(300 == ra.getLargestFree() );
+
+	// Split in the middle, and merge with both previous and next free ranges.
+	CHECK(ra.alloc(100, 0, offset[0]) );
+	CHECK(0 == offset[0]);
+	CHECK(ra.alloc(100, 0, offset[1]) );
+	CHECK(100 == offset[1]);
+	ra.free(offset[0], 100);
+	CHECK(2 == ra.getNumFreeRanges() );
+
+	ra.free(offset[1], 100);
+	CHECK(1 == ra.getNumFreeRanges() );
+	CHECK(300 == ra.getLargestFree() );
+
+	ra.free(offset[3], 100);
+	CHECK(ra.isEmpty() );
+	CHECK(1 == ra.getNumFreeRanges() );
+	CHECK(400 == ra.getLargestFree() );
+
+	ra.destroy();
+}
+
+static void testFull()
+{
+	bgfx::RangeAllocator ra;
+	ra.create(&s_allocator, 256);
+
+	uint64_t offset0 = UINT64_MAX;
+	uint64_t offset1 = UINT64_MAX;
+	CHECK(ra.alloc(128, 0, offset0) );
+	CHECK(ra.alloc(128, 0, offset1) );
+	CHECK(256 == ra.getUsed() );
+	CHECK(0 == ra.getNumFreeRanges() );
+	CHECK(0 == ra.getLargestFree() );
+
+	uint64_t offset = UINT64_MAX;
+	CHECK(!ra.alloc(1, 0, offset) );
+	CHECK(UINT64_MAX == offset);
+
+	// Larger than block.
+	ra.free(offset0, 128);
+	CHECK(!ra.alloc(257, 0, offset) );
+	CHECK(!ra.alloc(129, 0, offset) );
+
+	// Exact fit removes free range.
+	CHECK(ra.alloc(128, 0, offset) );
+	CHECK(offset0 == offset);
+	CHECK(0 == ra.getNumFreeRanges() );
+
+	ra.free(offset,  128);
+	ra.free(offset1, 128);
+	CHECK(ra.isEmpty() );
+
+	// Empty block can't satisfy anything.
+	ra.destroy();
+	ra.create(&s_allocator, 0);
+	CHECK(0 == ra.getNumFreeRanges() );
+	CHECK(!ra.alloc(1, 0, offset) );
+
+	ra.destroy();
+}
+
+static void testManyRanges()
+{
+	// Free range array grows beyond its initial capacity.
+	const uint32_t num = 256;
+
+	bgfx::RangeAllocator ra;
+	ra.create(&s_allocator, num*16);
+
+	uint64_t offset[num];
+	for (uint32_t ii = 0; ii < num; ++ii)
+	{
+		CHECK(ra.alloc(16, 16, offset[ii]) );
+	}
+
+	for (uint32_t ii = 0; ii < num; ii += 2)
+	{
+		ra.free(offset[ii], 16);
+	}
+
+	CHECK(num/2 == ra.getNumFreeRanges() );
+
+	for (uint32_t ii = 1; ii < num; ii += 2)
+	{
+		ra.free(offset[ii], 16);
+	}
+
+	CHECK(ra.isEmpty() );
+	CHECK(1 == ra.getNumFreeRanges() );
+	CHECK(num*16 == ra.getLargestFree() );
+
+	ra.destroy();
+}
+
+int main(int /*_argc*/, const char* /*_argv*/[])
+{
+	testAlloc();
+	testAlign();
+	testMerge();
+	testFull();
+	testManyRanges();
+
+	printf("range_allocator: %d/%d checks passed.\n", s_numChecks - s_numFailed, s_numChecks);
+
+	return 0 == s_numFailed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,1188 @@
+/*
+ * Copyright 2011-2024 Branimir Karadzic. All rights reserved.
+ * License: https://github.com/bkaradzic/bgfx/blob/master/LICENSE
+ */
+
+#include <bx/bx.h>
+#include <bx/commandline.h>
+#include <bx/math.h>
+#include <bx/rng.h>
+#include <bx/string.h>
+#include <bx/thread.h>
+#include <bx/timer.h>
+#include <bgfx/bgfx.h>
+
+#define BGFX_BENCH_VERSION_MAJOR 1
+#define BGFX_BENCH_VERSION_MINOR 0
+
+struct Settings
+{
+	Settings()
+		: numFrames(100)
+		, numDraws(60000)
+		, numViews(8)
+		, numThreads(4)
+		, numBuffers(2000)
+		, renderer(bgfx::RendererType::Noop)
+		, capture(NULL)
+		, replay(NULL)
+	{
+	}
+
+	uint32_t numFrames;
+	uint32_t numDraws;
+	uint32_t numViews;
+	uint32_t numThreads;
+	uint32_t numBuffers;
+	bgfx::RendererType::Enum renderer;
+	const char* capture;
+	const char* replay;
+};
+
+struct Timing
+{
+	Timing()
+		: min(INT64_MAX)
+		, max(0)
+		, total(0)
+		, count(0)
+	{
+	}
+
+	void add(int64_t _time)
+	{
+		min    = bx::min(min, _time);
+		max    = bx::max(max, _time);
+		total += _time;
+		++count;
+	}
+
+	void print(const char* _name, int64_t _freq) const
+	{
+		const double toMs = 1000.0/double(_freq);
+		bx::printf("%-32s avg %8.3f [ms], min %8.3f [ms], max %8.3f [ms], %d frames\n"
+			, _name
+			, 0 == count ? 0.0 : double(total)*toMs/double(count)
+			, 0 == count ? 0.0 : double(min)*toMs
+			, double(max)*toMs
+			, count
+			);
+	}
+
+	int64_t  min;
+	int64_t  max;
+	int64_t  total;
+	uint32_t count;
+};
+
+static bgfx::ProgramHandle createProgram()
+{
+	// Noop renderer doesn't compile shaders, only shader binary header is parsed by bgfx.
+	static const uint8_t vsh[] = { 'V', 'S', 'H', 5, 0, 0, 0, 0, 0, 0 };
+	static const uint8_t fsh[] = { 'F', 'S', 'H', 5, 0, 0, 0, 0, 0, 0 };
+
+	return bgfx::createProgram(
+		  bgfx::createShader(bgfx::makeRef(vsh, sizeof(vsh) ) )
+		, bgfx::createShader(bgfx::makeRef(fsh, sizeof(fsh) ) )
+		, true
+		);
+}
+
+static bool initRenderer(bgfx::RendererType::Enum _type, bgfx::Init& _init)
+{
+	_init.type              = _type;
+	_init.resolution.width  = 1280;
+	_init.resolution.height = 720;
+	_init.resolution.reset  = BGFX_RESET_NONE;
+
+	if (!bgfx::init(_init) )
+	{
+		bx::printf("Failed to initialize bgfx.\n");
+		return false;
+	}
+
+	return true;
+}
+
+static bool initNoop(const Settings& _settings, bgfx::Init& _init)
+{
+	BX_UNUSED(_settings);
+
+	return initRenderer(bgfx::RendererType::Noop, _init);
+}
+
+static Timing runSort(const Settings& _settings, uint32_t _numSortThreads)
+{
+	Timing timing;
+
+	bgfx::Init init;
+	init.limits.numSortThreads = _numSortThreads;
+	init.limits.maxDrawCalls   = bx::max(init.limits.maxDrawCalls, _settings.numDraws);
+
+	if (!initNoop(_settings, init) )
+	{
+		return timing;
+	}
+
+	bgfx::ProgramHandle program = createProgram();
+
+	for (uint32_t ii = 0; ii < _settings.numViews; ++ii)
+	{
+		bgfx::setViewRect(bgfx::ViewId(ii), 0, 0, 1280, 720);
+		bgfx::setViewMode(bgfx::ViewId(ii), bgfx::ViewMode::DepthAscending);
+	}
+
+	bx::RngMwc rng;
+
+	for (uint32_t frame = 0; frame < _settings.numFrames + 2; ++frame)
+	{
+		for (uint32_t ii = 0; ii < _settings.numDraws; ++ii)
+		{
+			bgfx::setVertexCount(3);
+			bgfx::submit(
+				  bgfx::ViewId(rng.gen() % _settings.numViews)
+				, program
+				, rng.gen() & 0xffffff
+				);
+		}
+
+		bgfx::frame();
+
+		// Skip first frames, until render thread is fed with full frames.
+		if (2 <= frame)
+		{
+			const bgfx::Stats* stats = bgfx::getStats();
+			timing.add(stats->cpuTimeEnd - stats->cpuTimeBegin);
+		}
+	}
+
+	bgfx::destroy(program);
+	bgfx::shutdown();
+
+	return timing;
+}
+
+static int32_t benchSort(const Settings& _settings)
+{
+	bx::printf("sort: %d draws, %d views, %d frames\n"
+		, _settings.numDraws
+		, _settings.numViews
+		, _settings.numFrames
+		);
+
+	const int64_t freq = bx::getHPFrequency();
+
+	const Timing single = runSort(_settings, 0);
+	single.print("render thread sort", freq);
+
+	const Timing parallel = runSort(_settings, _settings.numThreads);
+
+	char name[64];
+	bx::snprintf(name, sizeof(name), "parallel sort (%d threads)", _settings.numThreads);
+	parallel.print(name, freq);
+
+	return bx::kExitSuccess;
+}
+
+struct EncoderThread
+{
+	EncoderThread()
+		: program(BGFX_INVALID_HANDLE)
+		, numDraws(0)
+		, numViews(1)
+		, quit(false)
+	{
+	}
+
+	static int32_t threadFunc(bx::Thread* _self, void* _userData)
+	{
+		BX_UNUSED(_self);
+		EncoderThread* self = (EncoderThread*)_userData;
+		return self->run();
+	}
+
+	int32_t run()
+	{
+		bx::RngMwc rng;
+
+		for (;;)
+		{
+			startSem.wait();
+
+			if (quit)
+			{
+				break;
+			}
+
+			bgfx::Encoder* encoder = bgfx::begin(true);
+
+			if (NULL != encoder)
+			{
+				for (uint32_t ii = 0; ii < numDraws; ++ii)
+				{
+					const float mtx[16] =
+					{
+						1.0f, 0.0f, 0.0f, 0.0f,
+						0.0f, 1.0f, 0.0f, 0.0f,
+						0.0f, 0.0f, 1.0f, 0.0f,
+						float(ii), 0.0f, 0.0f, 1.0f,
+					};
+
+					encoder->setTransform(mtx);
+					encoder->setScissor(0, 0, 640, 360);
+					encoder->setVertexCount(3);
+					encoder->submit(bgfx::ViewId(rng.gen() % numViews), program);
+				}
+
+				bgfx::end(encoder);
+			}
+
+			doneSem.post();
+		}
+
+		return bx::kExitSuccess;
+	}
+
+	bx::Thread    thread;
+	bx::Semaphore startSem;
+	bx::Semaphore doneSem;
+
+	bgfx::ProgramHandle program;
+	uint32_t numDraws;
+	uint32_t numViews;
+	bool     quit;
+};
+
+static Timing runEncoders(const Settings& _settings, uint32_t _numEncoders, uint32_t& _numDropped)
+{
+	Timing timing;
+	_numDropped = 0;
+
+	bgfx::Init init;
+	init.limits.maxEncoders  = uint16_t(bx::max<uint32_t>(init.limits.maxEncoders, _numEncoders+1) );
+	init.limits.maxDrawCalls = bx::max(init.limits.maxDrawCalls, _settings.numDraws);
+
+	if (!initNoop(_settings, init) )
+	{
+		return timing;
+	}
+
+	bgfx::ProgramHandle program = createProgram();
+
+	for (uint32_t ii = 0; ii < _settings.numViews; ++ii)
+	{
+		bgfx::setViewRect(bgfx::ViewId(ii), 0, 0, 1280, 720);
+	}
+
+	EncoderThread* encoderThread = new EncoderThread[_numEncoders];
+
+	for (uint32_t ii = 0; ii < _numEncoders; ++ii)
+	{
+		EncoderThread& et = encoderThread[ii];
+		et.program  = program;
+		et.numDraws = _settings.numDraws/_numEncoders;
+		et.numViews = _settings.numViews;
+		et.thread.init(EncoderThread::threadFunc, &et, 0, "bench - encoder thread");
+	}
+
+	for (uint32_t frame = 0; frame < _settings.numFrames + 2; ++frame)
+	{
+		const int64_t start = bx::getHPCounter();
+
+		for (uint32_t ii = 0; ii < _numEncoders; ++ii)
+		{
+			encoderThread[ii].startSem.post();
+		}
+
+		for (uint32_t ii = 0; ii < _numEncoders; ++ii)
+		{
+			encoderThread[ii].doneSem.wait();
+		}
+
+		const int64_t submitTime = bx::getHPCounter() - start;
+
+		bgfx::frame();
+
+		// Skip first frames, until render thread is fed with full frames.
+		if (2 <= frame)
+		{
+			const bgfx::Stats* stats = bgfx::getStats();
+			_numDropped += stats->numTransformsDropped + stats->numScissorsDropped;
+			timing.add(submitTime);
+		}
+	}
+
+	for (uint32_t ii = 0; ii < _numEncoders; ++ii)
+	{
+		EncoderThread& et = encoderThread[ii];
+		et.quit = true;
+		et.startSem.post();
+		et.thread.shutdown();
+	}
+
+	delete [] encoderThread;
+
+	bgfx::destroy(program);
+	bgfx::shutdown();
+
+	return timing;
+}
+
+static int32_t benchEncoders(const Settings& _settings)
+{
+	bx::printf("encoders: %d draws, %d views, %d frames\n"
+		, _settings.numDraws
+		, _settings.numViews
+		, _settings.numFrames
+		);
+
+	const int64_t freq = bx::getHPFrequency();
+
+	for (uint32_t numEncoders = 1; numEncoders <= _settings.numThreads; numEncoders *= 2)
+	{
+		uint32_t numDropped;
+		const Timing timing = runEncoders(_settings, numEncoders, numDropped);
+
+		char name[64];
+		bx::snprintf(name, sizeof(name), "submit (%d encoders)", numEncoders);
+		timing.print(name, freq);
+
+		if (0 != numDropped)
+		{
+			bx::printf("%-32s %d transforms/scissors dropped\n", "", numDropped);
+		}
+	}
+
+	return bx::kExitSuccess;
+}
+
+static void submitDraws(bgfx::ProgramHandle _program, bgfx::ViewId _view, uint32_t _numDraws)
+{
+	float mtx[16];
+	bx::mtxIdentity(mtx);
+
+	for (uint32_t ii = 0; ii < _numDraws; ++ii)
+	{
+		mtx[12] = float(ii);
+		bgfx::setTransform(mtx);
+		bgfx::setState(BGFX_STATE_DEFAULT);
+		bgfx::setVertexCount(3);
+		bgfx::submit(_view, _program, ii);
+	}
+}
+
+static Timing runBundle(const Settings& _settings, bool _useBundle)
+{
+	Timing timing;
+
+	bgfx::Init init;
+	init.limits.maxDrawCalls = bx::max(init.limits.maxDrawCalls, _settings.numDraws);
+
+	if (!initNoop(_settings, init) )
+	{
+		return timing;
+	}
+
+	bgfx::ProgramHandle program = createProgram();
+
+	const uint32_t numViews = bx::min<uint32_t>(_settings.numViews, bgfx::getCaps()->limits.maxDrawBundles);
+	const uint32_t numDraws = _settings.numDraws/numViews;
+
+	bgfx::DrawBundleHandle* bundle = new bgfx::DrawBundleHandle[numViews];
+
+	for (uint32_t ii = 0; ii < numViews; ++ii)
+	{
+		bgfx::setViewRect(bgfx::ViewId(ii), 0, 0, 1280, 720);
+
+		if (_useBundle)
+		{
+			bundle[ii] = bgfx::createDrawBundle();
+			bgfx::beginDrawBundle(bundle[ii]);
+			submitDraws(program, bgfx::ViewId(ii), numDraws);
+			bgfx::endDrawBundle();
+		}
+	}
+
+	for (uint32_t frame = 0; frame < _settings.numFrames + 2; ++frame)
+	{
+		const int64_t start = bx::getHPCounter();
+
+		for (uint32_t ii = 0; ii < numViews; ++ii)
+		{
+			if (_useBundle)
+			{
+				bgfx::submit(bgfx::ViewId(ii), bundle[ii]);
+			}
+			else
+			{
+				submitDraws(program, bgfx::ViewId(ii), numDraws);
+			}
+		}
+
+		const int64_t submitTime = bx::getHPCounter() - start;
+
+		bgfx::frame();
+
+		// Skip first frames, until render thread is fed with full frames.
+		if (2 <= frame)
+		{
+			timing.add(submitTime);
+		}
+	}
+
+	if (_useBundle)
+	{
+		for (uint32_t ii = 0; ii < numViews; ++ii)
+		{
+			bgfx::destroy(bundle[ii]);
+		}
+	}
+
+	delete [] bundle;
+
+	bgfx::destroy(program);
+	bgfx::shutdown();
+
+	return timing;
+}
+
+static int32_t benchBundle(const Settings& _settings)
+{
+	bx::printf("bundle: %d draws, %d views, %d frames\n"
+		, _settings.numDraws
+		, _settings.numViews
+		, _settings.numFrames
+		);
+
+	const int64_t freq = bx::getHPFrequency();
+
+	const Timing immediate = runBundle(_settings, false);
+	immediate.print("submit draw calls", freq);
+
+	const Timing bundle = runBundle(_settings, true);
+	bundle.print("submit draw bundles", freq);
+
+	return bx::kExitSuccess;
+}
+
+static int32_t benchChurn(const Settings& _settings)
+{
+	// Destroyed handles are freed only in frame, leave room for buffers recreated during frame.
+	const uint32_t numBuffers = bx::min<uint32_t>(_settings.numBuffers, 3500);
+	const uint32_t numChurn   = bx::max<uint32_t>(numBuffers/10, 1);
+
+	bx::printf("churn: %d dynamic vertex and index buffers, %d recreated per frame, %d frames\n"
+		, numBuffers
+		, numChurn
+		, _settings.numFrames
+		);
+
+	const int64_t freq = bx::getHPFrequency();
+
+	bgfx::Init init;
+
+	if (!initNoop(_settings, init) )
+	{
+		return bx::kExitFailure;
+	}
+
+	bgfx::VertexLayout layout;
+	layout
+		.begin()
+		.add(bgfx::Attrib::Position,  3, bgfx::AttribType::Float)
+		.add(bgfx::Attrib::TexCoord0, 2, bgfx::AttribType::Float)
+		.end();
+
+	bgfx::DynamicVertexBufferHandle* vb = new bgfx::DynamicVertexBufferHandle[numBuffers];
+	bgfx::DynamicIndexBufferHandle*  ib = new bgfx::DynamicIndexBufferHandle[numBuffers];
+
+	bx::RngMwc rng;
+
+	for (uint32_t ii = 0; ii < numBuffers; ++ii)
+	{
+		vb[ii] = bgfx::createDynamicVertexBuffer(1 + rng.gen()%1024, layout);
+		ib[ii] = bgfx::createDynamicIndexBuffer(1 + rng.gen()%4096);
+	}
+
+	Timing timing;
+
+	for (uint32_t frame = 0; frame < _settings.numFrames + 2; ++frame)
+	{
+		const int64_t start = bx::getHPCounter();
+
+		for (uint32_t ii = 0; ii < numChurn; ++ii)
+		{
+			const uint32_t idx = rng.gen() % numBuffers;
+
+			bgfx::destroy(vb[idx]);
+			bgfx::destroy(ib[idx]);
+
+			vb[idx] = bgfx::createDynamicVertexBuffer(1 + rng.gen()%1024, layout);
+			ib[idx] = bgfx::createDynamicIndexBuffer(1 + rng.gen()%4096);
+		}
+
+		// Destroyed dynamic buffers are released back to allocator in frame.
+		bgfx::frame();
+
+		const int64_t time = bx::getHPCounter() - start;
+
+		// Skip first frames, until render thread is fed with full frames.
+		if (2 <= frame)
+		{
+			timing.add(time);
+		}
+	}
+
+	timing.print("create/destroy + frame", freq);
+
+	const bgfx::Stats* stats = bgfx::getStats();
+
+	bx::printf("%-32s used %8.2f [MiB], free %8.2f [MiB], fragmentation %5.1f%%\n"
+		, "dynamic vertex buffers"
+		, double(stats->dynamicVbUsed)/(1024.0*1024.0)
+		, double(stats->dynamicVbFree)/(1024.0*1024.0)
+		, 0 == stats->dynamicVbFree ? 0.0 : 100.0 - double(stats->dynamicVbLargestFree)*100.0/double(stats->dynamicVbFree)
+		);
+
+	bx::printf("%-32s used %8.2f [MiB], free %8.2f [MiB], fragmentation %5.1f%%\n"
+		, "dynamic index buffers"
+		, double(stats->dynamicIbUsed)/(1024.0*1024.0)
+		, double(stats->dynamicIbFree)/(1024.0*1024.0)
+		, 0 == stats->dynamicIbFree ? 0.0 : 100.0 - double(stats->dynamicIbLargestFree)*100.0/double(stats->dynamicIbFree)
+		);
+
+	for (uint32_t ii = 0; ii < numBuffers; ++ii)
+	{
+		bgfx::destroy(vb[ii]);
+		bgfx::destroy(ib[ii]);
+	}
+
+	delete [] vb;
+	delete [] ib;
+
+	bgfx::shutdown();
+
+	return bx::kExitSuccess;
+}
+
+struct PosColorVertex
+{
+	float    x, y, z;
+	uint32_t abgr;
+};
+
+static const PosColorVertex s_cubeVertices[] =
+{
+	{-1.0f,  1.0f,  1.0f, 0xff000000 },
+	{ 1.0f,  1.0f,  1.0f, 0xff0000ff },
+	{-1.0f, -1.0f,  1.0f, 0xff00ff00 },
+	{ 1.0f, -1.0f,  1.0f, 0xff00ffff },
+	{-1.0f,  1.0f, -1.0f, 0xffff0000 },
+	{ 1.0f,  1.0f, -1.0f, 0xffff00ff },
+	{-1.0f, -1.0f, -1.0f, 0xffffff00 },
+	{ 1.0f, -1.0f, -1.0f, 0xffffffff },
+};
+
+static const uint16_t s_cubeTriList[] =
+{
+	0, 1, 2,
+	1, 3, 2,
+	4, 6, 5,
+	5, 6, 7,
+	0, 2, 4,
+	4, 2, 6,
+	1, 5, 3,
+	5, 7, 3,
+	0, 4, 1,
+	4, 5, 1,
+	2, 3, 6,
+	6, 3, 7,
+};
+
+struct Scene
+{
+	bgfx::ProgramHandle      program;
+	bgfx::VertexBufferHandle vbh;
+	bgfx::IndexBufferHandle  ibh;
+	bgfx::UniformHandle      sampler;
+	bgfx::TextureHandle      texture[4];
+	uint32_t                 dim;
+};
+
+typedef void (*SubmitSceneFn)(const Scene& _scene, float _time);
+
+// Same draw calls as 01-cubes example.
+static void submitCubes(const Scene& _scene, float _time)
+{
+	const uint64_t state = 0
+		| BGFX_STATE_WRITE_RGB
+		| BGFX_STATE_WRITE_A
+		| BGFX_STATE_WRITE_Z
+		| BGFX_STATE_DEPTH_TEST_LESS
+		| BGFX_STATE_CULL_CW
+		| BGFX_STATE_MSAA
+		;
+
+	for (uint32_t yy = 0; yy < _scene.dim; ++yy)
+	{
+		for (uint32_t xx = 0; xx < _scene.dim; ++xx)
+		{
+			float mtx[16];
+			bx::mtxRotateXY(mtx, _time + xx*0.21f, _time + yy*0.37f);
+			mtx[12] = -15.0f + float(xx)*3.0f;
+			mtx[13] = -15.0f + float(yy)*3.0f;
+			mtx[14] = 0.0f;
+
+			bgfx::setTransform(mtx);
+			bgfx::setVertexBuffer(0, _scene.vbh);
+			bgfx::setIndexBuffer(_scene.ibh);
+			bgfx::setState(state);
+			bgfx::submit(0, _scene.program);
+		}
+	}
+}
+
+// Grid of cubes where neighbours alternate between textures and render states, as if scene is
+// submitted in object order without regard to materials.
+static void submitMaterials(const Scene& _scene, float _time)
+{
+	static const uint64_t s_state[] =
+	{
+		BGFX_STATE_DEFAULT,
+		BGFX_STATE_DEFAULT|BGFX_STATE_BLEND_ALPHA,
+		(BGFX_STATE_DEFAULT&~BGFX_STATE_CULL_MASK)|BGFX_STATE_CULL_CCW,
+	};
+
+	for (uint32_t yy = 0; yy < _scene.dim; ++yy)
+	{
+		for (uint32_t xx = 0; xx < _scene.dim; ++xx)
+		{
+			const uint32_t ii = yy*_scene.dim + xx;
+
+			float mtx[16];
+			bx::mtxRotateXY(mtx, _time + xx*0.21f, _time + yy*0.37f);
+			mtx[12] = -15.0f + float(xx)*0.5f;
+			mtx[13] = -15.0f + float(yy)*0.5f;
+			mtx[14] = 0.0f;
+
+			bgfx::setTransform(mtx);
+			bgfx::setVertexBuffer(0, _scene.vbh);
+			bgfx::setIndexBuffer(_scene.ibh);
+			bgfx::setTexture(0, _scene.sampler, _scene.texture[ii % BX_COUNTOF(_scene.texture)]);
+			bgfx::setState(s_state[ii % BX_COUNTOF(s_state)]);
+			bgfx::submit(0, _scene.program, uint32_t(ii) );
+		}
+	}
+}
+
+// Same draw calls as 17-drawstress example, with fixed dimension and single submit thread.
+static void submitDrawStress(const Scene& _scene, float _time)
+{
+	float mtxS[16];
+	bx::mtxScale(mtxS, 0.25f, 0.25f, 0.25f);
+
+	const float step = 0.6f;
+	const float pos[3] =
+	{
+		-step*_scene.dim / 2.0f,
+		-step*_scene.dim / 2.0f,
+		-15.0f,
+	};
+
+	for (uint32_t zz = 0; zz < _scene.dim; ++zz)
+	{
+		for (uint32_t yy = 0; yy < _scene.dim; ++yy)
+		{
+			for (uint32_t xx = 0; xx < _scene.dim; ++xx)
+			{
+				float mtxR[16];
+				bx::mtxRotateXYZ(mtxR, _time + xx*0.21f, _time + yy*0.37f, _time + zz*0.13f);
+
+				float mtx[16];
+				bx::mtxMul(mtx, mtxS, mtxR);
+
+				mtx[12] = pos[0] + float(xx)*step;
+				mtx[13] = pos[1] + float(yy)*step;
+				mtx[14] = pos[2] + float(zz)*step;
+
+				bgfx::setTransform(mtx);
+				bgfx::setVertexBuffer(0, _scene.vbh);
+				bgfx::setIndexBuffer(_scene.ibh);
+				bgfx::setState(BGFX_STATE_DEFAULT);
+				bgfx::submit(0, _scene.program);
+			}
+		}
+	}
+}
+
+static Timing runScene(const Settings& _settings, SubmitSceneFn _submitFn, uint32_t _dim, uint32_t _numDraws, bgfx::Stats& _stats, bgfx::ViewMode::Enum _viewMode = bgfx::ViewMode::Default)
+{
+	Timing timing;
+
+	// Profiling Noop renderer walks sorted frame like other renderers and counts state changes.
+	bgfx::Init init;
+	init.noopCounting        = true;
+	init.limits.maxDrawCalls = bx::max(init.limits.maxDrawCalls, _numDraws);
+
+	if (!initNoop(_settings, init) )
+	{
+		return timing;
+	}
+
+	// Capture starts before scene resources are created, so capture can be replayed on its own.
+	if (NULL != _settings.capture
+	&&  !bgfx::startFrameCapture(_settings.capture) )
+	{
+		bx::printf("Failed to create capture file \"%s\".\n", _settings.capture);
+	}
+
+	bgfx::VertexLayout layout;
+	layout
+		.begin()
+		.add(bgfx::Attrib::Position, 3, bgfx::AttribType::Float)
+		.add(bgfx::Attrib::Color0,   4, bgfx::AttribType::Uint8, true)
+		.end();
+
+	Scene scene;
+	scene.program = createProgram();
+	scene.vbh     = bgfx::createVertexBuffer(bgfx::makeRef(s_cubeVertices, sizeof(s_cubeVertices) ), layout);
+	scene.ibh     = bgfx::createIndexBuffer(bgfx::makeRef(s_cubeTriList, sizeof(s_cubeTriList) ) );
+	scene.sampler = bgfx::createUniform("s_texColor", bgfx::UniformType::Sampler);
+	scene.dim     = _dim;
+
+	for (uint32_t ii = 0; ii < BX_COUNTOF(scene.texture); ++ii)
+	{
+		const uint32_t rgba = 0xff000000 | (ii * 0x404040);
+		scene.texture[ii] = bgfx::createTexture2D(1, 1, false, 1, bgfx::TextureFormat::RGBA8, BGFX_TEXTURE_NONE, bgfx::copy(&rgba, sizeof(rgba) ) );
+	}
+
+	const bx::Vec3 at  = { 0.0f, 0.0f,   0.0f };
+	const bx::Vec3 eye = { 0.0f, 0.0f, -35.0f };
+
+	float view[16];
+	bx::mtxLookAt(view, eye, at);
+
+	float proj[16];
+	bx::mtxProj(proj, 60.0f, 1280.0f/720.0f, 0.1f, 100.0f, bgfx::getCaps()->homogeneousDepth);
+
+	bgfx::setViewRect(0, 0, 0, 1280, 720);
+	bgfx::setViewTransform(0, view, proj);
+	bgfx::setViewMode(0, _viewMode);
+
+	for (uint32_t frame = 0; frame < _settings.numFrames + 2; ++frame)
+	{
+		// Fixed time step keeps submitted frames deterministic between runs.
+		_submitFn(scene, float(frame)/60.0f);
+
+		bgfx::frame();
+
+		// Skip first frames, until render thread is fed with full frames.
+		if (2 <= frame)
+		{
+			const bgfx::Stats* stats = bgfx::getStats();
+			timing.add(stats->cpuTimeEnd - stats->cpuTimeBegin);
+			_stats = *stats;
+		}
+	}
+
+	bgfx::stopFrameCapture();
+
+	for (uint32_t ii = 0; ii < BX_COUNTOF(scene.texture); ++ii)
+	{
+		bgfx::destroy(scene.texture[ii]);
+	}
+
+	bgfx::destroy(scene.sampler);
+	bgfx::destroy(scene.ibh);
+	bgfx::destroy(scene.vbh);
+	bgfx::destroy(scene.program);
+	bgfx::shutdown();
+
+	return timing;
+}
+
+static void printSceneStats(const bgfx::Stats& _stats)
+{
+	bx::printf("%-32s draw %d, state %d, program %d, bind %d, uniform %d (%d redundant)\n"
+		, ""
+		, _stats.numDraw
+		, _stats.numStateChanges
+		, _stats.numProgramChanges
+		, _stats.numBindChanges
+		, _stats.numUniformUpdates
+		, _stats.numUniformRedundant
+		);
+}
+
+static int32_t benchCubes(const Settings& _settings)
+{
+	bx::printf("cubes: 11x11 cubes, %d frames\n", _settings.numFrames);
+
+	const int64_t freq = bx::getHPFrequency();
+
+	bgfx::Stats stats;
+	const Timing timing = runScene(_settings, submitCubes, 11, 11*11, stats);
+	timing.print("render thread", freq);
+	printSceneStats(stats);
+
+	return bx::kExitSuccess;
+}
+
+static int32_t benchDrawStress(const Settings& _settings)
+{
+	bx::printf("drawstress: %d frames\n", _settings.numFrames);
+
+	// Default and maximum dimension of 17-drawstress example.
+	static const uint32_t s_dim[] = { 16, 40 };
+
+	const int64_t freq = bx::getHPFrequency();
+
+	for (uint32_t ii = 0; ii < BX_COUNTOF(s_dim); ++ii)
+	{
+		const uint32_t dim = s_dim[ii];
+
+		bgfx::Stats stats;
+		const Timing timing = runScene(_settings, submitDrawStress, dim, dim*dim*dim, stats);
+
+		char name[64];
+		bx::snprintf(name, sizeof(name), "render thread (%dx%dx%d)", dim, dim, dim);
+		timing.print(name, freq);
+		printSceneStats(stats);
+	}
+
+	return bx::kExitSuccess;
+}
+
+static int32_t benchStateSort(const Settings& _settings)
+{
+	bx::printf("statesort: 64x64 cubes with interleaved materials, %d frames\n", _settings.numFrames);
+
+	const int64_t freq = bx::getHPFrequency();
+
+	static const struct { bgfx::ViewMode::Enum mode; const char* name; } s_mode[] =
+	{
+		{ bgfx::ViewMode::Default, "render thread (default)" },
+		{ bgfx::ViewMode::State,   "render thread (state)"   },
+	};
+
+	for (uint32_t ii = 0; ii < BX_COUNTOF(s_mode); ++ii)
+	{
+		bgfx::Stats stats;
+		const Timing timing = runScene(_settings, submitMaterials, 64, 64*64, stats, s_mode[ii].mode);
+		timing.print(s_mode[ii].name, freq);
+		printSceneStats(stats);
+	}
+
+	return bx::kExitSuccess;
+}
+
+static int32_t benchReplay(const Settings& _settings)
+{
+	if (NULL == _settings.replay)
+	{
+		bx::printf("replay: skipped, capture file is not specified with --replay.\n");
+		return bx::kExitSuccess;
+	}
+
+	bgfx::Init init;
+	init.noopCounting        = true;
+	init.limits.maxDrawCalls = bx::max(init.limits.maxDrawCalls, _settings.numDraws);
+
+	if (!initNoop(_settings, init) )
+	{
+		return bx::kExitFailure;
+	}
+
+	const uint32_t numFrames = bgfx::startFrameReplay(_settings.replay);
+
+	if (0 == numFrames)
+	{
+		bx::printf("Failed to replay capture file \"%s\".\n", _settings.replay);
+		bgfx::shutdown();
+		return bx::kExitFailure;
+	}
+
+	bx::printf("replay: %s, %d frames\n", _settings.replay, numFrames);
+
+	const int64_t freq = bx::getHPFrequency();
+
+	Timing timing;
+	bgfx::Stats stats;
+
+	for (uint32_t frame = 0; frame < numFrames; ++frame)
+	{
+		bgfx::frame();
+
+		// Skip first frames, until render thread is fed with full frames.
+		if (2 <= frame)
+		{
+			const bgfx::Stats* frameStats = bgfx::getStats();
+			timing.add(frameStats->cpuTimeEnd - frameStats->cpuTimeBegin);
+			stats = *frameStats;
+		}
+	}
+
+	bgfx::shutdown();
+
+	timing.print("render thread", freq);
+
+	if (0 < timing.count)
+	{
+		printSceneStats(stats);
+	}
+
+	return bx::kExitSuccess;
+}
+
+static int32_t benchReadback(const Settings& _settings)
+{
+	// Renderer is created without window, read back doesn't need back buffer.
+	bgfx::Init init;
+
+	if (!initRenderer(_settings.renderer, init) )
+	{
+		return bx::kExitFailure;
+	}
+
+	bx::printf("readback: %s renderer, %d frames\n"
+		, bgfx::getRendererName(bgfx::getRendererType() )
+		, _settings.numFrames
+		);
+
+	// Noop renderer doesn't copy data, only API and render thread overhead is measured.
+	const bool verify = bgfx::RendererType::Noop != bgfx::getRendererType();
+
+	bgfx::VertexLayout layout;
+	layout
+		.begin()
+		.add(bgfx::Attrib::Position, 4, bgfx::AttribType::Float)
+		.end();
+
+	static const uint32_t s_size[] = { 64<<10, 1<<20, 16<<20 };
+
+	const int64_t freq = bx::getHPFrequency();
+
+	uint8_t* data = new uint8_t[s_size[BX_COUNTOF(s_size)-1] ];
+
+	int32_t result = bx::kExitSuccess;
+
+	for (uint32_t ii = 0; ii < BX_COUNTOF(s_size); ++ii)
+	{
+		const uint32_t size = s_size[ii];
+
+		const bgfx::Memory* mem = bgfx::alloc(size);
+		for (uint32_t jj = 0; jj < size/4; ++jj)
+		{
+			( (uint32_t*)mem->data)[jj] = jj;
+		}
+
+		bgfx::DynamicVertexBufferHandle handle = bgfx::createDynamicVertexBuffer(mem, layout);
+
+		Timing timing;
+		uint32_t numFrames = 0;
+		uint32_t numErrors = 0;
+
+		for (uint32_t frame = 0; frame < _settings.numFrames + 2; ++frame)
+		{
+			bx::memSet(data, 0, size);
+
+			// Time from read back request until data is available to application.
+			const int64_t start = bx::getHPCounter();
+
+			const uint32_t ticket = bgfx::readBuffer(handle, 0, size, data);
+
+			while (!bgfx::isReadbackComplete(ticket) )
+			{
+				bgfx::frame();
+				++numFrames;
+			}
+
+			const int64_t time = bx::getHPCounter() - start;
+
+			// Skip first frames, until buffer is created and render thread is fed with frames.
+			if (2 <= frame)
+			{
+				timing.add(time);
+			}
+
+			if (verify)
+			{
+				for (uint32_t jj = 0; jj < size/4; ++jj)
+				{
+					if ( ( (uint32_t*)data)[jj] != jj)
+					{
+						++numErrors;
+						break;
+					}
+				}
+			}
+		}
+
+		bgfx::destroy(handle);
+
+		char name[64];
+		bx::snprintf(name, sizeof(name), "read back %d KiB", size>>10);
+		timing.print(name, freq);
+
+		bx::printf("%-32s %8.2f [MiB/s], %5.2f frames per read back\n"
+			, ""
+			, 0 == timing.total ? 0.0 : double(size)*double(timing.count)*double(freq)/(double(timing.total)*1024.0*1024.0)
+			, double(numFrames)/double(_settings.numFrames + 2)
+			);
+
+		if (0 != numErrors)
+		{
+			bx::printf("%-32s %d read backs returned wrong data\n", "", numErrors);
+			result = bx::kExitFailure;
+		}
+	}
+
+	delete [] data;
+
+	bgfx::shutdown();
+
+	return result;
+}
+
+struct Benchmark
+{
+	const char* name;
+	int32_t (*fn)(const Settings& _settings);
+	const char* desc;
+};
+
+static const Benchmark s_benchmark[] =
+{
+	{ "sort",       benchSort,       "Render item sort, render thread vs. sort worker threads." },
+	{ "encoders",   benchEncoders,   "Multithreaded submit throughput with increasing number of encoders." },
+	{ "bundle",     benchBundle,     "Submitting draw calls every frame vs. replaying recorded draw bundles." },
+	{ "churn",      benchChurn,      "Creating and destroying dynamic vertex and index buffers every frame." },
+	{ "cubes",      benchCubes,      "Render thread cost of 01-cubes workload on counting Noop renderer." },
+	{ "drawstress", benchDrawStress, "Render thread cost of 17-drawstress workload on counting Noop renderer." },
+	{ "statesort",  benchStateSort,  "Binding and state changes with default vs. state minimizing view sort mode." },
+	{ "replay",     benchReplay,     "Render thread cost of frames replayed from capture file on counting Noop renderer." },
+	{ "readback",   benchReadback,   "Dynamic vertex buffer read back latency and throughput." },
+};
+
+void help(const char* _error = NULL)
+{
+	if (NULL != _error)
+	{
+		bx::printf("Error:\n%s\n\n", _error);
+	}
+
+	bx::printf(
+		  "bench, bgfx headless benchmark tool, version %d.%d.%d.\n"
+		  "Copyright 2011-2024 Branimir Karadzic. All rights reserved.\n"
+		  "License: https://github.com/bkaradzic/bgfx/blob/master/LICENSE\n\n"
+		, BGFX_BENCH_VERSION_MAJOR
+		, BGFX_BENCH_VERSION_MINOR
+		, BGFX_API_VERSION
+		);
+
+	bx::printf(
+		  "Usage: bench [-b <benchmark>] [options]\n"
+
+		  "\n"
+		  "Benchmarks:\n"
+		);
+
+	for (uint32_t ii = 0; ii < BX_COUNTOF(s_benchmark); ++ii)
+	{
+		bx::printf("  %-24s %s\n", s_benchmark[ii].name, s_benchmark[ii].desc);
+	}
+
+	bx::printf(
+		  "\n"
+		  "Options:\n"
+		  "  -h, --help               Display this help and exit.\n"
+		  "  -v, --version            Output version information and exit.\n"
+		  "  -b, --bench <name>       Run only selected benchmark (default runs all).\n"
+		  "      --frames <num>       Number of measured frames (default 100).\n"
+		  "      --draws <num>        Number of draw calls per frame (default 60000).\n"
+		  "      --views <num>        Number of views (default 8).\n"
+		  "      --threads <num>      Number of worker or encoder threads (default 4).\n"
+		  "      --buffers <num>      Number of dynamic buffers (default 2000).\n"
+		  "      --capture <file>     Capture frames of cubes and drawstress benchmarks into file.\n"
+		  "      --replay <file>      Capture file replayed by replay benchmark.\n"
+		  "      --renderer <name>    Renderer used by readback benchmark (default noop).\n"
+
+		  "\n"
+		  "For additional information, see https://github.com/bkaradzic/bgfx\n"
+		);
+}
+
+int main(int _argc, const char* _argv[])
+{
+	bx::CommandLine cmdLine(_argc, _argv);
+
+	if (cmdLine.hasArg('v', "version") )
+	{
+		bx::printf(
+			  "bench, bgfx headless benchmark tool, version %d.%d.%d.\n"
+			, BGFX_BENCH_VERSION_MAJOR
+			, BGFX_BENCH_VERSION_MINOR
+			, BGFX_API_VERSION
+			);
+		return bx::kExitSuccess;
+	}
+
+	if (cmdLine.hasArg('h', "help") )
+	{
+		help();
+		return bx::kExitFailure;
+	}
+
+	Settings settings;
+	cmdLine.hasArg(settings.numFrames,  '\0', "frames");
+	cmdLine.hasArg(settings.numDraws,   '\0', "draws");
+	cmdLine.hasArg(settings.numViews,   '\0', "views");
+	cmdLine.hasArg(settings.numThreads, '\0', "threads");
+	cmdLine.hasArg(settings.numBuffers, '\0', "buffers");
+	settings.capture = cmdLine.findOption("capture");
+	settings.replay  = cmdLine.findOption("replay");
+
+	const char* renderer = cmdLine.findOption("renderer");
+	if (NULL != renderer)
+	{
+		if      (0 == bx::strCmpI(renderer, "d3d11") ) { settings.renderer = bgfx::RendererType::Direct3D11; }
+		else if (0 == bx::strCmpI(renderer, "d3d12") ) { settings.renderer = bgfx::RendererType::Direct3D12; }
+		else if (0 == bx::strCmpI(renderer, "gl")    ) { settings.renderer = bgfx::RendererType::OpenGL;     }
+		else if (0 == bx::strCmpI(renderer, "mtl")   ) { settings.renderer = bgfx::RendererType::Metal;      }
+		else if (0 == bx::strCmpI(renderer, "vk")    ) { settings.renderer = bgfx::RendererType::Vulkan;     }
+		else if (0 == bx::strCmpI(renderer, "noop")  ) { settings.renderer = bgfx::RendererType::Noop;       }
+		else
+		{
+			help("Unknown renderer name.");
+			return bx::kExitFailure;
+		}
+	}
+
+	settings.numFrames = bx::max<uint32_t>(settings.numFrames, 1);
+	settings.numViews  = bx::clamp<uint32_t>(settings.numViews, 1, 256);
+
+	const char* name = cmdLine.findOption('b', "bench");
+
+	int32_t result = bx::kExitSuccess;
+	bool found = false;
+
+	for (uint32_t ii = 0; ii < BX_COUNTOF(s_benchmark); ++ii)
+	{
+		const Benchmark& benchmark = s_benchmark[ii];
+
+		if (NULL == name
+		||  0 == bx::strCmp(name, benchmark.name) )
+		{
+			result |= benchmark.fn(settings);
+			found = true;
+		}
+	}
+
+	if (!found)
+	{
+		help("Unknown benchmark name.");
+		return bx::kExitFailure;
+	}
+
+	return result;
+}